@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+#include <opencv2/videoio.hpp>
+#include "bench_util.hpp"
+#include "face_core.hpp"
+#include "facecore.h"
+
+// Frame converted to C ABI pixel format, rows padded to stride
+struct FormattedFrame {
+    cv::Mat storage;
+    cv::Mat view;
+};
+
+static FormattedFrame formatFrame(const cv::Mat& bgr, facecore_format format, int padding) {
+    cv::Mat converted;
+    switch (format) {
+        case FACECORE_FORMAT_GRAY: cv::cvtColor(bgr, converted, cv::COLOR_BGR2GRAY); break;
+        case FACECORE_FORMAT_BGRA: cv::cvtColor(bgr, converted, cv::COLOR_BGR2BGRA); break;
+        case FACECORE_FORMAT_RGB: cv::cvtColor(bgr, converted, cv::COLOR_BGR2RGB); break;
+        case FACECORE_FORMAT_RGBA: cv::cvtColor(bgr, converted, cv::COLOR_BGR2RGBA); break;
+        default: converted = bgr; break;
+    }
+    FormattedFrame f;
+    int cn = converted.channels();
+    f.storage.create(converted.rows, converted.cols * cn + padding, CV_8UC1);
+    f.view = cv::Mat(converted.rows, converted.cols, converted.type(), f.storage.data, f.storage.step);
+    converted.copyTo(f.view);
+    return f;
+}
+
+// Boxes of every frame in sequence
+typedef std::vector<std::vector<cv::Rect> > SequenceFaces;
+
+static SequenceFaces runC(facecore_detector* detector, const std::vector<FormattedFrame>& frames, facecore_format format) {
+    SequenceFaces result;
+    facecore_reset(detector);
+    std::vector<facecore_box> boxes(64);
+    for (size_t i = 0; i < frames.size(); i++) {
+        const cv::Mat& v = frames[i].view;
+        int n = facecore_detect(detector, v.data, v.cols, v.rows, v.step, format, boxes.data(), (int) boxes.size());
+        std::vector<cv::Rect> faces;
+        for (int k = 0; k < std::min(n, (int) boxes.size()); k++) {
+            faces.push_back(cv::Rect(boxes[k].x, boxes[k].y, boxes[k].width, boxes[k].height));
+        }
+        result.push_back(faces);
+    }
+    return result;
+}
+
+static SequenceFaces runCpp(FaceCoreDetector& detector, const std::vector<cv::Mat>& frames) {
+    SequenceFaces result;
+    detector.reset();
+    std::vector<cv::Rect> faces;
+    for (size_t i = 0; i < frames.size(); i++) {
+        detector.detect(frames[i], faces);
+        result.push_back(faces);
+    }
+    return result;
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " <video | image directory | glob> [options]\n"
+              << "  --frames N   use at most N decoded frames (default 100)\n"
+              << "  --loops N    timed passes over frames per preset (default 3)\n"
+              << "  --model FILE Haar Cascade .xml (default haarcascade_frontalface_alt2.xml)" << std::endl;
+}
+
+// Check C interface against C++ detector for every preset and pixel format,
+// then report latency per preset, without any device
+int main(int argc, char **argv) {
+
+    std::string input, model;
+    int maxFrames = 100, loops = 3;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) maxFrames = std::atoi(argv[++i]);
+        else if (arg == "--loops" && i + 1 < argc) loops = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--model" && i + 1 < argc) model = argv[++i];
+        else if (input.empty() && !arg.empty() && arg[0] != '-') input = arg;
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+    if (input.empty()) {
+        usage(argv[0]);
+        return -1;
+    }
+
+    std::vector<cv::Mat> frames;
+    if (!loadFrames(input, maxFrames, frames)) {
+        std::cout << "Cannot read frames from " << input << std::endl;
+        return -1;
+    }
+    if (model.empty()) model = cv::samples::findFile("haarcascades/haarcascade_frontalface_alt2.xml");
+
+    int failures = 0;
+    std::cout << "Interface checks" << std::endl;
+    check(facecore_create("missing-model.xml", NULL) == NULL, "missing model returns NULL", failures);
+
+    facecore_config config;
+    facecore_config_preset(FACECORE_PRESET_DESKTOP, &config);
+    facecore_detector* detector = facecore_create(model.c_str(), &config);
+    if (!check(detector != NULL, "model loads through C interface", failures)) return 1;
+
+    facecore_box box;
+    const cv::Mat& f0 = frames[0];
+    check(facecore_detect(detector, NULL, f0.cols, f0.rows, f0.step, FACECORE_FORMAT_BGR, &box, 1) == -1,
+          "NULL pixels rejected", failures);
+    check(facecore_detect(detector, f0.data, f0.cols, f0.rows, f0.cols, FACECORE_FORMAT_BGR, &box, 1) == -1,
+          "stride shorter than row rejected", failures);
+    check(facecore_detect(detector, f0.data, f0.cols, f0.rows, f0.step, (facecore_format) 99, &box, 1) == -1,
+          "unknown format rejected", failures);
+    facecore_destroy(detector);
+
+    const facecore_preset presets[] = {FACECORE_PRESET_DESKTOP, FACECORE_PRESET_ANDROID, FACECORE_PRESET_IOS};
+    const char* presetNames[] = {"desktop", "android", "ios"};
+    const facecore_format formats[] = {FACECORE_FORMAT_GRAY, FACECORE_FORMAT_BGRA, FACECORE_FORMAT_RGB, FACECORE_FORMAT_RGBA};
+    const char* formatNames[] = {"gray", "bgra", "rgb", "rgba"};
+
+    // Unpadded BGR frames are the reference, every other layout is padded by 64 bytes per row
+    std::vector<FormattedFrame> bgr;
+    for (size_t i = 0; i < frames.size(); i++) bgr.push_back(formatFrame(frames[i], FACECORE_FORMAT_BGR, 0));
+
+    std::vector<double> presetMs;
+    for (size_t p = 0; p < 3; p++) {
+        std::cout << "Preset " << presetNames[p] << std::endl;
+        facecore_config_preset(presets[p], &config);
+        detector = facecore_create(model.c_str(), &config);
+        if (!check(detector != NULL, "model loads with preset", failures)) return 1;
+
+        const FaceCorePreset cppPresets[] = {FaceCorePreset::Desktop, FaceCorePreset::Android, FaceCorePreset::IOS};
+        FaceCoreDetector cpp(model, FaceCoreConfig::preset(cppPresets[p]));
+        SequenceFaces reference = runCpp(cpp, frames);
+
+        check(runC(detector, bgr, FACECORE_FORMAT_BGR) == reference, "bgr through C interface matches C++ detector", failures);
+        std::vector<FormattedFrame> padded;
+        for (size_t i = 0; i < frames.size(); i++) padded.push_back(formatFrame(frames[i], FACECORE_FORMAT_BGR, 64));
+        check(runC(detector, padded, FACECORE_FORMAT_BGR) == reference, "bgr with padded stride matches", failures);
+        for (size_t f = 0; f < 4; f++) {
+            std::vector<FormattedFrame> converted;
+            for (size_t i = 0; i < frames.size(); i++) converted.push_back(formatFrame(frames[i], formats[f], 64));
+            check(runC(detector, converted, formats[f]) == reference, std::string(formatNames[f]) + " matches bgr", failures);
+        }
+
+        // Face count is returned even when box array is too small
+        facecore_reset(detector);
+        bool counted = true;
+        for (size_t i = 0; i < frames.size(); i++) {
+            const cv::Mat& v = bgr[i].view;
+            int n = facecore_detect(detector, v.data, v.cols, v.rows, v.step, FACECORE_FORMAT_BGR, NULL, 0);
+            counted = counted && n == (int) reference[i].size();
+        }
+        check(counted, "face count returned with max_boxes 0", failures);
+
+        // Latency through C interface, same path as mobile apps
+        std::vector<facecore_box> boxes(64);
+        facecore_reset(detector);
+        auto start = std::chrono::steady_clock::now();
+        for (int l = 0; l < loops; l++) {
+            for (size_t i = 0; i < bgr.size(); i++) {
+                const cv::Mat& v = bgr[i].view;
+                facecore_detect(detector, v.data, v.cols, v.rows, v.step, FACECORE_FORMAT_BGR, boxes.data(), (int) boxes.size());
+            }
+        }
+        presetMs.push_back(elapsedMs(start) / (double) (loops * bgr.size()));
+        facecore_destroy(detector);
+    }
+
+    std::cout << std::endl << "Input: " << input << " (" << frames.size() << " frames, "
+              << frames[0].cols << "x" << frames[0].rows << ")" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    for (size_t p = 0; p < presetMs.size(); p++) {
+        std::cout << std::left << std::setw(10) << presetNames[p] << std::right << std::setw(10) << presetMs[p]
+                  << " ms/frame  " << std::setw(10) << 1000.0 / presetMs[p] << " frames/s" << std::endl;
+    }
+    if (failures) std::cout << "FAILED: " << failures << " checks" << std::endl;
+    else std::cout << "All checks passed" << std::endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,196 @@
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include "bench_util.hpp"
+#include "face_core.hpp"
+#include "facecore.h"
+
+// ctest treats this exit code as skipped
+static const int SKIPPED = 77;
+
+// Boxes returned by C interface, -1 result is kept as count
+struct CResult {
+    int count = 0;
+    std::vector<cv::Rect> faces;
+
+    bool operator==(const CResult& other) const { return count == other.count && faces == other.faces; }
+};
+
+static CResult detectC(facecore_detector* detector, const cv::Mat& frame, facecore_format format, int rotation = 0) {
+    facecore_box boxes[16];
+    CResult r;
+    r.count = facecore_detect_rotated(detector, frame.data, frame.cols, frame.rows, frame.step, format, rotation, boxes, 16);
+    for (int i = 0; i < std::min(r.count, 16); i++) r.faces.push_back(cv::Rect(boxes[i].x, boxes[i].y, boxes[i].width, boxes[i].height));
+    return r;
+}
+
+// 1280x720 BGR camera-like frame with sample face image scaled to full height, gray frame without image
+static cv::Mat uprightFrame(const std::string& image) {
+    cv::Mat frame(720, 1280, CV_8UC3, cv::Scalar::all(128));
+    cv::Mat face = image.empty() ? cv::Mat() : cv::imread(image, cv::IMREAD_COLOR);
+    if (!face.empty()) cv::resize(face, frame(cv::Rect(280, 0, 720, 720)), cv::Size(720, 720), 0, 0, cv::INTER_AREA);
+    return frame;
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " [--model FILE] [--image FILE]\n"
+              << "  --model FILE Haar Cascade .xml (default haarcascade_frontalface_alt2.xml of OpenCV samples)\n"
+              << "  --image FILE frame with one frontal face (default lena.jpg of OpenCV samples)" << std::endl;
+}
+
+// Host test of facecore C interface: create/destroy, invalid arguments, rotation, every preset
+// and ROI search finding a face that enters while another is tracked
+// Model and image are looked up in OpenCV samples data (OPENCV_SAMPLES_DATA_PATH),
+// skipped without model, face checks are skipped without image
+int main(int argc, char **argv) {
+
+    std::string model, image;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--model" && i + 1 < argc) model = argv[++i];
+        else if (arg == "--image" && i + 1 < argc) image = argv[++i];
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+    if (model.empty()) model = cv::samples::findFile("haarcascades/haarcascade_frontalface_alt2.xml", false, true);
+    if (image.empty()) image = cv::samples::findFile("lena.jpg", false, true);
+
+    int failures = 0;
+    std::cout << "Create and destroy" << std::endl;
+    check(facecore_create(NULL, NULL) == NULL, "NULL model path returns NULL", failures);
+    check(facecore_create("missing-model.xml", NULL) == NULL, "missing model returns NULL", failures);
+    check(facecore_create_from_memory(NULL, 10, NULL) == NULL, "NULL model data returns NULL", failures);
+    const char garbage[] = "<opencv_storage><cascade>";
+    check(facecore_create_from_memory(garbage, sizeof(garbage), NULL) == NULL, "broken model text returns NULL", failures);
+    facecore_destroy(NULL);
+    facecore_reset(NULL);
+    check(true, "destroy and reset ignore NULL", failures);
+
+    if (model.empty()) {
+        std::cout << "Haar Cascade model not found, set OPENCV_SAMPLES_DATA_PATH or pass --model" << std::endl;
+        return failures ? 1 : SKIPPED;
+    }
+
+    facecore_detector* detector = facecore_create(model.c_str(), NULL);
+    if (!check(detector != NULL, "model loads from file with NULL config", failures)) return 1;
+    facecore_destroy(detector);
+
+    std::ifstream file(model, std::ios::binary);
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    detector = facecore_create_from_memory(text.data(), text.size(), NULL);
+    if (!check(detector != NULL, "model loads from memory", failures)) return 1;
+
+    cv::Mat frame = uprightFrame(image);
+    bool haveFace = frame.at<cv::Vec3b>(360, 640) != cv::Vec3b(128, 128, 128);
+    if (!haveFace) std::cout << "Sample face image not found, face checks skipped" << std::endl;
+
+    std::cout << "Invalid arguments" << std::endl;
+    facecore_box box;
+    check(facecore_detect(NULL, frame.data, frame.cols, frame.rows, frame.step, FACECORE_FORMAT_BGR, &box, 1) == -1,
+          "NULL detector rejected", failures);
+    check(facecore_detect(detector, NULL, frame.cols, frame.rows, frame.step, FACECORE_FORMAT_BGR, &box, 1) == -1,
+          "NULL pixels rejected", failures);
+    check(facecore_detect(detector, frame.data, 0, frame.rows, frame.step, FACECORE_FORMAT_BGR, &box, 1) == -1,
+          "zero width rejected", failures);
+    check(facecore_detect(detector, frame.data, frame.cols, -1, frame.step, FACECORE_FORMAT_BGR, &box, 1) == -1,
+          "negative height rejected", failures);
+    check(facecore_detect(detector, frame.data, frame.cols, frame.rows, frame.cols, FACECORE_FORMAT_BGR, &box, 1) == -1,
+          "stride shorter than row rejected", failures);
+    check(facecore_detect(detector, frame.data, frame.cols, frame.rows, frame.step, (facecore_format) 99, &box, 1) == -1,
+          "unknown format rejected", failures);
+    check(facecore_detect(detector, frame.data, frame.cols, frame.rows, frame.step, FACECORE_FORMAT_BGR, NULL, 1) == -1,
+          "NULL boxes with max_boxes > 0 rejected", failures);
+    check(facecore_detect(detector, frame.data, frame.cols, frame.rows, frame.step, FACECORE_FORMAT_BGR, NULL, 0) >= 0,
+          "NULL boxes with max_boxes 0 counts faces", failures);
+
+    std::cout << "Rotation" << std::endl;
+    const int invalid[] = {45, -90, 360, 450};
+    for (int rotation : invalid) {
+        check(detectC(detector, frame, FACECORE_FORMAT_BGR, rotation).count == -1,
+              "rotation " + std::to_string(rotation) + " rejected", failures);
+    }
+    // Camera buffer that becomes the upright frame after clockwise rotation
+    const int rotations[] = {0, 90, 180, 270};
+    const int inverse[] = {-1, cv::ROTATE_90_COUNTERCLOCKWISE, cv::ROTATE_180, cv::ROTATE_90_CLOCKWISE};
+    facecore_reset(detector);
+    CResult upright = detectC(detector, frame, FACECORE_FORMAT_BGR);
+    if (haveFace) check(upright.count >= 1, "face found in upright frame", failures);
+    for (size_t r = 0; r < 4; r++) {
+        cv::Mat camera, gray;
+        if (inverse[r] < 0) camera = frame;
+        else cv::rotate(frame, camera, inverse[r]);
+        cv::cvtColor(camera, gray, cv::COLOR_BGR2GRAY);
+        facecore_reset(detector);
+        check(detectC(detector, camera, FACECORE_FORMAT_BGR, rotations[r]) == upright,
+              "bgr rotated by " + std::to_string(rotations[r]) + " matches upright frame", failures);
+        facecore_reset(detector);
+        check(detectC(detector, gray, FACECORE_FORMAT_GRAY, rotations[r]) == upright,
+              "gray rotated by " + std::to_string(rotations[r]) + " matches upright frame", failures);
+    }
+    facecore_destroy(detector);
+
+    std::cout << "Presets" << std::endl;
+    const facecore_preset presets[] = {FACECORE_PRESET_DESKTOP, FACECORE_PRESET_ANDROID, FACECORE_PRESET_IOS};
+    const FaceCorePreset cppPresets[] = {FaceCorePreset::Desktop, FaceCorePreset::Android, FaceCorePreset::IOS};
+    const char* presetNames[] = {"desktop", "android", "ios"};
+    for (size_t p = 0; p < 3; p++) {
+        std::string name = presetNames[p];
+        facecore_config config;
+        facecore_config_preset(presets[p], &config);
+        FaceCoreConfig cpp = FaceCoreConfig::preset(cppPresets[p]);
+        check(config.scale_factor == cpp.params.scaleFactor && config.min_neighbors == cpp.params.minNeighbors &&
+              config.min_size == cpp.params.minSize.width && config.roi_search == (cpp.roiSearch ? 1 : 0),
+              name + " preset matches C++ preset", failures);
+
+        detector = facecore_create(model.c_str(), &config);
+        if (!check(detector != NULL, name + " preset loads model", failures)) continue;
+        FaceCoreDetector reference(model, cpp);
+        std::vector<cv::Rect> faces;
+        reference.detect(frame, faces);
+        CResult c = detectC(detector, frame, FACECORE_FORMAT_BGR);
+        check(c.count == (int) faces.size() && c.faces == faces, name + " preset matches C++ detector", failures);
+        facecore_destroy(detector);
+    }
+
+    if (haveFace) {
+        // Face A is found again in its window every frame, face B enters on frame 3
+        std::cout << "ROI search" << std::endl;
+        cv::Mat face = cv::imread(image, cv::IMREAD_COLOR), scaled;
+        cv::resize(face, scaled, cv::Size(600, 600), 0, 0, cv::INTER_AREA);
+        cv::Mat one(720, 1280, CV_8UC3, cv::Scalar::all(128));
+        scaled.copyTo(one(cv::Rect(20, 60, 600, 600)));
+        cv::Mat two = one.clone();
+        scaled.copyTo(two(cv::Rect(660, 60, 600, 600)));
+
+        std::vector<cv::Rect> expected;
+        FaceCoreDetector full(model, FaceCoreConfig::preset(FaceCorePreset::Desktop));
+        full.detect(two, expected);
+
+        facecore_config config;
+        facecore_config_preset(FACECORE_PRESET_DESKTOP, &config);
+        config.roi_search = 1;
+        detector = facecore_create(model.c_str(), &config);
+        if (check(detector != NULL, "model loads with ROI search", failures)) {
+            for (int i = 0; i < 3; i++) detectC(detector, one, FACECORE_FORMAT_BGR);
+            int refreshEvery = RoiSearchConfig().refreshEvery;
+            CResult last;
+            for (int i = 0; i < refreshEvery; i++) last = detectC(detector, two, FACECORE_FORMAT_BGR);
+            check(expected.size() >= 2 && last.count == (int) expected.size(),
+                  "face entering while another is tracked is found within " + std::to_string(refreshEvery) + " frames", failures);
+            facecore_destroy(detector);
+        }
+    }
+
+    if (failures) std::cout << "FAILED: " << failures << " checks" << std::endl;
+    else std::cout << "All checks passed" << std::endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/videoio.hpp>
+
+// Timing, check and input helpers shared by the host benchmarks of FaceCore, QRCore, FaceDetect and WeChatQRCode
+
+/* Milliseconds elapsed since start */
+inline double elapsedMs(std::chrono::steady_clock::time_point start) {
+    std::chrono::duration<double, std::milli> diff = std::chrono::steady_clock::now() - start;
+    return diff.count();
+}
+
+/* Print check result and count failures */
+inline bool check(bool ok, const std::string& what, int& failures) {
+    std::cout << (ok ? "  ok    " : "  FAIL  ") << what << std::endl;
+    if (!ok) failures++;
+    return ok;
+}
+
+/* Median milliseconds of fn over runs */
+template <typename Fn>
+double medianMs(int runs, Fn fn) {
+    std::vector<double> times;
+    for (int i = 0; i < runs; i++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        times.push_back(elapsedMs(start));
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+/* Mean milliseconds of fn over runs, one untimed run first */
+template <typename Fn>
+double timeMs(int runs, Fn fn) {
+    fn();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++) fn();
+    return elapsedMs(start) / runs;
+}
+
+/* Same size, type and pixels */
+inline bool same(const cv::Mat& a, const cv::Mat& b) {
+    return a.size() == b.size() && a.type() == b.type() && cv::norm(a, b, cv::NORM_INF) == 0;
+}
+
+/* Decode clip, directory or glob pattern of images up front so disk and decoder are not timed
+ * At most maxFrames frames, every frame when maxFrames <= 0, grayscale frames when gray is set */
+inline bool loadFrames(const std::string& input, int maxFrames, std::vector<cv::Mat>& frames, bool gray = false) {
+    cv::VideoCapture cap(input);
+    if (cap.isOpened()) {
+        cv::Mat frame, converted;
+        while ((maxFrames <= 0 || (int) frames.size() < maxFrames) && cap.read(frame)) {
+            if (gray) {
+                cv::cvtColor(frame, converted, cv::COLOR_BGR2GRAY);
+                frames.push_back(converted.clone());
+            }
+            else frames.push_back(frame.clone());
+        }
+    }
+    // Directory or glob pattern of images
+    if (frames.empty()) {
+        std::vector<cv::String> files;
+        cv::glob(input, files, false);
+        std::sort(files.begin(), files.end());
+        for (size_t i = 0; i < files.size() && (maxFrames <= 0 || (int) frames.size() < maxFrames); i++) {
+            cv::Mat image = cv::imread(files[i], gray ? cv::IMREAD_GRAYSCALE : cv::IMREAD_COLOR);
+            if (!image.empty()) frames.push_back(image);
+        }
+    }
+    return !frames.empty();
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <opencv2/core.hpp>
+#include "face_detector_session.hpp"
+#include "facecore.h"
+#include "roi_redetector.hpp"
+
+// Detection settings each app used to hard-code
+enum class FaceCorePreset { Desktop, Android, IOS };
+
+// Detector configuration shared by desktop, Android and iOS
+struct FaceCoreConfig {
+    FaceDetectorParams params;
+    // Search around previous faces first, full frame when one is missed and every few frames for new faces
+    bool roiSearch = false;
+    RoiSearchConfig roi;
+
+    /* Settings previously hard-coded in face_detect.cpp, haar-cascade.cpp and HaarCascade.cpp */
+    static FaceCoreConfig preset(FaceCorePreset preset);
+};
+
+// Face detector used by every platform
+// Model is loaded once in constructor, buffers are reused between frames.
+// C++ callers use this class directly, JNI and Objective-C++ go through facecore.h.
+class FaceCoreDetector {
+
+public:
+    FaceCoreDetector(const std::string& model, const FaceCoreConfig& config = FaceCoreConfig());
+    /* Model .xml text in memory (Haar Cascade backend only), e.g. mmap or APK asset buffer, data may be released afterwards */
+    FaceCoreDetector(const void* modelData, size_t modelSize, const FaceCoreConfig& config = FaceCoreConfig());
+    FaceCoreDetector(const FaceCoreDetector&) = delete;
+    FaceCoreDetector& operator=(const FaceCoreDetector&) = delete;
+
+    /* Return true if model could not be loaded */
+    bool empty() const { return session_.empty(); }
+
+    const FaceCoreConfig& config() const { return config_; }
+
+    /* Detect faces in BGR(A) or grayscale frame, boxes are in frame coordinates */
+    void detect(const cv::Mat& frame, std::vector<cv::Rect>& faces);
+
+    /* Same on raw pixels with row stride in bytes, RGB(A) channel order is handled
+     * Return false on invalid frame */
+    bool detect(const uchar* pixels, int width, int height, size_t stride,
+                facecore_format format, std::vector<cv::Rect>& faces);
+
+    /* Same on camera buffer that becomes upright after clockwise rotation by rotationDegrees
+     * (0, 90, 180 or 270, other values return false), boxes are in upright frame coordinates
+     * Only the gray plane is rotated (whole BGR frame for YuNet), into a buffer reused between frames */
+    bool detect(const uchar* pixels, int width, int height, size_t stride,
+                facecore_format format, int rotationDegrees, std::vector<cv::Rect>& faces);
+
+    /* Forget faces of previous frames */
+    void reset();
+
+    FaceDetectorSession& session() { return session_; }
+    const RoiRedetector& redetector() const { return redetector_; }
+
+private:
+    FaceCoreConfig config_;
+    FaceDetectorSession session_;
+    RoiRedetector redetector_;
+
+    // Gray buffer for RGB(A) and rotated input, BGR copy of RGB(A) input for color backends,
+    // upright plane or BGR frame
+    cv::Mat gray_;
+    cv::Mat color_;
+    cv::Mat rotated_;
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include "spsc_ring.hpp"
+
+// Boxes kept per result, further faces are only counted
+const int FACE_RESULT_MAX_BOXES = 4;
+
+// Faces found in one camera frame, handed from analyzer thread to UI thread
+struct FaceResult {
+    // Steady clock time when detection finished
+    int64_t timestampNs = 0;
+    // Faces found, may be larger than FACE_RESULT_MAX_BOXES
+    int count = 0;
+    // left, top, right, bottom of each stored face
+    int boxes[FACE_RESULT_MAX_BOXES][4];
+};
+
+typedef SpscRing<FaceResult> FaceResultRing;
+
+// Ints needed to pack a result with all stored boxes
+const int FACE_RESULT_PACKED_MAX = 2 + 4 * FACE_RESULT_MAX_BOXES;
+
+/* Steady clock in nanoseconds, same clock as FaceResult::timestampNs */
+inline int64_t faceResultClockNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* Flatten result for Java int[]: age in ms at nowNs, number of stored boxes,
+ * then left, top, right, bottom of each box
+ * Boxes that do not fit into capacity are left out, return number of ints written */
+inline int packFaceResult(const FaceResult& result, int64_t nowNs, int* out, int capacity) {
+    if (capacity < 2) return 0;
+    int boxes = std::min(std::min(result.count, FACE_RESULT_MAX_BOXES), (capacity - 2) / 4);
+    boxes = std::max(boxes, 0);
+    out[0] = (int) std::max<int64_t>(0, (nowNs - result.timestampNs) / 1000000);
+    out[1] = boxes;
+    for (int i = 0; i < boxes; i++) {
+        for (int k = 0; k < 4; k++) out[2 + 4 * i + k] = result.boxes[i][k];
+    }
+    return 2 + 4 * boxes;
+}
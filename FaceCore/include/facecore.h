@@ -0,0 +1,93 @@
+#pragma once
+
+// C interface of facecore, called from JNI (Android) and Objective-C++ (iOS)
+// One detector keeps its model loaded and must only be used by one thread at a time.
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct facecore_detector facecore_detector;
+
+// Detection settings each app used to hard-code
+typedef enum {
+    FACECORE_PRESET_DESKTOP = 0,   // scaleFactor 1.1, minNeighbors 7, minSize 30
+    FACECORE_PRESET_ANDROID = 1,   // scaleFactor 1.1, minNeighbors 3, minSize 250, ROI search
+    FACECORE_PRESET_IOS = 2        // scaleFactor 1.15, minNeighbors 6, minSize 200, ROI search
+} facecore_preset;
+
+// Face detection model
+typedef enum {
+    FACECORE_BACKEND_HAAR = 0,     // Haar Cascade .xml, from file or memory
+    FACECORE_BACKEND_YUNET = 1     // YuNet .onnx through cv::FaceDetectorYN, from file only
+} facecore_backend;
+
+// Pixel layout of frame passed to facecore_detect()
+typedef enum {
+    FACECORE_FORMAT_GRAY = 0,      // 8-bit luma, e.g. Y plane of YUV_420_888
+    FACECORE_FORMAT_BGR = 1,
+    FACECORE_FORMAT_BGRA = 2,
+    FACECORE_FORMAT_RGB = 3,
+    FACECORE_FORMAT_RGBA = 4       // UIImage / CGImage bitmap
+} facecore_format;
+
+typedef struct {
+    double scale_factor;
+    int min_neighbors;
+    // Square face size limits in pixels of detection frame, 0 is no limit
+    int min_size;
+    int max_size;
+    // Downscale frame to this width before detection, 0 keeps input size
+    int detect_width;
+    // Search around previous faces first, full frame when one is missed and every few frames for new faces
+    int roi_search;
+    facecore_backend backend;
+    // YuNet minimum face confidence, ignored by Haar Cascade
+    float score_threshold;
+} facecore_config;
+
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int height;
+} facecore_box;
+
+/* Fill config with preset values */
+void facecore_config_preset(facecore_preset preset, facecore_config* config);
+
+/* Load model of config->backend, return NULL if it cannot be parsed
+ * config may be NULL for desktop preset (Haar Cascade) */
+facecore_detector* facecore_create(const char* model_path, const facecore_config* config);
+
+/* Same from model .xml text in memory (mmap of file, AAsset_getBuffer() of APK asset)
+ * Nothing is written to or read from disk, data may be released after return
+ * Only Haar Cascade backend, YuNet returns NULL */
+facecore_detector* facecore_create_from_memory(const void* model_data, size_t model_size,
+                                               const facecore_config* config);
+
+/* Free detector, NULL is ignored */
+void facecore_destroy(facecore_detector* detector);
+
+/* Detect faces in frame with given row stride in bytes
+ * At most max_boxes boxes are written in frame coordinates,
+ * return number of faces found (may be larger than max_boxes) or -1 on invalid arguments */
+int facecore_detect(facecore_detector* detector, const unsigned char* pixels, int width, int height,
+                    size_t stride, facecore_format format, facecore_box* boxes, int max_boxes);
+
+/* Same as facecore_detect() on camera buffer that becomes upright after clockwise rotation
+ * by rotation_degrees (0, 90, 180 or 270, e.g. ImageInfo.rotationDegrees on Android)
+ * Gray plane is rotated into reused buffer, boxes are in upright frame coordinates
+ * Return -1 on invalid arguments or any other rotation */
+int facecore_detect_rotated(facecore_detector* detector, const unsigned char* pixels, int width, int height,
+                            size_t stride, facecore_format format, int rotation_degrees,
+                            facecore_box* boxes, int max_boxes);
+
+/* Forget faces of previous frames, next frame is searched fully */
+void facecore_reset(facecore_detector* detector);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,328 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/core/utils/tls.hpp>
+
+// Limits of MatPool
+struct MatPoolConfig {
+    // Buffers above this size go straight to heap and back
+    size_t maxPooledBytes = (size_t) 64 << 20;
+    // Free buffers kept for reuse over all threads, buffers freed beyond this go back to heap
+    size_t maxRetainedBytes = (size_t) 128 << 20;
+    // Free buffers per size class a thread keeps before handing them to the shared list
+    size_t threadCacheBuffers = 4;
+};
+
+// Allocation counters of MatPool, sizes are size-class bytes
+struct MatPoolStats {
+    // MatPoolScope instances closed, one per processed frame
+    uint64_t frames = 0;
+    // Mat buffers handed out
+    uint64_t allocations = 0;
+    // Handed out buffers that came from heap because no free one of the size class was cached
+    uint64_t heapAllocations = 0;
+    // Buffers given back to heap, oversized or over retained limit
+    uint64_t heapFrees = 0;
+    size_t bytesInUse = 0;
+    size_t bytesRetained = 0;
+    // Peak of bytesInUse and of bytesInUse + bytesRetained
+    size_t highWaterInUse = 0;
+    size_t highWaterTotal = 0;
+};
+
+// Size-class pooling allocator for cv::Mat buffers
+// Freed buffers are kept in a free list of their size class (4 classes per
+// power of two, at most 25% slack) and handed out again on the next create()
+// of a similar size, so a pipeline allocating the same temporaries every frame
+// stops touching the heap after the first frames. UMatData headers are pooled
+// with their buffers. Only Mats attached to the pool allocate from it, the
+// process-wide default allocator is never changed. Each thread caches a few free buffers per class without
+// locking, the rest go to one shared list. Buffers freed on another thread
+// (pipeline stages) land in that thread's cache.
+// Every Mat allocated from the pool must be released before the pool is
+// destroyed, apps keep it in a function-local static that is never freed.
+class MatPool : public cv::MatAllocator {
+
+public:
+    explicit MatPool(const MatPoolConfig& config = MatPoolConfig())
+        : config_(config), central_(sizeClass(config.maxPooledBytes) + 1), caches_(*this) {}
+
+    ~MatPool() {
+        // Thread caches move their buffers to shared list first
+        caches_.cleanup();
+        for (size_t c = 0; c < central_.size(); c++) {
+            for (size_t i = 0; i < central_[c].size(); i++) freeBlock(central_[c][i]);
+        }
+    }
+
+    MatPool(const MatPool&) = delete;
+    MatPool& operator=(const MatPool&) = delete;
+
+    cv::UMatData* allocate(int dims, const int* sizes, int type, void* data0, size_t* step,
+                           cv::AccessFlag /*flags*/, cv::UMatUsageFlags /*usageFlags*/) const override {
+        // Same step layout as cv::Mat default allocator
+        size_t total = CV_ELEM_SIZE(type);
+        for (int i = dims - 1; i >= 0; i--) {
+            if (step) {
+                if (data0 && step[i] != cv::Mat::AUTO_STEP) {
+                    CV_Assert(total <= step[i]);
+                    total = step[i];
+                }
+                else {
+                    step[i] = total;
+                }
+            }
+            total *= sizes[i];
+        }
+
+        // Caller's memory or oversized buffer, plain heap header
+        if (data0 != NULL || total > config_.maxPooledBytes) {
+            cv::UMatData* u = new cv::UMatData(this);
+            u->data = u->origdata = data0 != NULL ? static_cast<uchar*>(data0) : static_cast<uchar*>(cv::fastMalloc(total));
+            u->size = total;
+            if (data0 != NULL) {
+                u->flags |= cv::UMatData::USER_ALLOCATED;
+            }
+            else {
+                allocations_++;
+                heapAllocations_++;
+                addInUse(total);
+            }
+            return u;
+        }
+
+        int cls = sizeClass(total);
+        size_t bytes = classBytes(cls);
+        Block block;
+        if (take(cls, block)) {
+            retained_ -= bytes;
+        }
+        else {
+            block.header = ::operator new(sizeof(cv::UMatData));
+            block.data = static_cast<uchar*>(cv::fastMalloc(bytes));
+            heapAllocations_++;
+        }
+        allocations_++;
+        addInUse(bytes);
+
+        cv::UMatData* u = new (block.header) cv::UMatData(this);
+        u->data = u->origdata = block.data;
+        u->size = total;
+        return u;
+    }
+
+    bool allocate(cv::UMatData* u, cv::AccessFlag /*accessFlags*/, cv::UMatUsageFlags /*usageFlags*/) const override {
+        return u != NULL;
+    }
+
+    void deallocate(cv::UMatData* u) const override {
+        if (u == NULL) return;
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+
+        if (u->flags & cv::UMatData::USER_ALLOCATED) {
+            delete u;
+            return;
+        }
+        if (u->size > config_.maxPooledBytes) {
+            inUse_ -= u->size;
+            heapFrees_++;
+            cv::fastFree(u->origdata);
+            delete u;
+            return;
+        }
+
+        int cls = sizeClass(u->size);
+        size_t bytes = classBytes(cls);
+        Block block;
+        block.header = u;
+        block.data = u->origdata;
+        u->~UMatData();
+        inUse_ -= bytes;
+
+        // Soft limit, concurrent frees may overshoot by a few buffers
+        if (retained_.fetch_add(bytes) + bytes > config_.maxRetainedBytes) {
+            retained_ -= bytes;
+            heapFrees_++;
+            freeBlock(block);
+            return;
+        }
+        updateHighWater(highTotal_, inUse_ + retained_);
+
+        std::vector<Block>& local = caches_.getRef().list(cls, central_.size());
+        if (local.size() < config_.threadCacheBuffers) {
+            local.push_back(block);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        central_[cls].push_back(block);
+    }
+
+    /* Allocate buffers of mat from this pool from its next reallocation on
+     * Buffer mat holds now goes back to the allocator it came from. Assigning
+     * another Mat to mat replaces the allocator, attach again after that. */
+    void attach(cv::Mat& mat) { mat.allocator = this; }
+
+    /* Count one processed frame, called by MatPoolScope */
+    void frameDone() const { frames_++; }
+
+    MatPoolStats stats() const {
+        MatPoolStats s;
+        s.frames = frames_;
+        s.allocations = allocations_;
+        s.heapAllocations = heapAllocations_;
+        s.heapFrees = heapFrees_;
+        s.bytesInUse = inUse_;
+        s.bytesRetained = retained_;
+        s.highWaterInUse = highInUse_;
+        s.highWaterTotal = highTotal_;
+        return s;
+    }
+
+    /* Print allocations per frame, bytes in use, retained and high-water marks */
+    void printStats(std::ostream& out) const {
+        MatPoolStats s = stats();
+        double frames = s.frames > 0 ? (double) s.frames : 1.0;
+        out << "MatPool: frames=" << s.frames
+            << " allocations/frame=" << s.allocations / frames
+            << " heap/frame=" << s.heapAllocations / frames
+            << " inUse=" << s.bytesInUse / 1024 << " KiB"
+            << " retained=" << s.bytesRetained / 1024 << " KiB"
+            << " highWater(inUse/total)=" << s.highWaterInUse / 1024 << "/" << s.highWaterTotal / 1024 << " KiB" << std::endl;
+    }
+
+    /* Size class of buffer, 0 holds up to 64 bytes, then 4 classes per power of two */
+    static int sizeClass(size_t size) {
+        if (size <= 64) return 0;
+        // 2^p < size <= 2^(p+1)
+        int p = 0;
+        while (((size - 1) >> (p + 1)) != 0) p++;
+        int quarter = (int) (((size - 1) >> (p - 2)) & 3);
+        return (p - 6) * 4 + quarter + 1;
+    }
+
+    /* Capacity of buffers in class */
+    static size_t classBytes(int cls) {
+        if (cls == 0) return 64;
+        int p = (cls - 1) / 4 + 6;
+        return ((size_t) 1 << p) + (size_t) ((cls - 1) % 4 + 1) * ((size_t) 1 << (p - 2));
+    }
+
+private:
+    // Pooled buffer with storage for its UMatData header
+    struct Block {
+        void* header;
+        uchar* data;
+    };
+
+    // Free buffers of one thread, lists are created on first use
+    struct ThreadCache {
+        std::vector<std::vector<Block>> lists;
+
+        std::vector<Block>& list(int cls, size_t classes) {
+            if (lists.empty()) lists.resize(classes);
+            return lists[cls];
+        }
+    };
+
+    // Thread-local caches, buffers of exiting threads go back to shared list
+    class CacheTLS : public cv::TLSData<ThreadCache> {
+    public:
+        explicit CacheTLS(const MatPool& pool) : pool_(pool) {}
+        ~CacheTLS() { cleanup(); }
+
+    protected:
+        void deleteDataInstance(void* data) const override {
+            ThreadCache* cache = static_cast<ThreadCache*>(data);
+            pool_.releaseCache(*cache);
+            delete cache;
+        }
+
+    private:
+        const MatPool& pool_;
+    };
+
+    bool take(int cls, Block& block) const {
+        std::vector<Block>& local = caches_.getRef().list(cls, central_.size());
+        if (!local.empty()) {
+            block = local.back();
+            local.pop_back();
+            return true;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (central_[cls].empty()) return false;
+        block = central_[cls].back();
+        central_[cls].pop_back();
+        return true;
+    }
+
+    void releaseCache(ThreadCache& cache) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t c = 0; c < cache.lists.size(); c++) {
+            central_[c].insert(central_[c].end(), cache.lists[c].begin(), cache.lists[c].end());
+        }
+        cache.lists.clear();
+    }
+
+    static void freeBlock(const Block& block) {
+        cv::fastFree(block.data);
+        ::operator delete(block.header);
+    }
+
+    void addInUse(size_t bytes) const {
+        size_t inUse = (inUse_ += bytes);
+        updateHighWater(highInUse_, inUse);
+        updateHighWater(highTotal_, inUse + retained_);
+    }
+
+    static void updateHighWater(std::atomic<size_t>& mark, size_t value) {
+        size_t seen = mark.load(std::memory_order_relaxed);
+        while (value > seen && !mark.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {}
+    }
+
+    MatPoolConfig config_;
+    mutable std::mutex mutex_;
+    mutable std::vector<std::vector<Block>> central_;
+
+    mutable std::atomic<uint64_t> frames_{0};
+    mutable std::atomic<uint64_t> allocations_{0};
+    mutable std::atomic<uint64_t> heapAllocations_{0};
+    mutable std::atomic<uint64_t> heapFrees_{0};
+    mutable std::atomic<size_t> inUse_{0};
+    mutable std::atomic<size_t> retained_{0};
+    mutable std::atomic<size_t> highInUse_{0};
+    mutable std::atomic<size_t> highTotal_{0};
+
+    // Last member, thread caches are emptied before shared list is freed
+    CacheTLS caches_;
+};
+
+// One frame of a pipeline on pool, given Mats are attached and the frame is
+// counted when the scope closes
+// Nothing process-wide is touched, scopes may be open on several threads and
+// Mats of other threads or OpenCV internals keep using the default allocator
+class MatPoolScope {
+
+public:
+    explicit MatPoolScope(MatPool& pool, std::initializer_list<cv::Mat*> mats = {}) : pool_(pool) {
+        for (cv::Mat* mat : mats) pool_.attach(*mat);
+    }
+
+    ~MatPoolScope() {
+        pool_.frameDone();
+    }
+
+    MatPoolScope(const MatPoolScope&) = delete;
+    MatPoolScope& operator=(const MatPoolScope&) = delete;
+
+private:
+    MatPool& pool_;
+};
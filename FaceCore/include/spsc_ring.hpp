@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+// Bounded lock-free ring for exactly one producer thread and one consumer thread
+// Meant as latest-result channel: producer never waits, when ring is full the
+// oldest queued item is dropped and counted, so a consumer coming back from a
+// stall finds the newest items. Each side writes its own index, the producer
+// only moves the consumer index forward with a CAS when it drops an item.
+// Slot count is a power of two, one slot stays free so the slot written next
+// is never the oldest queued one.
+template <typename T>
+class SpscRing {
+
+public:
+    /* Ring holding at least capacity items */
+    explicit SpscRing(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity + 1) size <<= 1;
+        mask_ = size - 1;
+        slots_.reset(new T[size]);
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /* Producer: copy item into ring, oldest item is dropped when ring is full
+     * Return false if the new item was dropped instead, only when the consumer
+     * is still copying the slot it would overwrite */
+    bool push(const T& item) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        size_t tail = tail_.load(std::memory_order_seq_cst);
+        if (head - tail >= mask_) {
+            // Failed CAS means consumer took the oldest item meanwhile, room is made either way
+            if (tail_.compare_exchange_strong(tail, tail + 1, std::memory_order_seq_cst)) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        // Consumer may still copy a slot it announced before the tail moved past it
+        size_t reading = reading_.load(std::memory_order_seq_cst);
+        if (reading != 0 && ((reading - 1) & mask_) == (head & mask_)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        slots_[head & mask_] = item;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /* Consumer: take oldest item, return false if ring is empty */
+    bool pop(T& item) {
+        while (true) {
+            size_t tail = tail_.load(std::memory_order_acquire);
+            if (tail == head_.load(std::memory_order_acquire)) return false;
+            // Announce slot, then confirm producer has not dropped it yet: after that
+            // producer sees the announcement and leaves the slot alone
+            reading_.store(tail + 1, std::memory_order_seq_cst);
+            if (tail_.load(std::memory_order_seq_cst) != tail) {
+                reading_.store(0, std::memory_order_release);
+                continue;
+            }
+            item = slots_[tail & mask_];
+            reading_.store(0, std::memory_order_release);
+            // Producer may have dropped the item while it was copied, take next one then
+            if (tail_.compare_exchange_strong(tail, tail + 1, std::memory_order_seq_cst)) return true;
+        }
+    }
+
+    /* Consumer: drain ring and keep newest item, return number of items taken */
+    size_t popLatest(T& item) {
+        size_t n = 0;
+        while (pop(item)) n++;
+        return n;
+    }
+
+    /* Approximate number of queued items, safe from any thread
+     * Consumer index is read first so it can never be ahead of producer index */
+    size_t size() const {
+        size_t tail = tail_.load(std::memory_order_acquire);
+        return head_.load(std::memory_order_acquire) - tail;
+    }
+
+    /* Items the ring holds before the oldest is dropped */
+    size_t capacity() const { return mask_; }
+
+    /* Items dropped because ring was full */
+    size_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    std::unique_ptr<T[]> slots_;
+    size_t mask_;
+    // Producer side
+    alignas(64) std::atomic<size_t> head_{0};
+    std::atomic<size_t> dropped_{0};
+    // Consumer side, tail is also moved by producer when it drops the oldest item
+    alignas(64) std::atomic<size_t> tail_{0};
+    // Index + 1 of slot consumer is copying, 0 when idle
+    std::atomic<size_t> reading_{0};
+};
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work counters of one pool thread
+struct WorkerStats {
+    // items run by this worker, including stolen ones
+    uint64_t executed = 0;
+    // items taken from another worker's queue
+    uint64_t stolen = 0;
+};
+
+// Fixed pool running batches of independent work items
+//
+// Items of a batch are split into contiguous blocks, one per worker queue.
+// Every worker runs its own block front to back and, once empty, steals from
+// the back of other queues, so uneven items (large pyramid layers next to tiny
+// ones) still keep every core busy. Calling thread works as worker 0.
+// Header only, shared by face detection and the QR decoders
+class WorkStealingPool {
+
+public:
+    typedef std::function<void(size_t item, int worker)> Task;
+
+    /* Start pool with given number of workers, 0 uses every hardware thread */
+    explicit WorkStealingPool(int threads = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /* Run task(item, worker) for every item in [0, count), return when all are done
+     * worker is in [0, threads()) so callers can keep per-worker buffers
+     * If a task throws, items not started yet are skipped and the first exception
+     * is rethrown here once every worker has left the batch */
+    void run(size_t count, const Task& task);
+
+    int threads() const { return (int) workers_.size(); }
+
+    /* Counters of each worker accumulated over all batches */
+    std::vector<WorkerStats> stats() const;
+    void resetStats();
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<size_t> items;
+        WorkerStats stats;
+    };
+
+    void threadLoop(int index);
+    void work(int index);
+    bool take(int index, size_t& item);
+    bool steal(int index, size_t& item);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread> threads_;
+
+    // Batch handoff between run() and pool threads
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    const Task* task_ = nullptr;
+    uint64_t generation_ = 0;
+    int active_ = 0;
+    bool stopping_ = false;
+    // First exception of current batch, guarded by mutex_
+    std::exception_ptr error_;
+    std::atomic<bool> failed_{false};
+};
+
+inline WorkStealingPool::WorkStealingPool(int threads) {
+    if (threads <= 0) threads = (int) std::max(1u, std::thread::hardware_concurrency());
+    for (int i = 0; i < threads; i++) workers_.emplace_back(new Worker());
+    // Worker 0 is the thread calling run()
+    for (int i = 1; i < threads; i++) threads_.emplace_back(&WorkStealingPool::threadLoop, this, i);
+}
+
+inline WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    start_.notify_all();
+    for (size_t i = 0; i < threads_.size(); i++) threads_[i].join();
+}
+
+inline void WorkStealingPool::run(size_t count, const Task& task) {
+    if (count == 0) return;
+
+    // Contiguous block per worker keeps neighbouring items on one core
+    size_t n = workers_.size();
+    for (size_t w = 0; w < n; w++) {
+        std::lock_guard<std::mutex> lock(workers_[w]->mutex);
+        for (size_t i = w * count / n; i < (w + 1) * count / n; i++) workers_[w]->items.push_back(i);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        error_ = nullptr;
+        failed_.store(false, std::memory_order_relaxed);
+        active_ = (int) threads_.size();
+        generation_++;
+    }
+    start_.notify_all();
+
+    work(0);
+
+    // Pool threads still use task until they leave the batch, even after a failure
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return active_ == 0; });
+    task_ = nullptr;
+    std::exception_ptr error = error_;
+    error_ = nullptr;
+    lock.unlock();
+    if (error) std::rethrow_exception(error);
+}
+
+inline void WorkStealingPool::threadLoop(int index) {
+    uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+            if (stopping_) return;
+            seen = generation_;
+        }
+
+        work(index);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            active_--;
+        }
+        done_.notify_one();
+    }
+}
+
+// Run own items, then steal until every queue is empty
+// Items are never added during a batch, so empty queues mean nothing is left to start
+// Exceptions stay in the pool, items left after a failure are taken but not run
+inline void WorkStealingPool::work(int index) {
+    Worker& self = *workers_[index];
+    size_t item;
+    while (take(index, item) || steal(index, item)) {
+        if (failed_.load(std::memory_order_acquire)) continue;
+        try {
+            (*task_)(item, index);
+            self.stats.executed++;
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!error_) error_ = std::current_exception();
+            failed_.store(true, std::memory_order_release);
+        }
+    }
+}
+
+inline bool WorkStealingPool::take(int index, size_t& item) {
+    Worker& self = *workers_[index];
+    std::lock_guard<std::mutex> lock(self.mutex);
+    if (self.items.empty()) return false;
+    item = self.items.front();
+    self.items.pop_front();
+    return true;
+}
+
+inline bool WorkStealingPool::steal(int index, size_t& item) {
+    int n = (int) workers_.size();
+    for (int k = 1; k < n; k++) {
+        Worker& victim = *workers_[(index + k) % n];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.items.empty()) continue;
+        // Take from opposite end to owner, away from items it is about to run
+        item = victim.items.back();
+        victim.items.pop_back();
+        workers_[index]->stats.stolen++;
+        return true;
+    }
+    return false;
+}
+
+inline std::vector<WorkerStats> WorkStealingPool::stats() const {
+    std::vector<WorkerStats> result;
+    for (size_t i = 0; i < workers_.size(); i++) result.push_back(workers_[i]->stats);
+    return result;
+}
+
+inline void WorkStealingPool::resetStats() {
+    for (size_t i = 0; i < workers_.size(); i++) workers_[i]->stats = WorkerStats();
+}
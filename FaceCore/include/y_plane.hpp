@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <opencv2/core.hpp>
+
+// Wrap Y plane of YUV_420_888 camera image in cv::Mat header without copying
+// Rows are rowStride bytes apart, Android may leave out padding after last row,
+// so buffer must hold (height - 1) * rowStride + width bytes.
+// Return empty Mat if buffer is too small or arguments are invalid.
+// Mat only borrows memory, it must not outlive the camera image.
+inline cv::Mat wrapYPlane(const void* data, size_t capacity, int width, int height, int rowStride) {
+    if (data == NULL || width <= 0 || height <= 0 || rowStride < width) return cv::Mat();
+    size_t required = (size_t) (height - 1) * (size_t) rowStride + (size_t) width;
+    if (capacity < required) return cv::Mat();
+    return cv::Mat(height, width, CV_8UC1, const_cast<void*>(data), (size_t) rowStride);
+}
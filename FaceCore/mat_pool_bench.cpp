@@ -0,0 +1,262 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/videoio.hpp>
+#include "bench_util.hpp"
+#include "mat_pool.hpp"
+
+// 720p camera-like frames with a dark square code pattern drifting over noise
+static void syntheticFrames(int count, std::vector<cv::Mat>& frames) {
+    cv::RNG rng(20220428);
+    for (int i = 0; i < count; i++) {
+        cv::Mat frame(720, 1280, CV_8UC3);
+        rng.fill(frame, cv::RNG::UNIFORM, 90, 170);
+        cv::Rect code(400 + 4 * i % 200, 180 + 2 * i % 100, 300, 300);
+        cv::rectangle(frame, code, cv::Scalar::all(255), cv::FILLED);
+        for (int m = 0; m < 21 * 21; m++) {
+            if (rng.uniform(0, 2) == 0) continue;
+            cv::Rect module(code.x + 10 + (m % 21) * 13, code.y + 10 + (m / 21) * 13, 13, 13);
+            cv::rectangle(frame, module, cv::Scalar::all(20), cv::FILLED);
+        }
+        frames.push_back(frame);
+    }
+}
+
+// Per-frame Mat chain of face_detect.cpp, opencv-zbar.cpp and wechatQR.cpp:
+// gray, gradients, blur, threshold, morphology, contours, crop, resize, unsharp, CLAHE, Otsu
+// Buffers of the chain are attached to pool when one is given, as the apps attach theirs
+static cv::Mat processFrame(const cv::Mat& frame, MatPool* pool = NULL) {
+    cv::Mat gray, small, gradX, gradY, gradient, blurred, thresh, close, erosion, expand, res, gaussian, unsharp, contrast, bin;
+    if (pool != NULL) {
+        cv::Mat* mats[] = {&gray, &small, &gradX, &gradY, &gradient, &blurred, &thresh, &close, &erosion, &expand,
+                           &res, &gaussian, &unsharp, &contrast, &bin};
+        for (cv::Mat* mat : mats) pool->attach(*mat);
+    }
+
+    cv::cvtColor(frame, gray, cv::COLOR_BGR2GRAY);
+
+    cv::resize(gray, small, cv::Size(480, gray.rows * 480 / gray.cols), 0, 0, cv::INTER_AREA);
+
+    cv::Sobel(gray, gradX, CV_32F, 1, 0, -1);
+    cv::Sobel(gray, gradY, CV_32F, 0, 1, -1);
+    cv::subtract(gradX, gradY, gradient);
+    cv::convertScaleAbs(gradient, gradient);
+
+    cv::blur(gradient, blurred, cv::Size(5, 5));
+    cv::threshold(blurred, thresh, 240, 250, cv::THRESH_BINARY);
+
+    cv::Mat kernel = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(27, 15));
+    cv::morphologyEx(thresh, close, cv::MORPH_CLOSE, kernel);
+    cv::erode(close, erosion, cv::Mat(), cv::Point(-1, -1), 4);
+    cv::dilate(erosion, expand, cv::Mat(), cv::Point(-1, -1), 4);
+
+    std::vector<std::vector<cv::Point>> contours;
+    cv::findContours(expand, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
+    cv::Rect box(0, 0, gray.cols, gray.rows);
+    double maxArea = 0.0;
+    for (size_t i = 0; i < contours.size(); i++) {
+        double area = cv::contourArea(contours[i]);
+        if (area > maxArea) {
+            maxArea = area;
+            box = cv::boundingRect(contours[i]);
+        }
+    }
+    cv::Mat crop = gray(box);
+
+    cv::resize(crop, res, cv::Size(500, std::max(1, crop.rows * 500 / crop.cols)), 0, 0, cv::INTER_AREA);
+    cv::GaussianBlur(res, gaussian, cv::Size(9, 9), 10.0);
+    cv::addWeighted(res, 8, gaussian, -7, 0, unsharp);
+
+    cv::Ptr<cv::CLAHE> clahe = cv::createCLAHE(2.0, cv::Size(8, 8));
+    clahe->apply(unsharp, contrast);
+    cv::threshold(contrast, bin, 0, 255, cv::THRESH_OTSU);
+    return bin;
+}
+
+// Latency and jitter of one replay
+struct ReplaySummary {
+    double mean = 0.0;
+    double p50 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+    double stddev = 0.0;
+};
+
+static ReplaySummary summarize(std::vector<double> times) {
+    ReplaySummary s;
+    std::sort(times.begin(), times.end());
+    for (size_t i = 0; i < times.size(); i++) s.mean += times[i];
+    s.mean /= (double) times.size();
+    for (size_t i = 0; i < times.size(); i++) s.stddev += (times[i] - s.mean) * (times[i] - s.mean);
+    s.stddev = std::sqrt(s.stddev / (double) times.size());
+    s.p50 = times[times.size() / 2];
+    s.p99 = times[std::min(times.size() - 1, times.size() * 99 / 100)];
+    s.max = times.back();
+    return s;
+}
+
+// Replay frames with chain buffers attached to pool, timing samples after warmup
+static std::vector<double> replay(MatPool& pool, const std::vector<cv::Mat>& frames, int loops, int warmup,
+                                  MatPoolStats& steady) {
+    std::vector<double> times;
+    int total = warmup + loops * (int) frames.size();
+    for (int n = 0; n < total; n++) {
+        if (n == warmup) steady = pool.stats();
+        auto start = std::chrono::steady_clock::now();
+        {
+            MatPoolScope scope(pool);
+            processFrame(frames[n % frames.size()], &pool);
+        }
+        if (n >= warmup) times.push_back(elapsedMs(start));
+    }
+    MatPoolStats end = pool.stats();
+    steady.frames = end.frames - steady.frames;
+    steady.allocations = end.allocations - steady.allocations;
+    steady.heapAllocations = end.heapAllocations - steady.heapAllocations;
+    steady.heapFrees = end.heapFrees - steady.heapFrees;
+    steady.bytesInUse = end.bytesInUse;
+    steady.bytesRetained = end.bytesRetained;
+    steady.highWaterInUse = end.highWaterInUse;
+    steady.highWaterTotal = end.highWaterTotal;
+    return times;
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " [video | image directory | glob] [options]\n"
+              << "  --frames N   frames to replay (default 60, synthetic 720p without input)\n"
+              << "  --loops N    replay sequence N times (default 5)\n"
+              << "  --warmup N   untimed frames before measuring (default 5)" << std::endl;
+}
+
+// Replay per-frame Mat chain of the vision pipelines with default allocator and with MatPool,
+// report allocations/frame, retained bytes and latency jitter
+int main(int argc, char **argv) {
+
+    std::string input;
+    int maxFrames = 60, loops = 5, warmup = 5;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) maxFrames = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--loops" && i + 1 < argc) loops = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--warmup" && i + 1 < argc) warmup = std::max(0, std::atoi(argv[++i]));
+        else if (input.empty() && !arg.empty() && arg[0] != '-') input = arg;
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    std::vector<cv::Mat> frames;
+    if (!input.empty() && !loadFrames(input, maxFrames, frames)) {
+        std::cout << "Cannot read frames from " << input << std::endl;
+        return -1;
+    }
+    if (frames.empty()) syntheticFrames(maxFrames, frames);
+
+    // Single-threaded replay, same timing conditions for both allocators
+    cv::setNumThreads(1);
+
+    // Pools are never destroyed, same as in the apps
+    // Pool that never keeps a buffer counts heap allocations of the default path
+    MatPoolConfig heapOnly;
+    heapOnly.maxPooledBytes = 0;
+    MatPool* counting = new MatPool(heapOnly);
+    MatPool* pool = new MatPool();
+
+    int failures = 0;
+    std::cout << "Pool checks" << std::endl;
+    {
+        cv::Mat reference = processFrame(frames[0]);
+        cv::Mat pooled;
+        {
+            MatPoolScope scope(*pool);
+            pooled = processFrame(frames[0], pool);
+        }
+        check(cv::norm(reference, pooled, cv::NORM_INF) == 0, "pooled chain output matches default allocator", failures);
+        check(pooled.u != NULL && pooled.u->currAllocator == pool, "attached Mats come from pool", failures);
+        pooled.release();
+        check(pool->stats().bytesInUse == 0, "every buffer returned to pool after frame", failures);
+        check(cv::Mat::getDefaultAllocator() != pool, "default allocator untouched by pool", failures);
+
+        bool classes = true;
+        for (size_t size = 1; size < ((size_t) 64 << 20); size += 1 + size / 5) {
+            int cls = MatPool::sizeClass(size);
+            size_t bytes = MatPool::classBytes(cls);
+            classes = classes && bytes >= size && (cls == 0 || MatPool::classBytes(cls - 1) < size)
+                      && (size <= 64 || bytes <= size + size / 4 + 1);
+        }
+        check(classes, "size classes fit every size with at most 25% slack", failures);
+
+        // Buffers freed on another thread (pipeline stage) are reused there
+        MatPool crossPool;
+        cv::Mat produced;
+        produced.allocator = &crossPool;
+        produced.create(480, 640, CV_8UC1);
+        uint64_t heapBefore = crossPool.stats().heapAllocations;
+        std::thread consumer([&]() {
+            produced.release();
+            cv::Mat next;
+            next.allocator = &crossPool;
+            next.create(480, 640, CV_8UC1);
+        });
+        consumer.join();
+        check(crossPool.stats().heapAllocations == heapBefore && crossPool.stats().bytesInUse == 0,
+              "buffer freed on other thread is reused by that thread", failures);
+
+        MatPoolConfig small;
+        small.maxRetainedBytes = 1 << 20;
+        MatPool limited(small);
+        {
+            std::vector<cv::Mat> mats(8);
+            for (size_t i = 0; i < mats.size(); i++) {
+                mats[i].allocator = &limited;
+                mats[i].create(512, 512, CV_8UC1);
+            }
+        }
+        check(limited.stats().bytesRetained <= small.maxRetainedBytes && limited.stats().heapFrees == 4,
+              "retained bytes capped, extra buffers go back to heap", failures);
+    }
+
+    MatPoolStats heapStats, poolStats;
+    std::vector<double> heapTimes = replay(*counting, frames, loops, warmup, heapStats);
+    std::vector<double> poolTimes = replay(*pool, frames, loops, warmup, poolStats);
+    // Crop sizes follow the code, a new size class may still show up after warm-up
+    check(poolStats.heapAllocations * 20 <= poolStats.allocations, "steady-state heap allocations below 5% of Mat allocations", failures);
+
+    ReplaySummary heap = summarize(heapTimes), pooled = summarize(poolTimes);
+    double heapFrames = (double) heapStats.frames, poolFrames = (double) poolStats.frames;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\nReplay: " << frames.size() << " frames " << frames[0].cols << "x" << frames[0].rows
+              << ", " << loops << " loops, " << warmup << " warm-up frames" << std::endl;
+    std::cout << std::left << std::setw(10) << "allocator" << std::right
+              << std::setw(12) << "allocs/fr" << std::setw(10) << "heap/fr" << std::setw(14) << "retained KiB"
+              << std::setw(15) << "highwater KiB" << std::setw(9) << "mean" << std::setw(9) << "p50"
+              << std::setw(9) << "p99" << std::setw(9) << "max" << std::setw(9) << "stddev" << std::endl;
+    std::cout << std::left << std::setw(10) << "default" << std::right
+              << std::setw(12) << heapStats.allocations / heapFrames << std::setw(10) << heapStats.heapAllocations / heapFrames
+              << std::setw(14) << heapStats.bytesRetained / 1024.0 << std::setw(15) << heapStats.highWaterTotal / 1024.0
+              << std::setw(9) << heap.mean << std::setw(9) << heap.p50 << std::setw(9) << heap.p99
+              << std::setw(9) << heap.max << std::setw(9) << heap.stddev << std::endl;
+    std::cout << std::left << std::setw(10) << "MatPool" << std::right
+              << std::setw(12) << poolStats.allocations / poolFrames << std::setw(10) << poolStats.heapAllocations / poolFrames
+              << std::setw(14) << poolStats.bytesRetained / 1024.0 << std::setw(15) << poolStats.highWaterTotal / 1024.0
+              << std::setw(9) << pooled.mean << std::setw(9) << pooled.p50 << std::setw(9) << pooled.p99
+              << std::setw(9) << pooled.max << std::setw(9) << pooled.stddev << std::endl;
+    std::cout << "Jitter (p99 - p50): default " << heap.p99 - heap.p50 << " ms, MatPool "
+              << pooled.p99 - pooled.p50 << " ms" << std::endl;
+
+    if (failures) std::cout << "FAILED: " << failures << " checks" << std::endl;
+    else std::cout << "All checks passed" << std::endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include "bench_util.hpp"
+#include "facecore.h"
+
+// Print min / median / mean of measured times
+static void report(const std::string& name, std::vector<double> times) {
+    std::sort(times.begin(), times.end());
+    double mean = 0.0;
+    for (size_t i = 0; i < times.size(); i++) mean += times[i];
+    mean /= (double) times.size();
+    std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(4)
+              << " min " << std::setw(10) << times.front() << " ms"
+              << "  median " << std::setw(10) << times[times.size() / 2] << " ms"
+              << "  mean " << std::setw(10) << mean << " ms" << std::endl;
+}
+
+// Read-only mapping of whole file, stands in for AAsset_getBuffer() of uncompressed APK asset
+struct MappedFile {
+    explicit MappedFile(const std::string& path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* addr = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                data = addr;
+                size = (size_t) st.st_size;
+            }
+        }
+        // Mapping stays valid after descriptor is closed
+        close(fd);
+    }
+    ~MappedFile() {
+        if (data != NULL) munmap(data, size);
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    void* data = NULL;
+    size_t size = 0;
+};
+
+// Former Android start: resource stream copied to tmp file, then model parsed from that file
+static facecore_detector* copyAndCreate(const std::string& model, const std::string& tmpPath,
+                                        const facecore_config* config) {
+    {
+        std::ifstream in(model.c_str(), std::ios::binary);
+        std::ofstream out(tmpPath.c_str(), std::ios::binary);
+        out << in.rdbuf();
+    }
+    return facecore_create(tmpPath.c_str(), config);
+}
+
+// Faces found in image, empty if no image
+static std::vector<cv::Rect> detect(facecore_detector* detector, const cv::Mat& image) {
+    std::vector<cv::Rect> faces;
+    if (image.empty()) return faces;
+    std::vector<facecore_box> boxes(64);
+    int n = facecore_detect(detector, image.data, image.cols, image.rows, image.step, FACECORE_FORMAT_BGR,
+                            boxes.data(), (int) boxes.size());
+    for (int i = 0; i < std::min(n, (int) boxes.size()); i++) {
+        faces.push_back(cv::Rect(boxes[i].x, boxes[i].y, boxes[i].width, boxes[i].height));
+    }
+    return faces;
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " <cascade.xml> [image] [options]\n"
+              << "  image        photo to compare faces of both load paths\n"
+              << "  --runs N     cold starts per path (default 20)\n"
+              << "  --tmp DIR    directory for former tmp-file copy (default /tmp)" << std::endl;
+}
+
+// Compare detector start-up through tmp-file copy (former MainActivity.onCreate)
+// with parsing the mapped model in memory (AAssetManager path on Android)
+int main(int argc, char **argv) {
+
+    std::string model, input, tmpDir = "/tmp";
+    int runs = 20;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--runs" && i + 1 < argc) runs = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--tmp" && i + 1 < argc) tmpDir = argv[++i];
+        else if (model.empty() && !arg.empty() && arg[0] != '-') model = arg;
+        else if (input.empty() && !arg.empty() && arg[0] != '-') input = arg;
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+    if (model.empty()) {
+        usage(argv[0]);
+        return -1;
+    }
+    cv::Mat image;
+    if (!input.empty()) {
+        image = cv::imread(input);
+        if (image.empty()) {
+            std::cout << "Cannot read " << input << std::endl;
+            return -1;
+        }
+    }
+
+    facecore_config config;
+    facecore_config_preset(FACECORE_PRESET_ANDROID, &config);
+    std::string tmpPath = tmpDir + "/haarcascade_frontalface.xml";
+
+    int failures = 0;
+    std::cout << "Load checks" << std::endl;
+    {
+        MappedFile mapped(model);
+        if (!check(mapped.data != NULL, "model file mapped", failures)) return 1;
+        facecore_detector* fromMemory = facecore_create_from_memory(mapped.data, mapped.size, &config);
+        facecore_detector* fromFile = copyAndCreate(model, tmpPath, &config);
+        check(fromMemory != NULL, "model parsed from memory", failures);
+        check(fromFile != NULL, "model parsed from tmp file copy", failures);
+        if (fromMemory != NULL && fromFile != NULL) {
+            std::vector<cv::Rect> a = detect(fromMemory, image), b = detect(fromFile, image);
+            check(a == b, "same faces from both models (" + std::to_string(a.size()) + " in image)", failures);
+        }
+        facecore_destroy(fromMemory);
+        facecore_destroy(fromFile);
+
+        const char garbage[] = "<?xml version=\"1.0\"?><opencv_storage></opencv_storage>";
+        check(facecore_create_from_memory(garbage, sizeof(garbage) - 1, &config) == NULL, "XML without cascade rejected", failures);
+        check(facecore_create_from_memory(mapped.data, 0, &config) == NULL, "empty buffer rejected", failures);
+        check(facecore_create_from_memory(NULL, mapped.size, &config) == NULL, "NULL buffer rejected", failures);
+        std::remove(tmpPath.c_str());
+    }
+
+    // Every run is a cold start of one detector, tmp file is removed in between like a fresh app start
+    std::vector<double> copyLoad, memoryLoad;
+    for (int i = 0; i < runs; i++) {
+        auto start = std::chrono::steady_clock::now();
+        facecore_detector* detector = copyAndCreate(model, tmpPath, &config);
+        copyLoad.push_back(elapsedMs(start));
+        facecore_destroy(detector);
+        std::remove(tmpPath.c_str());
+
+        start = std::chrono::steady_clock::now();
+        {
+            MappedFile mapped(model);
+            detector = facecore_create_from_memory(mapped.data, mapped.size, &config);
+        }
+        memoryLoad.push_back(elapsedMs(start));
+        facecore_destroy(detector);
+    }
+
+    std::cout << std::endl << "Detector start-up over " << runs << " runs" << std::endl;
+    report("before: tmp copy + load", copyLoad);
+    report("after: mmap + memory parse", memoryLoad);
+    if (failures) std::cout << "FAILED: " << failures << " checks" << std::endl;
+    else std::cout << "All checks passed" << std::endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bench_util.hpp"
+#include "face_result.hpp"
+
+// Result with one face whose coordinates encode sequence number
+static FaceResult makeResult(int seq) {
+    FaceResult r;
+    r.timestampNs = faceResultClockNs();
+    r.count = 1;
+    r.boxes[0][0] = seq;
+    r.boxes[0][1] = seq + 1;
+    r.boxes[0][2] = seq + 2;
+    r.boxes[0][3] = seq + 3;
+    return r;
+}
+
+// Former Android path: analyzer writes "l,t,r,b" to file, UI reads, parses and deletes it
+static bool fileRoundTrip(const std::string& path, const FaceResult& r, int box[4]) {
+    {
+        std::ofstream out(path.c_str());
+        out << r.boxes[0][0] << "," << r.boxes[0][1] << "," << r.boxes[0][2] << "," << r.boxes[0][3];
+    }
+    std::ifstream in(path.c_str());
+    if (!in) return false;
+    std::string line, field;
+    std::getline(in, line);
+    in.close();
+    std::istringstream fields(line);
+    for (int k = 0; k < 4 && std::getline(fields, field, ','); k++) box[k] = std::atoi(field.c_str());
+    return std::remove(path.c_str()) == 0;
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " [--items N] [--dir DIR]\n"
+              << "  --items N  results passed between threads (default 1000000)\n"
+              << "  --dir DIR  directory for file round trip (default /tmp)" << std::endl;
+}
+
+// Check SPSC result ring single-threaded and across two threads,
+// then compare per-result cost with former faceCoordinates.txt file exchange
+int main(int argc, char **argv) {
+
+    int items = 1000000;
+    std::string dir = "/tmp";
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--items" && i + 1 < argc) items = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--dir" && i + 1 < argc) dir = argv[++i];
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    int failures = 0;
+    std::cout << "Ring checks" << std::endl;
+    {
+        FaceResultRing ring(5);
+        check(ring.capacity() == 7, "8 slots with one kept free hold 7 items", failures);
+        FaceResult r;
+        check(!ring.pop(r), "empty ring pops nothing", failures);
+
+        bool pushed = true;
+        for (int i = 0; i < 8; i++) pushed = ring.push(makeResult(i)) && pushed;
+        check(pushed && ring.dropped() == 1 && ring.size() == 7, "full ring drops oldest and counts it", failures);
+
+        bool fifo = true;
+        for (int i = 1; i < 4; i++) fifo = fifo && ring.pop(r) && r.boxes[0][0] == i;
+        check(fifo, "items come out in push order after the dropped one", failures);
+
+        // Wrap around the end of slot array, UI stalled while analyzer overwrites
+        for (int i = 8; i < 20; i++) ring.push(makeResult(i));
+        check(ring.popLatest(r) == 7 && r.boxes[0][0] == 19 && ring.size() == 0, "popLatest after stall returns newest", failures);
+    }
+    {
+        FaceResult r;
+        r.timestampNs = 1000000000;
+        r.count = 6;
+        for (int i = 0; i < FACE_RESULT_MAX_BOXES; i++) {
+            for (int k = 0; k < 4; k++) r.boxes[i][k] = 10 * i + k;
+        }
+        int packed[FACE_RESULT_PACKED_MAX];
+        int n = packFaceResult(r, 1000000000 + 25000000, packed, FACE_RESULT_PACKED_MAX);
+        check(n == FACE_RESULT_PACKED_MAX && packed[0] == 25 && packed[1] == FACE_RESULT_MAX_BOXES
+              && packed[2] == 0 && packed[5] == 3 && packed[n - 1] == 10 * (FACE_RESULT_MAX_BOXES - 1) + 3,
+              "packed as age, stored boxes, l t r b", failures);
+        n = packFaceResult(r, r.timestampNs, packed, 7);
+        check(n == 6 && packed[1] == 1, "boxes beyond capacity left out", failures);
+        r.count = 0;
+        check(packFaceResult(r, r.timestampNs, packed, FACE_RESULT_PACKED_MAX) == 2 && packed[1] == 0, "no face packs two ints", failures);
+    }
+
+    // Analyzer and UI threads: every result arrives once and in order, or is counted as dropped
+    std::cout << "Two threads, " << items << " results" << std::endl;
+    FaceResultRing ring(16);
+    size_t received = 0;
+    bool ordered = true;
+    auto start = std::chrono::steady_clock::now();
+    std::thread consumer([&]() {
+        FaceResult r;
+        int last = -1;
+        while (last < items - 1 && received + ring.dropped() < (size_t) items) {
+            if (!ring.pop(r)) {
+                std::this_thread::yield();
+                continue;
+            }
+            ordered = ordered && r.boxes[0][0] > last && r.boxes[0][3] == r.boxes[0][0] + 3;
+            last = r.boxes[0][0];
+            received++;
+        }
+        while (ring.pop(r)) received++;
+    });
+    for (int i = 0; i < items; i++) {
+        if (!ring.push(makeResult(i))) std::this_thread::yield();
+    }
+    consumer.join();
+    double ringMs = elapsedMs(start);
+    check(ordered, "results received in order", failures);
+    check(received + ring.dropped() == (size_t) items, "received + dropped equals pushed", failures);
+
+    int rounds = std::max(1, std::min(items, 2000));
+    std::string path = dir + "/faceCoordinates.txt";
+    bool fileOk = true;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        int box[4] = {0, 0, 0, 0};
+        fileOk = fileRoundTrip(path, makeResult(i), box) && box[0] == i && box[3] == i + 3 && fileOk;
+    }
+    double fileMs = elapsedMs(start);
+    check(fileOk, "file round trip reads back same box", failures);
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "ring  " << std::setw(12) << ringMs * 1e6 / items << " ns/result  (" << ring.dropped() << " dropped)" << std::endl
+              << "file  " << std::setw(12) << fileMs * 1e6 / rounds << " ns/result" << std::endl;
+    if (failures) std::cout << "FAILED: " << failures << " checks" << std::endl;
+    else std::cout << "All checks passed" << std::endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,110 @@
+#include "face_core.hpp"
+#include <opencv2/imgproc.hpp>
+#include "plane_rotate.hpp"
+
+FaceCoreConfig FaceCoreConfig::preset(FaceCorePreset preset) {
+    FaceCoreConfig config;
+    switch (preset) {
+        case FaceCorePreset::Desktop:
+            config.params.scaleFactor = 1.1;
+            config.params.minNeighbors = 7;
+            config.params.minSize = cv::Size(30, 30);
+            break;
+        case FaceCorePreset::Android:
+            config.params.scaleFactor = 1.1;
+            config.params.minNeighbors = 3;
+            config.params.minSize = cv::Size(250, 250);
+            config.roiSearch = true;
+            break;
+        case FaceCorePreset::IOS:
+            config.params.scaleFactor = 1.15;
+            config.params.minNeighbors = 6;
+            config.params.minSize = cv::Size(200, 200);
+            config.roiSearch = true;
+            break;
+    }
+    return config;
+}
+
+FaceCoreDetector::FaceCoreDetector(const std::string& model, const FaceCoreConfig& config)
+    : config_(config), session_(model, config.params), redetector_(session_, config.roi) {
+}
+
+FaceCoreDetector::FaceCoreDetector(const void* modelData, size_t modelSize, const FaceCoreConfig& config)
+    : config_(config), redetector_(session_, config.roi) {
+    session_.params() = config.params;
+    session_.load(modelData, modelSize);
+}
+
+void FaceCoreDetector::detect(const cv::Mat& frame, std::vector<cv::Rect>& faces) {
+    if (config_.roiSearch) redetector_.detect(frame, faces);
+    else session_.detect(frame, faces);
+}
+
+bool FaceCoreDetector::detect(const uchar* pixels, int width, int height, size_t stride,
+                              facecore_format format, std::vector<cv::Rect>& faces) {
+    return detect(pixels, width, height, stride, format, 0, faces);
+}
+
+bool FaceCoreDetector::detect(const uchar* pixels, int width, int height, size_t stride,
+                              facecore_format format, int rotationDegrees, std::vector<cv::Rect>& faces) {
+    faces.clear();
+    int type, code;
+    switch (format) {
+        case FACECORE_FORMAT_GRAY: type = CV_8UC1; code = -1; break;
+        case FACECORE_FORMAT_BGR: type = CV_8UC3; code = cv::COLOR_BGR2GRAY; break;
+        case FACECORE_FORMAT_RGB: type = CV_8UC3; code = cv::COLOR_RGB2GRAY; break;
+        case FACECORE_FORMAT_BGRA: type = CV_8UC4; code = cv::COLOR_BGRA2GRAY; break;
+        case FACECORE_FORMAT_RGBA: type = CV_8UC4; code = cv::COLOR_RGBA2GRAY; break;
+        default: return false;
+    }
+    if (pixels == NULL || width <= 0 || height <= 0 || stride < (size_t) width * CV_ELEM_SIZE(type)) return false;
+    if (rotationDegrees != 0 && rotationDegrees != 90 && rotationDegrees != 180 && rotationDegrees != 270) return false;
+
+    // Wrap caller's memory, no copy
+    cv::Mat frame(height, width, type, const_cast<uchar*>(pixels), stride);
+
+    // Color backend (YuNet) gets BGR, RGB(A) channel order is swapped here
+    if (session_.input() == FaceBackendInput::BGR && type != CV_8UC1) {
+        const cv::Mat* bgr = &frame;
+        if (format != FACECORE_FORMAT_BGR && format != FACECORE_FORMAT_BGRA) {
+            cv::cvtColor(frame, color_, format == FACECORE_FORMAT_RGB ? cv::COLOR_RGB2BGR : cv::COLOR_RGBA2BGR);
+            bgr = &color_;
+        }
+        int rotation = rotationDegrees;
+        if (rotation == 0) {
+            detect(*bgr, faces);
+            return true;
+        }
+        cv::rotate(*bgr, rotated_, rotation == 90 ? cv::ROTATE_90_CLOCKWISE
+                                   : rotation == 180 ? cv::ROTATE_180 : cv::ROTATE_90_COUNTERCLOCKWISE);
+        detect(rotated_, faces);
+        return true;
+    }
+
+    // Rotated frame: convert to gray first so only one channel is moved
+    if (rotationDegrees != 0) {
+        const cv::Mat* plane = &frame;
+        if (code >= 0) {
+            cv::cvtColor(frame, gray_, code);
+            plane = &gray_;
+        }
+        rotatePlane(*plane, rotated_, rotationDegrees);
+        detect(rotated_, faces);
+        return true;
+    }
+
+    // Session expects BGR order, RGB(A) is converted to gray here
+    if (format == FACECORE_FORMAT_RGB || format == FACECORE_FORMAT_RGBA) {
+        cv::cvtColor(frame, gray_, code);
+        detect(gray_, faces);
+    }
+    else {
+        detect(frame, faces);
+    }
+    return true;
+}
+
+void FaceCoreDetector::reset() {
+    redetector_.reset();
+}
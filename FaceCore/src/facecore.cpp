@@ -0,0 +1,109 @@
+#include "facecore.h"
+#include <algorithm>
+#include "face_core.hpp"
+
+// Opaque handle behind C interface
+struct facecore_detector {
+    facecore_detector(const std::string& model, const FaceCoreConfig& config) : detector(model, config) {}
+    facecore_detector(const void* data, size_t size, const FaceCoreConfig& config) : detector(data, size, config) {}
+
+    FaceCoreDetector detector;
+    std::vector<cv::Rect> faces;
+};
+
+static FaceCoreConfig fromC(const facecore_config& c) {
+    FaceCoreConfig config;
+    config.params.scaleFactor = c.scale_factor;
+    config.params.minNeighbors = c.min_neighbors;
+    config.params.minSize = cv::Size(c.min_size, c.min_size);
+    config.params.maxSize = cv::Size(c.max_size, c.max_size);
+    config.params.detectWidth = c.detect_width;
+    config.roiSearch = c.roi_search != 0;
+    config.params.backend = c.backend == FACECORE_BACKEND_YUNET ? FaceBackendType::YuNet : FaceBackendType::Haar;
+    config.params.scoreThreshold = c.score_threshold;
+    return config;
+}
+
+void facecore_config_preset(facecore_preset preset, facecore_config* config) {
+    if (config == NULL) return;
+    FaceCorePreset p = FaceCorePreset::Desktop;
+    if (preset == FACECORE_PRESET_ANDROID) p = FaceCorePreset::Android;
+    else if (preset == FACECORE_PRESET_IOS) p = FaceCorePreset::IOS;
+
+    FaceCoreConfig c = FaceCoreConfig::preset(p);
+    config->scale_factor = c.params.scaleFactor;
+    config->min_neighbors = c.params.minNeighbors;
+    config->min_size = c.params.minSize.width;
+    config->max_size = c.params.maxSize.width;
+    config->detect_width = c.params.detectWidth;
+    config->roi_search = c.roiSearch ? 1 : 0;
+    config->backend = c.params.backend == FaceBackendType::YuNet ? FACECORE_BACKEND_YUNET : FACECORE_BACKEND_HAAR;
+    config->score_threshold = c.params.scoreThreshold;
+}
+
+// Construct detector from path or memory, NULL if model is not usable
+template <typename... Model>
+static facecore_detector* createDetector(const facecore_config* config, Model... model) {
+    FaceCoreConfig c = config != NULL ? fromC(*config) : FaceCoreConfig::preset(FaceCorePreset::Desktop);
+
+    // Exceptions must not cross C interface, allocation and model parsing may throw
+    facecore_detector* detector = NULL;
+    try {
+        detector = new facecore_detector(model..., c);
+    }
+    catch (...) {
+        return NULL;
+    }
+    if (detector->detector.empty()) {
+        delete detector;
+        return NULL;
+    }
+    return detector;
+}
+
+facecore_detector* facecore_create(const char* model_path, const facecore_config* config) {
+    if (model_path == NULL) return NULL;
+    return createDetector(config, std::string(model_path));
+}
+
+facecore_detector* facecore_create_from_memory(const void* model_data, size_t model_size,
+                                               const facecore_config* config) {
+    if (model_data == NULL || model_size == 0) return NULL;
+    return createDetector(config, model_data, model_size);
+}
+
+void facecore_destroy(facecore_detector* detector) {
+    delete detector;
+}
+
+int facecore_detect(facecore_detector* detector, const unsigned char* pixels, int width, int height,
+                    size_t stride, facecore_format format, facecore_box* boxes, int max_boxes) {
+    return facecore_detect_rotated(detector, pixels, width, height, stride, format, 0, boxes, max_boxes);
+}
+
+int facecore_detect_rotated(facecore_detector* detector, const unsigned char* pixels, int width, int height,
+                            size_t stride, facecore_format format, int rotation_degrees,
+                            facecore_box* boxes, int max_boxes) {
+    if (detector == NULL || (boxes == NULL && max_boxes > 0)) return -1;
+    try {
+        if (!detector->detector.detect(pixels, width, height, stride, format, rotation_degrees,
+                                       detector->faces)) return -1;
+    }
+    catch (...) {
+        return -1;
+    }
+
+    const std::vector<cv::Rect>& faces = detector->faces;
+    int count = std::min((int) faces.size(), max_boxes);
+    for (int i = 0; i < count; i++) {
+        boxes[i].x = faces[i].x;
+        boxes[i].y = faces[i].y;
+        boxes[i].width = faces[i].width;
+        boxes[i].height = faces[i].height;
+    }
+    return (int) faces.size();
+}
+
+void facecore_reset(facecore_detector* detector) {
+    if (detector != NULL) detector->detector.reset();
+}
@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <opencv2/core.hpp>
+#include "bench_util.hpp"
+#include "y_plane.hpp"
+
+// Synthetic Y plane like ImageProxy.planes[0]: pattern pixels, 0xEE padding, last row unpadded
+static std::vector<uchar> makePlane(int width, int height, int rowStride) {
+    std::vector<uchar> plane((size_t) (height - 1) * rowStride + width, 0xEE);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) plane[(size_t) y * rowStride + x] = (uchar) ((x * 7 + y * 13) & 0xff);
+    }
+    return plane;
+}
+
+static bool matchesPattern(const cv::Mat& image) {
+    for (int y = 0; y < image.rows; y++) {
+        const uchar* row = image.ptr<uchar>(y);
+        for (int x = 0; x < image.cols; x++) {
+            if (row[x] != (uchar) ((x * 7 + y * 13) & 0xff)) return false;
+        }
+    }
+    return true;
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " [--runs N]\n"
+              << "  --runs N   timed runs per case (default 500)" << std::endl;
+}
+
+// Check zero-copy Y plane wrapping on strided synthetic buffers and compare with
+// the former toByteArray() + Mat.put() copies, without any device
+int main(int argc, char **argv) {
+
+    int runs = 500;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--runs" && i + 1 < argc) runs = std::max(1, std::atoi(argv[++i]));
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    int failures = 0;
+    std::cout << "Wrap checks" << std::endl;
+    {
+        std::vector<uchar> plane = makePlane(640, 480, 704);
+        cv::Mat y = wrapYPlane(plane.data(), plane.size(), 640, 480, 704);
+        check(!y.empty() && y.data == plane.data(), "wrapped Mat points into camera buffer", failures);
+        check(y.step == 704 && y.cols == 640 && y.rows == 480 && y.type() == CV_8UC1, "step is rowStride", failures);
+        check(matchesPattern(y), "pixels read through step, padding skipped", failures);
+        check(wrapYPlane(plane.data(), plane.size() - 1, 640, 480, 704).empty(), "buffer one byte short rejected", failures);
+        check(wrapYPlane(plane.data(), plane.size(), 640, 480, 600).empty(), "rowStride below width rejected", failures);
+        check(wrapYPlane(NULL, plane.size(), 640, 480, 704).empty(), "NULL buffer rejected", failures);
+        check(wrapYPlane(plane.data(), plane.size(), 0, 480, 704).empty(), "empty size rejected", failures);
+    }
+
+    // Former Kotlin path: whole buffer to ByteArray, then Mat.put() of contiguous rows
+    const int sizes[][3] = {{640, 480, 640}, {640, 480, 704}, {1280, 720, 1280}, {1280, 720, 1344}, {1920, 1080, 1984}};
+    std::cout << std::endl << std::left << std::setw(12) << "frame" << std::setw(10) << "stride" << std::right
+              << std::setw(12) << "copy ms" << std::setw(12) << "wrap ms" << std::setw(14) << "copy correct" << std::endl;
+    std::cout << std::fixed << std::setprecision(4);
+    bool wrapOk = true;
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        int width = sizes[s][0], height = sizes[s][1], stride = sizes[s][2];
+        std::vector<uchar> plane = makePlane(width, height, stride);
+
+        std::vector<uchar> bytes;
+        cv::Mat copied(height, width, CV_8UC1);
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < runs; r++) {
+            bytes.assign(plane.begin(), plane.end());
+            std::memcpy(copied.data, bytes.data(), std::min(bytes.size(), copied.total()));
+        }
+        double copyMs = elapsedMs(start) / runs;
+
+        cv::Mat wrapped;
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < runs; r++) wrapped = wrapYPlane(plane.data(), plane.size(), width, height, stride);
+        double wrapMs = elapsedMs(start) / runs;
+
+        // Copy path ignored rowStride, image is sheared whenever rows are padded
+        wrapOk = wrapOk && wrapped.data == plane.data() && matchesPattern(wrapped);
+        std::ostringstream frame;
+        frame << width << "x" << height;
+        std::cout << std::left << std::setw(12) << frame.str() << std::setw(10) << stride << std::right
+                  << std::setw(12) << copyMs << std::setw(12) << wrapMs
+                  << std::setw(14) << (matchesPattern(copied) ? "yes" : "no (sheared)") << std::endl;
+    }
+
+    check(wrapOk, "wrap correct at every stride", failures);
+    if (failures) std::cout << "FAILED: " << failures << " checks" << std::endl;
+    else std::cout << "All checks passed" << std::endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include "bench_util.hpp"
+#include "area_gray_resize.hpp"
+
+// Largest absolute pixel difference
+static int maxDiff(const cv::Mat& a, const cv::Mat& b) {
+    cv::Mat diff;
+    cv::absdiff(a, b, diff);
+    double maxVal = 0;
+    cv::minMaxLoc(diff.reshape(1), NULL, &maxVal);
+    return (int) maxVal;
+}
+
+// Camera-like test frame: smooth gradients with sensor noise
+static cv::Mat syntheticFrame(cv::Size size, int type) {
+    cv::Mat frame(size, type);
+    int cn = frame.channels();
+    for (int y = 0; y < size.height; y++) {
+        uchar* row = frame.ptr<uchar>(y);
+        for (int x = 0; x < size.width; x++) {
+            for (int c = 0; c < cn; c++) row[x * cn + c] = (uchar) ((x * (c + 1) + y * (3 - c)) & 0xff);
+        }
+    }
+    cv::Mat noise(size, type);
+    cv::randn(noise, cv::Scalar::all(0), cv::Scalar::all(12));
+    cv::add(frame, noise, frame);
+    return frame;
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " [image] [options]\n"
+              << "  image        frame to scale to each resolution (default synthetic)\n"
+              << "  --width N    target width (default 480, same as faceDetect)\n"
+              << "  --runs N     timed runs per case, median is reported (default 200)" << std::endl;
+}
+
+// Compare fused INTER_AREA + gray kernel with cv::resize + cv::cvtColor at common camera resolutions
+int main(int argc, char **argv) {
+
+    std::string input;
+    int width = 480, runs = 200;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--width" && i + 1 < argc) width = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--runs" && i + 1 < argc) runs = std::max(1, std::atoi(argv[++i]));
+        else if (input.empty() && !arg.empty() && arg[0] != '-') input = arg;
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    cv::Mat image;
+    if (!input.empty()) {
+        image = cv::imread(input);
+        if (image.empty()) {
+            std::cout << "Cannot read " << input << std::endl;
+            return -1;
+        }
+    }
+
+    const cv::Size resolutions[] = {cv::Size(640, 480), cv::Size(1280, 720), cv::Size(1920, 1080)};
+    const int types[] = {CV_8UC3, CV_8UC4};
+
+    std::cout << std::left << std::setw(12) << "source" << std::setw(6) << "cn" << std::right
+              << std::setw(12) << "two-call" << std::setw(12) << "fused" << std::setw(12) << "fused+bgr"
+              << std::setw(10) << "speedup" << std::setw(10) << "maxdiff" << "  (ms, median)" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+
+    bool ok = true;
+    AreaGrayResizer resizer;
+    for (size_t r = 0; r < sizeof(resolutions) / sizeof(resolutions[0]); r++) {
+        for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++) {
+            cv::Mat frame;
+            if (image.empty()) {
+                frame = syntheticFrame(resolutions[r], types[t]);
+            }
+            else {
+                cv::resize(image, frame, resolutions[r], 0, 0, cv::INTER_LINEAR);
+                if (types[t] == CV_8UC4) cv::cvtColor(frame, frame, cv::COLOR_BGR2BGRA);
+            }
+
+            // Same size computation as faceDetect()
+            float factor = (float) width / (float) frame.cols;
+            cv::Size size(width, (int) (factor * frame.rows));
+
+            cv::Mat resized, gray;
+            double twoCallMs = medianMs(runs, [&]() {
+                cv::resize(frame, resized, size, 0, 0, cv::INTER_AREA);
+                cv::cvtColor(resized, gray, cv::COLOR_BGR2GRAY);
+            });
+
+            cv::Mat fusedGray(size, CV_8UC1), fusedColor(size, frame.type()), colorGray(size, CV_8UC1);
+            double fusedMs = medianMs(runs, [&]() { resizer.run(frame, fusedGray); });
+            double colorMs = medianMs(runs, [&]() { resizer.run(frame, colorGray, &fusedColor); });
+
+            int diff = std::max(maxDiff(gray, fusedGray), maxDiff(gray, colorGray));
+            int colorDiff = maxDiff(resized, fusedColor);
+            ok = ok && diff <= 1 && colorDiff <= 1;
+
+            std::ostringstream source;
+            source << frame.cols << "x" << frame.rows;
+            std::cout << std::left << std::setw(12) << source.str() << std::setw(6) << frame.channels() << std::right
+                      << std::setw(12) << twoCallMs << std::setw(12) << fusedMs << std::setw(12) << colorMs
+                      << std::setw(9) << twoCallMs / fusedMs << "x" << std::setw(10) << diff << std::endl;
+        }
+    }
+
+    std::cout << (ok ? "Gray and color within +-1 of cv::resize + cv::cvtColor" : "MISMATCH: difference above 1") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,236 @@
+#include "area_gray_resize.hpp"
+#include <algorithm>
+#include <opencv2/core/hal/intrin.hpp>
+#include <opencv2/imgproc.hpp>
+
+// cvtColor BGR2GRAY weights, fixed point with 14 fractional bits
+static const int GRAY_SHIFT = 14;
+static const int B2Y = 1868;
+static const int G2Y = 9617;
+static const int R2Y = 4899;
+
+// INTER_AREA weights exactly as cv::resize tabulates them
+static void areaTaps(int ssize, int dsize, double scale, std::vector<AreaTap>& tab) {
+    tab.clear();
+    for (int dx = 0; dx < dsize; dx++) {
+        double fsx1 = dx * scale;
+        double fsx2 = fsx1 + scale;
+        double cellWidth = std::min(scale, ssize - fsx1);
+
+        int sx1 = cvCeil(fsx1), sx2 = cvFloor(fsx2);
+        sx2 = std::min(sx2, ssize - 1);
+        sx1 = std::min(sx1, sx2);
+
+        if (sx1 - fsx1 > 1e-3) {
+            AreaTap tap = {dx, sx1 - 1, (float) ((sx1 - fsx1) / cellWidth)};
+            tab.push_back(tap);
+        }
+        for (int sx = sx1; sx < sx2; sx++) {
+            AreaTap tap = {dx, sx, (float) (1.0 / cellWidth)};
+            tab.push_back(tap);
+        }
+        if (fsx2 - sx2 > 1e-3) {
+            AreaTap tap = {dx, sx2, (float) (std::min(std::min(fsx2 - sx2, 1.), cellWidth) / cellWidth)};
+            tab.push_back(tap);
+        }
+    }
+}
+
+#if CV_SIMD
+// Weighted sum of expanded channels, 16 fractional bits scaled luma as float
+static inline void storeLuma(const cv::v_uint16& b, const cv::v_uint16& g, const cv::v_uint16& r, float* dst) {
+    cv::v_uint32 b0, b1, g0, g1, r0, r1;
+    cv::v_mul_expand(b, cv::vx_setall_u16((ushort) B2Y), b0, b1);
+    cv::v_mul_expand(g, cv::vx_setall_u16((ushort) G2Y), g0, g1);
+    cv::v_mul_expand(r, cv::vx_setall_u16((ushort) R2Y), r0, r1);
+    cv::v_store(dst, cv::v_cvt_f32(cv::v_reinterpret_as_s32(b0 + g0 + r0)));
+    cv::v_store(dst + cv::v_float32::nlanes, cv::v_cvt_f32(cv::v_reinterpret_as_s32(b1 + g1 + r1)));
+}
+#endif
+
+// Luma of one source row scaled by 2^GRAY_SHIFT, rounding is left for the end
+static void lumaRow(const uchar* S, int width, int cn, float* luma) {
+    int x = 0;
+    if (cn == 1) {
+        for (; x < width; x++) luma[x] = (float) (S[x] << GRAY_SHIFT);
+        return;
+    }
+#if CV_SIMD
+    const int n = cv::v_uint8::nlanes;
+    for (; x <= width - n; x += n) {
+        cv::v_uint8 b, g, r, a;
+        if (cn == 3) cv::v_load_deinterleave(S + x * 3, b, g, r);
+        else cv::v_load_deinterleave(S + x * 4, b, g, r, a);
+        cv::v_uint16 b0, b1, g0, g1, r0, r1;
+        cv::v_expand(b, b0, b1);
+        cv::v_expand(g, g0, g1);
+        cv::v_expand(r, r0, r1);
+        storeLuma(b0, g0, r0, luma + x);
+        storeLuma(b1, g1, r1, luma + x + n / 2);
+    }
+#endif
+    for (; x < width; x++) {
+        const uchar* p = S + x * cn;
+        luma[x] = (float) (p[0] * B2Y + p[1] * G2Y + p[2] * R2Y);
+    }
+}
+
+// sum = beta * row, or sum += beta * row
+static void accumulate(float* sum, const float* row, float beta, int n, bool first) {
+    int x = 0;
+#if CV_SIMD
+    cv::v_float32 vbeta = cv::vx_setall_f32(beta);
+    for (; x <= n - cv::v_float32::nlanes; x += cv::v_float32::nlanes) {
+        cv::v_float32 v = vbeta * cv::vx_load(row + x);
+        cv::v_store(sum + x, first ? v : cv::vx_load(sum + x) + v);
+    }
+#endif
+    for (; x < n; x++) sum[x] = first ? beta * row[x] : sum[x] + beta * row[x];
+}
+
+#if CV_SIMD
+static inline void accumulateLanes(float* sum, const cv::v_uint32& v, const cv::v_float32& beta, bool first) {
+    cv::v_float32 f = beta * cv::v_cvt_f32(cv::v_reinterpret_as_s32(v));
+    cv::v_store(sum, first ? f : cv::vx_load(sum) + f);
+}
+#endif
+
+// Same on 8-bit source row, channels are accumulated independently
+static void accumulate(float* sum, const uchar* row, float beta, int n, bool first) {
+    int x = 0;
+#if CV_SIMD
+    const int q = cv::v_float32::nlanes;
+    cv::v_float32 vbeta = cv::vx_setall_f32(beta);
+    for (; x <= n - cv::v_uint8::nlanes; x += cv::v_uint8::nlanes) {
+        cv::v_uint16 w0, w1;
+        cv::v_uint32 d0, d1, d2, d3;
+        cv::v_expand(cv::vx_load(row + x), w0, w1);
+        cv::v_expand(w0, d0, d1);
+        cv::v_expand(w1, d2, d3);
+        accumulateLanes(sum + x, d0, vbeta, first);
+        accumulateLanes(sum + x + q, d1, vbeta, first);
+        accumulateLanes(sum + x + 2 * q, d2, vbeta, first);
+        accumulateLanes(sum + x + 3 * q, d3, vbeta, first);
+    }
+#endif
+    for (; x < n; x++) sum[x] = first ? beta * row[x] : sum[x] + beta * row[x];
+}
+
+// Horizontal INTER_AREA taps over one vertically accumulated row
+template <int cn>
+static void areaRow(const std::vector<AreaTap>& tab, const float* sum, float* dst, int width) {
+    std::fill(dst, dst + width * cn, 0.f);
+    for (size_t k = 0; k < tab.size(); k++) {
+        const float* s = sum + tab[k].si * cn;
+        float* d = dst + tab[k].di * cn;
+        float alpha = tab[k].alpha;
+        for (int c = 0; c < cn; c++) d[c] += s[c] * alpha;
+    }
+}
+
+// Round accumulated luma back to 8 bits
+static void storeGray(const float* sum, int width, uchar* gray) {
+    const float scale = 1.f / (1 << GRAY_SHIFT);
+    int x = 0;
+#if CV_SIMD
+    const int n = cv::v_uint16::nlanes;
+    cv::v_float32 vscale = cv::vx_setall_f32(scale);
+    for (; x <= width - n; x += n) {
+        cv::v_int32 i0 = cv::v_round(cv::vx_load(sum + x) * vscale);
+        cv::v_int32 i1 = cv::v_round(cv::vx_load(sum + x + n / 2) * vscale);
+        cv::v_pack_u_store(gray + x, cv::v_pack(i0, i1));
+    }
+#endif
+    for (; x < width; x++) gray[x] = cv::saturate_cast<uchar>(sum[x] * scale);
+}
+
+// Round accumulated channels, gray comes from rounded color like cvtColor on resized frame
+static void storeColorGray(const float* sum, int width, int cn, uchar* color, uchar* gray) {
+    for (int x = 0; x < width; x++) {
+        uchar* c = color + x * cn;
+        for (int k = 0; k < cn; k++) c[k] = cv::saturate_cast<uchar>(sum[x * cn + k]);
+        if (cn == 1) gray[x] = c[0];
+        else gray[x] = (uchar) ((c[0] * B2Y + c[1] * G2Y + c[2] * R2Y + (1 << (GRAY_SHIFT - 1))) >> GRAY_SHIFT);
+    }
+}
+
+bool AreaGrayResizer::supported(cv::Size srcSize, cv::Size dstSize, int cn) {
+    return (cn == 1 || cn == 3 || cn == 4) && dstSize.width > 0 && dstSize.height > 0 &&
+           dstSize.width <= srcSize.width && dstSize.height <= srcSize.height;
+}
+
+void AreaGrayResizer::prepare(cv::Size srcSize, cv::Size dstSize) {
+    if (srcSize == srcSize_ && dstSize == dstSize_) return;
+    srcSize_ = srcSize;
+    dstSize_ = dstSize;
+
+    // Same scale computation as cv::resize with explicit destination size
+    double scaleX = 1. / ((double) dstSize.width / srcSize.width);
+    double scaleY = 1. / ((double) dstSize.height / srcSize.height);
+    areaTaps(srcSize.width, dstSize.width, scaleX, xtab_);
+    areaTaps(srcSize.height, dstSize.height, scaleY, ytab_);
+    luma_.resize(srcSize.width);
+}
+
+void AreaGrayResizer::run(const uchar* src, size_t srcStep, cv::Size srcSize, int cn,
+                          uchar* gray, size_t grayStep, cv::Size dstSize,
+                          uchar* color, size_t colorStep) {
+    prepare(srcSize, dstSize);
+
+    // Values accumulated per pixel, color channels or luma
+    int lanes = color != NULL ? cn : 1;
+    sum_.resize((size_t) srcSize.width * lanes);
+    row_.resize((size_t) dstSize.width * lanes);
+
+    // Rows are summed vertically first so horizontal taps run once per destination row
+    // A source row on a cell boundary is added to both destination rows
+    int dy = ytab_[0].di;
+    for (size_t j = 0; j < ytab_.size(); j++) {
+        const AreaTap& ty = ytab_[j];
+        const uchar* S = src + (size_t) ty.si * srcStep;
+        bool first = j == 0 || ytab_[j - 1].di != ty.di;
+        if (first && j > 0) {
+            storeRow(cn, color, colorStep, gray, grayStep, dy, dstSize.width);
+            dy = ty.di;
+        }
+
+        if (color != NULL) {
+            accumulate(sum_.data(), S, ty.alpha, srcSize.width * cn, first);
+        }
+        else {
+            lumaRow(S, srcSize.width, cn, luma_.data());
+            accumulate(sum_.data(), luma_.data(), ty.alpha, srcSize.width, first);
+        }
+    }
+    storeRow(cn, color, colorStep, gray, grayStep, dy, dstSize.width);
+}
+
+void AreaGrayResizer::storeRow(int cn, uchar* color, size_t colorStep, uchar* gray, size_t grayStep, int dy, int width) {
+    uchar* g = gray + (size_t) dy * grayStep;
+    if (color == NULL) {
+        areaRow<1>(xtab_, sum_.data(), row_.data(), width);
+        storeGray(row_.data(), width, g);
+        return;
+    }
+
+    if (cn == 1) areaRow<1>(xtab_, sum_.data(), row_.data(), width);
+    else if (cn == 3) areaRow<3>(xtab_, sum_.data(), row_.data(), width);
+    else areaRow<4>(xtab_, sum_.data(), row_.data(), width);
+    storeColorGray(row_.data(), width, cn, color + (size_t) dy * colorStep, g);
+}
+
+void AreaGrayResizer::run(const cv::Mat& src, cv::Mat& gray, cv::Mat* color) {
+    CV_Assert(src.depth() == CV_8U && gray.type() == CV_8UC1 && !gray.empty());
+    if (color != NULL) CV_Assert(color->size() == gray.size() && color->type() == src.type());
+
+    int cn = src.channels();
+    if (!supported(src.size(), gray.size(), cn)) {
+        cv::Mat& resized = color != NULL ? *color : fallback_;
+        cv::resize(src, resized, gray.size(), 0, 0, cv::INTER_AREA);
+        if (cn == 1) resized.copyTo(gray);
+        else cv::cvtColor(resized, gray, cv::COLOR_BGR2GRAY);
+        return;
+    }
+    run(src.data, src.step, src.size(), cn, gray.data, gray.step, gray.size(),
+        color != NULL ? color->data : NULL, color != NULL ? color->step : 0);
+}
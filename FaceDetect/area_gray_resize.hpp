@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <opencv2/core.hpp>
+
+// Source pixel si contributes to destination pixel di with weight alpha
+struct AreaTap {
+    int di;
+    int si;
+    float alpha;
+};
+
+// INTER_AREA downscale and BGR(A) to gray conversion in one pass over the source
+//
+// Replaces cv::resize(INTER_AREA) followed by cv::cvtColor(BGR2GRAY) without
+// the full-size color intermediate. Gray is within +-1 of the two calls.
+// Source rows are converted to luma with universal intrinsics and only one
+// channel is area-averaged. When the resized color frame is wanted too (for
+// display) B, G and R are averaged once and gray is taken from the result.
+// Rows are summed vertically with SIMD, horizontal weights are applied once
+// per destination row.
+// Tap tables and row buffers are kept between calls of the same size.
+class AreaGrayResizer {
+
+public:
+    /* Downscale 1, 3 or 4 channel src to gray.size() and write gray
+     * gray must be preallocated CV_8UC1, optional color receives resized src (same size, src type)
+     * Upscaling falls back to cv::resize + cv::cvtColor */
+    void run(const cv::Mat& src, cv::Mat& gray, cv::Mat* color = NULL);
+
+    /* Same on raw buffers, color may be NULL */
+    void run(const uchar* src, size_t srcStep, cv::Size srcSize, int cn,
+             uchar* gray, size_t grayStep, cv::Size dstSize,
+             uchar* color = NULL, size_t colorStep = 0);
+
+    /* Return true if sizes and channels are handled by the fused kernel */
+    static bool supported(cv::Size srcSize, cv::Size dstSize, int cn);
+
+private:
+    void prepare(cv::Size srcSize, cv::Size dstSize);
+
+    /* Apply horizontal taps to vertical sums and write destination row dy */
+    void storeRow(int cn, uchar* color, size_t colorStep, uchar* gray, size_t grayStep, int dy, int width);
+
+    cv::Size srcSize_;
+    cv::Size dstSize_;
+    std::vector<AreaTap> xtab_;
+    std::vector<AreaTap> ytab_;
+
+    // Reusable row buffers: source row luma, vertical sums and one destination row
+    std::vector<float> luma_;
+    std::vector<float> sum_;
+    std::vector<float> row_;
+    cv::Mat fallback_;
+};
@@ -0,0 +1,345 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+#include <opencv2/videoio.hpp>
+#include "bench_util.hpp"
+#include "face_backend.hpp"
+#include "face_core.hpp"
+#include "face_detector_session.hpp"
+
+// Read labelled boxes in face_batch CSV layout: file,frame,faces,x y w h;x y w h
+// File column is ignored, frame is the index in input
+static bool loadTruth(const std::string& path, size_t frames, std::vector<std::vector<cv::Rect>>& truth) {
+    std::ifstream in(path);
+    if (!in.is_open()) return false;
+    truth.assign(frames, std::vector<cv::Rect>());
+    std::string line;
+    std::getline(in, line);
+    while (std::getline(in, line)) {
+        std::vector<std::string> fields;
+        std::stringstream row(line);
+        std::string field;
+        while (std::getline(row, field, ',')) fields.push_back(field);
+        if (fields.size() < 3) continue;
+        size_t frame = (size_t) std::atol(fields[1].c_str());
+        if (frame >= frames || fields.size() < 4) continue;
+
+        std::stringstream boxes(fields[3]);
+        std::string box;
+        while (std::getline(boxes, box, ';')) {
+            cv::Rect r;
+            std::stringstream values(box);
+            if (values >> r.x >> r.y >> r.width >> r.height) truth[frame].push_back(r);
+        }
+    }
+    return true;
+}
+
+// True and false positives of one backend against reference boxes
+struct MatchCounts {
+    uint64_t truePositives = 0;
+    uint64_t found = 0;
+    uint64_t reference = 0;
+
+    double precision() const { return found > 0 ? (double) truePositives / found : 0.0; }
+    double recall() const { return reference > 0 ? (double) truePositives / reference : 0.0; }
+    double f1() const {
+        double p = precision(), r = recall();
+        return p + r > 0 ? 2 * p * r / (p + r) : 0.0;
+    }
+};
+
+static double iou(const cv::Rect& a, const cv::Rect& b) {
+    double inter = (a & b).area();
+    double uni = a.area() + b.area() - inter;
+    return uni > 0 ? inter / uni : 0.0;
+}
+
+// Greedy one-to-one matching at IoU >= 0.5, best overlapping pairs first
+static void matchFaces(const std::vector<cv::Rect>& found, const std::vector<cv::Rect>& reference, MatchCounts& counts) {
+    counts.found += found.size();
+    counts.reference += reference.size();
+    std::vector<std::pair<double, std::pair<size_t, size_t>>> pairs;
+    for (size_t i = 0; i < found.size(); i++) {
+        for (size_t j = 0; j < reference.size(); j++) {
+            double overlap = iou(found[i], reference[j]);
+            if (overlap >= 0.5) pairs.push_back(std::make_pair(overlap, std::make_pair(i, j)));
+        }
+    }
+    std::sort(pairs.rbegin(), pairs.rend());
+    std::vector<bool> usedFound(found.size(), false), usedReference(reference.size(), false);
+    for (size_t k = 0; k < pairs.size(); k++) {
+        size_t i = pairs[k].second.first, j = pairs[k].second.second;
+        if (usedFound[i] || usedReference[j]) continue;
+        usedFound[i] = usedReference[j] = true;
+        counts.truePositives++;
+    }
+}
+
+// One backend under test with its single-thread results
+struct BackendRun {
+    FaceBackendType type;
+    std::string model;
+    FaceDetectorParams params;
+    std::vector<double> times;
+    std::vector<std::vector<cv::Rect>> faces;
+};
+
+// Frames per second of threads sessions detecting in parallel, every session on its own frames
+// Faces of every frame are written to faces
+static double frameParallelFps(const BackendRun& run, const std::vector<cv::Mat>& frames, int threads, int loops,
+                               std::vector<std::vector<cv::Rect>>& faces) {
+    std::vector<std::unique_ptr<FaceDetectorSession>> sessions;
+    for (int t = 0; t < threads; t++) sessions.emplace_back(new FaceDetectorSession(run.model, run.params));
+    faces.assign(frames.size(), std::vector<cv::Rect>());
+
+    // Untimed warm-up of every session, first call allocates buffers
+    for (int t = 0; t < threads; t++) {
+        std::vector<cv::Rect> found;
+        sessions[t]->detect(frames[0], found);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            std::vector<cv::Rect> found;
+            for (int loop = 0; loop < loops; loop++) {
+                for (size_t i = t; i < frames.size(); i += threads) {
+                    sessions[t]->detect(frames[i], found);
+                    if (loop == 0) faces[i] = found;
+                }
+            }
+        });
+    }
+    for (size_t t = 0; t < workers.size(); t++) workers[t].join();
+    double seconds = elapsedMs(start) / 1000.0;
+    return seconds > 0 ? loops * frames.size() / seconds : 0.0;
+}
+
+// Frames per second of one session with OpenCV running threads inside every call
+static double intraFrameFps(const BackendRun& run, const std::vector<cv::Mat>& frames, int threads, int loops) {
+    cv::setNumThreads(threads);
+    FaceDetectorSession session(run.model, run.params);
+    std::vector<cv::Rect> found;
+    session.detect(frames[0], found);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int loop = 0; loop < loops; loop++) {
+        for (size_t i = 0; i < frames.size(); i++) session.detect(frames[i], found);
+    }
+    double seconds = elapsedMs(start) / 1000.0;
+    cv::setNumThreads(1);
+    return seconds > 0 ? loops * frames.size() / seconds : 0.0;
+}
+
+static double percentileMs(std::vector<double> times, double p) {
+    std::sort(times.begin(), times.end());
+    size_t rank = (size_t) (p / 100.0 * (times.size() - 1) + 0.5);
+    return times[std::min(rank, times.size() - 1)];
+}
+
+static bool sameFaces(const std::vector<std::vector<cv::Rect>>& a, const std::vector<std::vector<cv::Rect>>& b) {
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i] != b[i]) return false;
+    }
+    return true;
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " <video | image directory | glob> [options]\n"
+              << "  --yunet FILE   YuNet .onnx model, YuNet is skipped without it\n"
+              << "  --haar FILE    Haar Cascade .xml (default haarcascade_frontalface_alt2.xml)\n"
+              << "  --truth FILE   labelled boxes in face_batch CSV layout, frame = index in input\n"
+              << "                 without labels each backend is scored against the other\n"
+              << "  --frames N     use at most N decoded frames (default 100)\n"
+              << "  --loops N      timed passes over frames (default 3)\n"
+              << "  --threads N    highest thread count of scaling table (default all cores)\n"
+              << "  --width N      detection width (default 480)\n"
+              << "  --score F      YuNet confidence threshold (default 0.9)" << std::endl;
+}
+
+// Compare Haar Cascade and YuNet backends of FaceDetectorSession on recorded frames:
+// accuracy, ms/frame and scaling over threads
+int main(int argc, char **argv) {
+
+    std::string input, haarModel, yunetModel, truthPath;
+    int maxFrames = 100, loops = 3, maxThreads = 0, width = 480;
+    float score = 0.9f;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--yunet" && i + 1 < argc) yunetModel = argv[++i];
+        else if (arg == "--haar" && i + 1 < argc) haarModel = argv[++i];
+        else if (arg == "--truth" && i + 1 < argc) truthPath = argv[++i];
+        else if (arg == "--frames" && i + 1 < argc) maxFrames = std::atoi(argv[++i]);
+        else if (arg == "--loops" && i + 1 < argc) loops = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--threads" && i + 1 < argc) maxThreads = std::atoi(argv[++i]);
+        else if (arg == "--width" && i + 1 < argc) width = std::atoi(argv[++i]);
+        else if (arg == "--score" && i + 1 < argc) score = (float) std::atof(argv[++i]);
+        else if (input.empty() && !arg.empty() && arg[0] != '-') input = arg;
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+    if (input.empty()) {
+        usage(argv[0]);
+        return -1;
+    }
+    if (maxThreads <= 0) maxThreads = (int) std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<cv::Mat> frames;
+    if (!loadFrames(input, maxFrames, frames)) {
+        std::cout << "Cannot read frames from " << input << std::endl;
+        return -1;
+    }
+    std::vector<std::vector<cv::Rect>> truth;
+    if (!truthPath.empty() && !loadTruth(truthPath, frames.size(), truth)) {
+        std::cout << "Cannot read " << truthPath << std::endl;
+        return -1;
+    }
+    if (haarModel.empty()) haarModel = cv::samples::findFile("haarcascades/haarcascade_frontalface_alt2.xml");
+
+    // Same settings as face_detect.cpp, desktop preset of facecore, only backend differs
+    std::vector<BackendRun> runs;
+    BackendRun haar;
+    haar.type = FaceBackendType::Haar;
+    haar.model = haarModel;
+    haar.params = FaceCoreConfig::preset(FaceCorePreset::Desktop).params;
+    haar.params.detectWidth = width;
+    runs.push_back(haar);
+    if (!yunetModel.empty()) {
+        BackendRun yunet = haar;
+        yunet.type = FaceBackendType::YuNet;
+        yunet.model = yunetModel;
+        yunet.params.backend = FaceBackendType::YuNet;
+        yunet.params.scoreThreshold = score;
+        runs.push_back(yunet);
+    }
+
+    // Single-thread numbers first, scaling is measured separately
+    cv::setNumThreads(1);
+
+    int failures = 0;
+    std::cout << "Backend checks" << std::endl;
+    for (size_t b = 0; b < runs.size(); b++) {
+        BackendRun& run = runs[b];
+        std::string name = faceBackendName(run.type);
+        FaceDetectorSession session(run.model, run.params);
+        if (!check(!session.empty(), name + " model loads", failures)) return 1;
+
+        std::vector<cv::Rect> found;
+        session.detect(frames[0], found);
+        run.faces.assign(frames.size(), std::vector<cv::Rect>());
+        for (int loop = 0; loop < loops; loop++) {
+            for (size_t i = 0; i < frames.size(); i++) {
+                auto start = std::chrono::steady_clock::now();
+                session.detect(frames[i], found);
+                run.times.push_back(elapsedMs(start));
+                if (loop == 0) run.faces[i] = found;
+            }
+        }
+
+        bool inside = true;
+        for (size_t i = 0; i < frames.size(); i++) {
+            for (size_t j = 0; j < run.faces[i].size(); j++) {
+                const cv::Rect& r = run.faces[i][j];
+                // Mapping back from detection width may round one pixel past the edge
+                inside = inside && r.x >= 0 && r.y >= 0 && r.x + r.width <= frames[i].cols + 1
+                         && r.y + r.height <= frames[i].rows + 1;
+            }
+        }
+        check(inside, name + " boxes are in frame coordinates", failures);
+
+        // BGRA input goes through the shared session conversions
+        cv::Mat bgra;
+        cv::cvtColor(frames[0], bgra, cv::COLOR_BGR2BGRA);
+        std::vector<cv::Rect> fromBgra;
+        session.detect(bgra, fromBgra);
+        check(fromBgra == run.faces[0], name + " BGRA frame finds same faces as BGR", failures);
+
+        std::vector<std::vector<cv::Rect>> threaded;
+        frameParallelFps(run, frames, std::min(2, maxThreads), 1, threaded);
+        check(sameFaces(threaded, run.faces), name + " per-thread sessions find same faces as one session", failures);
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\nInput: " << input << " " << frames[0].cols << "x" << frames[0].rows
+              << ", " << frames.size() << " frames, detection width " << width << std::endl;
+
+    std::cout << "\nAccuracy (IoU >= 0.5) against " << (truth.empty() ? "other backend" : truthPath) << std::endl;
+    std::cout << std::left << std::setw(10) << "backend" << std::right << std::setw(10) << "faces/fr"
+              << std::setw(11) << "precision" << std::setw(9) << "recall" << std::setw(8) << "F1" << std::endl;
+    for (size_t b = 0; b < runs.size(); b++) {
+        uint64_t faceCount = 0;
+        for (size_t i = 0; i < frames.size(); i++) faceCount += runs[b].faces[i].size();
+        std::cout << std::left << std::setw(10) << faceBackendName(runs[b].type) << std::right
+                  << std::setw(10) << (double) faceCount / frames.size();
+        const std::vector<std::vector<cv::Rect>>* reference = NULL;
+        if (!truth.empty()) reference = &truth;
+        else if (runs.size() > 1) reference = &runs[1 - b].faces;
+        if (reference == NULL) {
+            std::cout << "  (no reference, pass --truth or --yunet)" << std::endl;
+            continue;
+        }
+        MatchCounts counts;
+        for (size_t i = 0; i < frames.size(); i++) matchFaces(runs[b].faces[i], (*reference)[i], counts);
+        std::cout << std::setw(11) << counts.precision() << std::setw(9) << counts.recall()
+                  << std::setw(8) << counts.f1() << std::endl;
+    }
+
+    std::cout << "\nLatency, 1 thread (ms/frame)" << std::endl;
+    std::cout << std::left << std::setw(10) << "backend" << std::right << std::setw(9) << "mean"
+              << std::setw(9) << "p50" << std::setw(9) << "p95" << std::setw(9) << "max" << std::endl;
+    for (size_t b = 0; b < runs.size(); b++) {
+        const std::vector<double>& t = runs[b].times;
+        double mean = 0.0;
+        for (size_t i = 0; i < t.size(); i++) mean += t[i];
+        mean /= (double) t.size();
+        std::cout << std::left << std::setw(10) << faceBackendName(runs[b].type) << std::right
+                  << std::setw(9) << mean << std::setw(9) << percentileMs(t, 50)
+                  << std::setw(9) << percentileMs(t, 95) << std::setw(9) << percentileMs(t, 100) << std::endl;
+    }
+
+    // Frame-parallel: one session per thread as in BatchRunner and StreamScheduler
+    // Intra-frame: one session, OpenCV parallel_for inside detectMultiScale / DNN layers
+    std::vector<int> threadCounts;
+    for (int t = 1; t < maxThreads; t *= 2) threadCounts.push_back(t);
+    threadCounts.push_back(maxThreads);
+
+    std::cout << "\nThread scaling (frames/s)" << std::endl;
+    std::cout << std::left << std::setw(10) << "backend" << std::right << std::setw(9) << "threads"
+              << std::setw(16) << "frame-parallel" << std::setw(9) << "speedup"
+              << std::setw(14) << "intra-frame" << std::setw(9) << "speedup" << std::endl;
+    for (size_t b = 0; b < runs.size(); b++) {
+        double baseFrame = 0.0, baseIntra = 0.0;
+        for (size_t k = 0; k < threadCounts.size(); k++) {
+            std::vector<std::vector<cv::Rect>> faces;
+            double frameFps = frameParallelFps(runs[b], frames, threadCounts[k], loops, faces);
+            double intraFps = intraFrameFps(runs[b], frames, threadCounts[k], loops);
+            if (k == 0) {
+                baseFrame = frameFps;
+                baseIntra = intraFps;
+            }
+            std::cout << std::left << std::setw(10) << faceBackendName(runs[b].type) << std::right
+                      << std::setw(9) << threadCounts[k] << std::setw(16) << frameFps
+                      << std::setw(8) << frameFps / baseFrame << "x" << std::setw(14) << intraFps
+                      << std::setw(8) << intraFps / baseIntra << "x" << std::endl;
+        }
+    }
+
+    if (failures) std::cout << "FAILED: " << failures << " checks" << std::endl;
+    else std::cout << "All checks passed" << std::endl;
+    return failures ? 1 : 0;
+}
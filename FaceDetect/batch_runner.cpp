@@ -0,0 +1,130 @@
+#include "batch_runner.hpp"
+#include <algorithm>
+#include <chrono>
+
+BatchRunner::BatchRunner(const std::string& model, const FaceDetectorParams& params, const BatchConfig& config)
+    : config_(config), pool_(config.workers) {
+    FaceDetectorParams workerParams = params;
+    workerParams.detectWidth = config_.detectWidth;
+    for (int i = 0; i < pool_.threads(); i++) {
+        workers_.emplace_back(new Worker());
+        workers_.back()->session.params() = workerParams;
+        workers_.back()->session.load(model);
+    }
+}
+
+bool BatchRunner::ready() const {
+    for (size_t i = 0; i < workers_.size(); i++) {
+        if (workers_[i]->session.empty()) return false;
+    }
+    return true;
+}
+
+void BatchRunner::planSegments(uint32_t file, const std::string& path) {
+    cv::VideoCapture probe(path);
+    if (!probe.isOpened()) {
+        stats_.unreadable++;
+        return;
+    }
+    int count = (int) probe.get(cv::CAP_PROP_FRAME_COUNT);
+    probe.release();
+
+    // Unknown length (some streams and containers) is read in one piece
+    if (count <= 0) {
+        VideoSegment whole = {file, 0, -1};
+        segments_.push_back(whole);
+        return;
+    }
+
+    int length = config_.segmentFrames;
+    if (length <= 0) length = (count + 4 * pool_.threads() - 1) / (4 * pool_.threads());
+    length = std::max(length, config_.minSegmentFrames);
+    for (int begin = 0; begin < count; begin += length) {
+        // Last segment reads to real end, container frame count is only an estimate
+        VideoSegment segment = {file, begin, begin + length < count ? begin + length : -1};
+        segments_.push_back(segment);
+    }
+}
+
+void BatchRunner::runSegment(const VideoSegment& segment, int worker) {
+    Worker& w = *workers_[worker];
+    w.results.clear();
+
+    cv::VideoCapture cap((*files_)[segment.file]);
+    if (!cap.isOpened()) return;
+
+    // Seek lands on requested frame or decoder position is reported differently,
+    // skip forward by grabbing when it stopped short
+    int position = 0;
+    if (segment.begin > 0) {
+        cap.set(cv::CAP_PROP_POS_FRAMES, segment.begin);
+        position = (int) cap.get(cv::CAP_PROP_POS_FRAMES);
+        if (position != segment.begin) seekMisses_++;
+
+        // Seek went past first frame of segment, nothing before it can be read again:
+        // reopen and grab forward from the start so no frame is lost
+        if (position > segment.begin) {
+            cap.open((*files_)[segment.file]);
+            if (!cap.isOpened()) return;
+            position = 0;
+        }
+        while (position < segment.begin && cap.grab()) position++;
+    }
+
+    uint64_t faces = 0;
+    while (segment.end < 0 || position < segment.end) {
+        if (!cap.read(w.frame)) break;
+
+        FrameFaces result;
+        result.file = segment.file;
+        result.frame = (uint32_t) position;
+        w.session.detect(w.frame, result.faces);
+        faces += result.faces.size();
+        w.results.push_back(std::move(result));
+        position++;
+    }
+
+    sink_->write(w.results);
+    frames_ += w.results.size();
+    faces_ += faces;
+}
+
+bool BatchRunner::run(const std::vector<std::string>& files, FaceSink& sink) {
+    auto start = std::chrono::steady_clock::now();
+    stats_ = BatchStats();
+    stats_.files = files.size();
+    frames_ = 0;
+    faces_ = 0;
+    seekMisses_ = 0;
+
+    segments_.clear();
+    for (size_t i = 0; i < files.size(); i++) planSegments((uint32_t) i, files[i]);
+    stats_.segments = segments_.size();
+    if (segments_.empty()) return false;
+
+    files_ = &files;
+    sink_ = &sink;
+    pool_.run(segments_.size(), [this](size_t item, int worker) {
+        runSegment(segments_[item], worker);
+    });
+    files_ = nullptr;
+    sink_ = nullptr;
+
+    stats_.frames = frames_;
+    stats_.faces = faces_;
+    stats_.seekMisses = seekMisses_;
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    stats_.seconds = elapsed.count();
+    return true;
+}
+
+void BatchRunner::printStats(std::ostream& out) const {
+    out << "Batch: files=" << stats_.files
+        << " unreadable=" << stats_.unreadable
+        << " segments=" << stats_.segments
+        << " seekMisses=" << stats_.seekMisses
+        << " workers=" << pool_.threads() << std::endl;
+    out << "Frames: " << stats_.frames << " faces=" << stats_.faces
+        << " in " << stats_.seconds << " s -> "
+        << (stats_.seconds > 0 ? stats_.frames / stats_.seconds : 0.0) << " frames/s" << std::endl;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/videoio.hpp>
+#include "face_detector_session.hpp"
+#include "face_sink.hpp"
+#include "work_stealing_pool.hpp"
+
+// Offline batch settings
+struct BatchConfig {
+    // Decode and detection threads, 0 uses every hardware thread
+    int workers = 0;
+    // Frames per segment, 0 splits every file into about 4 segments per worker
+    int segmentFrames = 0;
+    // Segments are never shorter than this, seeking restarts decoding at a keyframe
+    int minSegmentFrames = 150;
+    // Frames are downscaled to this width for detection, boxes are reported in source size
+    int detectWidth = 480;
+};
+
+// Contiguous frame range of one input file
+struct VideoSegment {
+    uint32_t file;
+    int begin;
+    // One past last frame, -1 reads until end of file
+    int end;
+};
+
+// Counters of a batch run
+struct BatchStats {
+    uint64_t files = 0;
+    uint64_t unreadable = 0;
+    uint64_t segments = 0;
+    uint64_t frames = 0;
+    uint64_t faces = 0;
+    // Segments whose seek landed on a different frame than requested
+    uint64_t seekMisses = 0;
+    double seconds = 0.0;
+};
+
+// Headless face detection over recorded video files
+// Every file is split into frame ranges, each range is decoded by its own
+// VideoCapture on a work-stealing pool and faces of every frame go to a sink.
+class BatchRunner {
+
+public:
+    BatchRunner(const std::string& model, const FaceDetectorParams& params, const BatchConfig& config = BatchConfig());
+
+    /* Return true if every worker has the model loaded */
+    bool ready() const;
+
+    /* Process files and write per-frame boxes, return false if no file could be read */
+    bool run(const std::vector<std::string>& files, FaceSink& sink);
+
+    const BatchStats& stats() const { return stats_; }
+    void printStats(std::ostream& out) const;
+
+private:
+    /* Split file into segments, frame count comes from container and may be unknown */
+    void planSegments(uint32_t file, const std::string& path);
+
+    /* Decode one segment and detect faces in every frame */
+    void runSegment(const VideoSegment& segment, int worker);
+
+    // Per-worker model and buffers
+    struct Worker {
+        FaceDetectorSession session;
+        cv::Mat frame;
+        std::vector<FrameFaces> results;
+    };
+
+    BatchConfig config_;
+    WorkStealingPool pool_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    const std::vector<std::string>* files_ = nullptr;
+    FaceSink* sink_ = nullptr;
+    std::vector<VideoSegment> segments_;
+    BatchStats stats_;
+
+    // Updated by workers
+    std::atomic<uint64_t> frames_{0};
+    std::atomic<uint64_t> faces_{0};
+    std::atomic<uint64_t> seekMisses_{0};
+};
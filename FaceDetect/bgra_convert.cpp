@@ -0,0 +1,77 @@
+#include "bgra_convert.hpp"
+#include <opencv2/core/hal/intrin.hpp>
+
+// cvtColor BGR2GRAY weights of 8-bit path, fixed point with 15 fractional bits (bit-exact)
+static const int GRAY_SHIFT = 15;
+static const int B2Y = 3735;
+static const int G2Y = 19235;
+static const int R2Y = 9798;
+
+#if CV_SIMD
+// Rounded weighted sum of 16-bit lanes, same rounding as cvtColor
+static inline cv::v_uint16 lumaLanes(const cv::v_uint16& b, const cv::v_uint16& g, const cv::v_uint16& r) {
+    cv::v_uint32 b0, b1, g0, g1, r0, r1;
+    cv::v_mul_expand(b, cv::vx_setall_u16((ushort) B2Y), b0, b1);
+    cv::v_mul_expand(g, cv::vx_setall_u16((ushort) G2Y), g0, g1);
+    cv::v_mul_expand(r, cv::vx_setall_u16((ushort) R2Y), r0, r1);
+    cv::v_uint32 delta = cv::vx_setall_u32(1 << (GRAY_SHIFT - 1));
+    return cv::v_pack((b0 + g0 + r0 + delta) >> GRAY_SHIFT, (b1 + g1 + r1 + delta) >> GRAY_SHIFT);
+}
+#endif
+
+// One row: gray in place, RGB mirrored
+static void convertRow(const uchar* S, int width, uchar* gray, uchar* rgb) {
+    int x = 0;
+#if CV_SIMD
+    const int n = cv::v_uint8::nlanes;
+#if !(CV_NEON || CV_SSSE3)
+    const int q = cv::v_uint32::nlanes;
+    CV_DECL_ALIGNED(CV_SIMD_WIDTH) unsigned reversed[cv::v_uint8::nlanes];
+#endif
+    for (; x <= width - n; x += n) {
+        cv::v_uint8 b, g, r, a;
+        cv::v_load_deinterleave(S + x * 4, b, g, r, a);
+
+        cv::v_uint16 b0, b1, g0, g1, r0, r1;
+        cv::v_expand(b, b0, b1);
+        cv::v_expand(g, g0, g1);
+        cv::v_expand(r, r0, r1);
+        cv::v_store(gray + x, cv::v_pack(lumaLanes(b0, g0, r0), lumaLanes(b1, g1, r1)));
+
+        // Pixels x .. x + n - 1 land reversed at width - x - n .. width - x - 1
+#if CV_NEON || CV_SSSE3
+        cv::v_store_interleave(rgb + (width - x - n) * 3, cv::v_reverse(r), cv::v_reverse(g), cv::v_reverse(b));
+#else
+        // Byte reverse is scalar on plain SSE2: reverse whole 32-bit pixels (one shuffle)
+        // and split the reversed block into channels again from L1
+        for (int k = 0; k < 4; k++) {
+            cv::v_store_aligned(reversed + k * q, cv::v_reverse(cv::vx_load((const unsigned*) (S + x * 4) + (3 - k) * q)));
+        }
+        cv::v_load_deinterleave((const uchar*) reversed, b, g, r, a);
+        cv::v_store_interleave(rgb + (width - x - n) * 3, r, g, b);
+#endif
+    }
+#endif
+    for (; x < width; x++) {
+        const uchar* p = S + x * 4;
+        gray[x] = (uchar) ((p[0] * B2Y + p[1] * G2Y + p[2] * R2Y + (1 << (GRAY_SHIFT - 1))) >> GRAY_SHIFT);
+        uchar* d = rgb + (width - 1 - x) * 3;
+        d[0] = p[2];
+        d[1] = p[1];
+        d[2] = p[0];
+    }
+}
+
+void bgraToGrayMirroredRgb(const uchar* bgra, size_t bgraStep, int width, int height,
+                           uchar* gray, size_t grayStep, uchar* rgb, size_t rgbStep) {
+    for (int y = 0; y < height; y++) {
+        convertRow(bgra + y * bgraStep, width, gray + y * grayStep, rgb + y * rgbStep);
+    }
+}
+
+void bgraToGrayMirroredRgb(const uchar* bgra, size_t bgraStep, int width, int height,
+                           cv::Mat& gray, cv::Mat& rgb) {
+    gray.create(height, width, CV_8UC1);
+    rgb.create(height, width, CV_8UC3);
+    bgraToGrayMirroredRgb(bgra, bgraStep, width, height, gray.data, gray.step, rgb.data, rgb.step);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <opencv2/core.hpp>
+
+// 32BGRA camera buffer to gray detection frame and mirrored RGB display frame in one pass
+//
+// Replaces the iOS sequence CGImage -> UIImage -> UIImageToMat (RGBA copy),
+// cvtColor(RGBA2GRAY), cvtColor(RGBA2RGB) and flip(1): every BGRA pixel is read
+// once with universal intrinsics, gray is written in camera orientation and RGB
+// is written horizontally mirrored for a natural selfie view.
+// Gray equals cvtColor(BGRA2GRAY), RGB equals cvtColor(BGRA2RGB) + flip(1).
+// Alpha is ignored. Rows of every buffer may be padded.
+void bgraToGrayMirroredRgb(const uchar* bgra, size_t bgraStep, int width, int height,
+                           uchar* gray, size_t grayStep, uchar* rgb, size_t rgbStep);
+
+/* Same with Mat outputs, gray and rgb are (re)allocated only when frame size changes */
+void bgraToGrayMirroredRgb(const uchar* bgra, size_t bgraStep, int width, int height,
+                           cv::Mat& gray, cv::Mat& rgb);
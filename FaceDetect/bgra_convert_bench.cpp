@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include "bench_util.hpp"
+#include "bgra_convert.hpp"
+
+// Random 32BGRA buffer with rows padded like CVPixelBufferGetBytesPerRow()
+static cv::Mat syntheticBgra(cv::Size size, int padding, cv::Mat& storage) {
+    storage.create(size.height, size.width * 4 + padding, CV_8UC1);
+    cv::randu(storage, cv::Scalar::all(0), cv::Scalar::all(256));
+    return cv::Mat(size.height, size.width, CV_8UC4, storage.data, storage.step);
+}
+
+// Former iOS path after CGImage / UIImage: UIImageToMat (RGBA copy), RGBA2GRAY, RGBA2RGB, flip
+static void currentSequence(const cv::Mat& bgra, cv::Mat& gray, cv::Mat& rgb) {
+    cv::Mat rgba;
+    cv::cvtColor(bgra, rgba, cv::COLOR_BGRA2RGBA);
+    cv::cvtColor(rgba, gray, cv::COLOR_RGBA2GRAY);
+    cv::cvtColor(rgba, rgb, cv::COLOR_RGBA2RGB);
+    cv::flip(rgb, rgb, 1);
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " [image] [options]\n"
+              << "  image        frame to scale to each resolution (default random)\n"
+              << "  --runs N     timed runs per case, median is reported (default 200)" << std::endl;
+}
+
+// Check fused BGRA -> gray + mirrored RGB kernel against the iOS cvtColor / flip sequence and time both
+int main(int argc, char **argv) {
+
+    std::string input;
+    int runs = 200;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--runs" && i + 1 < argc) runs = std::max(1, std::atoi(argv[++i]));
+        else if (input.empty() && !arg.empty() && arg[0] != '-') input = arg;
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+    cv::Mat image;
+    if (!input.empty()) {
+        image = cv::imread(input);
+        if (image.empty()) {
+            std::cout << "Cannot read " << input << std::endl;
+            return -1;
+        }
+    }
+
+    int failures = 0;
+    std::cout << "Kernel checks" << std::endl;
+    {
+        // Widths below, at and above one SIMD block, padded rows
+        const cv::Size sizes[] = {cv::Size(1, 1), cv::Size(15, 3), cv::Size(16, 4), cv::Size(33, 5),
+                                  cv::Size(641, 37), cv::Size(1280, 720)};
+        bool grayOk = true, rgbOk = true;
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            cv::Mat storage, expectedGray, expectedRgb, gray, rgb;
+            cv::Mat bgra = syntheticBgra(sizes[s], 40, storage);
+            currentSequence(bgra, expectedGray, expectedRgb);
+            bgraToGrayMirroredRgb(bgra.data, bgra.step, bgra.cols, bgra.rows, gray, rgb);
+            grayOk = grayOk && same(gray, expectedGray);
+            rgbOk = rgbOk && same(rgb, expectedRgb);
+        }
+        check(grayOk, "gray equals cvtColor(RGBA2GRAY) of UIImageToMat frame", failures);
+        check(rgbOk, "rgb equals cvtColor(RGBA2RGB) + flip(1)", failures);
+
+        // Padded output rows are written through step
+        cv::Mat storage, expectedGray, expectedRgb;
+        cv::Mat bgra = syntheticBgra(cv::Size(100, 20), 0, storage);
+        currentSequence(bgra, expectedGray, expectedRgb);
+        cv::Mat grayBig(20, 128, CV_8UC1), rgbBig(20, 128, CV_8UC3);
+        cv::Mat gray = grayBig(cv::Rect(0, 0, 100, 20)), rgb = rgbBig(cv::Rect(0, 0, 100, 20));
+        bgraToGrayMirroredRgb(bgra.data, bgra.step, bgra.cols, bgra.rows, gray.data, gray.step, rgb.data, rgb.step);
+        check(same(gray, expectedGray) && same(rgb, expectedRgb), "padded destination rows", failures);
+
+        cv::Mat reusedGray, reusedRgb;
+        bgraToGrayMirroredRgb(bgra.data, bgra.step, bgra.cols, bgra.rows, reusedGray, reusedRgb);
+        const uchar* g = reusedGray.data;
+        const uchar* c = reusedRgb.data;
+        bgraToGrayMirroredRgb(bgra.data, bgra.step, bgra.cols, bgra.rows, reusedGray, reusedRgb);
+        check(reusedGray.data == g && reusedRgb.data == c, "output buffers reused between frames", failures);
+    }
+
+    const cv::Size resolutions[] = {cv::Size(640, 480), cv::Size(1280, 720), cv::Size(1920, 1080)};
+    std::cout << std::endl << std::left << std::setw(12) << "source" << std::right
+              << std::setw(12) << "sequence" << std::setw(12) << "fused" << std::setw(10) << "speedup"
+              << "  (ms, median)" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    for (size_t r = 0; r < sizeof(resolutions) / sizeof(resolutions[0]); r++) {
+        cv::Mat storage;
+        cv::Mat bgra = syntheticBgra(resolutions[r], 0, storage);
+        if (!image.empty()) {
+            cv::Mat resized;
+            cv::resize(image, resized, resolutions[r], 0, 0, cv::INTER_LINEAR);
+            cv::cvtColor(resized, bgra, cv::COLOR_BGR2BGRA);
+        }
+
+        cv::Mat gray, rgb;
+        double sequenceMs = medianMs(runs, [&]() { currentSequence(bgra, gray, rgb); });
+        cv::Mat fusedGray, fusedRgb;
+        double fusedMs = medianMs(runs, [&]() {
+            bgraToGrayMirroredRgb(bgra.data, bgra.step, bgra.cols, bgra.rows, fusedGray, fusedRgb);
+        });
+
+        std::ostringstream source;
+        source << bgra.cols << "x" << bgra.rows;
+        std::cout << std::left << std::setw(12) << source.str() << std::right
+                  << std::setw(12) << sequenceMs << std::setw(12) << fusedMs
+                  << std::setw(9) << sequenceMs / fusedMs << "x" << std::endl;
+    }
+
+    if (failures) std::cout << "FAILED: " << failures << " checks" << std::endl;
+    else std::cout << "All checks passed" << std::endl;
+    return failures ? 1 : 0;
+}
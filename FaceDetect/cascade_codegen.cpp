@@ -0,0 +1,118 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "cascade_model.hpp"
+
+// Float literal which reads back to exactly the same value
+static std::string floatLiteral(float v) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.9g", v);
+    std::string s = buf;
+    if (s.find_first_of(".en") == std::string::npos) s += ".0";
+    return s + "f";
+}
+
+static void writeArray(std::ostream& out, const char* type, const char* name, const int32_t* values, size_t count) {
+    out << "constexpr " << type << " " << name << "[" << count << "] = {";
+    for (size_t i = 0; i < count; i++) {
+        out << (i % 16 == 0 ? "\n    " : " ") << values[i] << (i + 1 < count ? "," : "");
+    }
+    out << "\n};\n\n";
+}
+
+static void writeArray(std::ostream& out, const char* type, const char* name, const float* values, size_t count) {
+    out << "constexpr " << type << " " << name << "[" << count << "] = {";
+    for (size_t i = 0; i < count; i++) {
+        out << (i % 8 == 0 ? "\n    " : " ") << floatLiteral(values[i]) << (i + 1 < count ? "," : "");
+    }
+    out << "\n};\n\n";
+}
+
+// Generate header with binary cascade as constexpr tables and a traits struct for HaarCascadeDetector
+int main(int argc, char **argv) {
+
+    if (argc != 4) {
+        std::cout << "Usage: " << argv[0] << " <cascade.bin> <output.hpp> <StructName>" << std::endl;
+        std::cout << "  cascade.bin is written by cascade_convert" << std::endl;
+        return -1;
+    }
+    std::string binPath = argv[1];
+    std::string hppPath = argv[2];
+    std::string name = argv[3];
+
+    CascadeModel model;
+    if (!model.map(binPath)) {
+        std::cout << "Cannot map binary cascade " << binPath << std::endl;
+        return -1;
+    }
+    const CascadeBinaryHeader& h = model.header();
+    for (uint32_t i = 0; i < h.featureCount; i++) {
+        if (model.featureTilted()[i]) {
+            std::cout << "Tilted features are not supported" << std::endl;
+            return -1;
+        }
+    }
+
+    size_t rects = (size_t) h.featureCount * CASCADE_RECTS_PER_FEATURE;
+    std::string ns = name + "_tables";
+    const char* file = std::strrchr(binPath.c_str(), '/');
+
+    std::ostringstream out;
+    out << "#pragma once\n\n";
+    out << "// Generated by cascade_codegen from " << (file ? file + 1 : binPath.c_str()) << ", do not edit\n";
+    out << "// window " << h.windowWidth << "x" << h.windowHeight << ", " << h.stageCount << " stages, "
+        << h.weakCount << " weak classifiers, " << h.featureCount << " features\n\n";
+    out << "#include <cstdint>\n\n";
+
+    out << "namespace " << ns << " {\n\n";
+    writeArray(out, "float", "stageThreshold", model.stageThreshold(), h.stageCount);
+    writeArray(out, "int32_t", "stageWeakBegin", model.stageWeakBegin(), h.stageCount + 1);
+    writeArray(out, "int32_t", "weakNodeBegin", model.weakNodeBegin(), h.weakCount + 1);
+    writeArray(out, "int32_t", "weakLeafBegin", model.weakLeafBegin(), h.weakCount + 1);
+    writeArray(out, "int32_t", "nodeLeft", model.nodeLeft(), h.nodeCount);
+    writeArray(out, "int32_t", "nodeRight", model.nodeRight(), h.nodeCount);
+    writeArray(out, "int32_t", "nodeFeature", model.nodeFeature(), h.nodeCount);
+    writeArray(out, "float", "nodeThreshold", model.nodeThreshold(), h.nodeCount);
+    writeArray(out, "float", "leafValue", model.leafValue(), h.leafCount);
+    writeArray(out, "int32_t", "rectX", model.rectX(), rects);
+    writeArray(out, "int32_t", "rectY", model.rectY(), rects);
+    writeArray(out, "int32_t", "rectWidth", model.rectWidth(), rects);
+    writeArray(out, "int32_t", "rectHeight", model.rectHeight(), rects);
+    writeArray(out, "float", "rectWeight", model.rectWeight(), rects);
+    out << "} // namespace " << ns << "\n\n";
+
+    // Traits read by HaarCascadeDetector at compile time
+    out << "struct " << name << " {\n";
+    out << "    enum {\n";
+    out << "        windowWidth = " << h.windowWidth << ",\n";
+    out << "        windowHeight = " << h.windowHeight << ",\n";
+    out << "        stageCount = " << h.stageCount << ",\n";
+    out << "        weakCount = " << h.weakCount << ",\n";
+    out << "        featureCount = " << h.featureCount << "\n";
+    out << "    };\n";
+    const char* accessors[][2] = {
+        {"float", "stageThreshold"}, {"int", "stageWeakBegin"},
+        {"int", "weakNodeBegin"}, {"int", "weakLeafBegin"},
+        {"int", "nodeLeft"}, {"int", "nodeRight"}, {"int", "nodeFeature"}, {"float", "nodeThreshold"},
+        {"float", "leafValue"},
+        {"int", "rectX"}, {"int", "rectY"}, {"int", "rectWidth"}, {"int", "rectHeight"}, {"float", "rectWeight"},
+    };
+    for (size_t i = 0; i < sizeof(accessors) / sizeof(accessors[0]); i++) {
+        out << "    static constexpr " << accessors[i][0] << " " << accessors[i][1]
+            << "(int i) { return " << ns << "::" << accessors[i][1] << "[i]; }\n";
+    }
+    out << "};\n";
+
+    std::ofstream file_out(hppPath);
+    file_out << out.str();
+    file_out.close();
+    if (!file_out) {
+        std::cout << "Cannot write " << hppPath << std::endl;
+        return -1;
+    }
+    std::cout << hppPath << ": " << name << " with " << h.stageCount << " stages, "
+              << h.weakCount << " weak classifiers" << std::endl;
+    return 0;
+}
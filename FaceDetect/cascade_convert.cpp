@@ -0,0 +1,45 @@
+#include <fstream>
+#include <iostream>
+#include "cascade_model.hpp"
+
+// Convert Haar Cascade .xml model to binary format which is loaded with mmap
+int main(int argc, char **argv) {
+
+    if (argc != 3) {
+        std::cout << "Usage: " << argv[0] << " <cascade.xml> <cascade.bin>" << std::endl;
+        return -1;
+    }
+    std::string xmlPath = argv[1];
+    std::string binPath = argv[2];
+
+    // Parse XML once and flatten it
+    std::vector<uint8_t> blob;
+    std::string error;
+    if (!CascadeModel::convertXml(xmlPath, blob, error)) {
+        std::cout << "Cannot convert " << xmlPath << ": " << error << std::endl;
+        return -1;
+    }
+
+    std::ofstream out(binPath, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(blob.data()), (std::streamsize) blob.size());
+    out.close();
+    if (!out) {
+        std::cout << "Cannot write " << binPath << std::endl;
+        return -1;
+    }
+
+    // Map written file back to make sure it is loadable
+    CascadeModel model;
+    if (!model.map(binPath)) {
+        std::cout << "Written file cannot be mapped: " << binPath << std::endl;
+        return -1;
+    }
+    const CascadeBinaryHeader& h = model.header();
+    std::cout << binPath << ": window=" << h.windowWidth << "x" << h.windowHeight
+              << " stages=" << h.stageCount
+              << " weak=" << h.weakCount
+              << " nodes=" << h.nodeCount
+              << " features=" << h.featureCount
+              << " size=" << h.fileSize << " bytes" << std::endl;
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <opencv2/core.hpp>
+#include <opencv2/objdetect.hpp>
+#include "bench_util.hpp"
+#include "cascade_model.hpp"
+
+// Print min / median / mean of measured load times
+static void report(const std::string& name, std::vector<double> times) {
+    std::sort(times.begin(), times.end());
+    double mean = 0.0;
+    for (size_t i = 0; i < times.size(); i++) mean += times[i];
+    mean /= (double) times.size();
+    std::cout << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(4)
+              << " min " << std::setw(10) << times.front() << " ms"
+              << "  median " << std::setw(10) << times[times.size() / 2] << " ms"
+              << "  mean " << std::setw(10) << mean << " ms" << std::endl;
+}
+
+// Read one element per 4 KB page of array, and its last element
+template <typename T>
+static uint32_t touch(const T* data, uint32_t count) {
+    const uint32_t step = 4096 / sizeof(T);
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < count; i += step) sum += (uint32_t) data[i];
+    if (count > 0) sum += (uint32_t) data[count - 1];
+    return sum;
+}
+
+// Compare startup cost of the three ways to get a cascade model into memory
+int main(int argc, char **argv) {
+
+    if (argc < 3) {
+        std::cout << "Usage: " << argv[0] << " <cascade.xml> <cascade.bin> [runs]" << std::endl;
+        return -1;
+    }
+    std::string xmlPath = argv[1];
+    std::string binPath = argv[2];
+    int runs = argc > 3 ? std::max(1, std::atoi(argv[3])) : 20;
+
+    // XML text kept in memory so FileStorage case measures parsing only
+    std::ifstream in(xmlPath);
+    std::stringstream text;
+    text << in.rdbuf();
+    std::string xmlText = text.str();
+    if (xmlText.empty()) {
+        std::cout << "Cannot read " << xmlPath << std::endl;
+        return -1;
+    }
+
+    std::vector<double> xmlLoad, storageLoad, mmapLoad, mmapTouch;
+    volatile uint32_t sink = 0;
+    for (int i = 0; i < runs; i++) {
+        // 1. CascadeClassifier::load() as used by every call site today
+        auto start = std::chrono::steady_clock::now();
+        cv::CascadeClassifier xmlDetector;
+        if (!xmlDetector.load(xmlPath)) {
+            std::cout << "Cannot load " << xmlPath << std::endl;
+            return -1;
+        }
+        xmlLoad.push_back(elapsedMs(start));
+
+        // 2. FileStorage parsing XML from memory buffer
+        start = std::chrono::steady_clock::now();
+        cv::FileStorage fs(xmlText, cv::FileStorage::READ | cv::FileStorage::MEMORY);
+        cv::CascadeClassifier storageDetector;
+        storageDetector.read(fs.getFirstTopLevelNode());
+        storageLoad.push_back(elapsedMs(start));
+
+        // 3. mmap of binary model, no parsing at all
+        start = std::chrono::steady_clock::now();
+        CascadeModel model;
+        if (!model.map(binPath)) {
+            std::cout << "Cannot map " << binPath << ", create it with cascade_convert" << std::endl;
+            return -1;
+        }
+        mmapLoad.push_back(elapsedMs(start));
+
+        // Touch every page of every array so lazy page-in is included as well
+        const CascadeBinaryHeader& h = model.header();
+        const uint32_t rects = h.featureCount * CASCADE_RECTS_PER_FEATURE;
+        uint32_t sum = 0;
+        sum += touch(model.stageThreshold(), h.stageCount) + touch(model.stageWeakBegin(), h.stageCount + 1);
+        sum += touch(model.weakNodeBegin(), h.weakCount + 1) + touch(model.weakLeafBegin(), h.weakCount + 1);
+        sum += touch(model.nodeLeft(), h.nodeCount) + touch(model.nodeRight(), h.nodeCount);
+        sum += touch(model.nodeFeature(), h.nodeCount) + touch(model.nodeThreshold(), h.nodeCount);
+        sum += touch(model.leafValue(), h.leafCount) + touch(model.featureTilted(), h.featureCount);
+        sum += touch(model.rectX(), rects) + touch(model.rectY(), rects) + touch(model.rectWidth(), rects);
+        sum += touch(model.rectHeight(), rects) + touch(model.rectWeight(), rects);
+        sink = sink + sum;
+        mmapTouch.push_back(elapsedMs(start));
+    }
+
+    std::cout << "Cascade load time over " << runs << " runs" << std::endl;
+    report("CascadeClassifier::load", xmlLoad);
+    report("FileStorage (memory)", storageLoad);
+    // CascadeModel is the mapped file only, these rows do not include building a detector from it
+    report("mmap (map only, not a loaded detector)", mmapLoad);
+    report("mmap + page-in (map only)", mmapTouch);
+    return 0;
+}
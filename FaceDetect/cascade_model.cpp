@@ -0,0 +1,232 @@
+#include "cascade_model.hpp"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <opencv2/core.hpp>
+
+static const char CASCADE_MAGIC[8] = {'H', 'A', 'A', 'R', 'B', 'I', 'N', '\0'};
+static const uint32_t CASCADE_ENDIAN_TAG = 0x01020304;
+
+// Same epsilon CascadeClassifier subtracts from stage thresholds when reading XML
+static const float THRESHOLD_EPS = 1e-5f;
+
+CascadeModel::~CascadeModel() {
+    release();
+}
+
+void CascadeModel::release() {
+    if (mapped_) munmap(mapped_, mappedSize_);
+    mapped_ = NULL;
+    mappedSize_ = 0;
+    owned_.clear();
+    header_ = NULL;
+    data_ = NULL;
+    size_ = 0;
+}
+
+// Return true if count elements of 4 bytes at ofs fit in blob
+static bool inside(uint32_t ofs, size_t count, size_t size) {
+    return ofs % 4 == 0 && ofs <= size && count <= (size - ofs) / 4;
+}
+
+bool CascadeModel::bind(const uint8_t* data, size_t size) {
+    if (data == NULL || size < sizeof(CascadeBinaryHeader)) return false;
+    if (reinterpret_cast<uintptr_t>(data) % 4 != 0) return false;
+
+    const CascadeBinaryHeader* h = reinterpret_cast<const CascadeBinaryHeader*>(data);
+    if (std::memcmp(h->magic, CASCADE_MAGIC, sizeof(CASCADE_MAGIC)) != 0) return false;
+    if (h->version != CASCADE_BINARY_VERSION || h->endianTag != CASCADE_ENDIAN_TAG) return false;
+    if (h->fileSize > size || h->windowWidth <= 0 || h->windowHeight <= 0) return false;
+
+    // Only array bounds are checked here, indices inside arrays were validated by converter
+    size_t S = h->stageCount, W = h->weakCount, N = h->nodeCount, L = h->leafCount;
+    size_t R = (size_t) h->featureCount * CASCADE_RECTS_PER_FEATURE;
+    if (!inside(h->stageThresholdOfs, S, size) || !inside(h->stageWeakBeginOfs, S + 1, size) ||
+        !inside(h->weakNodeBeginOfs, W + 1, size) || !inside(h->weakLeafBeginOfs, W + 1, size) ||
+        !inside(h->nodeLeftOfs, N, size) || !inside(h->nodeRightOfs, N, size) ||
+        !inside(h->nodeFeatureOfs, N, size) || !inside(h->nodeThresholdOfs, N, size) ||
+        !inside(h->leafValueOfs, L, size) || !inside(h->featureTiltedOfs, h->featureCount, size) ||
+        !inside(h->rectXOfs, R, size) || !inside(h->rectYOfs, R, size) ||
+        !inside(h->rectWidthOfs, R, size) || !inside(h->rectHeightOfs, R, size) ||
+        !inside(h->rectWeightOfs, R, size)) {
+        return false;
+    }
+
+    header_ = h;
+    data_ = data;
+    size_ = size;
+    return true;
+}
+
+bool CascadeModel::map(const std::string& path) {
+    release();
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    size_t size = (size_t) st.st_size;
+    void* addr = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // Mapping stays valid after descriptor is closed
+    close(fd);
+    if (addr == MAP_FAILED) return false;
+
+    mapped_ = addr;
+    mappedSize_ = size;
+    if (!bind(static_cast<const uint8_t*>(addr), size)) {
+        release();
+        return false;
+    }
+    return true;
+}
+
+bool CascadeModel::attach(const void* data, size_t size) {
+    release();
+    return bind(static_cast<const uint8_t*>(data), size);
+}
+
+bool CascadeModel::assign(std::vector<uint8_t> blob) {
+    release();
+    owned_.swap(blob);
+    if (!bind(owned_.data(), owned_.size())) {
+        release();
+        return false;
+    }
+    return true;
+}
+
+// Append array to blob on 16-byte boundary, return its offset
+template <typename T>
+static uint32_t appendArray(std::vector<uint8_t>& blob, const std::vector<T>& values) {
+    blob.resize((blob.size() + 15) & ~(size_t) 15, 0);
+    uint32_t ofs = (uint32_t) blob.size();
+    if (!values.empty()) {
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(values.data());
+        blob.insert(blob.end(), p, p + values.size() * sizeof(T));
+    }
+    return ofs;
+}
+
+bool CascadeModel::convertXml(const std::string& xmlPath, std::vector<uint8_t>& blob, std::string& error) {
+    cv::FileStorage fs(xmlPath, cv::FileStorage::READ);
+    if (!fs.isOpened()) {
+        error = "cannot open " + xmlPath;
+        return false;
+    }
+    cv::FileNode root = fs.getFirstTopLevelNode();
+    if ((std::string) root["stageType"] != "BOOST" || (std::string) root["featureType"] != "HAAR") {
+        error = "only BOOST/HAAR cascades in new XML format are supported";
+        return false;
+    }
+    if ((int) root["featureParams"]["maxCatCount"] != 0) {
+        error = "categorical features are not supported";
+        return false;
+    }
+
+    std::vector<float> stageThreshold, nodeThreshold, leafValue, rectWeight;
+    std::vector<int32_t> stageWeakBegin, weakNodeBegin, weakLeafBegin;
+    std::vector<int32_t> nodeLeft, nodeRight, nodeFeature;
+    std::vector<int32_t> featureTilted, rectX, rectY, rectWidth, rectHeight;
+
+    // Stages, weak trees, nodes and leaves in CascadeClassifier order
+    cv::FileNode stages = root["stages"];
+    for (cv::FileNodeIterator it = stages.begin(); it != stages.end(); ++it) {
+        stageThreshold.push_back((float) (*it)["stageThreshold"] - THRESHOLD_EPS);
+        stageWeakBegin.push_back((int32_t) weakNodeBegin.size());
+
+        cv::FileNode weaks = (*it)["weakClassifiers"];
+        for (cv::FileNodeIterator wt = weaks.begin(); wt != weaks.end(); ++wt) {
+            cv::FileNode internalNodes = (*wt)["internalNodes"];
+            cv::FileNode leafValues = (*wt)["leafValues"];
+            if (internalNodes.size() % 4 != 0 || leafValues.size() != internalNodes.size() / 4 + 1) {
+                error = "malformed weak classifier";
+                return false;
+            }
+            weakNodeBegin.push_back((int32_t) nodeLeft.size());
+            weakLeafBegin.push_back((int32_t) leafValue.size());
+
+            for (cv::FileNodeIterator nt = internalNodes.begin(); nt != internalNodes.end(); ) {
+                nodeLeft.push_back((int) *nt); ++nt;
+                nodeRight.push_back((int) *nt); ++nt;
+                nodeFeature.push_back((int) *nt); ++nt;
+                nodeThreshold.push_back((float) *nt); ++nt;
+            }
+            for (cv::FileNodeIterator lt = leafValues.begin(); lt != leafValues.end(); ++lt) {
+                leafValue.push_back((float) *lt);
+            }
+        }
+    }
+    stageWeakBegin.push_back((int32_t) weakNodeBegin.size());
+    weakNodeBegin.push_back((int32_t) nodeLeft.size());
+    weakLeafBegin.push_back((int32_t) leafValue.size());
+
+    // Features, unused rectangles are stored with zero weight
+    cv::FileNode features = root["features"];
+    for (cv::FileNodeIterator it = features.begin(); it != features.end(); ++it) {
+        cv::FileNode rects = (*it)["rects"];
+        if (rects.size() == 0 || rects.size() > (size_t) CASCADE_RECTS_PER_FEATURE) {
+            error = "feature must have 1 to 3 rectangles";
+            return false;
+        }
+        featureTilted.push_back((int) (*it)["tilted"] != 0);
+        for (int ri = 0; ri < CASCADE_RECTS_PER_FEATURE; ri++) {
+            int x = 0, y = 0, w = 0, h = 0;
+            float weight = 0.f;
+            if (ri < (int) rects.size()) {
+                cv::FileNodeIterator rt = rects[ri].begin();
+                rt >> x >> y >> w >> h >> weight;
+            }
+            rectX.push_back(x);
+            rectY.push_back(y);
+            rectWidth.push_back(w);
+            rectHeight.push_back(h);
+            rectWeight.push_back(weight);
+        }
+    }
+
+    // Indices are checked once here so loading can skip it
+    for (size_t i = 0; i < nodeFeature.size(); i++) {
+        if (nodeFeature[i] < 0 || nodeFeature[i] >= (int32_t) featureTilted.size()) {
+            error = "node refers to missing feature";
+            return false;
+        }
+    }
+
+    CascadeBinaryHeader h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, CASCADE_MAGIC, sizeof(CASCADE_MAGIC));
+    h.version = CASCADE_BINARY_VERSION;
+    h.endianTag = CASCADE_ENDIAN_TAG;
+    h.windowWidth = (int) root["width"];
+    h.windowHeight = (int) root["height"];
+    h.stageCount = (uint32_t) stageThreshold.size();
+    h.weakCount = (uint32_t) weakNodeBegin.size() - 1;
+    h.nodeCount = (uint32_t) nodeLeft.size();
+    h.leafCount = (uint32_t) leafValue.size();
+    h.featureCount = (uint32_t) featureTilted.size();
+
+    blob.assign(sizeof(CascadeBinaryHeader), 0);
+    h.stageThresholdOfs = appendArray(blob, stageThreshold);
+    h.stageWeakBeginOfs = appendArray(blob, stageWeakBegin);
+    h.weakNodeBeginOfs = appendArray(blob, weakNodeBegin);
+    h.weakLeafBeginOfs = appendArray(blob, weakLeafBegin);
+    h.nodeLeftOfs = appendArray(blob, nodeLeft);
+    h.nodeRightOfs = appendArray(blob, nodeRight);
+    h.nodeFeatureOfs = appendArray(blob, nodeFeature);
+    h.nodeThresholdOfs = appendArray(blob, nodeThreshold);
+    h.leafValueOfs = appendArray(blob, leafValue);
+    h.featureTiltedOfs = appendArray(blob, featureTilted);
+    h.rectXOfs = appendArray(blob, rectX);
+    h.rectYOfs = appendArray(blob, rectY);
+    h.rectWidthOfs = appendArray(blob, rectWidth);
+    h.rectHeightOfs = appendArray(blob, rectHeight);
+    h.rectWeightOfs = appendArray(blob, rectWeight);
+    h.fileSize = (uint32_t) blob.size();
+    std::memcpy(blob.data(), &h, sizeof(h));
+    return true;
+}
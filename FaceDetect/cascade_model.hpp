@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Binary Haar Cascade model
+//
+// The cascade is stored as flat structure-of-arrays so it can be used
+// straight from a memory mapped file without any parsing:
+//
+//   header | stages | weak classifiers | tree nodes | leaves | features
+//
+// Every array starts on a 16-byte boundary, offsets in header are counted
+// from start of file. Values are little endian, indices are int32, thresholds
+// and weights are float32 exactly as CascadeClassifier keeps them in memory
+// (stage thresholds already include CascadeClassifier's 1e-5 epsilon).
+
+// Haar features have at most 3 weighted rectangles
+const int CASCADE_RECTS_PER_FEATURE = 3;
+
+struct CascadeBinaryHeader {
+    char magic[8];              // "HAARBIN\0"
+    uint32_t version;
+    uint32_t endianTag;         // 0x01020304 written in native order
+    uint32_t fileSize;
+
+    int32_t windowWidth;
+    int32_t windowHeight;
+
+    uint32_t stageCount;
+    uint32_t weakCount;
+    uint32_t nodeCount;
+    uint32_t leafCount;
+    uint32_t featureCount;
+
+    // stages: float threshold[S], int32 firstWeak[S + 1]
+    uint32_t stageThresholdOfs;
+    uint32_t stageWeakBeginOfs;
+    // weak classifiers: int32 firstNode[W + 1], int32 firstLeaf[W + 1]
+    uint32_t weakNodeBeginOfs;
+    uint32_t weakLeafBeginOfs;
+    // tree nodes: int32 left[N], int32 right[N], int32 feature[N], float threshold[N]
+    uint32_t nodeLeftOfs;
+    uint32_t nodeRightOfs;
+    uint32_t nodeFeatureOfs;
+    uint32_t nodeThresholdOfs;
+    // leaves: float value[L]
+    uint32_t leafValueOfs;
+    // features: int32 tilted[F], int32 x/y/width/height[3F], float weight[3F]
+    uint32_t featureTiltedOfs;
+    uint32_t rectXOfs;
+    uint32_t rectYOfs;
+    uint32_t rectWidthOfs;
+    uint32_t rectHeightOfs;
+    uint32_t rectWeightOfs;
+};
+
+const uint32_t CASCADE_BINARY_VERSION = 1;
+
+// Read-only view over a binary cascade
+// Memory comes from mmap, from a caller buffer or from an owned copy
+class CascadeModel {
+
+public:
+    CascadeModel() = default;
+    ~CascadeModel();
+
+    CascadeModel(const CascadeModel&) = delete;
+    CascadeModel& operator=(const CascadeModel&) = delete;
+
+    /* Memory map binary cascade file, no data is copied or parsed */
+    bool map(const std::string& path);
+
+    /* Use binary cascade already in memory, data must outlive the model */
+    bool attach(const void* data, size_t size);
+
+    /* Keep own copy of binary cascade */
+    bool assign(std::vector<uint8_t> blob);
+
+    /* Convert XML cascade (new "opencv-cascade-classifier" format) to binary blob */
+    static bool convertXml(const std::string& xmlPath, std::vector<uint8_t>& blob, std::string& error);
+
+    void release();
+    bool empty() const { return header_ == NULL; }
+
+    const CascadeBinaryHeader& header() const { return *header_; }
+    int windowWidth() const { return header_->windowWidth; }
+    int windowHeight() const { return header_->windowHeight; }
+    int stageCount() const { return (int) header_->stageCount; }
+    int featureCount() const { return (int) header_->featureCount; }
+
+    // Structure-of-arrays accessors
+    const float* stageThreshold() const { return array<float>(header_->stageThresholdOfs); }
+    const int32_t* stageWeakBegin() const { return array<int32_t>(header_->stageWeakBeginOfs); }
+    const int32_t* weakNodeBegin() const { return array<int32_t>(header_->weakNodeBeginOfs); }
+    const int32_t* weakLeafBegin() const { return array<int32_t>(header_->weakLeafBeginOfs); }
+    const int32_t* nodeLeft() const { return array<int32_t>(header_->nodeLeftOfs); }
+    const int32_t* nodeRight() const { return array<int32_t>(header_->nodeRightOfs); }
+    const int32_t* nodeFeature() const { return array<int32_t>(header_->nodeFeatureOfs); }
+    const float* nodeThreshold() const { return array<float>(header_->nodeThresholdOfs); }
+    const float* leafValue() const { return array<float>(header_->leafValueOfs); }
+    const int32_t* featureTilted() const { return array<int32_t>(header_->featureTiltedOfs); }
+    const int32_t* rectX() const { return array<int32_t>(header_->rectXOfs); }
+    const int32_t* rectY() const { return array<int32_t>(header_->rectYOfs); }
+    const int32_t* rectWidth() const { return array<int32_t>(header_->rectWidthOfs); }
+    const int32_t* rectHeight() const { return array<int32_t>(header_->rectHeightOfs); }
+    const float* rectWeight() const { return array<float>(header_->rectWeightOfs); }
+
+private:
+    /* Check header and that every array lies inside the blob */
+    bool bind(const uint8_t* data, size_t size);
+
+    template <typename T>
+    const T* array(uint32_t ofs) const { return reinterpret_cast<const T*>(data_ + ofs); }
+
+    const CascadeBinaryHeader* header_ = NULL;
+    const uint8_t* data_ = NULL;
+    size_t size_ = 0;
+
+    // mmap region, unmapped in release()
+    void* mapped_ = NULL;
+    size_t mappedSize_ = 0;
+    // owned copy from assign()
+    std::vector<uint8_t> owned_;
+};
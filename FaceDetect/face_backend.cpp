@@ -0,0 +1,100 @@
+#include "face_backend.hpp"
+
+std::unique_ptr<FaceBackend> FaceBackend::create(FaceBackendType type) {
+    switch (type) {
+        case FaceBackendType::YuNet: return std::unique_ptr<FaceBackend>(new YuNetFaceBackend());
+        case FaceBackendType::Haar: break;
+    }
+    return std::unique_ptr<FaceBackend>(new HaarFaceBackend());
+}
+
+bool HaarFaceBackend::load(const std::string& model) {
+    return detector_.load(model);
+}
+
+bool HaarFaceBackend::load(const void* data, size_t size) {
+    detector_ = cv::CascadeClassifier();
+    if (data == NULL || size == 0) return false;
+
+    // FileStorage parses XML straight from memory, same as CascadeClassifier::load() does after reading file
+    cv::FileStorage fs(std::string(static_cast<const char*>(data), size),
+                       cv::FileStorage::READ | cv::FileStorage::MEMORY);
+    return fs.isOpened() && detector_.read(fs.getFirstTopLevelNode());
+}
+
+bool HaarFaceBackend::empty() const {
+    return detector_.empty();
+}
+
+void HaarFaceBackend::detect(const cv::Mat& image, const FaceDetectorParams& params,
+                             cv::Size minSize, cv::Size maxSize, std::vector<cv::Rect>& faces) {
+    detector_.detectMultiScale(image, faces, params.scaleFactor, params.minNeighbors,
+                               params.flags, minSize, maxSize);
+}
+
+bool YuNetFaceBackend::load(const std::string& model) {
+    detector_.release();
+    inputSize_ = cv::Size();
+    try {
+        // Input size is set on first frame
+        detector_ = cv::FaceDetectorYN::create(model, "", cv::Size(320, 320));
+    }
+    catch (const cv::Exception&) {
+        detector_.release();
+    }
+    return !detector_.empty();
+}
+
+bool YuNetFaceBackend::load(const void*, size_t) {
+    // FaceDetectorYN::create() from buffer only exists since OpenCV 4.7
+    detector_.release();
+    return false;
+}
+
+bool YuNetFaceBackend::empty() const {
+    return detector_.empty();
+}
+
+void YuNetFaceBackend::detect(const cv::Mat& image, const FaceDetectorParams& params,
+                              cv::Size minSize, cv::Size maxSize, std::vector<cv::Rect>& faces) {
+    faces.clear();
+    if (image.size() != inputSize_) {
+        inputSize_ = image.size();
+        detector_->setInputSize(inputSize_);
+    }
+    if (params.scoreThreshold != scoreThreshold_) {
+        scoreThreshold_ = params.scoreThreshold;
+        detector_->setScoreThreshold(scoreThreshold_);
+    }
+    if (params.nmsThreshold != nmsThreshold_) {
+        nmsThreshold_ = params.nmsThreshold;
+        detector_->setNMSThreshold(nmsThreshold_);
+    }
+
+    detector_->detect(image, found_);
+
+    // Same size limits as detectMultiScale(), box is clipped to image
+    cv::Rect bounds(0, 0, image.cols, image.rows);
+    for (int i = 0; i < found_.rows; i++) {
+        const float* row = found_.ptr<float>(i);
+        cv::Rect box = cv::Rect(cvRound(row[0]), cvRound(row[1]), cvRound(row[2]), cvRound(row[3])) & bounds;
+        if (box.width < minSize.width || box.height < minSize.height) continue;
+        if (maxSize.width > 0 && maxSize.height > 0 && (box.width > maxSize.width || box.height > maxSize.height)) continue;
+        faces.push_back(box);
+    }
+}
+
+const char* faceBackendName(FaceBackendType type) {
+    switch (type) {
+        case FaceBackendType::YuNet: return "yunet";
+        case FaceBackendType::Haar: break;
+    }
+    return "haar";
+}
+
+bool parseFaceBackend(const std::string& name, FaceBackendType& type) {
+    if (name == "haar") type = FaceBackendType::Haar;
+    else if (name == "yunet") type = FaceBackendType::YuNet;
+    else return false;
+    return true;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/objdetect.hpp>
+
+// Face detection models a session can run
+enum class FaceBackendType { Haar, YuNet };
+
+// Pixel layout a backend detects on, session converts frames into it
+enum class FaceBackendInput { Gray, BGR };
+
+// Detection parameters passed to backend
+struct FaceDetectorParams {
+    // Model run by FaceDetectorSession, Haar Cascade .xml or YuNet .onnx
+    FaceBackendType backend = FaceBackendType::Haar;
+    // Haar Cascade parameters passed to detectMultiScale()
+    double scaleFactor = 1.1;
+    int minNeighbors = 7;
+    int flags = cv::CASCADE_SCALE_IMAGE;
+    // Face size limits of every backend
+    cv::Size minSize = cv::Size(30, 30);
+    cv::Size maxSize = cv::Size();
+    // YuNet confidence and NMS IoU thresholds
+    float scoreThreshold = 0.9f;
+    float nmsThreshold = 0.3f;
+    // Downscale frame to this width before detection, 0 keeps input size
+    // Note: minSize and maxSize are measured in downscaled frame
+    int detectWidth = 0;
+};
+
+// Face detection model behind FaceDetectorSession
+// Session owns the frame buffers and does resize, color conversion and box
+// mapping, backend only sees the prepared image in its input() layout.
+// A backend instance must only be used by one thread at a time.
+class FaceBackend {
+
+public:
+    virtual ~FaceBackend() {}
+
+    virtual FaceBackendType type() const = 0;
+    virtual FaceBackendInput input() const = 0;
+
+    /* Load model file, return false if it cannot be parsed */
+    virtual bool load(const std::string& model) = 0;
+
+    /* Load model from memory, data may be released after return */
+    virtual bool load(const void* data, size_t size) = 0;
+
+    /* Return true if no model is loaded */
+    virtual bool empty() const = 0;
+
+    /* Detect faces between minSize and maxSize in prepared image, boxes in image coordinates */
+    virtual void detect(const cv::Mat& image, const FaceDetectorParams& params,
+                        cv::Size minSize, cv::Size maxSize, std::vector<cv::Rect>& faces) = 0;
+
+    /* New backend of given type without model */
+    static std::unique_ptr<FaceBackend> create(FaceBackendType type);
+};
+
+// Haar Cascade through cv::CascadeClassifier
+class HaarFaceBackend : public FaceBackend {
+
+public:
+    FaceBackendType type() const override { return FaceBackendType::Haar; }
+    FaceBackendInput input() const override { return FaceBackendInput::Gray; }
+    bool load(const std::string& model) override;
+    bool load(const void* data, size_t size) override;
+    bool empty() const override;
+    void detect(const cv::Mat& image, const FaceDetectorParams& params,
+                cv::Size minSize, cv::Size maxSize, std::vector<cv::Rect>& faces) override;
+
+private:
+    cv::CascadeClassifier detector_;
+};
+
+// YuNet CNN through cv::FaceDetectorYN (OpenCV DNN, CPU)
+// Network input is resized only when prepared image size changes.
+// OpenCV 4.5 can only read the .onnx model from a file.
+class YuNetFaceBackend : public FaceBackend {
+
+public:
+    FaceBackendType type() const override { return FaceBackendType::YuNet; }
+    FaceBackendInput input() const override { return FaceBackendInput::BGR; }
+    bool load(const std::string& model) override;
+    bool load(const void* data, size_t size) override;
+    bool empty() const override;
+    void detect(const cv::Mat& image, const FaceDetectorParams& params,
+                cv::Size minSize, cv::Size maxSize, std::vector<cv::Rect>& faces) override;
+
+private:
+    cv::Ptr<cv::FaceDetectorYN> detector_;
+    cv::Size inputSize_;
+    float scoreThreshold_ = 0.0f;
+    float nmsThreshold_ = 0.0f;
+    // Rows of x, y, w, h, 5 landmarks and score
+    cv::Mat found_;
+};
+
+/* Lower case name used on command lines and in reports */
+const char* faceBackendName(FaceBackendType type);
+
+/* Parse "haar" or "yunet", return false on unknown name */
+bool parseFaceBackend(const std::string& name, FaceBackendType& type);
@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <opencv2/core.hpp>
+#include <opencv2/objdetect.hpp>
+#include "batch_runner.hpp"
+#include "face_core.hpp"
+#include "face_sink.hpp"
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " <video or directory>... -o <output.csv|output.bin> [options]\n"
+              << "  -o FILE             output file, .csv is text, anything else compact binary\n"
+              << "  --workers N         decode and detection threads (default all cores)\n"
+              << "  --segment-frames N  frames per segment (default about 4 segments per worker)\n"
+              << "  --width N           detection width, boxes are reported in source size (default 480)\n"
+              << "  --model FILE        Haar Cascade .xml (default haarcascade_frontalface_alt2.xml)" << std::endl;
+}
+
+// Detect faces in recorded videos without display, segments of every file are decoded in parallel
+int main(int argc, char **argv) {
+
+    BatchConfig config;
+    std::string outputPath, model;
+    std::vector<std::string> inputs;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) outputPath = argv[++i];
+        else if (arg == "--workers" && i + 1 < argc) config.workers = std::atoi(argv[++i]);
+        else if (arg == "--segment-frames" && i + 1 < argc) config.segmentFrames = std::atoi(argv[++i]);
+        else if (arg == "--width" && i + 1 < argc) config.detectWidth = std::atoi(argv[++i]);
+        else if (arg == "--model" && i + 1 < argc) model = argv[++i];
+        else if (!arg.empty() && arg[0] != '-') inputs.push_back(arg);
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+    if (inputs.empty() || outputPath.empty()) {
+        usage(argv[0]);
+        return -1;
+    }
+
+    // Directories are expanded to every file inside, in name order
+    std::vector<std::string> files;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        std::vector<cv::String> found;
+        cv::glob(inputs[i], found, false);
+        std::sort(found.begin(), found.end());
+        files.insert(files.end(), found.begin(), found.end());
+    }
+
+    if (model.empty()) model = cv::samples::findFile("haarcascades/haarcascade_frontalface_alt2.xml");
+
+    // Same detection settings as face_detect.cpp, desktop preset of facecore
+    FaceDetectorParams params = FaceCoreConfig::preset(FaceCorePreset::Desktop).params;
+
+    // Parallelism comes from segments, OpenCV threads inside each call would oversubscribe cores
+    cv::setNumThreads(1);
+
+    BatchRunner runner(model, params, config);
+    if (!runner.ready()) {
+        std::cout << "Cannot load Haar Cascade model." << std::endl;
+        return -1;
+    }
+
+    FaceSink sink;
+    if (!sink.open(outputPath, FaceSink::formatFor(outputPath), files)) {
+        std::cout << "Cannot create " << outputPath << std::endl;
+        return -1;
+    }
+    bool processed = runner.run(files, sink);
+    if (!sink.close()) {
+        std::cout << "Cannot write " << outputPath << std::endl;
+        return -1;
+    }
+    if (!processed) {
+        std::cout << "No readable video in input." << std::endl;
+        return -1;
+    }
+
+    runner.printStats(std::cout);
+    return 0;
+}
@@ -0,0 +1,205 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+#include <opencv2/videoio.hpp>
+#include "bench_util.hpp"
+#include "area_gray_resize.hpp"
+#include "face_core.hpp"
+#include "face_detector_session.hpp"
+#include "face_draw.hpp"
+
+// Latency summary of one stage
+struct StageSummary {
+    std::string name;
+    double mean = 0.0;
+    double p50 = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+};
+
+// Nearest-rank percentile of sorted samples
+static double percentile(const std::vector<double>& sorted, double p) {
+    size_t rank = (size_t) std::ceil(p / 100.0 * (double) sorted.size());
+    return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+}
+
+static StageSummary summarize(const std::string& name, std::vector<double> times) {
+    StageSummary s;
+    s.name = name;
+    std::sort(times.begin(), times.end());
+    for (size_t i = 0; i < times.size(); i++) s.mean += times[i];
+    s.mean /= (double) times.size();
+    s.p50 = percentile(times, 50);
+    s.p95 = percentile(times, 95);
+    s.p99 = percentile(times, 99);
+    s.max = times.back();
+    return s;
+}
+
+// Escape backslashes and quotes for JSON string
+static std::string jsonString(const std::string& text) {
+    std::string out = "\"";
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '"' || text[i] == '\\') out += '\\';
+        out += text[i];
+    }
+    return out + "\"";
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " <video | image directory | glob> [options]\n"
+              << "  --frames N   replay at most N decoded frames (default all)\n"
+              << "  --loops N    replay sequence N times (default 5)\n"
+              << "  --warmup N   untimed frames before measuring (default 10)\n"
+              << "  --model FILE Haar Cascade .xml (default haarcascade_frontalface_alt2.xml)\n"
+              << "  --unfused    time cv::resize and cv::cvtColor as separate stages instead of fused kernel\n"
+              << "  --json       print results as JSON for regression tracking" << std::endl;
+}
+
+// Replay recorded frames from memory through faceDetect() stages and report latency percentiles
+int main(int argc, char **argv) {
+
+    std::string input, model;
+    int maxFrames = 0, loops = 5, warmup = 10;
+    bool json = false, unfused = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) maxFrames = std::atoi(argv[++i]);
+        else if (arg == "--loops" && i + 1 < argc) loops = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--warmup" && i + 1 < argc) warmup = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--model" && i + 1 < argc) model = argv[++i];
+        else if (arg == "--json") json = true;
+        else if (arg == "--unfused") unfused = true;
+        else if (input.empty() && !arg.empty() && arg[0] != '-') input = arg;
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+    if (input.empty()) {
+        usage(argv[0]);
+        return -1;
+    }
+
+    std::vector<cv::Mat> frames;
+    if (!loadFrames(input, maxFrames, frames)) {
+        std::cout << "Cannot read frames from " << input << std::endl;
+        return -1;
+    }
+
+    if (model.empty()) model = cv::samples::findFile("haarcascades/haarcascade_frontalface_alt2.xml");
+
+    // Same settings as face_detect.cpp, desktop preset of facecore
+    FaceDetectorParams params = FaceCoreConfig::preset(FaceCorePreset::Desktop).params;
+    FaceDetectorSession session(model, params);
+    if (session.empty()) {
+        std::cout << "Cannot load Haar Cascade model." << std::endl;
+        return -1;
+    }
+
+    std::vector<double> resizeMs, cvtColorMs, detectMs, drawMs, totalMs;
+    cv::Mat output, gray;
+    AreaGrayResizer resizer;
+    std::vector<cv::Rect> faces;
+    uint64_t faceCount = 0;
+    int total = warmup + loops * (int) frames.size();
+    auto benchStart = std::chrono::steady_clock::now();
+    for (int n = 0; n < total; n++) {
+        const cv::Mat& frame = frames[n % frames.size()];
+        if (n == warmup) benchStart = std::chrono::steady_clock::now();
+
+        // Same stages as faceDetect(), fused resize + gray is reported as resize stage
+        // and leaves cvtColor empty, unfused mode times the two OpenCV calls separately
+        auto start = std::chrono::steady_clock::now();
+        float factor = 480.0f / (float) frame.cols;
+        cv::Size size(480, (int) (factor * frame.rows));
+        if (unfused) {
+            cv::resize(frame, output, size, 0, 0, cv::INTER_AREA);
+        }
+        else {
+            output.create(size, frame.type());
+            gray.create(size, CV_8UC1);
+            resizer.run(frame, gray, &output);
+        }
+        double t1 = elapsedMs(start);
+
+        if (unfused) cv::cvtColor(output, gray, cv::COLOR_BGR2GRAY);
+        double t2 = elapsedMs(start);
+
+        session.detect(gray, faces);
+        double t3 = elapsedMs(start);
+
+        drawFaces(output, faces);
+        double t4 = elapsedMs(start);
+
+        if (n < warmup) continue;
+        resizeMs.push_back(t1);
+        cvtColorMs.push_back(t2 - t1);
+        detectMs.push_back(t3 - t2);
+        drawMs.push_back(t4 - t3);
+        totalMs.push_back(t4);
+        faceCount += faces.size();
+    }
+    double seconds = elapsedMs(benchStart) / 1000.0;
+
+    std::vector<StageSummary> stages;
+    // Stage keys stay the same in both modes for regression tracking,
+    // fused kernel time is under resize and cvtColor is near 0
+    stages.push_back(summarize("resize", resizeMs));
+    stages.push_back(summarize("cvtColor", cvtColorMs));
+    stages.push_back(summarize("detectMultiScale", detectMs));
+    stages.push_back(summarize("draw", drawMs));
+    stages.push_back(summarize("total", totalMs));
+    size_t measured = totalMs.size();
+    double fps = seconds > 0 ? measured / seconds : 0.0;
+
+    if (json) {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(4);
+        out << "{\n"
+            << "  \"input\": " << jsonString(input) << ",\n"
+            << "  \"resolution\": [" << frames[0].cols << ", " << frames[0].rows << "],\n"
+            << "  \"frames\": " << frames.size() << ",\n"
+            << "  \"measured\": " << measured << ",\n"
+            << "  \"opencv_threads\": " << cv::getNumThreads() << ",\n"
+            << "  \"fused_resize_gray\": " << (unfused ? "false" : "true") << ",\n"
+            << "  \"throughput_fps\": " << fps << ",\n"
+            << "  \"faces_per_frame\": " << (double) faceCount / measured << ",\n"
+            << "  \"stages_ms\": {\n";
+        for (size_t i = 0; i < stages.size(); i++) {
+            const StageSummary& s = stages[i];
+            out << "    " << jsonString(s.name) << ": {\"mean\": " << s.mean << ", \"p50\": " << s.p50
+                << ", \"p95\": " << s.p95 << ", \"p99\": " << s.p99 << ", \"max\": " << s.max << "}"
+                << (i + 1 < stages.size() ? "," : "") << "\n";
+        }
+        out << "  }\n}";
+        std::cout << out.str() << std::endl;
+        return 0;
+    }
+
+    std::cout << "Input: " << input << " (" << frames.size() << " frames, "
+              << frames[0].cols << "x" << frames[0].rows << "), measured " << measured << " frames" << std::endl;
+    std::cout << std::left << std::setw(18) << "stage" << std::right
+              << std::setw(10) << "mean" << std::setw(10) << "p50" << std::setw(10) << "p95"
+              << std::setw(10) << "p99" << std::setw(10) << "max" << "  (ms)" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    for (size_t i = 0; i < stages.size(); i++) {
+        const StageSummary& s = stages[i];
+        std::cout << std::left << std::setw(18) << s.name << std::right
+                  << std::setw(10) << s.mean << std::setw(10) << s.p50 << std::setw(10) << s.p95
+                  << std::setw(10) << s.p99 << std::setw(10) << s.max << std::endl;
+    }
+    std::cout << "Throughput: " << fps << " frames/s, "
+              << (double) faceCount / measured << " faces/frame" << std::endl;
+    return 0;
+}
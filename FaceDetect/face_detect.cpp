@@ -1,59 +1,220 @@
 #include <iostream>
+#include <fstream>
+#include <cstdlib>
 #include <opencv2/imgproc.hpp>
 #include <opencv2/videoio.hpp>
 #include <opencv2/objdetect.hpp>
 #include <opencv2/highgui.hpp>
+#include "area_gray_resize.hpp"
+#include "face_core.hpp"
+#include "face_detector_session.hpp"
+#include "face_draw.hpp"
+#include "face_pipeline.hpp"
+#include "face_tracker.hpp"
+#include "mat_pool.hpp"
+#include "frontalface_alt2_cascade.hpp"
+#include "motion_gate.hpp"
+#include "parallel_haar_detector.hpp"
+#include "roi_redetector.hpp"
+
+// Haar Cascade detects on resized gray, color backend of session (YuNet) on resized BGR frame
+template <typename Detector>
+void detectResized(Detector& detector, const cv::Mat& gray, const cv::Mat&, std::vector<cv::Rect>& faces) {
+    detector.detect(gray, faces);
+}
+
+void detectResized(FaceDetectorSession& session, const cv::Mat& gray, const cv::Mat& color, std::vector<cv::Rect>& faces) {
+    session.detect(session.input() == FaceBackendInput::BGR ? color : gray, faces);
+}
+
 
 // Implement detecting face in each frame
-cv::Mat faceDetect(cv::Mat frame, std::string model) {
+// Haar Cascade model is kept loaded in session, resized frame is written to output buffer
+// Detector is FaceDetectorSession, FaceTracker, RoiRedetector, MotionGate or ParallelFaceDetector
+template <typename Detector>
+void faceDetect(const cv::Mat& frame, Detector& detector, cv::Mat& output, cv::Mat& gray, AreaGrayResizer& resizer) {
 
-    // Resize image
+    // Resize image and convert to grayscale in one pass over the frame
+    // Buffers are only reallocated when frame size changes
     float factor = 480.0f / (float) frame.cols;
-    cv::resize(frame, frame, cv::Size(480, (int) (factor * frame.rows)), cv::INTER_AREA);
-    // Convert to grayscale
-    cv::Mat grayFrame;
-    cv::cvtColor(frame, grayFrame, cv::COLOR_BGR2GRAY);
-
-    // Call Haar Cascades model and detect face
-    cv::CascadeClassifier detector;
-    // "haarcascade_frontalface_alt2" is chosen
-    detector.load(model);
-    // scaleFactor=1.1, minNeighbors=7, minSize=(30, 30)
+    cv::Size size(480, (int) (factor * frame.rows));
+    output.create(size, frame.type());
+    gray.create(size, CV_8UC1);
+    resizer.run(frame, gray, &output);
+
+    // Detect face with already loaded model
     std::vector<cv::Rect> face;
-    detector.detectMultiScale(grayFrame, face, 1.1, 7, cv::CASCADE_SCALE_IMAGE, cv::Size(30, 30));
-
-    // Draw detected rectangular bounding box
-    for ( size_t i = 0; i < face.size(); i++ ) {
-        int x = face[i].x; 
-        int y = face[i].y;
-        int h = face[i].height;
-        int w = face[i].width;
-        cv::rectangle(frame, cv::Point(x, y - (int) (0.05 * h)), 
-                             cv::Point(x + w, y + h + (int) (0.05 * h)), cv::Scalar(0, 255, 0), 2);
+    detectResized(detector, gray, output, face);
+
+    drawFaces(output, face);
+}
+
+
+// Compiled alt2 cascade, scales and row bands are scanned by a work-stealing pool
+struct ParallelFaceDetector {
+    ParallelFaceDetector(const FaceDetectorParams& params, const ParallelScanConfig& config)
+        : params(params), detector(config) {}
+
+    void detect(const cv::Mat& frame, std::vector<cv::Rect>& faces) {
+        detector.detectMultiScale(frame, faces, params.scaleFactor, params.minNeighbors, params.minSize, params.maxSize);
     }
 
-    return frame;
+    FaceDetectorParams params;
+    ParallelHaarDetector<FrontalFaceAlt2Cascade> detector;
+};
+
+
+// Run capture, detection and display on separate threads
+// Results are shown in capture order
+int runPipeline(cv::VideoCapture& cap, const std::string& model,
+                const FaceDetectorParams& params, const PipelineConfig& config) {
+    FacePipeline pipeline(model, params, config);
+    if (!pipeline.ready()) {
+        std::cout << "Cannot load face model." << std::endl;
+        return -1;
+    }
+
+    std::string window_name = "Face detection";
+    cv::namedWindow(window_name);
+    pipeline.run(cap, [&](PipelineFrame& item) {
+        drawFaces(item.frame, item.faces);
+        cv::imshow(window_name, item.frame);
+
+        // If Spacebar is pressed, stop capturing
+        if (cv::waitKey(1) == 32) {
+            std::cout << "Quit button is pressed, closing program..." << std::endl;
+            return false;
+        }
+        return true;
+    });
+
+    pipeline.printStats(std::cout);
+    return 0;
 }
 
 
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " [--video FILE] [--backend haar|yunet] [--model FILE] [--roi | --track N | --motion | --scan-threads N] [--pipeline] [--workers N] [--queue N] [--block]\n"
+              << "  --video FILE      read frames from video file instead of camera\n"
+              << "  --backend NAME    haar (default) or yunet, YuNet needs --model\n"
+              << "  --model FILE      Haar Cascade .xml or YuNet .onnx (default haarcascade_frontalface_alt2.xml)\n"
+              << "  --roi             search around previous faces first, full frame only on misses\n"
+              << "  --track N         run full detection every N frames, track faces in between (without --pipeline)\n"
+              << "  --motion          skip or limit detection on frames without scene change (without --pipeline)\n"
+              << "  --motion-audit    with --motion, also detect full frames and count faces the gate missed\n"
+              << "  --motion-log FILE with --motion, write per-frame gate decision and score as CSV\n"
+              << "  --scan-threads N  scan scales of compiled cascade on N threads, 0 uses all cores (without --pipeline)\n"
+              << "  --pipeline        run capture, detection and display on separate threads\n"
+              << "  --workers N       number of detection threads in pipeline mode (default 2)\n"
+              << "  --queue N         capacity of each pipeline queue (default 4)\n"
+              << "  --block           wait for free queue slot instead of dropping oldest frame" << std::endl;
+}
+
+
+// Per-frame Mat buffers of sequential loop, never destroyed so Mats kept across frames can still return to it
+static MatPool& framePool() {
+    static MatPool* pool = new MatPool();
+    return *pool;
+}
+
 // Read and process frame by frame
 int main(int argc, char **argv) {
 
+    // Parse command line options
+    bool pipelined = false;
+    bool tracking = false;
+    bool roiSearch = false;
+    bool scanParallel = false;
+    bool motionGate = false;
+    std::string videoPath, motionLog, model;
+    FaceBackendType backend = FaceBackendType::Haar;
+    PipelineConfig config;
+    ParallelScanConfig scanConfig;
+    TrackerConfig trackerConfig;
+    MotionGateConfig gateConfig;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--pipeline") pipelined = true;
+        else if (arg == "--roi") roiSearch = true;
+        else if (arg == "--track" && i + 1 < argc) {
+            tracking = true;
+            trackerConfig.detectEvery = std::atoi(argv[++i]);
+        }
+        else if (arg == "--video" && i + 1 < argc) videoPath = argv[++i];
+        else if (arg == "--backend" && i + 1 < argc && parseFaceBackend(argv[i + 1], backend)) i++;
+        else if (arg == "--model" && i + 1 < argc) model = argv[++i];
+        else if (arg == "--motion") motionGate = true;
+        else if (arg == "--motion-audit") gateConfig.audit = true;
+        else if (arg == "--motion-log" && i + 1 < argc) motionLog = argv[++i];
+        else if (arg == "--scan-threads" && i + 1 < argc) {
+            scanParallel = true;
+            scanConfig.threads = std::atoi(argv[++i]);
+        }
+        else if (arg == "--workers" && i + 1 < argc) config.workers = std::atoi(argv[++i]);
+        else if (arg == "--queue" && i + 1 < argc) config.queueCapacity = (size_t) std::atoi(argv[++i]);
+        else if (arg == "--block") config.policy = BackpressurePolicy::Block;
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
     // Declare Haar Cascade .xml file located in OpenCV install location
     // Use cv::samples::findFile to scan file in build or install directory
-    std::string haarCascade_model = cv::samples::findFile("haarcascades/haarcascade_frontalface_alt2.xml");
+    // YuNet .onnx is not shipped with OpenCV and has to be given
+    if (backend == FaceBackendType::YuNet && model.empty()) {
+        usage(argv[0]);
+        return -1;
+    }
+    std::string haarCascade_model = !model.empty() ? model : cv::samples::findFile("haarcascades/haarcascade_frontalface_alt2.xml");
+
+    // Load model once for the whole capture session
+    // "haarcascade_frontalface_alt2" is chosen, desktop preset of facecore
+    // scaleFactor=1.1, minNeighbors=7, minSize=(30, 30)
+    FaceDetectorParams params = FaceCoreConfig::preset(FaceCorePreset::Desktop).params;
+    params.backend = backend;
 
-    // Define video capture object with camera device index
-    cv::VideoCapture cap(0);
+    // Define video capture object with camera device index or recorded video
+    cv::VideoCapture cap;
+    if (videoPath.empty()) cap.open(0);
+    else cap.open(videoPath);
 
     // If camera fails to open, exit program
     if (!cap.isOpened()) {
-        std::cout << "Camera not found." << std::endl;
+        std::cout << (videoPath.empty() ? "Camera not found." : "Cannot open " + videoPath) << std::endl;
+        return -1;
+    }
+
+    if (pipelined) {
+        int ret = runPipeline(cap, haarCascade_model, params, config);
+        cap.release();
+        cv::destroyAllWindows();
+        return ret;
+    }
+
+    FaceDetectorSession session(haarCascade_model, params);
+    if (session.empty()) {
+        std::cout << "Cannot load face model." << std::endl;
         return -1;
     }
+    FaceTracker tracker(session, trackerConfig);
+    RoiRedetector redetector(session);
+    MotionGate gate(session, gateConfig);
+    // Pool threads are only started when parallel scan is used
+    if (!scanParallel) scanConfig.threads = 1;
+    ParallelFaceDetector parallelDetector(params, scanConfig);
 
+    // Per-frame gate decisions for offline comparison
+    std::ofstream gateLog;
+    if (motionGate && !motionLog.empty()) {
+        gateLog.open(motionLog);
+        gateLog << "frame,decision,score,changed_tiles,tiles,pixels,detect_ms,faces,missed" << std::endl;
+    }
+
+    cv::Mat frame, output, gray;
+    AreaGrayResizer resizer;
     while (true) {
-        cv::Mat frame;
         // read a new frame from video 
         bool ret = cap.read(frame); 
 
@@ -62,9 +223,24 @@ int main(int argc, char **argv) {
             break;
         }
         else {     
+            // Resized and gray buffers come from pool, reallocated only when frame size changes
+            MatPoolScope poolScope(framePool(), {&gray, &output});
+
             // Process frame here
             // Call faceDetect() defined earlier
-            cv::Mat output = faceDetect(frame, haarCascade_model);
+            if (tracking) faceDetect(frame, tracker, output, gray, resizer);
+            else if (roiSearch) faceDetect(frame, redetector, output, gray, resizer);
+            else if (motionGate) {
+                faceDetect(frame, gate, output, gray, resizer);
+                if (gateLog.is_open()) {
+                    const GateFrame& g = gate.last();
+                    gateLog << gate.stats().frames - 1 << "," << gateDecisionName(g.decision) << "," << g.score << ","
+                            << g.changedTiles << "," << g.tiles << "," << g.pixelsScanned << "," << g.detectMs << ","
+                            << gate.lastFaces().size() << "," << g.missed << std::endl;
+                }
+            }
+            else if (scanParallel) faceDetect(frame, parallelDetector, output, gray, resizer);
+            else faceDetect(frame, session, output, gray, resizer);
             
             // Create display window
             std::string window_name = "Face detection";
@@ -79,6 +255,11 @@ int main(int argc, char **argv) {
         } 
     }
 
+    if (tracking) tracker.printStats(std::cout);
+    if (roiSearch) redetector.printStats(std::cout);
+    if (motionGate) gate.printStats(std::cout);
+    framePool().printStats(std::cout);
+
     cap.release();
     cv::destroyAllWindows();
     return 0;
@@ -0,0 +1,95 @@
+#include "face_detector_session.hpp"
+
+FaceDetectorSession::FaceDetectorSession(const std::string& model, const FaceDetectorParams& params)
+    : params_(params) {
+    load(model);
+}
+
+void FaceDetectorSession::selectBackend() {
+    if (!backend_ || backend_->type() != params_.backend) backend_ = FaceBackend::create(params_.backend);
+}
+
+bool FaceDetectorSession::load(const std::string& model) {
+    model_ = model;
+    selectBackend();
+    return backend_->load(model);
+}
+
+bool FaceDetectorSession::load(const void* data, size_t size) {
+    model_ = "<memory>";
+    selectBackend();
+    return backend_->load(data, size);
+}
+
+bool FaceDetectorSession::empty() const {
+    return !backend_ || backend_->empty();
+}
+
+FaceBackendInput FaceDetectorSession::input() const {
+    return backend_ ? backend_->input() : FaceBackendInput::Gray;
+}
+
+double FaceDetectorSession::prepare(const cv::Mat& frame, const cv::Mat*& image) {
+    bool downscale = params_.detectWidth > 0 && frame.cols > params_.detectWidth;
+    double factor = downscale ? (double) params_.detectWidth / (double) frame.cols : 1.0;
+    cv::Size size = downscale ? cv::Size(params_.detectWidth, (int) (factor * frame.rows)) : frame.size();
+
+    if (backend_->input() == FaceBackendInput::BGR) {
+        // Color backend gets 3 channels, gray and BGRA frames are expanded or stripped first
+        const cv::Mat* src = &frame;
+        if (frame.channels() != 3) {
+            cv::cvtColor(frame, converted_, frame.channels() == 1 ? cv::COLOR_GRAY2BGR : cv::COLOR_BGRA2BGR);
+            src = &converted_;
+        }
+        if (!downscale) {
+            image = src;
+            return 1.0;
+        }
+        // Same fused area kernel as gray backends, resized color comes out of the same pass
+        gray_.create(size, CV_8UC1);
+        color_.create(size, CV_8UC3);
+        resizer_.run(*src, gray_, &color_);
+        image = &color_;
+        return factor;
+    }
+
+    // Resize image only when requested width is smaller than frame
+    // Area downscale and grayscale conversion are done in one pass into reused buffer
+    image = &gray_;
+    if (downscale) {
+        gray_.create(size, CV_8UC1);
+        resizer_.run(frame, gray_);
+        return factor;
+    }
+
+    // Convert to grayscale, single channel frame is used directly
+    if (frame.channels() == 1) {
+        image = &frame;
+    }
+    else {
+        cv::cvtColor(frame, gray_, cv::COLOR_BGR2GRAY);
+    }
+    return 1.0;
+}
+
+void FaceDetectorSession::detect(const cv::Mat& frame, std::vector<cv::Rect>& faces) {
+    detect(frame, faces, params_.minSize, params_.maxSize);
+}
+
+void FaceDetectorSession::detect(const cv::Mat& frame, std::vector<cv::Rect>& faces,
+                                 cv::Size minSize, cv::Size maxSize) {
+    faces.clear();
+    if (frame.empty() || empty()) return;
+
+    const cv::Mat* image = NULL;
+    double factor = prepare(frame, image);
+    backend_->detect(*image, params_, minSize, maxSize, faces);
+
+    // Map bounding boxes back to input frame
+    if (factor != 1.0) {
+        for ( size_t i = 0; i < faces.size(); i++ ) {
+            faces[i] = cv::Rect(cvRound(faces[i].x / factor), cvRound(faces[i].y / factor),
+                                cvRound(faces[i].width / factor), cvRound(faces[i].height / factor));
+        }
+    }
+}
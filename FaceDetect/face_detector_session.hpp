@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+#include "area_gray_resize.hpp"
+#include "face_backend.hpp"
+
+// Keep face model loaded between frames
+// Model is parsed once in constructor instead of every frame by the backend
+// chosen in params (Haar Cascade or YuNet). Resize and color buffers are owned
+// by the session and shared by every backend, they are reused as long as frame
+// size does not change, downscaling to detectWidth and grayscale conversion are fused
+class FaceDetectorSession {
+
+public:
+    FaceDetectorSession() = default;
+    FaceDetectorSession(const std::string& model, const FaceDetectorParams& params = FaceDetectorParams());
+
+    /* Load model with backend of params().backend, return false if file cannot be parsed */
+    bool load(const std::string& model);
+
+    /* Load Haar Cascade .xml text from memory (mapped file or APK asset),
+     * no file is opened, data may be released after return
+     * YuNet can only be loaded from file with OpenCV 4.5 */
+    bool load(const void* data, size_t size);
+
+    /* Return true if no model is loaded */
+    bool empty() const;
+
+    /* Path of currently loaded model */
+    const std::string& modelPath() const { return model_; }
+
+    FaceDetectorParams& params() { return params_; }
+    const FaceDetectorParams& params() const { return params_; }
+
+    /* Image layout the loaded backend detects on, BGR frames keep YuNet at full accuracy */
+    FaceBackendInput input() const;
+
+    /* Detect faces in BGR(A) or grayscale frame
+     * Bounding boxes are returned in input frame coordinates */
+    void detect(const cv::Mat& frame, std::vector<cv::Rect>& faces);
+
+    /* Same as above but only faces between minSize and maxSize are searched */
+    void detect(const cv::Mat& frame, std::vector<cv::Rect>& faces, cv::Size minSize, cv::Size maxSize);
+
+private:
+    /* Resize and convert frame into gray or BGR buffer of backend, return scaling factor */
+    double prepare(const cv::Mat& frame, const cv::Mat*& image);
+
+    /* Create backend of params().backend unless it is already the loaded one */
+    void selectBackend();
+
+    std::unique_ptr<FaceBackend> backend_;
+    FaceDetectorParams params_;
+    std::string model_;
+
+    // Reusable per-frame buffers
+    AreaGrayResizer resizer_;
+    cv::Mat gray_;
+    cv::Mat color_;
+    // Full size BGR of gray or BGRA frame for color backends
+    cv::Mat converted_;
+};
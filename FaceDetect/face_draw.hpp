@@ -0,0 +1,17 @@
+#pragma once
+
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+
+// Draw detected rectangular bounding box
+inline void drawFaces(cv::Mat& frame, const std::vector<cv::Rect>& face) {
+    for ( size_t i = 0; i < face.size(); i++ ) {
+        int x = face[i].x; 
+        int y = face[i].y;
+        int h = face[i].height;
+        int w = face[i].width;
+        cv::rectangle(frame, cv::Point(x, y - (int) (0.05 * h)), 
+                             cv::Point(x + w, y + h + (int) (0.05 * h)), cv::Scalar(0, 255, 0), 2);
+    }
+}
@@ -0,0 +1,172 @@
+#include "face_pipeline.hpp"
+#include "area_gray_resize.hpp"
+#include <opencv2/imgproc.hpp>
+
+FacePipeline::FacePipeline(const std::string& model, const FaceDetectorParams& params,
+                           const PipelineConfig& config)
+    : config_(config),
+      captureQueue_(config.queueCapacity, config.policy),
+      resultQueue_(config.queueCapacity, config.policy) {
+    if (config_.workers < 1) config_.workers = 1;
+    if (config_.reorderWindow == 0) config_.reorderWindow = 2 * (size_t) config_.workers;
+
+    // CascadeClassifier is not safe to share between threads
+    // so every worker loads its own copy of the model
+    sessions_.reserve(config_.workers);
+    for (int i = 0; i < config_.workers; i++) {
+        sessions_.emplace_back(model, params);
+    }
+}
+
+FacePipeline::~FacePipeline() {
+    stop();
+    if (captureThread_.joinable()) captureThread_.join();
+    for (size_t i = 0; i < workerThreads_.size(); i++) {
+        if (workerThreads_[i].joinable()) workerThreads_[i].join();
+    }
+}
+
+bool FacePipeline::ready() const {
+    for (size_t i = 0; i < sessions_.size(); i++) {
+        if (sessions_[i].empty()) return false;
+    }
+    return true;
+}
+
+void FacePipeline::stop() {
+    stop_.store(true, std::memory_order_release);
+}
+
+void FacePipeline::captureLoop(cv::VideoCapture& cap) {
+    uint64_t seq = 0;
+    while (!stop_.load(std::memory_order_acquire)) {
+        PipelineFrame item;
+        // read a new frame from video
+        if (!cap.read(item.frame)) {
+            std::cout << "Can't receive frame (stream end?). Exiting ..." << std::endl;
+            break;
+        }
+        item.seq = seq++;
+        // With DropOldest policy a slow detector makes us skip stale frames
+        // instead of stalling camera I/O
+        if (!captureQueue_.push(std::move(item))) break;
+    }
+    captured_ = seq;
+    captureQueue_.close();
+}
+
+void FacePipeline::detectLoop(int worker) {
+    FaceDetectorSession& session = sessions_[worker];
+    PipelineFrame item;
+    AreaGrayResizer resizer;
+    cv::Mat gray;
+
+    while (captureQueue_.pop(item)) {
+        if (stop_.load(std::memory_order_acquire)) continue;
+
+        // Resize image and convert to grayscale in one pass
+        if (config_.frameWidth > 0 && item.frame.cols != config_.frameWidth) {
+            // Resized frame goes downstream, so a new buffer is needed for every frame
+            float factor = (float) config_.frameWidth / (float) item.frame.cols;
+            cv::Size size(config_.frameWidth, (int) (factor * item.frame.rows));
+            cv::Mat resized(size, item.frame.type());
+            gray.create(size, CV_8UC1);
+            resizer.run(item.frame, gray, &resized);
+            item.frame = resized;
+            // Color backend (YuNet) detects on resized BGR frame
+            session.detect(session.input() == FaceBackendInput::BGR ? resized : gray, item.faces);
+        }
+        else {
+            session.detect(item.frame, item.faces);
+        }
+        resultQueue_.push(std::move(item));
+    }
+
+    // Last worker to leave closes the render queue
+    if (activeWorkers_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        resultQueue_.close();
+    }
+}
+
+void FacePipeline::renderLoop(const RenderCallback& render) {
+    // Results arrive in completion order, hold them back until
+    // every earlier sequence number has been shown
+    std::map<uint64_t, PipelineFrame> pending;
+    uint64_t expected = 0;
+    PipelineFrame item;
+
+    while (resultQueue_.pop(item)) {
+        if (stop_.load(std::memory_order_acquire)) continue;
+
+        // Frame arrived after we already moved past it
+        if (item.seq < expected) {
+            late_++;
+            continue;
+        }
+        uint64_t seq = item.seq;
+        pending[seq] = std::move(item);
+
+        // Missing frames were dropped by backpressure or are stuck in a slow worker,
+        // do not wait for them forever
+        if (pending.size() > config_.reorderWindow) {
+            uint64_t first = pending.begin()->first;
+            skipped_ += first - expected;
+            expected = first;
+        }
+
+        while (!pending.empty() && pending.begin()->first == expected) {
+            if (!render(pending.begin()->second)) stop();
+            displayed_++;
+            pending.erase(pending.begin());
+            expected++;
+            if (stop_.load(std::memory_order_acquire)) break;
+        }
+    }
+
+    // Queue closed, no more frames can fill the gaps: show what is held back in order
+    while (!pending.empty() && !stop_.load(std::memory_order_acquire)) {
+        uint64_t first = pending.begin()->first;
+        skipped_ += first - expected;
+        if (!render(pending.begin()->second)) stop();
+        displayed_++;
+        pending.erase(pending.begin());
+        expected = first + 1;
+    }
+}
+
+void FacePipeline::run(cv::VideoCapture& cap, const RenderCallback& render) {
+    stop_.store(false, std::memory_order_release);
+    activeWorkers_.store(config_.workers, std::memory_order_release);
+
+    captureThread_ = std::thread(&FacePipeline::captureLoop, this, std::ref(cap));
+    for (int i = 0; i < config_.workers; i++) {
+        workerThreads_.emplace_back(&FacePipeline::detectLoop, this, i);
+    }
+
+    // Render on calling thread because GUI calls must stay on main thread
+    renderLoop(render);
+
+    captureThread_.join();
+    for (size_t i = 0; i < workerThreads_.size(); i++) workerThreads_[i].join();
+    workerThreads_.clear();
+}
+
+static void printQueue(std::ostream& out, const char* name, const FrameQueue<PipelineFrame>& queue) {
+    const QueueStats& s = queue.stats();
+    out << name << ": pushed=" << s.pushed.load()
+        << " popped=" << s.popped.load()
+        << " dropped=" << s.dropped.load()
+        << " depth=" << queue.depth()
+        << " maxDepth=" << s.maxDepth.load()
+        << "/" << queue.capacity() << std::endl;
+}
+
+void FacePipeline::printStats(std::ostream& out) const {
+    out << "Pipeline: workers=" << config_.workers
+        << " captured=" << captured_
+        << " displayed=" << displayed_
+        << " skipped=" << skipped_
+        << " late=" << late_ << std::endl;
+    printQueue(out, "capture -> detect", captureQueue_);
+    printQueue(out, "detect -> render", resultQueue_);
+}
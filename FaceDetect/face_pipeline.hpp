@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <thread>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/videoio.hpp>
+#include "face_detector_session.hpp"
+#include "frame_queue.hpp"
+
+// Pipelined mode settings
+struct PipelineConfig {
+    // Number of detection worker threads
+    int workers = 2;
+    // Capacity of capture -> detect and detect -> render queues
+    size_t queueCapacity = 4;
+    BackpressurePolicy policy = BackpressurePolicy::DropOldest;
+    // Frames are resized to this width before detection, 0 keeps camera size
+    int frameWidth = 480;
+    // Max results held back while waiting for a missing sequence number, 0 means 2 * workers
+    size_t reorderWindow = 0;
+};
+
+// Frame travelling through the pipeline with its detection result
+struct PipelineFrame {
+    uint64_t seq = 0;
+    cv::Mat frame;
+    std::vector<cv::Rect> faces;
+};
+
+// Three-stage capture -> detect -> render pipeline
+// Capture thread reads camera, a pool of workers runs detection with their own
+// FaceDetectorSession, render stage runs on calling thread and shows results
+// in frame sequence order.
+class FacePipeline {
+
+public:
+    // Render callback, return false to stop the pipeline
+    typedef std::function<bool(PipelineFrame&)> RenderCallback;
+
+    FacePipeline(const std::string& model, const FaceDetectorParams& params,
+                 const PipelineConfig& config = PipelineConfig());
+    ~FacePipeline();
+
+    /* Return true if every worker session loaded the model */
+    bool ready() const;
+
+    /* Run until capture ends or render returns false, blocks calling thread */
+    void run(cv::VideoCapture& cap, const RenderCallback& render);
+
+    /* Ask all stages to finish, safe to call from any thread */
+    void stop();
+
+    /* Print per-stage queue counters */
+    void printStats(std::ostream& out) const;
+
+private:
+    void captureLoop(cv::VideoCapture& cap);
+    void detectLoop(int worker);
+    void renderLoop(const RenderCallback& render);
+
+    PipelineConfig config_;
+    std::vector<FaceDetectorSession> sessions_;
+
+    FrameQueue<PipelineFrame> captureQueue_;
+    FrameQueue<PipelineFrame> resultQueue_;
+
+    std::thread captureThread_;
+    std::vector<std::thread> workerThreads_;
+    std::atomic<bool> stop_{false};
+    std::atomic<int> activeWorkers_{0};
+
+    // Render stage counters
+    uint64_t captured_ = 0;
+    uint64_t displayed_ = 0;
+    uint64_t late_ = 0;
+    uint64_t skipped_ = 0;
+};
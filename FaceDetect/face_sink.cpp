@@ -0,0 +1,92 @@
+#include "face_sink.hpp"
+#include <cstring>
+
+static const char FACE_SINK_MAGIC[8] = {'F', 'A', 'C', 'E', 'B', 'O', 'X', '\0'};
+static const uint32_t FACE_SINK_VERSION = 1;
+
+// Append value in host byte order, every supported target is little endian
+template <typename T>
+static void append(std::string& buffer, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    buffer.append(bytes, sizeof(T));
+}
+
+// Double-quoted CSV field, quotes inside are doubled, so commas and newlines in paths stay in one field
+static std::string csvField(const std::string& value) {
+    std::string field = "\"";
+    for (size_t i = 0; i < value.size(); i++) {
+        if (value[i] == '"') field += '"';
+        field += value[i];
+    }
+    return field + "\"";
+}
+
+SinkFormat FaceSink::formatFor(const std::string& path) {
+    size_t dot = path.rfind('.');
+    if (dot != std::string::npos && path.substr(dot) == ".csv") return SinkFormat::Csv;
+    return SinkFormat::Binary;
+}
+
+bool FaceSink::open(const std::string& path, SinkFormat format, const std::vector<std::string>& files) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    format_ = format;
+    files_ = files;
+    frames_ = 0;
+    out_.open(path, format == SinkFormat::Csv ? std::ios::out : std::ios::out | std::ios::binary);
+    if (!out_.is_open()) return false;
+
+    buffer_.clear();
+    if (format_ == SinkFormat::Csv) {
+        buffer_ = "file,frame,faces,boxes\n";
+    }
+    else {
+        buffer_.append(FACE_SINK_MAGIC, sizeof(FACE_SINK_MAGIC));
+        append<uint32_t>(buffer_, FACE_SINK_VERSION);
+        append<uint32_t>(buffer_, (uint32_t) files_.size());
+        for (size_t i = 0; i < files_.size(); i++) {
+            append<uint32_t>(buffer_, (uint32_t) files_[i].size());
+            buffer_.append(files_[i]);
+        }
+    }
+    out_.write(buffer_.data(), (std::streamsize) buffer_.size());
+    return (bool) out_;
+}
+
+void FaceSink::write(const std::vector<FrameFaces>& frames) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffer_.clear();
+    for (size_t i = 0; i < frames.size(); i++) {
+        const FrameFaces& f = frames[i];
+        if (format_ == SinkFormat::Csv) {
+            buffer_ += csvField(files_[f.file]) + "," + std::to_string(f.frame) + "," + std::to_string(f.faces.size()) + ",";
+            for (size_t j = 0; j < f.faces.size(); j++) {
+                const cv::Rect& r = f.faces[j];
+                if (j > 0) buffer_ += ";";
+                buffer_ += std::to_string(r.x) + " " + std::to_string(r.y) + " " +
+                           std::to_string(r.width) + " " + std::to_string(r.height);
+            }
+            buffer_ += "\n";
+        }
+        else {
+            append<uint32_t>(buffer_, f.file);
+            append<uint32_t>(buffer_, f.frame);
+            append<uint32_t>(buffer_, (uint32_t) f.faces.size());
+            for (size_t j = 0; j < f.faces.size(); j++) {
+                append<int32_t>(buffer_, f.faces[j].x);
+                append<int32_t>(buffer_, f.faces[j].y);
+                append<int32_t>(buffer_, f.faces[j].width);
+                append<int32_t>(buffer_, f.faces[j].height);
+            }
+        }
+    }
+    out_.write(buffer_.data(), (std::streamsize) buffer_.size());
+    frames_ += frames.size();
+}
+
+bool FaceSink::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!out_.is_open()) return false;
+    out_.close();
+    return !out_.fail();
+}
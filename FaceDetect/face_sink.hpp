@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <opencv2/core.hpp>
+
+// Output format of batch results
+enum class SinkFormat {
+    // One text line per frame: file,frame,faces,"x y w h;x y w h"
+    Csv,
+    // Little endian records, see FaceSink
+    Binary
+};
+
+// Faces found in one frame of one input file
+struct FrameFaces {
+    uint32_t file = 0;
+    uint32_t frame = 0;
+    std::vector<cv::Rect> faces;
+};
+
+// Thread-safe writer of per-frame bounding boxes
+//
+// Binary layout:
+//   "FACEBOX\0" | uint32 version | uint32 fileCount
+//   fileCount x (uint32 length | path bytes)
+//   records: uint32 file | uint32 frame | uint32 count | count x int32 (x, y, width, height)
+//
+// Segments are decoded in parallel, so records are grouped by segment and
+// frames of one file are not in order; readers sort by (file, frame).
+class FaceSink {
+
+public:
+    /* Create output file and write list of input files, return false on error */
+    bool open(const std::string& path, SinkFormat format, const std::vector<std::string>& files);
+
+    /* Append frames of one segment with a single lock */
+    void write(const std::vector<FrameFaces>& frames);
+
+    /* Flush and close, return false if any write failed */
+    bool close();
+
+    /* Choose format from file extension, .csv is text, anything else binary */
+    static SinkFormat formatFor(const std::string& path);
+
+    uint64_t framesWritten() const { return frames_; }
+
+private:
+    std::mutex mutex_;
+    std::ofstream out_;
+    SinkFormat format_ = SinkFormat::Binary;
+    std::vector<std::string> files_;
+    uint64_t frames_ = 0;
+
+    // Reused encoding buffer, only touched under mutex
+    std::string buffer_;
+};
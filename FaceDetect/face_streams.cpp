@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/objdetect.hpp>
+#include <opencv2/videoio.hpp>
+#include "face_core.hpp"
+#include "stream_scheduler.hpp"
+
+// Simulated camera settings
+struct FeedConfig {
+    std::string path;
+    int stream = 0;
+    // Frames per second of the source, 0 uses container rate
+    double fps = 15.0;
+    // Delay of first frame so feeds do not all deliver at the same instant
+    double phaseMs = 0.0;
+};
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " <video, image or directory>... [options]\n"
+              << "  --streams N     simulated feeds, inputs are reused in turn (default one per input)\n"
+              << "  --fps F         frames per second of every feed, 0 uses video rate (default 15)\n"
+              << "  --seconds S     run time (default 10)\n"
+              << "  --workers N     detection threads shared by all feeds (default all cores)\n"
+              << "  --queue N       frames queued per feed before oldest is dropped (default 2)\n"
+              << "  --deadline MS   queued frames older than this are dropped (default 100)\n"
+              << "  --width N       detection width (default 480)\n"
+              << "  --model FILE    Haar Cascade .xml (default haarcascade_frontalface_alt2.xml)" << std::endl;
+}
+
+// File-backed camera, delivers frames at source rate and starts over at end of file
+// A still image is delivered as the same frame over and over.
+void runFeed(StreamScheduler& scheduler, const FeedConfig& feed, const std::atomic<bool>& stop) {
+    cv::VideoCapture cap(feed.path);
+    cv::Mat still;
+    if (!cap.isOpened() || !cap.grab()) {
+        still = cv::imread(feed.path);
+        if (still.empty()) {
+            std::cout << "Cannot read " << feed.path << std::endl;
+            return;
+        }
+    } else {
+        cap.set(cv::CAP_PROP_POS_FRAMES, 0);
+    }
+
+    double fps = feed.fps;
+    if (fps <= 0 && cap.isOpened()) fps = cap.get(cv::CAP_PROP_FPS);
+    if (fps <= 0) fps = 15.0;
+    auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / fps));
+    auto next = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double, std::milli>(feed.phaseMs));
+
+    int64_t index = 0;
+    while (!stop) {
+        std::this_thread::sleep_until(next);
+        // Camera does not catch up on missed frames, it just delivers the next one
+        next = std::max(next + period, std::chrono::steady_clock::now());
+
+        // Fresh Mat for every frame, scheduler keeps the buffer until detection is done
+        cv::Mat frame = still;
+        if (still.empty() && !cap.read(frame)) {
+            cap.set(cv::CAP_PROP_POS_FRAMES, 0);
+            if (!cap.read(frame)) break;
+        }
+        scheduler.submit(feed.stream, frame, index++);
+    }
+}
+
+// Run many simulated camera feeds through one shared detection scheduler and report per-feed fps, delay and drops
+int main(int argc, char **argv) {
+
+    StreamSchedulerConfig config;
+    int streams = 0;
+    double fps = 15.0, seconds = 10.0, deadlineMs = 100.0;
+    std::string model;
+    std::vector<std::string> inputs;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--streams" && i + 1 < argc) streams = std::atoi(argv[++i]);
+        else if (arg == "--fps" && i + 1 < argc) fps = std::atof(argv[++i]);
+        else if (arg == "--seconds" && i + 1 < argc) seconds = std::atof(argv[++i]);
+        else if (arg == "--workers" && i + 1 < argc) config.workers = std::atoi(argv[++i]);
+        else if (arg == "--queue" && i + 1 < argc) config.streamQueue = (size_t) std::atoi(argv[++i]);
+        else if (arg == "--deadline" && i + 1 < argc) deadlineMs = std::atof(argv[++i]);
+        else if (arg == "--width" && i + 1 < argc) config.detectWidth = std::atoi(argv[++i]);
+        else if (arg == "--model" && i + 1 < argc) model = argv[++i];
+        else if (!arg.empty() && arg[0] != '-') inputs.push_back(arg);
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+    if (inputs.empty()) {
+        usage(argv[0]);
+        return -1;
+    }
+
+    // Directories are expanded to every file inside, in name order
+    std::vector<std::string> files;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        std::vector<cv::String> found;
+        cv::glob(inputs[i], found, false);
+        std::sort(found.begin(), found.end());
+        files.insert(files.end(), found.begin(), found.end());
+    }
+    if (files.empty()) {
+        std::cout << "No input file found." << std::endl;
+        return -1;
+    }
+    if (streams <= 0) streams = (int) files.size();
+
+    if (model.empty()) model = cv::samples::findFile("haarcascades/haarcascade_frontalface_alt2.xml");
+
+    // Same detection settings as face_detect.cpp, desktop preset of facecore
+    FaceDetectorParams params = FaceCoreConfig::preset(FaceCorePreset::Desktop).params;
+
+    // Parallelism comes from the worker pool, OpenCV threads inside each call would oversubscribe cores
+    cv::setNumThreads(1);
+
+    StreamScheduler scheduler(model, params, config);
+    if (!scheduler.ready()) {
+        std::cout << "Cannot load Haar Cascade model." << std::endl;
+        return -1;
+    }
+
+    std::vector<FeedConfig> feeds(streams);
+    for (int i = 0; i < streams; i++) {
+        StreamConfig stream;
+        stream.name = files[i % files.size()];
+        stream.deadlineMs = deadlineMs;
+        feeds[i].path = stream.name;
+        feeds[i].stream = scheduler.addStream(stream);
+        feeds[i].fps = fps;
+        feeds[i].phaseMs = fps > 0 ? 1000.0 / fps * i / streams : 0.0;
+    }
+
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < streams; i++) threads.emplace_back(runFeed, std::ref(scheduler), std::cref(feeds[i]), std::cref(stop));
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    stop = true;
+    for (size_t i = 0; i < threads.size(); i++) threads[i].join();
+    scheduler.drain();
+
+    scheduler.printStats(std::cout);
+    uint64_t processed = 0, submitted = 0;
+    for (int i = 0; i < streams; i++) {
+        StreamStats s = scheduler.stats(i);
+        processed += s.processed;
+        submitted += s.submitted;
+    }
+    std::cout << "Total: submitted=" << submitted << " processed=" << processed
+              << " -> " << processed / seconds << " frames/s" << std::endl;
+    return 0;
+}
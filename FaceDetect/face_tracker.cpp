@@ -0,0 +1,110 @@
+#include "face_tracker.hpp"
+#include <chrono>
+#include <opencv2/imgproc.hpp>
+
+// Milliseconds elapsed since start
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    std::chrono::duration<double, std::milli> diff = std::chrono::steady_clock::now() - start;
+    return diff.count();
+}
+
+FaceTracker::FaceTracker(FaceDetectorSession& session, const TrackerConfig& config)
+    : session_(session), config_(config), redetector_(session, config.search) {
+    if (config_.detectEvery < 1) config_.detectEvery = 1;
+}
+
+void FaceTracker::reset() {
+    tracks_.clear();
+    sinceFull_ = 0;
+    lost_ = false;
+}
+
+void FaceTracker::detectFull() {
+    auto start = std::chrono::steady_clock::now();
+    session_.detect(gray_, found_);
+    stats_.fullMs += elapsedMs(start);
+    stats_.fullDetections++;
+    stats_.lastFramePixels = (uint64_t) gray_.total();
+
+    tracks_.clear();
+    for ( size_t i = 0; i < found_.size(); i++ ) {
+        TrackedFace face;
+        face.box = found_[i];
+        tracks_.push_back(face);
+    }
+    sinceFull_ = 0;
+    lost_ = false;
+}
+
+void FaceTracker::trackFaces() {
+    auto start = std::chrono::steady_clock::now();
+
+    redetector_.beginFrame();
+    for ( size_t i = 0; i < tracks_.size(); i++ ) {
+        TrackedFace& face = tracks_[i];
+
+        // Search expanded window with narrow size band around previous box
+        cv::Rect found;
+        stats_.roiSearches++;
+        if (redetector_.searchAround(gray_, face.box, found)) {
+            face.box = found;
+            face.hits++;
+            face.misses = 0;
+        }
+        else {
+            face.misses++;
+            face.hits = 0;
+            lost_ = true;
+        }
+    }
+    redetector_.endFrame();
+    stats_.lastFramePixels = redetector_.stats().lastFramePixels;
+    stats_.roiMs += elapsedMs(start);
+}
+
+void FaceTracker::detect(const cv::Mat& frame, std::vector<cv::Rect>& faces) {
+    faces.clear();
+    if (frame.empty()) return;
+
+    // Convert to grayscale once, shared by every search window
+    if (frame.channels() == 1) gray_ = frame;
+    else cv::cvtColor(frame, gray_, cv::COLOR_BGR2GRAY);
+
+    stats_.frames++;
+    // Full detection on cadence, when nothing is tracked or a face was lost last frame
+    bool cadence = sinceFull_ + 1 >= config_.detectEvery;
+    if (tracks_.empty() || cadence || lost_) {
+        if (!cadence && lost_) stats_.forcedDetections++;
+        detectFull();
+    }
+    else {
+        sinceFull_++;
+        trackFaces();
+    }
+
+    stats_.pixelsScanned += stats_.lastFramePixels;
+
+    // Faces that were lost this frame are not reported
+    for ( size_t i = 0; i < tracks_.size(); i++ ) {
+        if (tracks_[i].misses == 0) faces.push_back(tracks_[i].box);
+    }
+
+    if (gray_.data == frame.data) gray_.release();
+}
+
+void FaceTracker::printStats(std::ostream& out) const {
+    if (stats_.frames == 0) return;
+
+    double fullAvg = stats_.fullDetections ? stats_.fullMs / stats_.fullDetections : 0.0;
+    double frameAvg = (stats_.fullMs + stats_.roiMs) / stats_.frames;
+
+    out << "Tracking: frames=" << stats_.frames
+        << " fullDetections=" << stats_.fullDetections
+        << " (forced " << stats_.forcedDetections << ")"
+        << " roiSearches=" << stats_.roiSearches
+        << " pixels/frame=" << (double) stats_.pixelsScanned / stats_.frames << std::endl;
+    out << "Full-frame detection: " << fullAvg << " ms -> every-frame baseline "
+        << (fullAvg > 0 ? 1000.0 / fullAvg : 0.0) << " detections/s" << std::endl;
+    out << "Detect-then-track: " << frameAvg << " ms/frame -> "
+        << (frameAvg > 0 ? 1000.0 / frameAvg : 0.0) << " detections/s" << std::endl;
+}
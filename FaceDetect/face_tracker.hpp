@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <opencv2/core.hpp>
+#include "face_detector_session.hpp"
+#include "roi_redetector.hpp"
+
+// Detect-then-track settings
+struct TrackerConfig {
+    // Run full-frame detection every N frames
+    int detectEvery = 10;
+    // Window and size band used to find known faces again
+    RoiSearchConfig search;
+};
+
+// Face followed between full detections
+struct TrackedFace {
+    cv::Rect box;
+    // consecutive frames the face was found again in its search window
+    int hits = 0;
+    // consecutive frames the face was not found
+    int misses = 0;
+};
+
+// Timing and work counters of tracking mode
+struct TrackerStats {
+    uint64_t frames = 0;
+    uint64_t fullDetections = 0;
+    uint64_t roiSearches = 0;
+    // Full detections forced by a lost face instead of cadence
+    uint64_t forcedDetections = 0;
+    // Pixels passed to the detector, full frames and search windows
+    uint64_t pixelsScanned = 0;
+    uint64_t lastFramePixels = 0;
+    double fullMs = 0.0;
+    double roiMs = 0.0;
+};
+
+// Run Haar Cascade on the whole frame every N frames,
+// in between only search small windows around known faces.
+// Full detection is also run early when a known face is lost.
+class FaceTracker {
+
+public:
+    FaceTracker(FaceDetectorSession& session, const TrackerConfig& config = TrackerConfig());
+
+    /* Detect or track faces in BGR(A) or grayscale frame */
+    void detect(const cv::Mat& frame, std::vector<cv::Rect>& faces);
+
+    /* Forget known faces, next frame runs full detection */
+    void reset();
+
+    const std::vector<TrackedFace>& tracks() const { return tracks_; }
+    const TrackerStats& stats() const { return stats_; }
+    /* Hits, misses and window pixels of search windows between full detections */
+    const RoiSearchStats& roiStats() const { return redetector_.stats(); }
+
+    /* Print achieved detection rate against every-frame detection */
+    void printStats(std::ostream& out) const;
+
+private:
+    void detectFull();
+    void trackFaces();
+
+    FaceDetectorSession& session_;
+    TrackerConfig config_;
+    RoiRedetector redetector_;
+    std::vector<TrackedFace> tracks_;
+    TrackerStats stats_;
+    int sinceFull_ = 0;
+    bool lost_ = false;
+
+    // Reusable per-frame buffers
+    cv::Mat gray_;
+    std::vector<cv::Rect> found_;
+};
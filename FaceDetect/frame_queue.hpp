@@ -0,0 +1,158 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+// What producer does when queue is full
+enum class BackpressurePolicy {
+    DropOldest, // discard oldest queued item and push the new one
+    Block       // wait until a consumer frees a slot
+};
+
+// Queue depth counters, safe to read from any thread
+struct QueueStats {
+    std::atomic<size_t> pushed{0};
+    std::atomic<size_t> popped{0};
+    std::atomic<size_t> dropped{0};
+    std::atomic<size_t> maxDepth{0};
+};
+
+// Bounded lock-free queue connecting pipeline stages
+// Based on Dmitry Vyukov's bounded MPMC queue: every cell carries a sequence number
+// so producers and consumers only contend on one atomic index each.
+// Works for SPSC, MPSC and SPMC stages, capacity is rounded up to a power of two.
+template <typename T>
+class FrameQueue {
+
+public:
+    explicit FrameQueue(size_t capacity, BackpressurePolicy policy = BackpressurePolicy::DropOldest)
+        : policy_(policy) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        mask_ = size - 1;
+        cells_.reset(new Cell[size]);
+        for (size_t i = 0; i < size; i++) cells_[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    FrameQueue(const FrameQueue&) = delete;
+    FrameQueue& operator=(const FrameQueue&) = delete;
+
+    /* Push without waiting, return false if queue is full */
+    bool tryPush(T&& item) {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->seq.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t) seq - (intptr_t) pos;
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            }
+            else if (diff < 0) return false;
+            else pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+        cell->data = std::move(item);
+        cell->seq.store(pos + 1, std::memory_order_release);
+
+        stats_.pushed.fetch_add(1, std::memory_order_relaxed);
+        updateMaxDepth();
+        return true;
+    }
+
+    /* Pop without waiting, return false if queue is empty */
+    bool tryPop(T& item) {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->seq.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t) seq - (intptr_t) (pos + 1);
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            }
+            else if (diff < 0) return false;
+            else pos = dequeuePos_.load(std::memory_order_relaxed);
+        }
+        item = std::move(cell->data);
+        cell->data = T();
+        cell->seq.store(pos + mask_ + 1, std::memory_order_release);
+
+        stats_.popped.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /* Push according to backpressure policy
+     * Return false only if queue was closed while waiting */
+    bool push(T&& item) {
+        int spins = 0;
+        while (!tryPush(std::move(item))) {
+            if (policy_ == BackpressurePolicy::DropOldest) {
+                T oldest;
+                if (tryPop(oldest)) {
+                    stats_.popped.fetch_sub(1, std::memory_order_relaxed);
+                    stats_.dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            else {
+                if (closed()) return false;
+                backoff(spins);
+            }
+        }
+        return true;
+    }
+
+    /* Wait for an item, return false once queue is closed and drained */
+    bool pop(T& item) {
+        int spins = 0;
+        while (!tryPop(item)) {
+            if (closed()) return tryPop(item);
+            backoff(spins);
+        }
+        return true;
+    }
+
+    /* Signal that no more items will be pushed */
+    void close() { closed_.store(true, std::memory_order_release); }
+    bool closed() const { return closed_.load(std::memory_order_acquire); }
+
+    /* Approximate number of queued items */
+    size_t depth() const {
+        size_t in = enqueuePos_.load(std::memory_order_relaxed);
+        size_t out = dequeuePos_.load(std::memory_order_relaxed);
+        return in > out ? in - out : 0;
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+    const QueueStats& stats() const { return stats_; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> seq;
+        T data;
+    };
+
+    void updateMaxDepth() {
+        size_t d = depth();
+        size_t prev = stats_.maxDepth.load(std::memory_order_relaxed);
+        while (d > prev && !stats_.maxDepth.compare_exchange_weak(prev, d, std::memory_order_relaxed)) {}
+    }
+
+    // Spin briefly, then yield, then sleep so idle stages do not burn a core
+    static void backoff(int& spins) {
+        if (++spins < 64) return;
+        if (spins < 128) std::this_thread::yield();
+        else std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+    BackpressurePolicy policy_;
+    alignas(64) std::atomic<size_t> enqueuePos_{0};
+    alignas(64) std::atomic<size_t> dequeuePos_{0};
+    alignas(64) std::atomic<bool> closed_{false};
+    QueueStats stats_;
+};
@@ -0,0 +1,3619 @@
+#pragma once
+
+// Generated by cascade_codegen from haarcascade_frontalface_alt2.bin, do not edit
+// window 20x20, 20 stages, 1047 weak classifiers, 2094 features
+
+#include <cstdint>
+
+namespace FrontalFaceAlt2Cascade_tables {
+
+constexpr float stageThreshold[20] = {
+    0.350682288f, 3.47216797f, 5.98447895f, 8.51177692f, 8.46800613f, 12.5784903f, 14.5467405f, 18.5722408f,
+    21.5781097f, 22.5852814f, 25.6092911f, 32.6471176f, 30.672121f, 34.6770668f, 36.72649f, 38.2360268f,
+    44.6829567f, 47.7634392f, 44.2512703f, 53.755558f
+};
+
+constexpr int32_t stageWeakBegin[21] = {
+    0, 3, 12, 26, 45, 64, 91, 122, 161, 206, 253, 306, 373, 436, 507, 582,
+    660, 751, 848, 938, 1047
+};
+
+constexpr int32_t weakNodeBegin[1048] = {
+    0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30,
+    32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62,
+    64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94,
+    96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126,
+    128, 130, 132, 134, 136, 138, 140, 142, 144, 146, 148, 150, 152, 154, 156, 158,
+    160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180, 182, 184, 186, 188, 190,
+    192, 194, 196, 198, 200, 202, 204, 206, 208, 210, 212, 214, 216, 218, 220, 222,
+    224, 226, 228, 230, 232, 234, 236, 238, 240, 242, 244, 246, 248, 250, 252, 254,
+    256, 258, 260, 262, 264, 266, 268, 270, 272, 274, 276, 278, 280, 282, 284, 286,
+    288, 290, 292, 294, 296, 298, 300, 302, 304, 306, 308, 310, 312, 314, 316, 318,
+    320, 322, 324, 326, 328, 330, 332, 334, 336, 338, 340, 342, 344, 346, 348, 350,
+    352, 354, 356, 358, 360, 362, 364, 366, 368, 370, 372, 374, 376, 378, 380, 382,
+    384, 386, 388, 390, 392, 394, 396, 398, 400, 402, 404, 406, 408, 410, 412, 414,
+    416, 418, 420, 422, 424, 426, 428, 430, 432, 434, 436, 438, 440, 442, 444, 446,
+    448, 450, 452, 454, 456, 458, 460, 462, 464, 466, 468, 470, 472, 474, 476, 478,
+    480, 482, 484, 486, 488, 490, 492, 494, 496, 498, 500, 502, 504, 506, 508, 510,
+    512, 514, 516, 518, 520, 522, 524, 526, 528, 530, 532, 534, 536, 538, 540, 542,
+    544, 546, 548, 550, 552, 554, 556, 558, 560, 562, 564, 566, 568, 570, 572, 574,
+    576, 578, 580, 582, 584, 586, 588, 590, 592, 594, 596, 598, 600, 602, 604, 606,
+    608, 610, 612, 614, 616, 618, 620, 622, 624, 626, 628, 630, 632, 634, 636, 638,
+    640, 642, 644, 646, 648, 650, 652, 654, 656, 658, 660, 662, 664, 666, 668, 670,
+    672, 674, 676, 678, 680, 682, 684, 686, 688, 690, 692, 694, 696, 698, 700, 702,
+    704, 706, 708, 710, 712, 714, 716, 718, 720, 722, 724, 726, 728, 730, 732, 734,
+    736, 738, 740, 742, 744, 746, 748, 750, 752, 754, 756, 758, 760, 762, 764, 766,
+    768, 770, 772, 774, 776, 778, 780, 782, 784, 786, 788, 790, 792, 794, 796, 798,
+    800, 802, 804, 806, 808, 810, 812, 814, 816, 818, 820, 822, 824, 826, 828, 830,
+    832, 834, 836, 838, 840, 842, 844, 846, 848, 850, 852, 854, 856, 858, 860, 862,
+    864, 866, 868, 870, 872, 874, 876, 878, 880, 882, 884, 886, 888, 890, 892, 894,
+    896, 898, 900, 902, 904, 906, 908, 910, 912, 914, 916, 918, 920, 922, 924, 926,
+    928, 930, 932, 934, 936, 938, 940, 942, 944, 946, 948, 950, 952, 954, 956, 958,
+    960, 962, 964, 966, 968, 970, 972, 974, 976, 978, 980, 982, 984, 986, 988, 990,
+    992, 994, 996, 998, 1000, 1002, 1004, 1006, 1008, 1010, 1012, 1014, 1016, 1018, 1020, 1022,
+    1024, 1026, 1028, 1030, 1032, 1034, 1036, 1038, 1040, 1042, 1044, 1046, 1048, 1050, 1052, 1054,
+    1056, 1058, 1060, 1062, 1064, 1066, 1068, 1070, 1072, 1074, 1076, 1078, 1080, 1082, 1084, 1086,
+    1088, 1090, 1092, 1094, 1096, 1098, 1100, 1102, 1104, 1106, 1108, 1110, 1112, 1114, 1116, 1118,
+    1120, 1122, 1124, 1126, 1128, 1130, 1132, 1134, 1136, 1138, 1140, 1142, 1144, 1146, 1148, 1150,
+    1152, 1154, 1156, 1158, 1160, 1162, 1164, 1166, 1168, 1170, 1172, 1174, 1176, 1178, 1180, 1182,
+    1184, 1186, 1188, 1190, 1192, 1194, 1196, 1198, 1200, 1202, 1204, 1206, 1208, 1210, 1212, 1214,
+    1216, 1218, 1220, 1222, 1224, 1226, 1228, 1230, 1232, 1234, 1236, 1238, 1240, 1242, 1244, 1246,
+    1248, 1250, 1252, 1254, 1256, 1258, 1260, 1262, 1264, 1266, 1268, 1270, 1272, 1274, 1276, 1278,
+    1280, 1282, 1284, 1286, 1288, 1290, 1292, 1294, 1296, 1298, 1300, 1302, 1304, 1306, 1308, 1310,
+    1312, 1314, 1316, 1318, 1320, 1322, 1324, 1326, 1328, 1330, 1332, 1334, 1336, 1338, 1340, 1342,
+    1344, 1346, 1348, 1350, 1352, 1354, 1356, 1358, 1360, 1362, 1364, 1366, 1368, 1370, 1372, 1374,
+    1376, 1378, 1380, 1382, 1384, 1386, 1388, 1390, 1392, 1394, 1396, 1398, 1400, 1402, 1404, 1406,
+    1408, 1410, 1412, 1414, 1416, 1418, 1420, 1422, 1424, 1426, 1428, 1430, 1432, 1434, 1436, 1438,
+    1440, 1442, 1444, 1446, 1448, 1450, 1452, 1454, 1456, 1458, 1460, 1462, 1464, 1466, 1468, 1470,
+    1472, 1474, 1476, 1478, 1480, 1482, 1484, 1486, 1488, 1490, 1492, 1494, 1496, 1498, 1500, 1502,
+    1504, 1506, 1508, 1510, 1512, 1514, 1516, 1518, 1520, 1522, 1524, 1526, 1528, 1530, 1532, 1534,
+    1536, 1538, 1540, 1542, 1544, 1546, 1548, 1550, 1552, 1554, 1556, 1558, 1560, 1562, 1564, 1566,
+    1568, 1570, 1572, 1574, 1576, 1578, 1580, 1582, 1584, 1586, 1588, 1590, 1592, 1594, 1596, 1598,
+    1600, 1602, 1604, 1606, 1608, 1610, 1612, 1614, 1616, 1618, 1620, 1622, 1624, 1626, 1628, 1630,
+    1632, 1634, 1636, 1638, 1640, 1642, 1644, 1646, 1648, 1650, 1652, 1654, 1656, 1658, 1660, 1662,
+    1664, 1666, 1668, 1670, 1672, 1674, 1676, 1678, 1680, 1682, 1684, 1686, 1688, 1690, 1692, 1694,
+    1696, 1698, 1700, 1702, 1704, 1706, 1708, 1710, 1712, 1714, 1716, 1718, 1720, 1722, 1724, 1726,
+    1728, 1730, 1732, 1734, 1736, 1738, 1740, 1742, 1744, 1746, 1748, 1750, 1752, 1754, 1756, 1758,
+    1760, 1762, 1764, 1766, 1768, 1770, 1772, 1774, 1776, 1778, 1780, 1782, 1784, 1786, 1788, 1790,
+    1792, 1794, 1796, 1798, 1800, 1802, 1804, 1806, 1808, 1810, 1812, 1814, 1816, 1818, 1820, 1822,
+    1824, 1826, 1828, 1830, 1832, 1834, 1836, 1838, 1840, 1842, 1844, 1846, 1848, 1850, 1852, 1854,
+    1856, 1858, 1860, 1862, 1864, 1866, 1868, 1870, 1872, 1874, 1876, 1878, 1880, 1882, 1884, 1886,
+    1888, 1890, 1892, 1894, 1896, 1898, 1900, 1902, 1904, 1906, 1908, 1910, 1912, 1914, 1916, 1918,
+    1920, 1922, 1924, 1926, 1928, 1930, 1932, 1934, 1936, 1938, 1940, 1942, 1944, 1946, 1948, 1950,
+    1952, 1954, 1956, 1958, 1960, 1962, 1964, 1966, 1968, 1970, 1972, 1974, 1976, 1978, 1980, 1982,
+    1984, 1986, 1988, 1990, 1992, 1994, 1996, 1998, 2000, 2002, 2004, 2006, 2008, 2010, 2012, 2014,
+    2016, 2018, 2020, 2022, 2024, 2026, 2028, 2030, 2032, 2034, 2036, 2038, 2040, 2042, 2044, 2046,
+    2048, 2050, 2052, 2054, 2056, 2058, 2060, 2062, 2064, 2066, 2068, 2070, 2072, 2074, 2076, 2078,
+    2080, 2082, 2084, 2086, 2088, 2090, 2092, 2094
+};
+
+constexpr int32_t weakLeafBegin[1048] = {
+    0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45,
+    48, 51, 54, 57, 60, 63, 66, 69, 72, 75, 78, 81, 84, 87, 90, 93,
+    96, 99, 102, 105, 108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141,
+    144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174, 177, 180, 183, 186, 189,
+    192, 195, 198, 201, 204, 207, 210, 213, 216, 219, 222, 225, 228, 231, 234, 237,
+    240, 243, 246, 249, 252, 255, 258, 261, 264, 267, 270, 273, 276, 279, 282, 285,
+    288, 291, 294, 297, 300, 303, 306, 309, 312, 315, 318, 321, 324, 327, 330, 333,
+    336, 339, 342, 345, 348, 351, 354, 357, 360, 363, 366, 369, 372, 375, 378, 381,
+    384, 387, 390, 393, 396, 399, 402, 405, 408, 411, 414, 417, 420, 423, 426, 429,
+    432, 435, 438, 441, 444, 447, 450, 453, 456, 459, 462, 465, 468, 471, 474, 477,
+    480, 483, 486, 489, 492, 495, 498, 501, 504, 507, 510, 513, 516, 519, 522, 525,
+    528, 531, 534, 537, 540, 543, 546, 549, 552, 555, 558, 561, 564, 567, 570, 573,
+    576, 579, 582, 585, 588, 591, 594, 597, 600, 603, 606, 609, 612, 615, 618, 621,
+    624, 627, 630, 633, 636, 639, 642, 645, 648, 651, 654, 657, 660, 663, 666, 669,
+    672, 675, 678, 681, 684, 687, 690, 693, 696, 699, 702, 705, 708, 711, 714, 717,
+    720, 723, 726, 729, 732, 735, 738, 741, 744, 747, 750, 753, 756, 759, 762, 765,
+    768, 771, 774, 777, 780, 783, 786, 789, 792, 795, 798, 801, 804, 807, 810, 813,
+    816, 819, 822, 825, 828, 831, 834, 837, 840, 843, 846, 849, 852, 855, 858, 861,
+    864, 867, 870, 873, 876, 879, 882, 885, 888, 891, 894, 897, 900, 903, 906, 909,
+    912, 915, 918, 921, 924, 927, 930, 933, 936, 939, 942, 945, 948, 951, 954, 957,
+    960, 963, 966, 969, 972, 975, 978, 981, 984, 987, 990, 993, 996, 999, 1002, 1005,
+    1008, 1011, 1014, 1017, 1020, 1023, 1026, 1029, 1032, 1035, 1038, 1041, 1044, 1047, 1050, 1053,
+    1056, 1059, 1062, 1065, 1068, 1071, 1074, 1077, 1080, 1083, 1086, 1089, 1092, 1095, 1098, 1101,
+    1104, 1107, 1110, 1113, 1116, 1119, 1122, 1125, 1128, 1131, 1134, 1137, 1140, 1143, 1146, 1149,
+    1152, 1155, 1158, 1161, 1164, 1167, 1170, 1173, 1176, 1179, 1182, 1185, 1188, 1191, 1194, 1197,
+    1200, 1203, 1206, 1209, 1212, 1215, 1218, 1221, 1224, 1227, 1230, 1233, 1236, 1239, 1242, 1245,
+    1248, 1251, 1254, 1257, 1260, 1263, 1266, 1269, 1272, 1275, 1278, 1281, 1284, 1287, 1290, 1293,
+    1296, 1299, 1302, 1305, 1308, 1311, 1314, 1317, 1320, 1323, 1326, 1329, 1332, 1335, 1338, 1341,
+    1344, 1347, 1350, 1353, 1356, 1359, 1362, 1365, 1368, 1371, 1374, 1377, 1380, 1383, 1386, 1389,
+    1392, 1395, 1398, 1401, 1404, 1407, 1410, 1413, 1416, 1419, 1422, 1425, 1428, 1431, 1434, 1437,
+    1440, 1443, 1446, 1449, 1452, 1455, 1458, 1461, 1464, 1467, 1470, 1473, 1476, 1479, 1482, 1485,
+    1488, 1491, 1494, 1497, 1500, 1503, 1506, 1509, 1512, 1515, 1518, 1521, 1524, 1527, 1530, 1533,
+    1536, 1539, 1542, 1545, 1548, 1551, 1554, 1557, 1560, 1563, 1566, 1569, 1572, 1575, 1578, 1581,
+    1584, 1587, 1590, 1593, 1596, 1599, 1602, 1605, 1608, 1611, 1614, 1617, 1620, 1623, 1626, 1629,
+    1632, 1635, 1638, 1641, 1644, 1647, 1650, 1653, 1656, 1659, 1662, 1665, 1668, 1671, 1674, 1677,
+    1680, 1683, 1686, 1689, 1692, 1695, 1698, 1701, 1704, 1707, 1710, 1713, 1716, 1719, 1722, 1725,
+    1728, 1731, 1734, 1737, 1740, 1743, 1746, 1749, 1752, 1755, 1758, 1761, 1764, 1767, 1770, 1773,
+    1776, 1779, 1782, 1785, 1788, 1791, 1794, 1797, 1800, 1803, 1806, 1809, 1812, 1815, 1818, 1821,
+    1824, 1827, 1830, 1833, 1836, 1839, 1842, 1845, 1848, 1851, 1854, 1857, 1860, 1863, 1866, 1869,
+    1872, 1875, 1878, 1881, 1884, 1887, 1890, 1893, 1896, 1899, 1902, 1905, 1908, 1911, 1914, 1917,
+    1920, 1923, 1926, 1929, 1932, 1935, 1938, 1941, 1944, 1947, 1950, 1953, 1956, 1959, 1962, 1965,
+    1968, 1971, 1974, 1977, 1980, 1983, 1986, 1989, 1992, 1995, 1998, 2001, 2004, 2007, 2010, 2013,
+    2016, 2019, 2022, 2025, 2028, 2031, 2034, 2037, 2040, 2043, 2046, 2049, 2052, 2055, 2058, 2061,
+    2064, 2067, 2070, 2073, 2076, 2079, 2082, 2085, 2088, 2091, 2094, 2097, 2100, 2103, 2106, 2109,
+    2112, 2115, 2118, 2121, 2124, 2127, 2130, 2133, 2136, 2139, 2142, 2145, 2148, 2151, 2154, 2157,
+    2160, 2163, 2166, 2169, 2172, 2175, 2178, 2181, 2184, 2187, 2190, 2193, 2196, 2199, 2202, 2205,
+    2208, 2211, 2214, 2217, 2220, 2223, 2226, 2229, 2232, 2235, 2238, 2241, 2244, 2247, 2250, 2253,
+    2256, 2259, 2262, 2265, 2268, 2271, 2274, 2277, 2280, 2283, 2286, 2289, 2292, 2295, 2298, 2301,
+    2304, 2307, 2310, 2313, 2316, 2319, 2322, 2325, 2328, 2331, 2334, 2337, 2340, 2343, 2346, 2349,
+    2352, 2355, 2358, 2361, 2364, 2367, 2370, 2373, 2376, 2379, 2382, 2385, 2388, 2391, 2394, 2397,
+    2400, 2403, 2406, 2409, 2412, 2415, 2418, 2421, 2424, 2427, 2430, 2433, 2436, 2439, 2442, 2445,
+    2448, 2451, 2454, 2457, 2460, 2463, 2466, 2469, 2472, 2475, 2478, 2481, 2484, 2487, 2490, 2493,
+    2496, 2499, 2502, 2505, 2508, 2511, 2514, 2517, 2520, 2523, 2526, 2529, 2532, 2535, 2538, 2541,
+    2544, 2547, 2550, 2553, 2556, 2559, 2562, 2565, 2568, 2571, 2574, 2577, 2580, 2583, 2586, 2589,
+    2592, 2595, 2598, 2601, 2604, 2607, 2610, 2613, 2616, 2619, 2622, 2625, 2628, 2631, 2634, 2637,
+    2640, 2643, 2646, 2649, 2652, 2655, 2658, 2661, 2664, 2667, 2670, 2673, 2676, 2679, 2682, 2685,
+    2688, 2691, 2694, 2697, 2700, 2703, 2706, 2709, 2712, 2715, 2718, 2721, 2724, 2727, 2730, 2733,
+    2736, 2739, 2742, 2745, 2748, 2751, 2754, 2757, 2760, 2763, 2766, 2769, 2772, 2775, 2778, 2781,
+    2784, 2787, 2790, 2793, 2796, 2799, 2802, 2805, 2808, 2811, 2814, 2817, 2820, 2823, 2826, 2829,
+    2832, 2835, 2838, 2841, 2844, 2847, 2850, 2853, 2856, 2859, 2862, 2865, 2868, 2871, 2874, 2877,
+    2880, 2883, 2886, 2889, 2892, 2895, 2898, 2901, 2904, 2907, 2910, 2913, 2916, 2919, 2922, 2925,
+    2928, 2931, 2934, 2937, 2940, 2943, 2946, 2949, 2952, 2955, 2958, 2961, 2964, 2967, 2970, 2973,
+    2976, 2979, 2982, 2985, 2988, 2991, 2994, 2997, 3000, 3003, 3006, 3009, 3012, 3015, 3018, 3021,
+    3024, 3027, 3030, 3033, 3036, 3039, 3042, 3045, 3048, 3051, 3054, 3057, 3060, 3063, 3066, 3069,
+    3072, 3075, 3078, 3081, 3084, 3087, 3090, 3093, 3096, 3099, 3102, 3105, 3108, 3111, 3114, 3117,
+    3120, 3123, 3126, 3129, 3132, 3135, 3138, 3141
+};
+
+constexpr int32_t nodeLeft[2094] = {
+    0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1,
+    0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 1, -1, 1, -1,
+    1, -1, 0, -1, 1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1,
+    1, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1,
+    1, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 1, -1, 1, -1,
+    0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 1, -1, 1, -1, 0, -1,
+    0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1,
+    1, -1, 1, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1,
+    1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1,
+    0, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 0, -1,
+    1, -1, 0, -1, 0, -1, 1, -1, 0, -1, 1, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 1, -1, 1, -1,
+    1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    1, -1, 1, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1,
+    0, -1, 1, -1, 0, -1, 1, -1, 0, -1, 0, -1, 1, -1, 1, -1,
+    0, -1, 0, -1, 1, -1, 0, -1, 1, -1, 0, -1, 1, -1, 1, -1,
+    1, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    0, -1, 0, -1, 1, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1,
+    1, -1, 1, -1, 0, -1, 1, -1, 0, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 1, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1,
+    0, -1, 1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1, 0, -1,
+    0, -1, 1, -1, 1, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 1, -1, 1, -1,
+    0, -1, 1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1,
+    1, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1,
+    0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1,
+    1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 1, -1,
+    1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 1, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1, 1, -1,
+    0, -1, 1, -1, 0, -1, 1, -1, 0, -1, 0, -1, 1, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1,
+    1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1,
+    1, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 1, -1, 1, -1, 0, -1,
+    1, -1, 1, -1, 0, -1, 1, -1, 1, -1, 1, -1, 0, -1, 0, -1,
+    0, -1, 1, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1,
+    0, -1, 1, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1,
+    1, -1, 1, -1, 0, -1, 1, -1, 1, -1, 0, -1, 1, -1, 1, -1,
+    0, -1, 1, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1, 0, -1,
+    0, -1, 1, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 0, -1, 1, -1, 0, -1, 1, -1, 0, -1, 1, -1, 0, -1,
+    0, -1, 1, -1, 1, -1, 0, -1, 1, -1, 1, -1, 1, -1, 0, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 0, -1, 1, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 0, -1, 1, -1,
+    0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 0, -1,
+    1, -1, 1, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1,
+    1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 0, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 0, -1, 0, -1,
+    0, -1, 1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1,
+    1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 1, -1, 0, -1, 1, -1,
+    1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 1, -1, 1, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 0, -1, 1, -1, 1, -1, 0, -1,
+    1, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1,
+    1, -1, 0, -1, 1, -1, 0, -1, 0, -1, 1, -1, 0, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1,
+    1, -1, 0, -1, 1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1,
+    1, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1, 1, -1,
+    1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 1, -1,
+    0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1,
+    0, -1, 1, -1, 0, -1, 1, -1, 1, -1, 0, -1, 1, -1, 1, -1,
+    0, -1, 1, -1, 0, -1, 1, -1, 0, -1, 0, -1, 1, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    1, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 0, -1, 0, -1,
+    1, -1, 1, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 0, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 1, -1,
+    1, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 1, -1,
+    1, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 0, -1,
+    1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 1, -1,
+    1, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1,
+    1, -1, 0, -1, 0, -1, 1, -1, 0, -1, 1, -1, 0, -1, 0, -1,
+    1, -1, 1, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1,
+    1, -1, 0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1,
+    1, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 0, -1,
+    0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 1, -1, 0, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1, 1, -1,
+    0, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 1, -1, 0, -1,
+    1, -1, 1, -1, 0, -1, 1, -1, 1, -1, 0, -1, 1, -1, 0, -1,
+    0, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1, 0, -1,
+    0, -1, 1, -1, 1, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1,
+    0, -1, 0, -1, 1, -1, 0, -1, 1, -1, 1, -1, 0, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1,
+    0, -1, 1, -1, 0, -1, 1, -1, 1, -1, 0, -1, 0, -1, 1, -1,
+    1, -1, 1, -1, 0, -1, 1, -1, 1, -1, 1, -1, 0, -1, 1, -1,
+    1, -1, 1, -1, 0, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 1, -1,
+    1, -1, 1, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 1, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 0, -1, 1, -1, 0, -1, 0, -1, 1, -1, 0, -1
+};
+
+constexpr int32_t nodeRight[2094] = {
+    1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2,
+    1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 0, -2, 0, -2,
+    0, -2, 1, -2, 0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2,
+    0, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 0, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2,
+    0, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 0, -2, 0, -2,
+    1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 0, -2, 0, -2, 1, -2,
+    1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2,
+    0, -2, 0, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2,
+    0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2,
+    1, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 1, -2,
+    0, -2, 1, -2, 1, -2, 0, -2, 1, -2, 0, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 0, -2, 0, -2,
+    0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    0, -2, 0, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2,
+    1, -2, 0, -2, 1, -2, 0, -2, 1, -2, 1, -2, 0, -2, 0, -2,
+    1, -2, 1, -2, 0, -2, 1, -2, 0, -2, 1, -2, 0, -2, 0, -2,
+    0, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2,
+    1, -2, 1, -2, 0, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2,
+    0, -2, 0, -2, 1, -2, 0, -2, 1, -2, 0, -2, 0, -2, 0, -2,
+    0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 0, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 0, -2,
+    1, -2, 0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2, 1, -2,
+    1, -2, 0, -2, 0, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 0, -2, 0, -2,
+    1, -2, 0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2, 0, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2,
+    0, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2,
+    1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2,
+    0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 0, -2,
+    0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 0, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2, 0, -2,
+    1, -2, 0, -2, 1, -2, 0, -2, 1, -2, 1, -2, 0, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2,
+    0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2,
+    0, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 0, -2, 0, -2, 1, -2,
+    0, -2, 0, -2, 1, -2, 0, -2, 0, -2, 0, -2, 1, -2, 1, -2,
+    1, -2, 0, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2,
+    0, -2, 0, -2, 1, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2,
+    1, -2, 0, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2,
+    0, -2, 0, -2, 1, -2, 0, -2, 0, -2, 1, -2, 0, -2, 0, -2,
+    1, -2, 0, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2, 1, -2,
+    1, -2, 0, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2,
+    0, -2, 1, -2, 0, -2, 1, -2, 0, -2, 1, -2, 0, -2, 1, -2,
+    1, -2, 0, -2, 0, -2, 1, -2, 0, -2, 0, -2, 0, -2, 1, -2,
+    0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 1, -2, 0, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 1, -2, 0, -2,
+    1, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 1, -2,
+    0, -2, 0, -2, 1, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2,
+    0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2,
+    0, -2, 0, -2, 0, -2, 0, -2, 1, -2, 0, -2, 0, -2, 0, -2,
+    0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 1, -2, 1, -2,
+    1, -2, 0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2,
+    0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 0, -2, 1, -2, 0, -2,
+    0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 0, -2, 0, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2,
+    0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2, 0, -2, 0, -2,
+    0, -2, 0, -2, 0, -2, 0, -2, 1, -2, 0, -2, 0, -2, 1, -2,
+    0, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2,
+    0, -2, 1, -2, 0, -2, 1, -2, 1, -2, 0, -2, 1, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2,
+    0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2,
+    0, -2, 1, -2, 0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2,
+    0, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2, 0, -2,
+    0, -2, 0, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 0, -2,
+    0, -2, 0, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 0, -2,
+    1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2,
+    1, -2, 0, -2, 1, -2, 0, -2, 0, -2, 1, -2, 0, -2, 0, -2,
+    1, -2, 0, -2, 1, -2, 0, -2, 1, -2, 1, -2, 0, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    0, -2, 1, -2, 1, -2, 0, -2, 0, -2, 0, -2, 1, -2, 1, -2,
+    0, -2, 0, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 0, -2, 1, -2,
+    0, -2, 0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2, 0, -2,
+    0, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 0, -2,
+    0, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 1, -2,
+    0, -2, 0, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 0, -2,
+    0, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2,
+    0, -2, 1, -2, 1, -2, 0, -2, 1, -2, 0, -2, 1, -2, 1, -2,
+    0, -2, 0, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2,
+    0, -2, 1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2,
+    0, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 0, -2, 1, -2,
+    1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 0, -2, 1, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2, 0, -2,
+    1, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 0, -2, 1, -2,
+    0, -2, 0, -2, 1, -2, 0, -2, 0, -2, 1, -2, 0, -2, 1, -2,
+    1, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2, 1, -2,
+    1, -2, 0, -2, 0, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2, 0, -2,
+    1, -2, 1, -2, 0, -2, 1, -2, 0, -2, 0, -2, 1, -2, 0, -2,
+    0, -2, 0, -2, 0, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2,
+    1, -2, 0, -2, 1, -2, 0, -2, 0, -2, 1, -2, 1, -2, 0, -2,
+    0, -2, 0, -2, 1, -2, 0, -2, 0, -2, 0, -2, 1, -2, 0, -2,
+    0, -2, 0, -2, 1, -2, 0, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 0, -2,
+    0, -2, 0, -2, 1, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2,
+    0, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+    1, -2, 0, -2, 1, -2, 0, -2, 0, -2, 0, -2, 0, -2, 0, -2,
+    0, -2, 1, -2, 0, -2, 1, -2, 1, -2, 0, -2, 1, -2
+};
+
+constexpr int32_t nodeFeature[2094] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+    304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+    320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+    336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+    352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+    368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+    384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399,
+    400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415,
+    416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
+    432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
+    448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463,
+    464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
+    480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+    496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511,
+    512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
+    528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543,
+    544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559,
+    560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575,
+    576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639,
+    640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655,
+    656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671,
+    672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687,
+    688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703,
+    704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
+    720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735,
+    736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751,
+    752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767,
+    768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783,
+    784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799,
+    800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815,
+    816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831,
+    832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847,
+    848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863,
+    864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879,
+    880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895,
+    896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911,
+    912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927,
+    928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943,
+    944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959,
+    960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975,
+    976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991,
+    992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007,
+    1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+    1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039,
+    1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+    1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
+    1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+    1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+    1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119,
+    1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135,
+    1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151,
+    1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
+    1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
+    1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199,
+    1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
+    1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231,
+    1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247,
+    1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+    1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+    1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+    1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+    1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+    1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+    1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
+    1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375,
+    1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
+    1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407,
+    1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423,
+    1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439,
+    1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455,
+    1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471,
+    1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487,
+    1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+    1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519,
+    1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535,
+    1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551,
+    1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567,
+    1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
+    1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599,
+    1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615,
+    1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631,
+    1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647,
+    1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663,
+    1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679,
+    1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695,
+    1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711,
+    1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727,
+    1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743,
+    1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759,
+    1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775,
+    1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791,
+    1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807,
+    1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823,
+    1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839,
+    1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855,
+    1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871,
+    1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887,
+    1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903,
+    1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919,
+    1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
+    1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951,
+    1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967,
+    1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983,
+    1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999,
+    2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015,
+    2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031,
+    2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047,
+    2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063,
+    2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079,
+    2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093
+};
+
+constexpr float nodeThreshold[2094] = {
+    0.00432723295f, 0.0130761601f, 0.000524346018f, 0.00445730006f, -0.000927082612f, 0.000339891092f, 0.00230257399f, 0.00441743387f,
+    0.0222032107f, -0.000172831104f, 0.004356727f, -0.00260328897f, 0.00173096301f, -0.00781464018f, -0.00873434171f, 0.000945223204f,
+    0.0494148582f, 0.00448917504f, 0.0603136197f, -0.00107628503f, -0.00950832386f, 0.00766013097f, 0.00764676789f, -0.000846629322f,
+    -0.0048506218f, -0.00461416505f, -0.00243013096f, 0.000417879608f, 0.00100109295f, 0.00105771003f, 0.00123765494f, 0.00035315039f,
+    -0.0119536603f, 0.00141829997f, 0.00346429809f, -0.0149489501f, -0.00105068495f, -0.00407829182f, 0.000542428286f, -0.00732040592f,
+    0.00114212895f, 0.00117834006f, 0.0440771095f, 0.00379000907f, -0.0024291419f, 0.00942623243f, 0.00806302577f, 0.00522408122f,
+    -0.00706305681f, 0.00568975415f, 0.00124729297f, 0.0495434888f, -0.00493261497f, 2.79181404e-05f, 0.00308762002f, 7.46696605e-06f,
+    0.00187397294f, 0.000933802512f, 0.00191518501f, -0.00596837979f, -0.000721156015f, -0.00596631179f, 0.0308741797f, -0.0110997101f,
+    0.00211641798f, -0.00943174399f, -0.00352660194f, -0.00169075595f, 0.000464709301f, -0.0102155702f, 0.00126347097f, -0.0118752997f,
+    -0.0107323397f, 0.00718364818f, -0.0283408891f, -0.000458132301f, 0.00429403409f, 0.0107510798f, 0.0224651191f, -0.0579885393f,
+    0.00721108913f, -0.0483675711f, -0.01441806f, -0.0231563896f, 0.00769853406f, -0.00562486192f, -0.000729367486f, 0.000617838989f,
+    -4.58039394e-05f, -1.47193596e-05f, -0.00134693703f, -0.00247747893f, 0.0052632778f, 0.00490753399f, -0.00232543494f, -0.00146654795f,
+    -0.123116903f, 0.00221083406f, 0.0020661531f, 0.000361302809f, 0.0799578726f, 0.002606472f, 0.00656990102f, 0.00162596104f,
+    0.00362049812f, -0.00443919515f, -0.00905409455f, -0.000460674812f, -0.00566210411f, 0.00511658378f, -0.00213623396f, -0.00548099214f,
+    -0.00810619071f, 0.00600487087f, -0.0870285481f, -0.00478096399f, -0.00221666601f, 0.00136427302f, -0.0090077864f, -0.0154941203f,
+    -0.00421650289f, 0.0432497598f, 0.000287865114f, 0.00123731501f, 0.00195283f, -0.00149470603f, 0.00358786806f, -0.00259386911f,
+    0.00358106801f, -0.00285523501f, 0.00197585393f, 0.00325831189f, 0.000237116794f, 0.00259425002f, -0.0250324495f, 0.00630879495f,
+    -0.00324949203f, -0.0148857301f, 0.00806232169f, 0.0274056792f, 0.0343686007f, -0.0272929706f, 0.00074452121f, 0.000703362806f,
+    -0.122754604f, 0.00325599289f, -0.0320903994f, 0.00329579995f, -0.00322731701f, 0.00111716695f, -0.0172799509f, 0.0117412005f,
+    0.00464052288f, -0.0169130303f, 0.0100601697f, -0.000607154914f, -0.00108654005f, 0.00893620774f, -0.000263726601f, 0.01311005f,
+    -0.00298062805f, -0.00416195719f, 0.0338423289f, -0.00125645602f, -0.0196352303f, -0.000996254967f, -0.0231271107f, 0.0235257093f,
+    -0.0193565208f, -0.00417871121f, 0.00314887799f, 0.00739722792f, 7.1955119e-06f, 0.0471144095f, 0.00728787109f, -0.0061887512f,
+    0.00297573209f, -0.00184498099f, 0.000102395403f, 0.00242770091f, -0.0647513121f, 0.000393801514f, 0.00143974402f, -0.000540685607f,
+    -7.12379597e-06f, -0.00236610393f, 0.00173432694f, 0.001587459f, 0.0037285639f, -0.128838196f, 0.00794121809f, -0.0126617299f,
+    3.01467899e-05f, -0.0163301602f, 1.46227703e-05f, -0.0208586603f, 0.00281945593f, 0.00378993689f, 0.0353446417f, -0.00115716003f,
+    -0.00587427523f, -1.52017801e-05f, -0.000226818796f, 0.00378456898f, -8.52959929e-05f, -0.0443948917f, 0.00101260305f, -0.00763277803f,
+    0.00403304119f, 0.136766896f, -0.0050060479f, -0.0124758398f, -0.000940122583f, -0.0121919801f, -0.000549594813f, -0.000218024303f,
+    0.00691157999f, -0.00097631698f, -0.00878701732f, -0.00167610298f, -0.0556949489f, -0.0198443793f, -0.000747516111f, 0.0230328906f,
+    -0.00307002803f, -0.00116368395f, 0.224643394f, 0.00144121097f, -0.0300112497f, -0.0530789606f, 0.00208009291f, -0.00407381821f,
+    -0.0195293706f, -0.0533094704f, -0.0348495618f, -0.1265845f, 7.33251181e-06f, -0.0118438704f, -0.00484706787f, 0.00816939771f,
+    -0.00647167908f, -1.51884797e-05f, 0.0030696711f, -0.000162967204f, -0.00982758589f, -0.00416938588f, 0.000353413197f, 0.00480545498f,
+    0.000210711805f, -0.00283188699f, -7.56336794e-06f, -0.000828881399f, 0.00162092596f, 0.00913389586f, -0.00412122905f, -0.00254472904f,
+    -0.000626527821f, -3.65963315e-05f, 0.0138827199f, 0.00104937004f, 0.0182153601f, -0.0113345804f, -0.00410975609f, 0.000426128914f,
+    0.00603015488f, 0.000335877092f, 0.00062279508f, -0.0258371197f, 0.0217749104f, 0.00176822999f, -0.0137938103f, -0.00508528296f,
+    0.00617950177f, 0.0100303199f, -0.00642019277f, -0.00569612812f, -0.00714981603f, 0.00244507403f, -0.0375034101f, 0.000477994414f,
+    -0.00708060805f, 0.0328180008f, 0.000651889888f, 0.0046485588f, -0.00198279298f, -0.00160113105f, -0.00305399392f, 0.000432120403f,
+    -0.0274521206f, 0.0009309944f, 0.006714419f, -0.00337016908f, -0.0189039595f, -0.00658508716f, 0.00588105014f, 0.000800920825f,
+    0.00185105798f, 0.00632736506f, -0.00338209304f, -0.001929297f, 0.0149952201f, -0.0263307504f, -0.00417342223f, 0.0272683501f,
+    0.00098880264f, -0.00105288497f, 0.00522880722f, 0.0303954594f, -0.0791139305f, 0.0182316694f, 0.00522880722f, 0.000439228286f,
+    -0.000865019625f, 0.00103269797f, -0.00729977479f, -0.000936290424f, -0.00604832312f, 0.0067529222f, 0.0530780293f, -0.00102258101f,
+    0.0312706493f, -0.00635221694f, -0.00622156309f, 0.002109739f, 0.0108458595f, 0.000642304018f, 0.000733117224f, 0.00101342006f,
+    0.0110935597f, -0.00791275315f, 0.0129053099f, -0.00424309121f, -0.000213043095f, -0.00223086402f, 0.002640052f, 0.0751010329f,
+    -0.00770129682f, 0.00155883702f, -0.000476879388f, 0.000842347275f, -0.01282511f, -0.000651565671f, -0.0120061599f, 0.00132134196f,
+    -0.0203074403f, 0.00401809299f, 0.00453153113f, -0.00443817396f, 0.00156920101f, -0.00495164422f, -0.0274296794f, 0.00141819695f,
+    -0.0130789401f, -0.00350927794f, 0.0189207308f, 0.00216833502f, 0.00164015905f, 0.000140059201f, -0.00331375911f, -0.00294590299f,
+    0.000136122297f, 0.000605120324f, -0.0175139904f, -0.0187350307f, 0.01206565f, -0.00265441788f, 0.00145012897f, 0.0109540196f,
+    0.0157717094f, -0.0142526897f, 3.04118603e-05f, 0.0234862994f, 0.00522054499f, -0.0258124303f, -0.00195266504f, -0.00814700499f,
+    0.00329624489f, -0.001396131f, -0.00410554418f, -0.0108887795f, -0.00767684216f, -0.00977297872f, 0.00604397105f, -0.000461346412f,
+    0.0579923615f, 0.000593849807f, -0.00623534806f, -0.0127849299f, 0.000419736694f, 0.000806468015f, -0.00163390103f, -0.00482999999f,
+    -0.00639920682f, 0.108191997f, 0.000650565606f, 0.0206112508f, -0.02512905f, 0.00179229397f, 0.00156262203f, -0.000618987309f,
+    0.00481114211f, 0.00224842294f, -0.0301472396f, 0.275486797f, 0.00368946302f, 0.0072957701f, -0.0562110692f, -0.00264785602f,
+    -0.00145340001f, 0.00285409205f, 0.000582430221f, 0.000925094821f, 0.0198064409f, 0.000703956117f, 0.00255637802f, 0.00108241604f,
+    -0.00092893769f, -0.0180097297f, 0.00235001906f, 0.000818224915f, 0.000620953215f, 0.000967809698f, 0.000480002112f, 9.05386405e-05f,
+    -0.0439147986f, -0.00565013383f, 0.00386614911f, -6.30694267e-05f, 0.0525337383f, 0.00138186605f, -0.000892640674f, 0.0855795071f,
+    -0.000183433396f, -0.00979248155f, 0.0144286202f, -0.0456870012f, -0.00257630902f, -0.0383018591f, 0.00289782905f, -0.00251650601f,
+    0.000562819827f, 0.00366843911f, 0.00213197898f, 0.00760373101f, -0.0001166808f, 0.003165951f, -0.0225694999f, 0.000271296012f,
+    -0.0154344598f, -0.00848616567f, -0.1180747f, -0.00123000797f, -0.00702903513f, 0.00893252064f, -0.0477359816f, -0.0441555791f,
+    -0.0259834807f, -0.00478858314f, 0.00674234517f, 0.0116547504f, -0.00569827296f, -0.00729833497f, 0.0079091778f, -0.000158749797f,
+    -0.00622358778f, 0.00133088604f, 0.00520552788f, 0.0140651697f, -0.00673841499f, 0.00334067806f, -0.0118806995f, 0.00142263796f,
+    0.00298581296f, -0.00204815809f, 0.00171227299f, -0.0169808697f, -0.00112904701f, 0.00286200596f, -0.0038065759f, 0.00590902707f,
+    0.00110043702f, -0.00233962992f, -0.00360681606f, 0.0408311896f, -0.00710822502f, -0.000937597302f, -0.00167408201f, 0.0882877037f,
+    0.000820096291f, -0.000766246172f, 0.000657696684f, -0.00213047909f, -0.000373170507f, -0.0111722304f, 0.0434352197f, 0.000967361615f,
+    -0.00314528891f, 0.001523313f, 0.00208542799f, 0.0360982008f, 0.00161795702f, -0.000621323008f, 0.000718785392f, -0.03933952f,
+    -0.00109888299f, 0.0021191421f, 0.00523598911f, -0.00221698894f, -0.00823035929f, -0.00823035929f, 0.000453432614f, -0.000417770614f,
+    0.00278237695f, -6.03618682e-05f, 0.00350617897f, 0.000170131199f, -0.00233789301f, -0.00213691709f, 0.00102504005f, -4.47262209e-05f,
+    0.000571022916f, 0.000577430124f, 0.000796920911f, 0.000359459489f, 0.000439739f, -0.00089061429f, 0.00541102421f, -0.00085764908f,
+    -0.0220006499f, -0.00787316822f, -0.0274444595f, 0.00197922694f, -0.0056783692f, 1.50572196e-05f, -0.00541367102f, 0.00536792399f,
+    -0.00314266607f, 0.0109073902f, 0.00584367616f, 9.05072302e-05f, -0.0163457897f, 0.00159875001f, -0.00402579783f, -0.00677504716f,
+    -0.00324706896f, 0.00154096202f, -0.0128581198f, -0.000148246705f, -0.00902108103f, -0.02879503f, 0.00902108103f, 0.00741211791f,
+    -0.0037217529f, 0.198658898f, 1.52087196e-05f, -0.00390899181f, 0.0025106289f, 0.000239216606f, 0.00694431318f, 0.00120656297f,
+    0.0025106289f, 0.00175140402f, -0.00419782102f, 0.00130928506f, 0.000673961826f, -0.0105307102f, -0.406722993f, -0.0263145491f,
+    0.00225571496f, 0.0121548604f, -0.0184365399f, 0.000536761479f, -0.00262655411f, -0.000511198072f, 0.000414548413f, -0.000550287485f,
+    -0.00103477202f, -0.00339666312f, 0.00317959092f, -0.000165289501f, 0.00837252103f, -0.002579981f, 0.000901943888f, 0.000369522109f,
+    0.000997461379f, -0.00366880395f, -0.000895010307f, 0.00519049214f, 0.000422744401f, 0.00851767138f, -0.0366236083f, -0.00411037123f,
+    -0.00660173316f, 0.0255786404f, 0.0114474399f, 0.000724275014f, 0.00971275009f, -0.0113375699f, -0.00814538822f, -0.00855707563f,
+    0.0022993309f, 0.00384309306f, -0.000991165405f, 0.0254964698f, -0.0157483593f, -0.0180461202f, 0.0103233904f, 0.00164522405f,
+    0.0158811491f, 0.0105865197f, -0.0215316899f, 0.00524804695f, 0.00182193401f, 0.00813139416f, 0.00170559797f, -7.44835488e-05f,
+    0.000383423903f, 0.00318689109f, 0.160443202f, -0.00672855601f, 7.26384815e-06f, 0.000555511971f, -0.0108223204f, -0.00458340207f,
+    -0.00302050705f, 0.0778646171f, 0.0264943801f, 0.0369121097f, 0.0057857791f, 0.000938497717f, -0.0110032f, -0.001173764f,
+    -0.00365966698f, -0.00248227501f, -0.00446060719f, -0.00359696499f, -0.00362225599f, 0.00120593398f, 0.00431249384f, -0.00449612504f,
+    -0.00138606899f, -0.000515884603f, 7.03300029e-05f, -0.000209765494f, 0.00136422599f, 0.00154836604f, 0.191796094f, -0.00447769091f,
+    -0.1264918f, 6.52533272e-05f, 0.00418564212f, 0.000274782302f, -0.002290681f, 0.00167445f, 0.00123497599f, -0.00871587545f,
+    0.00466136215f, -0.00858159922f, 0.0143521205f, -0.00779487193f, -0.00341556803f, -0.00426390907f, 0.00871776976f, -0.00322326296f,
+    -0.0421883687f, 0.0198757499f, -0.0311345104f, 0.00570323877f, 0.00527336821f, -0.0031231069f, 0.000464538491f, 0.0303558894f,
+    -0.00429927697f, 0.000195091998f, -0.00777844805f, 0.0169175994f, -0.0519485697f, -0.00547512202f, 1.52108396e-05f, 0.00102355797f,
+    -0.000104277198f, 0.00878537819f, 0.0034012699f, 0.000585823786f, -0.002297336f, -0.0143301897f, 0.000985659659f, -0.0466407612f,
+    -0.119073004f, 0.0193332806f, 0.0314278491f, 0.000200821305f, -0.00625849003f, 0.00828610454f, 0.00205297093f, 0.00325248693f,
+    -0.0318849012f, 0.00183793402f, -0.000485126802f, -0.00254078791f, -0.00515590608f, -0.0449687503f, 0.00589842815f, 0.00327631203f,
+    -0.000101615202f, -0.000162903001f, 0.00905413646f, 0.0353984907f, 0.0056469352f, -0.00248071901f, -0.00410887878f, -0.00207144697f,
+    -0.00289390609f, 0.00134672795f, -0.0907791331f, -0.0831717625f, -0.00141070003f, 0.0556687601f, 0.0577015392f, -0.425032914f,
+    -0.000443807192f, 0.000179247698f, 0.00503824698f, 0.0151911704f, -0.0123003898f, 0.00151680305f, 0.000957545475f, -0.0189622007f,
+    -0.0222722609f, -0.0251452308f, 0.0195339005f, -0.00112313498f, -0.00148611399f, 0.000350028888f, -0.00112313498f, 0.0104097398f,
+    -0.0878325626f, 0.00165848795f, -0.00230087503f, 0.03302617f, -0.00135850697f, 0.00078067492f, -0.0180257596f, 0.00123549101f,
+    -0.000925830274f, 0.000801239978f, 0.00249148393f, -0.0504885986f, -0.000778383517f, 0.000235728905f, 0.00455750711f, 0.00812419876f,
+    -0.000446121587f, -0.000289729389f, 7.16048316e-06f, -0.000384977087f, 0.000194898603f, -0.0170838498f, 0.000835136976f, 0.000754996086f,
+    0.00802167132f, -0.0389305092f, -7.03487676e-05f, -0.00853505731f, 0.0108544501f, 0.000453295012f, 0.000181171505f, 0.0004664156f,
+    -0.00848547928f, -0.0189343095f, 0.00498145493f, 0.00342867803f, 0.000442037912f, 0.000238225504f, -0.00642616395f, 0.00996377692f,
+    0.0136540504f, -0.0099892877f, 0.0365586318f, 4.89993799e-05f, 0.0136540504f, 0.001880278f, -0.0136540504f, 0.00127787003f,
+    0.000988433952f, 1.45115e-05f, -0.000227754295f, -0.0147537403f, -0.00341482507f, 0.0075806682f, -0.00577346887f, 7.40336691e-05f,
+    -0.0082278084f, 0.00533809094f, -0.00270491093f, 0.00773413386f, 0.0108866096f, 0.0110386601f, -0.0100542f, 0.00770728802f,
+    -0.00058278098f, -0.00257392204f, -0.00701677613f, -0.00177272898f, -0.0163182896f, -0.0116630001f, 0.00258814893f, -0.0037328999f,
+    -0.001435593f, 0.00183408998f, 0.122802898f, 0.0502287f, -0.0214370005f, -0.0310096201f, -0.0129737202f, 0.00158180203f,
+    -0.00978062488f, 0.00117357401f, 0.00146516296f, 0.00235321489f, -0.00618096814f, 0.000656886492f, 0.0262280107f, -0.0179581102f,
+    -0.0076468722f, -0.002748281f, 0.0138518503f, 0.00263691903f, -0.00315135997f, -1.47884602e-05f, -0.0736769885f, -0.00309127802f,
+    0.00792409666f, 0.00857780408f, 0.00554031692f, -0.0001188651f, -0.0184083693f, -0.00234905793f, -0.00761573995f, -0.00331909698f,
+    -0.000946429791f, 0.00878585503f, 0.000163954595f, -0.00235089404f, 7.54499633e-05f, 0.0270184893f, 0.000845612085f, -0.00116871099f,
+    0.0228975005f, 0.708792627f, 0.03748383f, 0.00128275005f, -0.00517183123f, 0.00275459397f, -0.00360729196f, -0.000252587488f,
+    -0.00705147488f, -0.00543237617f, -1.46529401e-05f, -0.00185569201f, 0.00476095406f, 0.00156762602f, 0.00542399194f, -0.00646923995f,
+    -0.000780385395f, 0.0450864509f, -0.00514053879f, -0.0212361291f, -0.00237633404f, 0.0541225895f, -0.000534929801f, -0.000584540481f,
+    0.003003194f, 0.000691612076f, 0.0112127904f, -0.000761081988f, 0.000119845798f, -0.000197253496f, -0.00551804202f, 0.00121482497f,
+    -0.00424974412f, -0.00949157216f, 0.000653786003f, -0.000497411005f, -0.0430792496f, -0.000519990921f, -0.0045451629f, -0.00796104036f,
+    -0.000319193408f, -0.0192238893f, -0.00130769901f, 0.0198250394f, -0.00220132805f, -0.00785967056f, 0.00141421997f, -0.0112327598f,
+    0.0029746301f, 0.000532838283f, 0.0101052597f, -0.0116536999f, -0.00706099812f, 0.0022343141f, -0.0298022795f, 0.00116118405f,
+    0.000948244473f, 0.000412846304f, -0.03120354f, 0.00276528811f, 0.0256447792f, -0.00753315305f, 0.00320471497f, -0.000242824797f,
+    -0.000619793427f, -0.00080101029f, -0.0009181684f, 0.00122395298f, -0.000687437307f, -0.00182524696f, -0.0074570789f, 0.00537757482f,
+    0.00376023096f, 0.000877522223f, 0.005508448f, -0.000759490475f, 0.001635266f, -0.000127508494f, 0.0220676102f, -0.0192037895f,
+    -0.0129981097f, -0.00313326903f, -0.00529375579f, 0.00218570698f, -0.00457507093f, -0.0451521389f, -0.00277835596f, -0.00257524801f,
+    0.00116141303f, 0.00233501894f, 0.00384992897f, 0.00245296303f, 0.00367313903f, 0.00219371007f, -0.00646668719f, -0.00571862515f,
+    0.000999418786f, -0.000782764982f, 0.00432311883f, 0.004083829f, 0.000305158988f, 0.00126402802f, -0.0101526603f, -0.002686369f,
+    -0.00905156136f, -0.00632042112f, 0.00261173001f, 0.0143390195f, 0.00284527801f, 1.47832898e-05f, 0.00818145555f, 0.00663219905f,
+    -0.00224834611f, 0.0123745603f, -0.00665166881f, -0.00857506134f, 0.0065078442f, 0.0286752097f, 0.00706738606f, 0.00123678299f,
+    0.00748186791f, 0.00471098395f, -0.00694057904f, 0.0333020985f, 0.0361046307f, 0.0196746495f, 0.00347661506f, 0.00139873696f,
+    0.00409742491f, 0.0026973791f, -0.00565916998f, 0.000394609699f, 0.00217505707f, 0.00146144396f, -0.000530065678f, 0.1486931f,
+    -5.88164985e-05f, -0.00162753696f, -0.0128818098f, 0.000949829177f, -0.0123159997f, 0.00902866013f, -0.0868761167f, -1.51075601e-05f,
+    -0.0174576603f, -0.00252194703f, 0.001065652f, -0.00425403006f, -0.00903491024f, -0.00152309996f, 0.00284411502f, -0.00328244292f,
+    3.2161719e-05f, 3.01184009e-05f, -0.00561500993f, -0.0173892099f, -4.43610807e-05f, 0.000103548999f, 0.00159396301f, 0.00254407898f,
+    1.50831802e-05f, -9.92822024e-05f, 0.00055371708f, 0.00191867596f, -0.000507642224f, 0.00172364805f, 0.0130921695f, 0.000414464797f,
+    0.0218357295f, 0.0483239405f, 0.00160919502f, 0.00134697603f, 0.000177290596f, 0.000367436209f, -0.00123521197f, 0.00117055303f,
+    -2.96954295e-05f, 0.000270507386f, -7.96262102e-05f, 0.00033152441f, -0.0523058288f, 0.0268804692f, -0.000242030001f, -0.00164246396f,
+    -0.000268302887f, -0.002264963f, 0.0156272091f, 0.162113205f, -0.0037391691f, -0.00208784197f, 0.00233342103f, 6.51163864e-05f,
+    0.00746257184f, -0.0220326893f, -0.00830816105f, -0.00043259369f, -0.0322092287f, -0.000904248387f, 0.00227275002f, 0.00598200085f,
+    -0.000588566181f, -0.00088227191f, -7.44734571e-05f, 0.000391489797f, -0.00369396294f, -0.0112078497f, -0.0103374096f, 0.00368836406f,
+    -0.00389842805f, -0.00599867292f, 0.00450436817f, 0.0177995302f, -0.0184625704f, 1.49313e-05f, -0.0860212296f, -6.08187584e-05f,
+    0.00126706797f, 0.00136998796f, 0.0033162781f, -0.00145320396f, -0.071492061f, 0.00198579789f, 0.00625164993f, 0.00270055002f,
+    0.0111303898f, 0.0150928497f, -0.0279433001f, 4.40369913e-05f, -0.0122327702f, -0.000685914129f, -0.00389929907f, 0.000491139072f,
+    0.00821177475f, -0.0455644801f, -0.00536319101f, -0.0122749703f, 0.00541859912f, 0.00081846962f, 0.00413581403f, 0.000395780109f,
+    0.00468876911f, -0.0182554405f, -0.00627364684f, 0.00243201689f, -0.0496176295f, 0.00117012102f, -0.0452372916f, 0.00475634215f,
+    -0.0148359695f, 0.000774366083f, 0.0148359695f, -0.000808925426f, 0.000775176683f, -0.00676189782f, -0.0401358604f, -0.00336514693f,
+    0.000747130078f, -0.00427273894f, 0.00362025108f, 0.000473076187f, 0.033094909f, -0.0115441196f, -0.00742344698f, -0.00422529504f,
+    0.0181331094f, 0.00709030498f, -0.0132729402f, 0.000146321996f, -0.0035790191f, -0.000469971012f, -0.0481794402f, -0.000925813627f,
+    -0.01478073f, -0.100274503f, -0.000938481011f, -0.00288613606f, -0.0436827615f, 0.00261157006f, 0.0436827615f, 0.00171795301f,
+    -0.0339649096f, -0.00109935901f, 0.0543010794f, 0.00109935901f, -1.49541202e-05f, 0.0314158686f, 0.0108318496f, 0.000865457114f,
+    0.00227431604f, 0.00393408211f, 0.00814519078f, -0.00527632888f, -0.0083787851f, 0.00156219106f, 0.00323187397f, 0.00668040197f,
+    -0.00333964801f, -0.209334806f, 0.00638058223f, -0.0060137799f, -0.00817560777f, 0.000639517792f, 0.00101277605f, 0.000497845991f,
+    0.000135964903f, 0.01357166f, 3.02590797e-05f, -0.0032625841f, -0.000192170104f, 0.0219938792f, 0.000789077778f, 0.000508938916f,
+    0.000116627103f, 0.00806040782f, 0.000959259691f, -0.0195261296f, 0.0412424393f, 0.0156267099f, 0.000299471896f, -0.00100376096f,
+    0.000681282429f, 0.000130989996f, 0.0031696721f, -0.00205873698f, -0.00046395039f, 0.00350894802f, -0.002397598f, 0.00109012797f,
+    -0.000165243706f, -0.000416023191f, -0.000237399101f, 0.0247397609f, -0.01534284f, 0.0115404697f, 0.00642306218f, 0.0129778096f,
+    0.00110633997f, 0.00137436902f, 0.0162337795f, -0.000815193518f, -0.0907824934f, 0.0116652101f, -0.0232864097f, 0.00215593399f,
+    -0.00431672204f, 0.00156105997f, 0.0140766399f, 0.00710185897f, -0.00482216477f, -0.0053852899f, 0.0073483279f, -0.00357075199f,
+    0.00233401009f, 0.00474327803f, 0.00650554895f, 0.0125892498f, -0.00633583684f, -0.00576396519f, 0.00135997497f, 0.0284042601f,
+    -0.0092958156f, -0.00118003204f, -0.00209481409f, 0.00416799588f, 0.0054458892f, -0.00127665105f, 0.000594042707f, 0.0423096083f,
+    0.00561896712f, 0.00724011986f, -0.00456106709f, 4.55061599e-05f, -0.00619037915f, 0.000811864622f, 0.0137798097f, 0.001129032f,
+    -0.0001061035f, 0.000166957907f, 0.001129032f, -0.120193496f, -0.0152307404f, 0.00357598299f, 0.01347946f, -0.00211629504f,
+    -0.0178777091f, 0.00109319703f, -0.00305531593f, 0.00363650499f, 9.78964817e-05f, -0.000327144488f, 0.000434250309f, 0.01400558f,
+    -0.000926549314f, 0.00395042682f, -0.000580868684f, -0.0120180203f, -0.145215407f, -0.00660490198f, -0.0349097513f, 0.00374784204f,
+    0.0330380313f, 0.00368725997f, -0.00453119399f, 0.00410585105f, -0.00875998475f, -0.02300331f, 0.00536648184f, 0.0389717706f,
+    -0.0277671907f, -0.00988940895f, -0.00320731406f, -0.000674849784f, -0.00519475201f, -0.000261698995f, 0.00224214792f, -0.001213977f,
+    -0.00294697704f, -0.0003929183f, 0.625507295f, 0.00977445208f, 0.0943782479f, -0.00195609103f, 0.00906527694f, 0.000421380711f,
+    -0.000442201912f, -0.00473135011f, 0.00153955095f, 0.0024315f, -0.0155816199f, 0.00108169205f, -0.00221976591f, -0.000930486713f,
+    -0.0047418708f, -0.00629503699f, 0.00352160493f, -0.00242893794f, -0.00252614706f, -0.00148173398f, -0.224745303f, 0.00283425092f,
+    -0.0208216105f, 0.000148963401f, -0.00335244997f, -0.0372798815f, 0.000138967705f, -0.000319126208f, 0.000540034613f, 0.00389568508f,
+    0.00160845299f, -0.000574745878f, 0.0134350397f, 0.00213681394f, 0.0141576296f, 0.00538843917f, 0.00880134106f, 0.000388588494f,
+    -0.00221435889f, -0.00846429728f, 0.0150443902f, 0.00763464021f, 0.000338951213f, 0.000211576102f, -0.0275149494f, 0.0516030602f,
+    0.00375106512f, -0.00214576395f, -0.000581780099f, -0.000936385419f, 0.0416674912f, -0.00677637802f, -0.00291705807f, 0.000327895308f,
+    0.0117298001f, 0.001171218f, 0.00935550965f, 0.00165706105f, -0.00133878097f, 0.0001758055f, -0.00294732489f, 0.00832208991f,
+    0.00743666897f, -0.000213228894f, -0.00780246314f, 0.000566112285f, -0.00923465006f, -1.46764996e-05f, 0.00970079377f, -0.00353206508f,
+    0.0216164105f, 0.0034567609f, 0.0229143202f, 0.0034328911f, -0.00865108334f, 0.00145100395f, 0.00781917199f, 0.000207985504f,
+    -0.00399622181f, -1.50101396e-05f, -0.00424287887f, 0.00913749821f, 0.00882545859f, 0.000940922124f, -0.0125033502f, 0.00867596455f,
+    -0.0104167601f, 0.00274324603f, -0.00423856918f, 0.0183258709f, -0.0243345406f, 0.000464693614f, 0.00342600094f, -0.00258273189f,
+    0.00105456996f, -0.000912576914f, 0.00265890104f, 0.00485983584f, 0.00806386769f, -0.00758983707f, 0.000363680709f, 0.0625949502f,
+    -0.00497532077f, -0.00208801194f, 0.000956445117f, -0.0317214616f, 0.00128986896f, 0.00984051637f, 0.00122370897f, -0.00842325855f,
+    -0.000727263221f, 0.00468429318f, -0.00103795796f, 0.00913427304f, 0.00149711198f, 0.00157623203f, 0.00874962471f, -0.000851035991f,
+    -0.0173255708f, -0.00832664408f, 1.51579097e-05f, 0.00180414703f, 0.00306915608f, -5.22255104e-05f, 0.0001007217f, 0.000135737006f,
+    0.000921378785f, 0.000303165813f, 0.0395824797f, 0.0475196801f, 0.01887176f, -0.00039876459f, 0.000465566001f, 0.0067090611f,
+    -0.00189311604f, -0.0130569497f, -0.000194841195f, 1.50932201e-05f, -7.16179602e-06f, 0.000301646796f, 0.00441951817f, -0.00739841815f,
+    -0.00780312018f, -0.0107314298f, 0.00142467802f, -8.27175681e-05f, 0.00448034098f, 0.00307891401f, -0.00113102898f, -0.00104106904f,
+    0.00116485404f, 0.000900573621f, 0.00687815389f, -0.0352839008f, -0.00133202004f, -0.00231775711f, 0.000213329404f, 0.0134679005f,
+    -0.00128291699f, 0.000515716383f, 0.00392541988f, -0.0337805897f, -0.0378537215f, -0.000407529005f, -0.00311938091f, -0.0157149695f,
+    -0.000785257027f, -0.000287505012f, 0.0280168597f, -0.00190188398f, 0.0206475593f, 0.00430025719f, 0.0134591404f, -0.0103200404f,
+    0.319907486f, 0.000921987987f, 0.000418525393f, 0.000358911086f, -0.2099244f, -0.00493281521f, 0.00234091305f, 0.00471202703f,
+    0.0287131909f, -0.00261565507f, -0.0135589698f, -0.000303317996f, -0.000556017621f, 0.00240253308f, -0.0034089901f, 0.000800196023f,
+    0.00219010701f, 0.00337453699f, 0.000800196023f, 0.0173460692f, -0.00195684494f, -0.0112290196f, -0.00266083889f, -0.0116151003f,
+    -0.0952486023f, 0.00737017812f, -0.0149539001f, 0.000570387929f, 0.00585161988f, 0.000211505496f, -6.96791903e-06f, -0.000796773878f,
+    0.0194594804f, -0.01116083f, 0.0140561499f, -0.000329583505f, -0.00546364207f, 5.88816692e-05f, 0.00663434295f, 0.0452634096f,
+    -0.00806461275f, 0.000473895489f, 1.48773597e-05f, 0.0243211593f, 6.99313969e-05f, 0.00262877601f, 0.00381905399f, -0.0259891506f,
+    0.00120624003f, -0.00155574002f, -0.00226919306f, 0.000232872495f, -0.00559997f, -0.0104961898f, -1.48149302e-05f, -0.000642870786f,
+    -0.000188919497f, -0.0090413522f, 0.00795347057f, -0.00279089995f, 0.00328571f, 0.000770630082f, 0.063021943f, -0.00283746095f,
+    0.046461951f, 0.0291525405f, -1.40002903e-05f, -0.00127570797f, 0.00135965296f, 0.000179919298f, -1.41666396e-05f, 6.02523905e-05f,
+    0.00643203687f, 0.0004668232f, 0.0057436279f, 0.00320192403f, -0.000576379418f, -0.00379019207f, 0.00489141094f, 0.00464592921f,
+    -0.0068799369f, -0.0181474704f, 0.000114092203f, -0.000543342729f, -0.00276024896f, -0.00197305693f, 0.00245652394f, 0.000193920103f,
+    0.0786430165f, 0.00652768696f, -0.0787167996f, 0.00572984992f, 0.000623865577f, -0.0852672309f, 0.0409811102f, 0.00771357492f,
+    -0.00686639408f, 0.0145596396f, -0.0100643104f, 0.00362740806f, -0.00234215404f, -0.0246864092f, 0.000194561202f, 0.000317142112f,
+    0.00207939907f, 0.00179827097f, -0.0002228706f, 0.000326239213f, -0.0667926818f, -0.00148698897f, -0.00504548708f, -0.00482975878f,
+    -0.00107225997f, 0.00879011955f, -0.0071750381f, 0.001125123f, 0.0106347101f, -0.0117632197f, 0.0923240632f, 0.00189910806f,
+    -0.0105103403f, -0.000745313126f, 0.00800410006f, 0.00581105286f, -0.0279185809f, 0.00217393995f, -0.00406395877f, 0.000600171392f,
+    0.00192147703f, -0.0138608301f, 0.0230068509f, -0.00138579297f, 0.00126374105f, -0.0146752102f, -0.00295350701f, -0.001718977f,
+    -0.000424840895f, -0.000852486584f, 0.00890345685f, 1.48956497e-05f, -0.000470916013f, 0.0004308481f, -0.000638939615f, -7.37337468e-05f,
+    -0.00889914855f, -0.0102533503f, -0.0596374907f, 0.0217071995f, 0.00991070457f, -0.0109983003f, 0.000746088917f, 0.000295391714f,
+    0.0500541292f, -0.00723306602f, -0.00268633803f, -0.00101958495f, -0.0202049203f, 0.0021340379f, -0.00183488894f, -0.00594894681f,
+    -0.000230301201f, 0.00505810091f, -0.000519500114f, -0.000686209474f, -0.00749362679f, -0.0156829301f, -0.00326497504f, 0.000384639308f,
+    0.004449239f, 0.0231183209f, 0.00208351598f, 0.00115131505f, 0.0361047089f, 0.000362561987f, -0.00346354698f, -0.00287968293f,
+    -0.00811195001f, 0.00459320797f, 0.00700147403f, 0.000801695394f, -0.00866523292f, -0.00273150508f, 0.00133015902f, -0.00426482409f,
+    0.00632514991f, -0.00307537406f, -0.00073622138f, 3.00824795e-05f, -0.00387227302f, 0.000628790585f, 0.00134115794f, -0.00836819224f,
+    0.000933057512f, -0.00107465102f, -0.0186100509f, 0.00136514194f, 0.00737444218f, 0.0084163323f, 0.00514139887f, 0.00458470313f,
+    0.0285652392f, 0.00043958801f, 0.0314594582f, 0.00560116302f, 0.000718356692f, -0.00553030893f, 0.00141292799f, 0.000255307095f,
+    0.000319664105f, 0.0050411392f, 0.00776178809f, 0.00293746311f, -0.00164977205f, -0.00588344177f, 0.000874591875f, -0.0153087797f,
+    0.0322924517f, -0.000438425195f, 0.00154295296f, -0.00247330288f, 0.00209949398f, -0.00575411087f, -0.0102331303f, 0.225545093f,
+    0.0296665598f, -0.002851845f, 0.000974653289f, 1.40447401e-05f, -0.0175794307f, -0.0523816794f, -0.0112421103f, -0.00367284007f,
+    0.00350827607f, 0.00616797106f, -0.000970099005f, -0.0109570101f, -0.0083272513f, 2.97983806e-05f, 0.000282440393f, -0.000813641178f,
+    0.00180080405f, -0.00699447794f, 4.56253983e-05f, -0.000731899228f, -0.000299802196f, -2.90609405e-05f, -0.000597426901f, 0.0001483183f,
+    -0.00294410298f, 0.137412101f, -0.0884141773f, 0.0706102774f, -0.00771889789f, 0.0151153998f, 0.00106718799f, 0.000704879116f,
+    -0.0986907333f, 0.0623734184f, 0.00194965198f, -0.000891391479f, -0.000551504083f, -0.00117219496f, -0.000744806428f, -0.00262648403f,
+    -0.000397126889f, 0.00359849492f, 0.00530806184f, 0.000963198778f, 0.000507764693f, 0.00362231606f, -0.0620614104f, 0.000643871899f,
+    0.0262399092f, 0.00081940298f, 0.000238331195f, -0.001586976f, -0.00672634179f, 0.0110061103f, 0.00714458199f, -0.00472337985f,
+    0.00984374061f, 1.51246404e-05f, 0.0399088711f, 0.00539036794f, -0.0399088711f, 0.00539036794f, 0.00670051901f, -0.0126237897f,
+    0.01180661f, -0.00342572294f, 0.000393852999f, 0.0343881883f, -0.0750099868f, 0.00049022492f, -0.00855252892f, 0.000131355206f,
+    0.00479486585f, 0.00201246911f, -0.117854796f, 0.00155750196f, -0.0155737596f, -0.00218547904f, 0.00292723393f, 0.00646636682f,
+    -0.00761403609f, 0.00415125722f, 0.00277116406f, -0.0128361098f, -0.00243800506f, 0.00217133295f, 0.000628007285f, -0.00979823899f,
+    0.00735438289f, -0.0146650402f, 0.0302445106f, -0.0566602089f, -0.00569674792f, 0.0308067705f, 0.00227487693f, 0.00204369007f,
+    -0.00862779561f, 0.000651133829f, 0.000881882617f, -0.0145949097f, -0.00123045803f, -0.000218672998f, -0.00109099597f, 0.000352103787f,
+    -0.00725637795f, 0.001470185f, 0.000114727198f, 0.00305064698f, 0.000262699497f, -0.00363655505f, -0.00848932937f, 0.00581074087f,
+    0.000755839515f, -0.00220176904f, 0.00279089389f, -0.00182285695f, -0.00724955089f, -0.000687445223f, 0.00251744408f, -0.0101513797f,
+    -0.0041399952f, -0.00470785517f, 0.0419810414f, -0.0142729999f, 0.00408695219f, 0.00176068f, 0.000125505496f, -0.00295032095f,
+    -0.00113124202f, -0.00169831805f, -0.0114578204f, -0.00849625655f, 0.0119190896f, 0.00644164206f, -0.00087857811f, -0.00203127111f,
+    -0.00152624305f, 0.00428608805f, 0.00350109208f, 0.0125876702f, 0.0002620749f, 4.47017301e-05f, 0.000780846982f, 0.000888512121f,
+    0.00233690697f, 0.00166883599f, 0.000308444694f, 0.00346175604f, 0.0189613104f, 0.173473105f, 0.000200205497f, 0.00109670602f,
+    0.000151070999f, -0.00344635011f, 0.00851766206f, -0.0358121097f, -0.0211554002f, 0.000898909406f, -0.00156137603f, 0.000671208603f,
+    -0.0215970296f, -0.0249472298f, 0.00187259796f, 0.00639127195f, -0.00915523991f, 0.00217156601f, 0.00123303698f, -0.000407859014f,
+    0.000464376091f, -0.000116001997f, -0.0127187204f, 8.943188e-05f, -0.000339136895f, -0.0180263408f, 0.0069179181f, -0.000118396798f,
+    -0.00394741818f, 6.00509193e-05f, 0.00914236438f, 0.000213054402f, -0.0002085585f, 0.00131303899f, -0.0029134769f, 0.00296457694f,
+    0.00177725498f, -0.00771363499f, 0.000510274782f, 0.001746063f, 0.000380682788f, 0.00282288902f, -0.00530004781f, 4.49512991e-05f,
+    0.00327524589f, -0.002816258f, 0.00141122798f, 0.00830620341f, 0.00221648393f, -0.00498686312f, -0.00366642606f, -0.0105812298f,
+    0.00733664911f, -0.000393189403f, -0.00813753344f, 0.00248091505f, 0.000887497794f, -0.000421949197f, -0.00797901116f, 0.00114396296f,
+    0.00755421305f, 0.00102883996f, -0.00172346702f, 0.575866997f, 0.00666405214f, 0.00899055228f, 0.00571542f, 0.00112579297f,
+    -0.000917890109f, -0.00104928599f, 3.54539297e-05f, 0.000290157099f, 0.000160716605f, -0.000529611076f, 0.000266825693f, -0.000134925402f,
+    -0.0108416798f, 0.0120778298f, 0.00221288693f, -0.0152661903f, 6.79295335e-05f, 0.000176335903f, 0.000813113817f, 0.0032630451f,
+    -0.0039503919f, -0.000398645789f, -0.0114325201f, 0.00533391722f, 0.00831932575f, -0.000424799189f, -0.111894302f, -0.00755537814f,
+    -0.00703370292f, -0.0148336804f, 0.00875067245f, 0.00166450103f, 0.00949008204f, 0.00111331104f, 0.00949407555f, -0.00153966201f,
+    0.134349599f, -0.00949407555f, 0.0200117901f, -0.00188750098f, 0.00718427822f, 0.00169769698f, 0.0049219979f, 0.0118031995f,
+    -0.00977034494f, 0.00211748993f, 0.0094801411f, -0.002607879f, -0.00572527479f, -0.00823256187f, 0.00089571951f, -0.000150215696f,
+    0.000484896591f, -0.0961926505f, -0.00110535196f, -0.102150403f, 0.00301478896f, 0.00761316484f, 0.00151976303f, -0.0141972797f,
+    -0.0138188796f, -0.00050701329f, -0.00935375318f, -0.00947710592f, 0.00169236504f, 0.000586525421f, -0.00258266204f, -0.00273076398f,
+    0.0218715705f, -1.50102996e-05f, 0.00535837002f, 0.005005755f, -0.00190300704f, -0.00785066932f, -0.00270936708f, 0.00141380797f,
+    0.00903001986f, -0.000979256816f, 0.00139844394f, 0.000833721075f, 0.0105510596f, 8.83441026e-05f, -0.0410223082f, 0.00750656286f,
+    0.0410223082f, -0.000539613771f, -0.0686960369f, -0.00184479402f, -0.00609599194f, -0.00420683017f, -0.0007133279f, 0.1175678f,
+    5.935429e-05f, -0.00631736917f, 0.0149414996f, -0.00207893993f, -0.000707362196f, -0.0031247111f, -0.000789193786f, 0.0101795802f,
+    -0.00275061093f, 0.0106013296f, 0.00514667807f, 0.0763211474f, -0.00150276895f, 0.0122666704f, -0.0311185792f, 0.0289055891f,
+    0.0475983806f, 0.0308085494f, -0.000212778104f, 0.0789699629f, -0.0102579501f, 0.00126048899f, -0.0334904604f, -0.000592027674f,
+    3.03207507e-05f, -0.000543696806f, -0.0334904604f, -0.000592027674f, 0.00205508899f, -0.00443535717f, -0.0841704234f, 0.00674190279f,
+    0.0102781504f, 0.00588008622f, -6.96791903e-06f, 0.000824195275f, -0.00552683184f, 0.000961286714f, 0.00248105102f, -0.00104805897f,
+    -0.00612879079f, 0.000116823299f, -0.0399094783f, 0.00158594595f, -0.0226902291f, 0.00209160708f, -0.0247154199f, -0.0134194503f,
+    -0.00606294721f, -0.00209210301f, 0.0259618592f, 0.000179086695f, -0.00315468502f, -0.00113977597f, -0.0478402115f, 0.00041577089f,
+    -0.000442470395f, 0.00144793501f, 0.01570151f, 0.000278057298f, -0.00290105096f, 0.000208305195f, -0.0515300296f, 0.0001716345f,
+    0.0236142799f, -0.000564277987f, 0.006690396f, -0.0048789531f, -0.00685373321f, 0.000998938107f, -0.000133547001f, 0.001016511f,
+    0.000912167714f, 0.00100802595f, -0.000131024906f, 0.0005522875f, -0.000121309698f, -1.51129898e-05f, -0.000401258294f, -0.000657668512f,
+    0.000622204214f, 0.00146633596f, -0.0495477095f, 0.00130175694f, -0.00449145306f, 0.00165923696f, 0.00646954589f, 0.00498102698f,
+    -0.0385369807f, -0.282756507f, -0.00903018285f, -0.0438662693f, -0.00457010698f, -0.00233624107f, 0.00539603317f, -0.00262976089f,
+    -0.00385774788f, 0.00139638002f, -0.00886994693f, -0.000706262887f, 0.00426458102f, 0.061572101f, -0.004538198f, -0.00408778992f,
+    0.00643086014f, 0.00704552606f, -0.00232464401f, 6.02766013e-05f, 0.0180845596f, 0.000846935203f, -0.02693104f, -0.00423466414f,
+    0.0269471109f, 0.00464468822f, -0.00695776613f, 0.000876097125f, 0.00161033298f, -0.00128485903f, 0.0102435397f, 0.000268893491f,
+    0.003790366f, -0.0293696802f, 0.00607430888f, -0.0127107203f, -0.00594454492f, -0.00289274799f
+};
+
+constexpr float leafValue[3141] = {
+    0.0383819006f, 0.896525681f, 0.262931406f, 0.102166303f, 0.123840198f, 0.691038311f, 0.195369706f, 0.210144103f,
+    0.825867474f, 0.101837598f, 0.821905792f, 0.195655495f, 0.220540702f, 0.0732632577f, 0.59314841f, 0.184411496f,
+    0.403221399f, 0.806652129f, 0.254832804f, 0.60570699f, 0.277906388f, 0.288998008f, 0.761658728f, 0.349564314f,
+    0.815165281f, 0.280878305f, 0.602777481f, 0.760750175f, 0.444403589f, 0.143731207f, 0.531817019f, 0.541105211f,
+    0.218068704f, 0.115896001f, 0.234067902f, 0.599038184f, 0.180549607f, 0.217789397f, 0.801823676f, 0.114135496f,
+    0.120309398f, 0.610853076f, 0.207995996f, 0.330205411f, 0.751109421f, 0.276822209f, 0.166829303f, 0.582947671f,
+    0.150878802f, 0.439122796f, 0.764659524f, 0.265155613f, 0.229805306f, 0.544216573f, 0.362284392f, 0.260125995f,
+    0.723365784f, 0.384967893f, 0.296551287f, 0.548030913f, 0.410477012f, 0.723902404f, 0.278728396f, 0.564051628f,
+    0.594754815f, 0.331202f, 0.660323203f, 0.468066514f, 0.206433803f, 0.529885113f, 0.528160274f, 0.190954998f,
+    0.138064593f, 0.549063683f, 0.126028106f, 0.237266302f, 0.524016619f, 0.176921606f, 0.199806497f, 0.229938f,
+    0.739321113f, 0.153384f, 0.203685895f, 0.585491598f, 0.204989597f, 0.323419988f, 0.732301414f, 0.304514915f,
+    0.293213397f, 0.562129617f, 0.365803689f, 0.271215588f, 0.722633481f, 0.441983789f, 0.361297697f, 0.525145113f,
+    0.362861693f, 0.160109505f, 0.705227673f, 0.130128801f, 0.178632393f, 0.552152991f, 0.348738313f, 0.267399102f,
+    0.666791916f, 0.343786389f, 0.599533617f, 0.349771798f, 0.215048999f, 0.627143621f, 0.251954198f, 0.0824118927f,
+    0.591005683f, 0.370520115f, 0.159472793f, 0.598048091f, 0.283250809f, 0.787709117f, 0.155574098f, 0.523965716f,
+    0.662036598f, 0.142471999f, 0.442983389f, 0.158854097f, 0.237579897f, 0.521713495f, 0.194172502f, 0.627840579f,
+    0.374604493f, 0.384092212f, 0.310649306f, 0.553784728f, 0.344444901f, 0.272955209f, 0.642895103f, 0.165708601f,
+    0.227385104f, 0.698934972f, 0.151207402f, 0.556447029f, 0.160544202f, 0.188025907f, 0.312249899f, 0.716539621f,
+    0.385958314f, 0.245529398f, 0.569571018f, 0.271652013f, 0.229336202f, 0.720862985f, 0.783362091f, 0.55452323f,
+    0.255068988f, 0.181939006f, 0.352987587f, 0.655281901f, 0.546230972f, 0.135984302f, 0.541581511f, 0.111511998f,
+    0.584671974f, 0.259834886f, 0.161056906f, 0.537667871f, 0.173945501f, 0.190207303f, 0.3272008f, 0.636484087f,
+    0.691485286f, 0.432732612f, 0.696384311f, 0.859413385f, 0.0973944664f, 0.458703011f, 0.255462587f, 0.33190909f,
+    0.596410275f, 0.266659498f, 0.184818596f, 0.624597073f, 0.537992716f, 0.518302917f, 0.217041999f, 0.261338413f,
+    0.278653204f, 0.590898812f, 0.261286914f, 0.59154129f, 0.345578194f, 0.158705205f, 0.127041101f, 0.597942889f,
+    0.1995105f, 0.737307012f, 0.292173713f, 0.195641994f, 0.569204688f, 0.183906496f, 0.217166707f, 0.271998912f,
+    0.715024412f, 0.182518393f, 0.56998378f, 0.350985289f, 0.402392685f, 0.360409588f, 0.729199529f, 0.649149001f,
+    0.551899314f, 0.265968114f, 0.671251297f, 0.169137806f, 0.432627797f, 0.340510011f, 0.551679313f, 0.33113879f,
+    0.167531505f, 0.361575186f, 0.64207828f, 0.29210791f, 0.561303198f, 0.335786015f, 0.697064281f, 0.354115009f,
+    0.614400625f, 0.55371809f, 0.534195721f, 0.275710493f, 0.248952106f, 0.171192899f, 0.552395284f, 0.827345073f,
+    0.377939105f, 0.547625184f, 0.329654098f, 0.606288373f, 0.243422002f, 0.381409496f, 0.551761627f, 0.372689307f,
+    0.122966401f, 0.725227475f, 0.497345507f, 0.534831285f, 0.585191488f, 0.43841669f, 0.229783401f, 0.62959379f,
+    0.413159907f, 0.169545904f, 0.51741302f, 0.0595193915f, 0.135724798f, 0.299662888f, 0.579169512f, 0.659258902f,
+    0.530717194f, 0.379512101f, 0.312831491f, 0.553789318f, 0.1027309f, 0.466085911f, 0.715885818f, 0.472444892f,
+    0.0593456887f, 0.702730179f, 0.471873105f, 0.589473426f, 0.486235589f, 0.524758816f, 0.691747129f, 0.466961712f,
+    0.2382406f, 0.277347088f, 0.742715478f, 0.247973502f, 0.219950303f, 0.588998973f, 0.259571612f, 0.186012596f,
+    0.415187091f, 0.710347414f, 0.25279671f, 0.139300093f, 0.525451481f, 0.248772904f, 0.271070004f, 0.661883771f,
+    0.381282598f, 0.232643202f, 0.526301086f, 0.42933321f, 0.160040393f, 0.678231478f, 0.667929411f, 0.458770514f,
+    0.717623889f, 0.186407506f, 0.553825974f, 0.315045089f, 0.282879114f, 0.587022424f, 0.370482385f, 0.42189309f,
+    0.666700125f, 0.246118203f, 0.355758786f, 0.166554704f, 0.523484886f, 0.288461298f, 0.296934009f, 0.608011127f,
+    0.453639001f, 0.517726421f, 0.144918203f, 0.761690974f, 0.215970606f, 0.546018779f, 0.392629594f, 0.347888112f,
+    0.554266274f, 0.60642761f, 0.569740713f, 0.177971393f, 0.537937224f, 0.332783908f, 0.546153128f, 0.211616099f,
+    0.663582325f, 0.436585903f, 0.538742483f, 0.160280496f, 0.533045888f, 0.291747689f, 0.560812414f, 0.199798107f,
+    0.393831402f, 0.575743616f, 0.423945695f, 0.767655313f, 0.535386622f, 0.251477689f, 0.236490399f, 0.238586396f,
+    0.541466475f, 0.651161492f, 0.60304141f, 0.358770102f, 0.542359293f, 0.236095399f, 0.540175796f, 0.283698589f,
+    0.181351602f, 0.542104602f, 0.398036599f, 0.261638492f, 0.523773015f, 0.243810803f, 0.532714605f, 0.819037676f,
+    0.467969388f, 0.55639118f, 0.436758608f, 0.666434884f, 0.559461117f, 0.304271191f, 0.211601898f, 0.692468524f,
+    0.304377705f, 0.318328589f, 0.545655906f, 0.252226889f, 0.290261805f, 0.313045591f, 0.688493729f, 0.296246588f,
+    0.3099626f, 0.57525152f, 0.399319589f, 0.482737213f, 0.753783286f, 0.261692703f, 0.31087029f, 0.549123585f,
+    0.323969185f, 0.651741087f, 0.417891204f, 0.677120388f, 0.415951103f, 0.565289199f, 0.768960118f, 0.287332386f,
+    0.498893291f, 0.546300828f, 0.363123506f, 0.551255226f, 0.114376701f, 0.289107889f, 0.54473418f, 0.30234319f,
+    0.216700599f, 0.527815282f, 0.325483412f, 0.526305079f, 0.752632916f, 0.741033018f, 0.683660984f, 0.45790711f,
+    0.744993627f, 0.486077994f, 0.236145705f, 0.146732703f, 0.234781995f, 0.532337725f, 0.147705704f, 0.349853396f,
+    0.580356181f, 0.525955081f, 0.436288297f, 0.620892286f, 0.203946099f, 0.519835889f, 0.137119606f, 0.632342994f,
+    0.472016305f, 0.656708717f, 0.605306029f, 0.509051919f, 0.311693311f, 0.342980415f, 0.383840293f, 0.577559829f,
+    0.214346901f, 0.595296621f, 0.376015812f, 0.569262683f, 0.578430414f, 0.397428215f, 0.181889296f, 0.684911013f,
+    0.435158402f, 0.272666097f, 0.423643112f, 0.58446759f, 0.337132096f, 0.527022183f, 0.805365086f, 0.286601812f,
+    0.588894606f, 0.3895787f, 0.217781693f, 0.177531704f, 0.567147017f, 0.465296209f, 0.476831108f, 0.569523871f,
+    0.339740187f, 0.625004113f, 0.428841203f, 0.534776211f, 0.411551893f, 0.566075385f, 0.78813231f, 0.360433996f,
+    0.55695051f, 0.541664422f, 0.550715685f, 0.388227701f, 0.318585098f, 0.557836413f, 0.321924597f, 0.707323313f,
+    0.55580157f, 0.461384207f, 0.686928988f, 0.487031788f, 0.26503709f, 0.528151512f, 0.608588219f, 0.430486798f,
+    0.544583201f, 0.532833576f, 0.236432403f, 0.262558103f, 0.156499296f, 0.679288328f, 0.348580897f, 0.369825512f,
+    0.592165828f, 0.300708413f, 0.362492293f, 0.707242608f, 0.441670209f, 0.30287081f, 0.541737616f, 0.437450409f,
+    0.440158993f, 0.756519079f, 0.231078699f, 0.3568196f, 0.574999928f, 0.359368891f, 0.636356771f, 0.232702896f,
+    0.70746237f, 0.570023715f, 0.359045088f, 0.280544102f, 0.412541896f, 0.61779958f, 0.54030782f, 0.563364387f,
+    0.335653901f, 0.71095109f, 0.490385085f, 0.282458305f, 0.189136997f, 0.537796617f, 0.311949492f, 0.720675826f,
+    0.185466796f, 0.498173296f, 0.263827413f, 0.687106729f, 0.471468687f, 0.154828504f, 0.437684298f, 0.632736802f,
+    0.316681415f, 0.619974375f, 0.437968701f, 0.147071406f, 0.580945909f, 0.343194902f, 0.395945787f, 0.324002504f,
+    0.564664721f, 0.427452803f, 0.334166795f, 0.662796021f, 0.404692799f, 0.548405826f, 0.356994092f, 0.182415098f,
+    0.797182024f, 0.506856918f, 0.216700703f, 0.658417881f, 0.462824315f, 0.209025204f, 0.511230528f, 0.778457582f,
+    0.513235927f, 0.174241498f, 0.526714802f, 0.341844797f, 0.563126504f, 0.200639397f, 0.624964893f, 0.320322812f,
+    0.519932985f, 0.614070594f, 0.659289598f, 0.371112496f, 0.295211196f, 0.332080394f, 0.552841485f, 0.171055004f,
+    0.33594349f, 0.567490518f, 0.477324188f, 0.808104515f, 0.484582812f, 0.678400218f, 0.551463902f, 0.364235997f,
+    0.125443503f, 0.442487895f, 0.572846174f, 0.280504197f, 0.195091203f, 0.565292478f, 0.616648376f, 0.452657998f,
+    0.594448686f, 0.408694208f, 0.279352695f, 0.64449352f, 0.567165613f, 0.531181216f, 0.261435688f, 0.299677402f,
+    0.448994309f, 0.688827991f, 0.519686401f, 0.346699595f, 0.553358793f, 0.308144003f, 0.269387096f, 0.554448903f,
+    0.558784783f, 0.467211306f, 0.60908252f, 0.902759194f, 0.471983492f, 0.219692007f, 0.627300918f, 0.483921796f,
+    0.690906227f, 0.173848793f, 0.630414486f, 0.447430193f, 0.530253828f, 0.533839703f, 0.379688293f, 0.32698369f,
+    0.455481201f, 0.635834813f, 0.280972511f, 0.311982602f, 0.709030628f, 0.298194796f, 0.302056015f, 0.580881119f,
+    0.373810291f, 0.216312602f, 0.661925375f, 0.291040391f, 0.557862282f, 0.336662799f, 0.407242596f, 0.685959578f,
+    0.31054619f, 0.33373329f, 0.337095886f, 0.545121074f, 0.262567014f, 0.605046272f, 0.323241502f, 0.326261312f,
+    0.581730783f, 0.416438997f, 0.70953989f, 0.529287577f, 0.254138887f, 0.40853411f, 0.526323617f, 0.300320297f,
+    0.402920514f, 0.352131993f, 0.666400492f, 0.459356606f, 0.1474756f, 0.517863214f, 0.183727801f, 0.808265805f,
+    0.516668797f, 0.479801387f, 0.334629595f, 0.544444919f, 0.358902693f, 0.598312974f, 0.298396409f, 0.616322398f,
+    0.521713018f, 0.205415905f, 0.344666898f, 0.559748471f, 0.267378688f, 0.69002682f, 0.44866389f, 0.550878525f,
+    0.204832301f, 0.1254953f, 0.506035626f, 0.0676330626f, 0.56607008f, 0.42922011f, 0.713640392f, 0.433887601f,
+    0.70608753f, 0.526868522f, 0.258058012f, 0.540696084f, 0.1905054f, 0.2551893f, 0.533907712f, 0.469330996f,
+    0.52619642f, 0.314543486f, 0.175685301f, 0.777472973f, 0.512429297f, 0.528455973f, 0.388780206f, 0.550117373f,
+    0.248982906f, 0.426214606f, 0.593506217f, 0.254522294f, 0.485199004f, 0.702141881f, 0.714327097f, 0.517572522f,
+    0.280864388f, 0.517322183f, 0.450286597f, 0.579569519f, 0.191511601f, 0.650243223f, 0.455931515f, 0.537624717f,
+    0.705623329f, 0.491460592f, 0.267870605f, 0.441085398f, 0.636831999f, 0.276356399f, 0.486730188f, 0.67287761f,
+    0.407051414f, 0.260494888f, 0.615486026f, 0.573199987f, 0.497337699f, 0.738700688f, 0.698475122f, 0.269116789f,
+    0.474177986f, 0.355101407f, 0.524461389f, 0.209665f, 0.41310969f, 0.462029308f, 0.677541018f, 0.562827528f,
+    0.557685971f, 0.457765013f, 0.495925605f, 0.562563598f, 0.204710796f, 0.224214807f, 0.453334391f, 0.61999321f,
+    0.66627562f, 0.500798821f, 0.238499299f, 0.375350088f, 0.517717123f, 0.163449302f, 0.25873819f, 0.629953384f,
+    0.465878993f, 0.335407615f, 0.2154129f, 0.523571372f, 0.646889687f, 0.289308906f, 0.525481582f, 0.329971105f,
+    0.704159319f, 0.323546588f, 0.496117085f, 0.712804317f, 0.496117085f, 0.320847213f, 0.661391675f, 0.355133295f,
+    0.371013492f, 0.57463938f, 0.389488012f, 0.305410296f, 0.288557798f, 0.648774505f, 0.317443103f, 0.382091999f,
+    0.523289323f, 0.362279505f, 0.653895915f, 0.400368094f, 0.389317304f, 0.561453283f, 0.3687644f, 0.644302785f,
+    0.338085294f, 0.582464814f, 0.393876702f, 0.342797101f, 0.551569879f, 0.380353808f, 0.643950522f, 0.416834593f,
+    0.66546011f, 0.418272287f, 0.560472429f, 0.65868628f, 0.324491203f, 0.488287002f, 0.222907901f, 0.410728514f,
+    0.574759126f, 0.2065797f, 0.492642313f, 0.713948488f, 0.678008676f, 0.521493018f, 0.114399597f, 0.193752602f,
+    0.381257713f, 0.551418781f, 0.2474024f, 0.481778294f, 0.592307985f, 0.750820875f, 0.287981093f, 0.519969523f,
+    0.304491013f, 0.406348288f, 0.567656279f, 0.0967175588f, 0.453783303f, 0.611537516f, 0.480775088f, 0.340379506f,
+    0.525552928f, 0.750583589f, 0.545544684f, 0.322606891f, 0.2311849f, 0.527104795f, 0.146992996f, 0.367813885f,
+    0.713192999f, 0.499386698f, 0.531205416f, 0.468937814f, 0.571402192f, 0.69487977f, 0.400450498f, 0.587488174f,
+    0.532957196f, 0.55458492f, 0.344958186f, 0.121718302f, 0.537504971f, 0.34156251f, 0.419517905f, 0.346075386f,
+    0.515586019f, 0.0580656789f, 0.147344902f, 0.555937827f, 0.547771513f, 0.420779109f, 0.562188089f, 0.644714713f,
+    0.276512712f, 0.488859594f, 0.526469111f, 0.578531027f, 0.429110289f, 0.34554109f, 0.602691889f, 0.414389312f,
+    0.609529376f, 0.610828221f, 0.470772088f, 0.324436694f, 0.383075714f, 0.573432624f, 0.661091924f, 0.613930702f,
+    0.468614995f, 0.352002203f, 0.257875413f, 0.5467242f, 0.482014686f, 0.571015f, 0.483191103f, 0.613367915f,
+    0.492858291f, 0.258130908f, 0.447112411f, 0.516102493f, 0.331653386f, 0.0926062167f, 0.852211475f, 0.513790786f,
+    0.545906007f, 0.521935284f, 0.192718595f, 0.191600204f, 0.52315712f, 0.353534013f, 0.646410108f, 0.738303781f,
+    0.496474385f, 0.36117059f, 0.342190713f, 0.594351172f, 0.455010414f, 0.471686214f, 0.665619075f, 0.459271699f,
+    0.656340122f, 0.125883505f, 0.523950219f, 0.801585197f, 0.500795782f, 0.227482006f, 0.435194612f, 0.586762786f,
+    0.446505189f, 0.454445809f, 0.570711076f, 0.65276438f, 0.344472796f, 0.53246361f, 0.310878813f, 0.313323706f,
+    0.664586723f, 0.264013112f, 0.564720511f, 0.348537296f, 0.314065486f, 0.64891988f, 0.388772905f, 0.721652985f,
+    0.165313795f, 0.513982594f, 0.314061999f, 0.599369884f, 0.331739813f, 0.265293807f, 0.184956893f, 0.531395793f,
+    0.404009998f, 0.615818977f, 0.178648695f, 0.451108992f, 0.452822f, 0.597228289f, 0.25338921f, 0.341041207f,
+    0.592364371f, 0.695804417f, 0.385108411f, 0.54081893f, 0.200930893f, 0.629539311f, 0.439504087f, 0.240529999f,
+    0.545017421f, 0.378235787f, 0.303389698f, 0.463377893f, 0.633595228f, 0.659882605f, 0.662169695f, 0.475524694f,
+    0.280120105f, 0.382948905f, 0.562362671f, 0.453634292f, 0.560813904f, 0.426577985f, 0.263709188f, 0.417075098f,
+    0.593298793f, 0.525676429f, 0.663262188f, 0.489258885f, 0.149977893f, 0.423332006f, 0.575604022f, 0.528882682f,
+    0.452401787f, 0.560412526f, 0.557827413f, 0.332305789f, 0.555878818f, 0.365394711f, 0.192453399f, 0.531364977f,
+    0.202773094f, 0.763606012f, 0.514082611f, 0.525297582f, 0.263293713f, 0.532868922f, 0.241608799f, 0.393654495f,
+    0.547874212f, 0.478819907f, 0.363161206f, 0.528831601f, 0.693113923f, 0.452010006f, 0.685505509f, 0.53004241f,
+    0.560689211f, 0.423062295f, 0.324722886f, 0.198569596f, 0.534987271f, 0.420750886f, 0.515345871f, 0.311810106f,
+    0.327450693f, 0.595307827f, 0.422552109f, 0.721117973f, 0.493659198f, 0.703027725f, 0.142553493f, 0.605933189f,
+    0.439399511f, 0.448884994f, 0.425655007f, 0.579543829f, 0.424603999f, 0.495800912f, 0.675943077f, 0.542348087f,
+    0.363654286f, 0.546434879f, 0.254881889f, 0.658765674f, 0.45328021f, 0.382277101f, 0.307732195f, 0.524413288f,
+    0.103386298f, 0.55547452f, 0.322131693f, 0.468237907f, 0.537307024f, 0.380066693f, 0.179920703f, 0.509506881f,
+    0.754460514f, 0.562864482f, 0.480168909f, 0.580210209f, 0.174274504f, 0.34665969f, 0.510715485f, 0.532608628f,
+    0.634277523f, 0.499269307f, 0.3433429f, 0.186813697f, 0.521546483f, 0.622930527f, 0.493577212f, 0.721794486f,
+    0.500797629f, 0.602414906f, 0.232950807f, 0.451041698f, 0.514199674f, 0.28602919f, 0.470492512f, 0.417985111f,
+    0.672664702f, 0.580980182f, 0.60747838f, 0.452405989f, 0.338351995f, 0.569691002f, 0.397084504f, 0.150270194f,
+    0.757367074f, 0.493643701f, 0.339093298f, 0.502509713f, 0.742208302f, 0.519737184f, 0.0973469168f, 0.518573999f,
+    0.364935011f, 0.561927915f, 0.3760297f, 0.632844508f, 0.493608207f, 0.742652476f, 0.138935f, 0.509196222f,
+    0.348264813f, 0.603631675f, 0.231917307f, 0.511665285f, 0.6555022f, 0.132607102f, 0.467403412f, 0.518202722f,
+    0.631824315f, 0.482551903f, 0.291867107f, 0.562137127f, 0.424921304f, 0.481374502f, 0.518400609f, 0.205122307f,
+    0.1179922f, 0.498781115f, 0.697375596f, 0.533983111f, 0.503328919f, 0.685190678f, 0.30028221f, 0.459308386f,
+    0.644004524f, 0.531129122f, 0.472910613f, 0.572146118f, 0.366233289f, 0.536198974f, 0.300863296f, 0.342238903f,
+    0.770345807f, 0.451639086f, 0.325634211f, 0.340655595f, 0.589702725f, 0.430657893f, 0.714958727f, 0.434568495f,
+    0.329597414f, 0.584562004f, 0.352668792f, 0.408195496f, 0.420311302f, 0.66341269f, 0.394246697f, 0.229407206f,
+    0.523896098f, 0.302603185f, 0.603219628f, 0.34124589f, 0.73062408f, 0.359932512f, 0.523438096f, 0.349375814f,
+    0.274610907f, 0.562658608f, 0.52822262f, 0.452204913f, 0.605430186f, 0.330686212f, 0.145500004f, 0.538492799f,
+    0.4814156f, 0.356374115f, 0.540514529f, 0.695774317f, 0.505089283f, 0.231699497f, 0.601858199f, 0.475508213f,
+    0.558523774f, 0.228246599f, 0.404058814f, 0.565016985f, 0.52677393f, 0.679404974f, 0.479703397f, 0.0884257331f,
+    0.402078807f, 0.545733213f, 0.526761293f, 0.480605215f, 0.639436483f, 0.172481f, 0.447982401f, 0.631000876f,
+    0.594816923f, 0.485417485f, 0.530936122f, 0.31836319f, 0.308497608f, 0.535202622f, 0.611532688f, 0.495164603f,
+    0.706133127f, 0.37542209f, 0.411551714f, 0.588944495f, 0.0956105664f, 0.530050874f, 0.396189809f, 0.648186922f,
+    0.511044025f, 0.312151909f, 0.480142891f, 0.542971015f, 0.416236311f, 0.732933521f, 0.535687208f, 0.345554709f,
+    0.365502208f, 0.37767601f, 0.539177477f, 0.403930485f, 0.695044398f, 0.498111695f, 0.529673278f, 0.58426398f,
+    0.478950292f, 0.609217882f, 0.672174275f, 0.406689405f, 0.358508795f, 0.537115812f, 0.403350711f, 0.154757202f,
+    0.543384373f, 0.0842926726f, 0.486005396f, 0.183301002f, 0.52075541f, 0.70482409f, 0.417058706f, 0.58651638f,
+    0.530791819f, 0.552245319f, 0.350716501f, 0.304265112f, 0.533932328f, 0.280623615f, 0.641013324f, 0.562087119f,
+    0.439031899f, 0.644555688f, 0.200271398f, 0.462466508f, 0.5263201f, 0.587398112f, 0.483660012f, 0.156613097f,
+    0.427017897f, 0.580666006f, 0.621586621f, 0.557664275f, 0.412200212f, 0.153670996f, 0.634426892f, 0.450741202f,
+    0.545797527f, 0.540165722f, 0.389079988f, 0.355561107f, 0.583675027f, 0.427431613f, 0.586044014f, 0.449895799f,
+    0.549819887f, 0.410099298f, 0.670137882f, 0.435300112f, 0.539117694f, 0.550405025f, 0.399093509f, 0.359293312f,
+    0.403417289f, 0.580607712f, 0.541238487f, 0.494492292f, 0.558943629f, 0.580921829f, 0.474695712f, 0.284589589f,
+    0.241441101f, 0.51957649f, 0.103009202f, 0.181463897f, 0.424607188f, 0.570797324f, 0.614332318f, 0.520567119f,
+    0.422044188f, 0.318259209f, 0.571046829f, 0.422609389f, 0.516282976f, 0.266628891f, 0.521467984f, 0.398176104f,
+    0.332276314f, 0.570583403f, 0.663655818f, 0.550556779f, 0.442066193f, 0.595993817f, 0.53695941f, 0.374433994f,
+    0.410359502f, 0.51775068f, 0.187810004f, 0.235289201f, 0.170875102f, 0.542497396f, 0.583653092f, 0.511743307f,
+    0.1865931f, 0.510869324f, 0.477549106f, 0.2439854f, 0.334964991f, 0.451836795f, 0.728935421f, 0.295080096f,
+    0.566905499f, 0.283085108f, 0.409057796f, 0.695149422f, 0.463786811f, 0.316767514f, 0.331670612f, 0.539639771f,
+    0.26005739f, 0.748429477f, 0.507319212f, 0.395201087f, 0.588027477f, 0.355212003f, 0.243487805f, 0.319556296f,
+    0.55854547f, 0.484528989f, 0.380118102f, 0.535851181f, 0.435632914f, 0.261306614f, 0.615549624f, 0.594206214f,
+    0.494542807f, 0.738485515f, 0.221448198f, 0.360097706f, 0.529855013f, 0.577656627f, 0.693445683f, 0.482720703f,
+    0.321667701f, 0.39625001f, 0.568036377f, 0.756741822f, 0.652355671f, 0.502705395f, 0.253877014f, 0.438727707f,
+    0.617763221f, 0.520114005f, 0.464791f, 0.618425488f, 0.304099411f, 0.451880813f, 0.624578297f, 0.27889359f,
+    0.469850004f, 0.650245428f, 0.180517107f, 0.320806891f, 0.552202284f, 0.643693388f, 0.567670524f, 0.450910389f,
+    0.312214613f, 0.296519399f, 0.523049474f, 0.546471179f, 0.461850286f, 0.567954898f, 0.543088019f, 0.543362319f,
+    0.338522106f, 0.526559472f, 0.485721588f, 0.681512415f, 0.283216089f, 0.396683097f, 0.551248074f, 0.678462029f,
+    0.390650302f, 0.545720279f, 0.364020407f, 0.582972407f, 0.419497997f, 0.460670292f, 0.326148301f, 0.523608088f,
+    0.702211201f, 0.287047088f, 0.507647693f, 0.470952094f, 0.470829189f, 0.616984189f, 0.311425298f, 0.185143501f,
+    0.550481498f, 0.493734807f, 0.615294814f, 0.473549992f, 0.651057184f, 0.408834189f, 0.568415225f, 0.30258289f,
+    0.523250282f, 0.201762095f, 0.642842591f, 0.432886511f, 0.642050982f, 0.525406599f, 0.249098405f, 0.528761923f,
+    0.33297959f, 0.359834492f, 0.549834073f, 0.481870502f, 0.526633024f, 0.310578912f, 0.399529189f, 0.32284379f,
+    0.581921518f, 0.802607119f, 0.387561709f, 0.546657085f, 0.437205791f, 0.112655103f, 0.639541626f, 0.54239893f,
+    0.497927308f, 0.604223609f, 0.349109203f, 0.419506788f, 0.577596605f, 0.488598704f, 0.544446826f, 0.442099512f,
+    0.669979215f, 0.447860599f, 0.656489372f, 0.551187873f, 0.401744515f, 0.540553629f, 0.229439303f, 0.51779002f,
+    0.356775612f, 0.556469977f, 0.362769812f, 0.55724138f, 0.678491116f, 0.412125289f, 0.60722357f, 0.545976698f,
+    0.527670681f, 0.237491593f, 0.0724927932f, 0.462634593f, 0.820896327f, 0.520873189f, 0.54844141f, 0.423003495f,
+    0.27805531f, 0.540383101f, 0.379098892f, 0.479833603f, 0.376695007f, 0.542922914f, 0.620716274f, 0.335794508f,
+    0.514263213f, 0.534464002f, 0.515960813f, 0.256182313f, 0.512309194f, 0.601764619f, 0.310937196f, 0.271228701f,
+    0.54424423f, 0.402888805f, 0.473606586f, 0.745143473f, 0.348799199f, 0.229033306f, 0.551788986f, 0.439314902f,
+    0.0901679024f, 0.623354018f, 0.478945911f, 0.548969626f, 0.557980895f, 0.437587798f, 0.35791561f, 0.561366022f,
+    0.393904388f, 0.390155494f, 0.452861905f, 0.544134319f, 0.580311179f, 0.333685011f, 0.550485611f, 0.612478912f,
+    0.0872716308f, 0.520458817f, 0.393532902f, 0.591885388f, 0.411961406f, 0.483962387f, 0.47873649f, 0.636066318f,
+    0.423111707f, 0.427458912f, 0.609404802f, 0.427198797f, 0.449710786f, 0.55491221f, 0.547719598f, 0.288292289f,
+    0.561512709f, 0.333887011f, 0.309935212f, 0.667749226f, 0.436904907f, 0.430172414f, 0.615388513f, 0.3387326f,
+    0.624871373f, 0.359413087f, 0.386842489f, 0.440934509f, 0.547647417f, 0.326017112f, 0.411134899f, 0.608816385f,
+    0.426942289f, 0.430646688f, 0.581051409f, 0.366914302f, 0.461066395f, 0.629059017f, 0.532868981f, 0.521326125f,
+    0.323121995f, 0.356857002f, 0.344066113f, 0.562560499f, 0.456117302f, 0.532135189f, 0.367415488f, 0.202935398f,
+    0.556303322f, 0.261884987f, 0.606219471f, 0.595076382f, 0.454511702f, 0.643552423f, 0.352073401f, 0.517977893f,
+    0.532668829f, 0.349198103f, 0.542923689f, 0.208402306f, 0.396527201f, 0.542545378f, 0.530641198f, 0.545038581f,
+    0.4256697f, 0.596861124f, 0.475814015f, 0.315094411f, 0.484774888f, 0.542631626f, 0.433834106f, 0.428750992f,
+    0.634518504f, 0.410185188f, 0.484910488f, 0.414633691f, 0.547126412f, 0.287718385f, 0.510190189f, 0.721695125f,
+    0.527618229f, 0.661845982f, 0.484163105f, 0.187415794f, 0.461693496f, 0.708896577f, 0.300197989f, 0.456180811f,
+    0.561078787f, 0.234170094f, 0.567228615f, 0.419996411f, 0.620748222f, 0.539495885f, 0.382386297f, 0.706168115f,
+    0.306551307f, 0.482737303f, 0.519312203f, 0.464243501f, 0.580769479f, 0.29498139f, 0.45858869f, 0.602235377f,
+    0.435784101f, 0.456153989f, 0.611906171f, 0.653714418f, 0.34747231f, 0.533696771f, 0.373167604f, 0.571722925f,
+    0.479337901f, 0.405643612f, 0.617404819f, 0.447175413f, 0.617969811f, 0.228549495f, 0.524956584f, 0.178495005f,
+    0.726195276f, 0.455039889f, 0.525299072f, 0.544522226f, 0.327221811f, 0.701383173f, 0.496594399f, 0.329559803f,
+    0.536264181f, 0.649610877f, 0.4757137f, 0.234374106f, 0.462011814f, 0.689841926f, 0.210071996f, 0.462152898f,
+    0.579713583f, 0.211826205f, 0.488461494f, 0.687249899f, 0.527510583f, 0.417232096f, 0.549113989f, 0.212487698f,
+    0.549521506f, 0.420779586f, 0.332194209f, 0.221295804f, 0.523265302f, 0.110179603f, 0.381010085f, 0.561729193f,
+    0.579505682f, 0.639226913f, 0.471143812f, 0.340988398f, 0.365930289f, 0.538817108f, 0.717038572f, 0.638681829f,
+    0.46813041f, 0.32637009f, 0.576781929f, 0.434641808f, 0.469782799f, 0.443738908f, 0.606166899f, 0.655851126f,
+    0.337635398f, 0.509165525f, 0.29478839f, 0.555698216f, 0.466545612f, 0.733835578f, 0.354387194f, 0.528514981f,
+    0.194444194f, 0.0990492925f, 0.513985395f, 0.582710981f, 0.344142795f, 0.514883876f, 0.520799816f, 0.48355031f,
+    0.632221997f, 0.136453807f, 0.453732014f, 0.606675088f, 0.496837497f, 0.583168089f, 0.468823999f, 0.756828904f,
+    0.43301481f, 0.576846898f, 0.444328189f, 0.527447283f, 0.303785592f, 0.358172089f, 0.593758404f, 0.429462999f,
+    0.595457673f, 0.479222298f, 0.58561331f, 0.357347786f, 0.402602285f, 0.576474309f, 0.498133302f, 0.4736588f,
+    0.558360815f, 0.616743684f, 0.413142413f, 0.62806952f, 0.344635814f, 0.103865802f, 0.520448923f, 0.216740206f,
+    0.673839927f, 0.489665091f, 0.51779151f, 0.481964588f, 0.54644382f, 0.342359602f, 0.448846102f, 0.591267109f,
+    0.556886315f, 0.516106784f, 0.171300098f, 0.491620392f, 0.640466273f, 0.28590849f, 0.545928299f, 0.471571386f,
+    0.569007516f, 0.327982694f, 0.430200785f, 0.569604516f, 0.538723528f, 0.50214231f, 0.596532226f, 0.347349405f,
+    0.647554517f, 0.464378208f, 0.339331508f, 0.510410011f, 0.777281523f, 0.366467386f, 0.540565073f, 0.392620504f,
+    0.425151914f, 0.413514495f, 0.69257462f, 0.345587313f, 0.223419398f, 0.528611898f, 0.420652002f, 0.650298178f,
+    0.411759794f, 0.367330104f, 0.290623814f, 0.544511199f, 0.423351586f, 0.388636112f, 0.626916587f, 0.552445114f,
+    0.496009588f, 0.537349105f, 0.684940517f, 0.403723508f, 0.67869401f, 0.381467611f, 0.552705884f, 0.374495596f,
+    0.352092892f, 0.564190328f, 0.307502598f, 0.48888281f, 0.545632124f, 0.474355012f, 0.292524815f, 0.468845487f,
+    0.623034775f, 0.689584315f, 0.535580218f, 0.342346609f, 0.593707621f, 0.470865995f, 0.273699701f, 0.528715611f,
+    0.533619285f, 0.322481394f, 0.298391014f, 0.562399924f, 0.429591209f, 0.681396127f, 0.585796893f, 0.460342914f,
+    0.274485111f, 0.504752696f, 0.236274198f, 0.524224818f, 0.482369095f, 0.675253689f, 0.173463494f, 0.635438085f,
+    0.458747506f, 0.458038092f, 0.517638087f, 0.120438501f, 0.233795702f, 0.390281409f, 0.565293014f, 0.551202893f,
+    0.545597613f, 0.479894906f, 0.612708688f, 0.531713188f, 0.385093212f, 0.5446437f, 0.523464382f, 0.221304402f,
+    0.491619796f, 0.147147596f, 0.485289395f, 0.277377397f, 0.462646186f, 0.576807916f, 0.164428994f, 0.47785911f,
+    0.62618649f, 0.525730789f, 0.549804807f, 0.398310691f, 0.403351903f, 0.414934009f, 0.579534113f, 0.393411487f,
+    0.0734004825f, 0.520258605f, 0.374950588f, 0.507815003f, 0.660606623f, 0.454771101f, 0.331100613f, 0.538425922f,
+    0.651325285f, 0.526476502f, 0.345699102f, 0.626861393f, 0.539921284f, 0.434539706f, 0.383560598f, 0.333766788f,
+    0.553916574f, 0.578827024f, 0.527507782f, 0.270112514f, 0.585228026f, 0.472833693f, 0.331391811f, 0.425881088f,
+    0.560978711f, 0.489519209f, 0.0438944809f, 0.422917098f, 0.561629295f, 0.478812814f, 0.480028212f, 0.580138922f,
+    0.707817614f, 0.444962412f, 0.595773101f, 0.417704701f, 0.537294805f, 0.373692691f, 0.665880799f, 0.264792204f,
+    0.510181785f, 0.454863489f, 0.515706182f, 0.343643904f, 0.235439107f, 0.688774109f, 0.51110518f, 0.543886781f,
+    0.545114875f, 0.483135313f, 0.211341903f, 0.527368188f, 0.399258703f, 0.468826085f, 0.550423503f, 0.438487113f,
+    0.3892847f, 0.600172281f, 0.456166297f, 0.068125613f, 0.481302589f, 0.562065721f, 0.0666322932f, 0.358823299f,
+    0.529540718f, 0.48226881f, 0.467033297f, 0.568311274f, 0.536079526f, 0.613724589f, 0.318808913f, 0.448772013f,
+    0.489416689f, 0.67166537f, 0.333674192f, 0.471821994f, 0.59606272f, 0.358855486f, 0.621871293f, 0.481730014f,
+    0.255002707f, 0.672807872f, 0.50510639f, 0.540190995f, 0.541946173f, 0.434714288f, 0.697062492f, 0.326341689f,
+    0.491787314f, 0.00729372911f, 0.457922995f, 0.537988126f, 0.602408886f, 0.333614409f, 0.496281594f, 0.355875105f,
+    0.169856295f, 0.520898581f, 0.55906862f, 0.584873378f, 0.379583687f, 0.567028821f, 0.518269479f, 0.332770914f,
+    0.541048586f, 0.602264225f, 0.364464402f, 0.344128191f, 0.52924341f, 0.274707586f, 0.802786827f, 0.522231519f,
+    0.358672798f, 0.490038693f, 0.468105614f, 0.572195292f, 0.538880587f, 0.667553782f, 0.344844192f, 0.923961401f,
+    0.488489687f, 0.63060528f, 0.39974311f, 0.566398203f, 0.397298098f, 0.520106375f, 0.514073014f, 0.124513097f,
+    0.380209506f, 0.330944806f, 0.54745388f, 0.489260197f, 0.593739927f, 0.466466904f, 0.702135324f, 0.322275102f,
+    0.506839514f, 0.471770108f, 0.450938314f, 0.565116286f, 0.38052249f, 0.314001799f, 0.685814619f, 0.683467329f,
+    0.299247295f, 0.547567785f, 0.294140697f, 0.38969779f, 0.587297082f, 0.357657194f, 0.523240089f, 0.323108792f,
+    0.671567321f, 0.547054172f, 0.386339605f, 0.277146012f, 0.468913615f, 0.585196376f, 0.270439714f, 0.562255025f,
+    0.357931703f, 0.417387187f, 0.419501305f, 0.554946899f, 0.285739094f, 0.602453291f, 0.437750787f, 0.468935013f,
+    0.466460496f, 0.576256216f, 0.638173997f, 0.371148795f, 0.553075075f, 0.52643621f, 0.373051286f, 0.544573128f,
+    0.243817002f, 0.532467127f, 0.368298888f, 0.648147404f, 0.489615887f, 0.655884326f, 0.361387014f, 0.550289571f,
+    0.363251805f, 0.2261132f, 0.498789012f, 0.684719622f, 0.244629905f, 0.351152509f, 0.539982677f, 0.682367325f,
+    0.489158005f, 0.713561893f, 0.352252185f, 0.404986888f, 0.551582575f, 0.41267699f, 0.28994289f, 0.538643181f,
+    0.377134413f, 0.582738698f, 0.426755697f, 0.468812495f, 0.485392213f, 0.616364479f, 0.174919501f, 0.682618976f,
+    0.489407003f, 0.461459607f, 0.518301725f, 0.268669605f, 0.175846696f, 0.636938214f, 0.493004411f, 0.413939893f,
+    0.604555726f, 0.481636405f, 0.545081079f, 0.292400092f, 0.669960618f, 0.628283679f, 0.598657012f, 0.485258013f,
+    0.334004909f, 0.516892374f, 0.267948002f, 0.592579186f, 0.543772817f, 0.434680015f, 0.412950099f, 0.452287406f,
+    0.655629218f, 0.45320341f, 0.378598392f, 0.541697502f, 0.688424826f, 0.309132606f, 0.524365485f, 0.476579398f,
+    0.47253859f, 0.571655512f, 0.214335993f, 0.565321028f, 0.438511103f, 0.59247762f, 0.45734489f, 0.576938272f,
+    0.599260926f, 0.361008108f, 0.504932582f, 0.153848901f, 0.521614075f, 0.142839104f, 0.282550693f, 0.403501689f,
+    0.543779314f, 0.466899693f, 0.533135474f, 0.413657188f, 0.715516329f, 0.311789989f, 0.520843983f, 0.463765889f,
+    0.456165314f, 0.544523418f, 0.419310808f, 0.596623778f, 0.410050005f, 0.484505594f, 0.620684624f, 0.493120909f,
+    0.528246284f, 0.91048342f, 0.345592201f, 0.470855415f, 0.565162301f, 0.473102391f, 0.617588699f, 0.513953328f,
+    0.342308789f, 0.491828203f, 0.594208717f, 0.492304295f, 0.640527189f, 0.450439692f, 0.61920768f, 0.537481308f,
+    0.224710107f, 0.521717072f, 0.255470306f, 0.379251599f, 0.524322689f, 0.386033714f, 0.538068771f, 0.417836398f,
+    0.613362312f, 0.402853787f, 0.553685188f, 0.527992129f, 0.233467504f, 0.517591178f, 0.107485302f, 0.534592986f,
+    0.419893801f, 0.385582507f, 0.333519012f, 0.526320219f, 0.586039722f, 0.543778479f, 0.371610492f, 0.333075494f,
+    0.536659777f, 0.469379395f, 0.100695603f, 0.481603593f, 0.621567726f, 0.546195388f, 0.4578453f, 0.541930974f,
+    0.200804695f, 0.519328117f, 0.391219407f, 0.429974407f, 0.434450299f, 0.553197384f, 0.107572101f, 0.5762797f,
+    0.457464397f, 0.747680783f, 0.526176512f, 0.450555086f, 0.440710306f, 0.424427092f, 0.689297676f, 0.125226796f,
+    0.407779187f, 0.544281781f, 0.537800372f, 0.31665799f, 0.528573811f, 0.490521491f, 0.452273607f, 0.558061421f,
+    0.661268175f, 0.51077652f, 0.338692993f, 0.570756018f, 0.501602113f, 0.63064599f, 0.301780611f, 0.629385114f,
+    0.452048898f, 0.334400713f, 0.282537907f, 0.515097082f, 0.139826506f, 0.529399872f, 0.233172804f, 0.494046599f,
+    0.546657085f, 0.462676793f, 0.627004087f, 0.550814092f, 0.406187296f, 0.409656793f, 0.561555684f, 0.466688603f,
+    0.231148094f, 0.308701187f, 0.551466227f, 0.700505614f, 0.579748571f, 0.469165087f, 0.592859507f, 0.374139786f,
+    0.517016888f, 0.54149878f, 0.51803273f, 0.152968407f, 0.2515468f, 0.512199879f, 0.372594893f, 0.553243577f,
+    0.496076614f, 0.598331511f, 0.416395307f, 0.588014483f, 0.339966297f, 0.784662127f, 0.328811407f, 0.515508771f,
+    0.459605992f, 0.312698692f, 0.71833992f, 0.527400613f, 0.48786661f, 0.561515272f, 0.516081214f, 0.570161402f,
+    0.320485085f, 0.553883791f, 0.534942925f, 0.44721511f, 0.501283705f, 0.256293595f, 0.450338304f, 0.26304999f,
+    0.575650871f, 0.485486388f, 0.40847519f, 0.407335609f, 0.592024088f, 0.341938287f, 0.682956398f, 0.440452307f,
+    0.439174503f, 0.460106313f, 0.635793686f, 0.373001009f, 0.309382409f, 0.590137005f, 0.4337565f, 0.421750396f,
+    0.584684789f, 0.408469111f, 0.508728683f, 0.727718413f, 0.296790302f, 0.411046296f, 0.558121979f, 0.428730994f,
+    0.426619589f, 0.64440459f, 0.408482492f, 0.318192095f, 0.523069322f, 0.354835689f, 0.561059773f, 0.269384891f,
+    0.623540819f, 0.286198199f, 0.522684813f, 0.325783312f, 0.388296902f, 0.534116626f, 0.6353966f, 0.588076115f,
+    0.459309012f, 0.313401014f, 0.52771318f, 0.36041069f, 0.529034197f, 0.465447992f, 0.604490519f, 0.254112691f,
+    0.43669191f, 0.582288623f, 0.547269225f, 0.146160796f, 0.518181086f, 0.127013505f, 0.483268499f, 0.222357899f,
+    0.591892898f, 0.476150692f, 0.572722375f, 0.363673091f, 0.527173102f, 0.274052501f, 0.549778402f, 0.605989516f,
+    0.496031404f, 0.376946509f, 0.406236202f, 0.566821516f, 0.461865693f, 0.486750513f, 0.651844978f, 0.567759573f,
+    0.371073395f, 0.567660511f, 0.251152188f, 0.388675094f, 0.526225388f, 0.655747294f, 0.593410611f, 0.428592205f,
+    0.542605877f, 0.535130322f, 0.483427793f, 0.206716895f, 0.511225224f, 0.346871406f, 0.447900802f, 0.625390172f,
+    0.496898711f, 0.203130394f, 0.561872184f, 0.404657215f, 0.494326413f, 0.561342776f, 0.384533197f, 0.775984228f,
+    0.462473303f, 0.628627717f, 0.240931407f, 0.534550488f, 0.350795805f, 0.664710104f, 0.499850988f, 0.3022165f,
+    0.591915071f, 0.635176778f, 0.499331087f, 0.190233603f, 0.525336921f, 0.398586005f, 0.466610402f, 0.3823165f,
+    0.532663286f, 0.706365585f, 0.381346285f, 0.524673522f, 0.479163885f, 0.449121803f, 0.537090123f, 0.207647398f,
+    0.444763511f, 0.566716313f, 0.54650712f, 0.549326181f, 0.458070815f, 0.550157189f, 0.508579075f, 0.330569804f,
+    0.427646905f, 0.112321801f, 0.515272319f, 0.738677204f, 0.4996292f, 0.133941397f, 0.4679012f, 0.69286561f,
+    0.501206815f, 0.583358228f, 0.38263911f, 0.556635082f, 0.300272107f, 0.590804279f, 0.500087082f, 0.397503495f,
+    0.36976859f, 0.57561928f, 0.63752681f, 0.536326587f, 0.443317086f, 0.582899928f, 0.268067092f, 0.464288592f,
+    0.547532022f, 0.532083392f, 0.46464929f, 0.523274481f, 0.493508607f, 0.310311794f, 0.288304687f, 0.364031315f,
+    0.536875486f, 0.646863103f, 0.525965989f, 0.383142799f, 0.208681896f, 0.497853309f, 0.596125722f, 0.574642181f,
+    0.35868451f, 0.536347389f, 0.283313692f, 0.547772229f, 0.41105321f, 0.599038601f, 0.572525322f, 0.414951205f,
+    0.539635181f, 0.537970424f, 0.389130294f, 0.371467113f, 0.5529567f, 0.37558049f, 0.502577305f, 0.585032225f,
+    0.461757392f, 0.593770087f, 0.56453681f, 0.393762499f, 0.51821059f, 0.300741613f, 0.519640386f, 0.36975801f,
+    0.432759315f, 0.571580887f, 0.34737131f, 0.543825924f, 0.445390612f, 0.651171386f, 0.144329503f, 0.488819987f,
+    0.395110905f, 0.391026586f, 0.534950376f, 0.127574399f, 0.503828883f, 0.695130408f, 0.525344312f, 0.501124382f,
+    0.731133282f, 0.495353609f, 0.253555596f, 0.646244287f, 0.233072206f, 0.47022441f, 0.554454923f, 0.0336896889f,
+    0.478712112f, 0.633835196f, 0.543148696f, 0.410583287f, 0.540399075f, 0.310553998f, 0.425447196f, 0.544715405f,
+    0.611836195f, 0.529004216f, 0.422478706f, 0.431534588f, 0.662926316f, 0.3028965f, 0.549185276f, 0.318855405f,
+    0.518428922f, 0.33288309f, 0.392360806f, 0.523513913f, 0.597764671f, 0.454168797f, 0.536942899f, 0.631814122f,
+    0.349063307f, 0.475902498f, 0.588719785f, 0.596133173f, 0.484198302f, 0.170540407f, 0.477937996f, 0.0978796631f,
+    0.582222402f, 0.545962691f, 0.461006612f, 0.36703229f, 0.430238605f, 0.569171071f, 0.691732109f, 0.711004019f,
+    0.50601548f, 0.876918912f, 0.651919186f, 0.454606891f, 0.532986581f, 0.52204591f, 0.295351893f, 0.504863322f,
+    0.583735824f, 0.302008599f, 0.315806389f, 0.438638985f, 0.54432112f, 0.562539577f, 0.528119802f, 0.34014079f,
+    0.347165912f, 0.448169708f, 0.53857702f, 0.449251294f, 0.416731209f, 0.602110207f, 0.414842814f, 0.559208989f,
+    0.407321095f, 0.608891428f, 0.529830515f, 0.376195014f, 0.47160849f, 0.510133684f, 0.0467468016f, 0.118186899f,
+    0.511906326f, 0.777844191f, 0.187413499f, 0.498002797f, 0.700581789f, 0.448223889f, 0.626575291f, 0.440265507f,
+    0.399947494f, 0.524778485f, 0.819357574f, 0.352981687f, 0.585272789f, 0.324597806f, 0.38928169f, 0.433505207f,
+    0.652062416f, 0.404113501f, 0.562498212f, 0.396752506f, 0.385611206f, 0.599788904f, 0.424161404f, 0.666016877f,
+    0.448137909f, 0.558348775f, 0.353545904f, 0.340980709f, 0.542068779f, 0.1934084f, 0.408362687f, 0.549022198f,
+    0.228570804f, 0.464866787f, 0.601735592f, 0.359803885f, 0.425965101f, 0.547643483f, 0.650723815f, 0.514940977f,
+    0.336298496f, 0.267293006f, 0.56521821f, 0.429814488f, 0.115188599f, 0.43735981f, 0.561212897f, 0.520464897f,
+    0.481346786f, 0.636120915f, 0.150687099f, 0.45816949f, 0.620024085f, 0.343223512f, 0.308822691f, 0.522673786f,
+    0.718793929f, 0.312081486f, 0.506584406f, 0.475458413f, 0.526165783f, 0.335017413f, 0.171348095f, 0.472580194f,
+    0.595646918f, 0.655822277f, 0.483540088f, 0.558691382f, 0.264570594f, 0.36579451f, 0.512477219f, 0.2385654f,
+    0.54904741f, 0.427474797f, 0.693890095f, 0.364598811f, 0.509252608f, 0.468580812f, 0.497341007f, 0.772609711f,
+    0.687746584f, 0.47885251f, 0.692165792f, 0.548183978f, 0.380016297f, 0.520449281f, 0.258243501f, 0.49611631f,
+    0.321520299f, 0.546042383f, 0.604654372f, 0.493992209f, 0.529109418f, 0.544612288f, 0.356736213f, 0.551832914f,
+    0.693097889f, 0.509338796f, 0.320152611f, 0.498924613f, 0.227705404f, 0.481093109f, 0.528386712f, 0.325592488f,
+    0.626653612f, 0.509713709f, 0.319191009f, 0.454958588f, 0.264503896f, 0.51538682f, 0.619758487f, 0.546919882f,
+    0.420685589f, 0.414076f, 0.547660887f, 0.415502101f, 0.716046929f, 0.524080813f, 0.37296629f, 0.403379887f,
+    0.526398599f, 0.356009305f, 0.45697999f, 0.304257095f, 0.586825371f, 0.491415709f, 0.491852999f, 0.626696289f,
+    0.563323617f, 0.55539161f, 0.382764608f, 0.549869776f, 0.438228309f, 0.542403281f, 0.28881219f, 0.347265512f,
+    0.507637084f, 0.466120511f, 0.374477506f, 0.52940011f, 0.466048509f, 0.417506188f, 0.691630602f, 0.201821506f,
+    0.751119792f, 0.503208399f, 0.250451386f, 0.330140114f, 0.521833718f, 0.461444288f, 0.461995006f, 0.524703026f,
+    0.631436825f, 0.340130687f, 0.505552709f, 0.4939996f, 0.296545088f, 0.519436777f, 0.788699806f, 0.510698676f,
+    0.296714604f, 0.57143712f, 0.448120087f, 0.538491189f, 0.619356871f, 0.433988512f, 0.769729912f, 0.31713891f,
+    0.524669886f, 0.424120814f, 0.423189998f, 0.41741389f, 0.591960371f, 0.427738905f, 0.372016102f, 0.522681892f,
+    0.54780668f, 0.362867892f, 0.615000486f, 0.474707514f, 0.458013803f, 0.55856818f, 0.529880106f, 0.369838506f,
+    0.849861979f, 0.556566179f, 0.479571313f, 0.628625989f, 0.405240595f, 0.617301524f, 0.441426396f, 0.357057095f,
+    0.315132886f, 0.525270283f, 0.612472117f, 0.516997576f, 0.359627187f, 0.491498798f, 0.454621106f, 0.53958118f,
+    0.190313399f, 0.697407722f, 0.496771604f, 0.474894792f, 0.518017828f, 0.292432189f, 0.766587019f, 0.521555126f,
+    0.336571902f, 0.626095772f, 0.453350991f, 0.538648903f, 0.410349607f, 0.583039105f, 0.430410594f, 0.213258296f,
+    0.487289101f, 0.545891523f, 0.3974365f, 0.756855071f, 0.504561186f, 0.396629989f, 0.419808298f, 0.543580413f,
+    0.636945784f, 0.526956677f, 0.381224304f, 0.415676296f, 0.352353305f, 0.534945428f, 0.440332204f, 0.605816126f,
+    0.446821898f, 0.482570589f, 0.483599812f, 0.603927791f, 0.687182724f, 0.284222096f, 0.514542818f, 0.602442622f,
+    0.47566101f, 0.572115421f, 0.493106902f, 0.331169814f, 0.622759819f, 0.523209274f, 0.399523199f, 0.531479776f,
+    0.448161989f, 0.390797198f, 0.667164087f, 0.535701096f, 0.477096587f, 0.557009995f, 0.494712412f, 0.524130702f,
+    0.251265496f, 0.461955398f, 0.630171895f, 0.497303188f, 0.287097007f, 0.425280511f, 0.557924688f, 0.574731588f,
+    0.520337403f, 0.39035669f, 0.553432107f, 0.533804417f, 0.392584085f, 0.414431602f, 0.470137298f, 0.528173625f,
+    0.252725601f, 0.560514629f, 0.429785609f, 0.483968288f, 0.511050284f, 0.08048933f, 0.382892013f, 0.485842913f,
+    0.735495925f, 0.672322392f, 0.442957789f, 0.607077777f, 0.307634503f, 0.559364378f, 0.365102291f, 0.427796811f,
+    0.458354503f, 0.528468311f, 0.379819214f, 0.38504371f, 0.593968809f, 0.412302494f, 0.576059997f, 0.423764586f,
+    0.392992109f, 0.576192319f, 0.278044492f, 0.479450703f, 0.0740558803f, 0.515357792f, 0.585873783f, 0.356761098f,
+    0.55989629f, 0.534685075f, 0.478253692f, 0.545675397f, 0.28318119f, 0.548521578f, 0.415969789f, 0.563910127f,
+    0.459698409f, 0.59312427f, 0.323062003f, 0.379529387f, 0.54086113f, 0.113229796f, 0.633937001f, 0.483877093f,
+    0.566525519f, 0.675141811f, 0.414094508f, 0.356125891f, 0.534727991f, 0.364977986f, 0.275465608f, 0.422599286f,
+    0.562917888f, 0.490603685f, 0.400705189f, 0.538070917f, 0.221467197f, 0.735315621f, 0.500503302f, 0.332790613f,
+    0.391528904f, 0.540184975f, 0.717660487f, 0.452697814f, 0.607691288f, 0.256983399f, 0.49996379f, 0.595822811f,
+    0.345909387f, 0.451512694f, 0.582971573f, 0.480739206f, 0.346221685f, 0.520159483f, 0.659985304f, 0.282182813f,
+    0.512528479f, 0.488381892f, 0.482991815f, 0.542871714f, 0.443459898f, 0.225663602f, 0.595622778f, 0.4527224f,
+    0.284434915f, 0.518645287f, 0.380899906f, 0.57186991f, 0.426256388f, 0.594271898f, 0.77311039f, 0.499765396f,
+    0.668113828f, 0.330560803f, 0.474997491f, 0.286093295f, 0.618888319f, 0.484210014f, 0.607024908f, 0.378268987f,
+    0.536819696f, 0.369020998f, 0.385711491f, 0.53181088f, 0.232700899f, 0.556072295f, 0.430141002f, 0.676763773f,
+    0.519490421f, 0.361285388f, 0.3237845f, 0.119485199f, 0.49917239f, 0.485496014f, 0.487232298f, 0.59035778f,
+    0.654731572f, 0.58492732f, 0.455423087f, 0.40646261f, 0.539954305f, 0.415280998f, 0.179668099f, 0.425186306f,
+    0.541352272f, 0.522812486f, 0.485374302f, 0.609344423f, 0.220502406f, 0.569273174f, 0.446875691f, 0.148331404f,
+    0.62112838f, 0.496660113f, 0.229467198f, 0.640709102f, 0.474856287f, 0.535493612f, 0.513697803f, 0.0105957398f,
+    0.371180385f, 0.171207398f, 0.506175816f, 0.672911882f, 0.441064596f, 0.544402778f, 0.556891084f, 0.502386928f,
+    0.356240511f, 0.545678616f, 0.554513872f, 0.4622311f, 0.494253606f, 0.296123385f, 0.596433878f, 0.549522877f,
+    0.517395914f, 0.294021696f, 0.310629994f, 0.465115011f, 0.684661388f, 0.522605717f, 0.518224418f, 0.2705428f,
+    0.1109512f, 0.49386251f, 0.140411094f, 0.439235687f, 0.521655202f, 0.229411393f, 0.617665291f, 0.523622274f,
+    0.33289659f, 0.486618698f, 0.411640704f, 0.539564013f, 0.561073601f, 0.562138915f, 0.346120387f, 0.489676207f,
+    0.430540413f, 0.534071386f, 0.554499984f, 0.603854001f, 0.3746593f, 0.500734806f, 0.529809713f, 0.47161451f,
+    0.626937509f, 0.515482783f, 0.381304085f, 0.444023997f, 0.469753414f, 0.548550427f, 0.551360488f, 0.361863911f,
+    0.583845675f, 0.252322286f, 0.411725789f, 0.539299607f, 0.672632992f, 0.504119277f, 0.360772908f, 0.156373903f,
+    0.489198089f, 0.577984512f, 0.218687907f, 0.477157712f, 0.609923124f, 0.346399695f, 0.363069296f, 0.525219619f,
+    0.666632175f, 0.339954704f, 0.503569782f, 0.503680289f, 0.54185307f, 0.4318977f, 0.722102523f, 0.332097292f,
+    0.502443373f, 0.193876505f, 0.480218887f, 0.57307148f, 0.426251501f, 0.571917117f, 0.406415313f, 0.499572605f,
+    0.528928697f, 0.458172888f, 0.601214826f, 0.505797684f, 0.359943211f, 0.499179691f, 0.467546999f, 0.537477314f,
+    0.658647895f, 0.385329604f, 0.519604027f, 0.600423574f, 0.329322785f, 0.524523675f, 0.256591409f, 0.461549401f,
+    0.594243228f, 0.548737586f, 0.457835913f, 0.54269278f, 0.393946111f, 0.404978991f, 0.552070379f, 0.4879089f,
+    0.484494388f, 0.551282585f, 0.436797112f, 0.64259553f, 0.488182694f, 0.537209928f, 0.583455324f, 0.48690781f,
+    0.382463694f, 0.481348813f, 0.69667393f, 0.05392766f, 0.533745587f, 0.416074812f, 0.599743724f, 0.372718513f,
+    0.51156342f, 0.525203526f, 0.52567178f, 0.393440604f, 0.206192493f, 0.0618832111f, 0.492505789f, 0.315759003f,
+    0.203368202f, 0.516476989f, 0.661118329f, 0.280778915f, 0.496287614f, 0.514638782f, 0.628448784f, 0.495558888f,
+    0.148674801f, 0.470133811f, 0.632097185f, 0.528681815f, 0.464837015f, 0.533321023f, 0.508487821f, 0.362962514f,
+    0.875715673f, 0.485669613f, 0.458411604f, 0.542024076f, 0.270730287f, 0.505748689f, 0.702652395f, 0.482727885f,
+    0.424724907f, 0.550876319f, 0.810480118f, 0.515461922f, 0.351437986f, 0.488688886f, 0.462237805f, 0.538247824f,
+    0.636659622f, 0.536850691f, 0.376542985f, 0.423468709f, 0.467240602f, 0.535068393f, 0.573276281f, 0.548179924f,
+    0.378459305f, 0.515590727f, 0.535318971f, 0.438715398f, 0.503200293f, 0.587353885f, 0.221544504f, 0.541702986f,
+    0.6056512f, 0.498518199f, 0.335206985f, 0.692924082f, 0.477822006f
+};
+
+constexpr int32_t rectX[6282] = {
+    2, 2, 0, 8, 8, 0, 13, 13, 0, 4, 8, 0, 6, 6, 0, 3,
+    3, 0, 4, 4, 0, 9, 9, 0, 1, 7, 0, 4, 4, 0, 1, 1,
+    0, 2, 2, 0, 7, 9, 0, 6, 6, 0, 8, 8, 0, 3, 3, 0,
+    14, 14, 0, 4, 8, 0, 0, 3, 0, 5, 5, 0, 13, 13, 0, 12,
+    12, 0, 1, 1, 0, 2, 2, 0, 5, 5, 0, 2, 2, 0, 4, 8,
+    0, 13, 13, 0, 5, 5, 0, 7, 9, 0, 12, 14, 12, 5, 5, 0,
+    5, 7, 0, 0, 3, 0, 9, 9, 0, 0, 0, 0, 2, 2, 5, 2,
+    2, 0, 10, 13, 10, 12, 12, 0, 5, 5, 7, 7, 7, 0, 4, 10,
+    4, 7, 11, 7, 9, 9, 0, 3, 3, 9, 15, 15, 0, 10, 11, 0,
+    0, 0, 0, 7, 8, 0, 2, 2, 0, 9, 9, 0, 6, 6, 0, 4,
+    8, 0, 10, 10, 0, 12, 12, 0, 4, 4, 0, 7, 9, 0, 12, 12,
+    0, 15, 15, 0, 2, 2, 7, 5, 5, 0, 12, 12, 0, 15, 15, 0,
+    0, 4, 0, 2, 2, 0, 10, 11, 0, 10, 11, 0, 7, 7, 0, 4,
+    4, 0, 10, 10, 0, 5, 5, 0, 5, 7, 0, 6, 7, 0, 7, 9,
+    0, 9, 9, 0, 8, 9, 0, 1, 1, 0, 9, 10, 0, 16, 16, 0,
+    8, 9, 0, 0, 0, 9, 13, 13, 0, 12, 12, 0, 7, 8, 0, 6,
+    6, 0, 10, 13, 10, 13, 13, 0, 4, 4, 7, 6, 6, 0, 8, 8,
+    0, 2, 2, 0, 0, 0, 0, 10, 10, 0, 7, 8, 0, 8, 9, 0,
+    4, 4, 0, 6, 9, 0, 5, 8, 0, 4, 4, 0, 13, 13, 0, 10,
+    10, 0, 3, 3, 6, 1, 3, 0, 9, 10, 0, 10, 11, 0, 2, 2,
+    0, 7, 7, 0, 7, 9, 0, 10, 11, 0, 8, 9, 0, 2, 2, 10,
+    8, 8, 0, 7, 7, 0, 0, 2, 0, 2, 2, 0, 16, 16, 0, 13,
+    16, 13, 7, 7, 0, 7, 7, 0, 15, 15, 0, 10, 10, 0, 6, 6,
+    0, 6, 6, 0, 13, 13, 0, 12, 15, 12, 3, 3, 0, 9, 10, 0,
+    1, 1, 0, 1, 1, 5, 9, 9, 0, 10, 10, 0, 5, 8, 0, 0,
+    0, 0, 6, 6, 0, 8, 8, 0, 6, 6, 0, 3, 3, 8, 15, 15,
+    0, 5, 10, 5, 1, 3, 0, 1, 1, 0, 13, 16, 13, 11, 11, 0,
+    0, 0, 10, 1, 1, 0, 11, 11, 0, 11, 11, 0, 9, 9, 0, 8,
+    8, 0, 3, 10, 3, 18, 18, 0, 3, 3, 0, 0, 0, 0, 9, 9,
+    0, 10, 15, 10, 7, 7, 0, 6, 8, 0, 10, 11, 0, 9, 11, 0,
+    3, 3, 0, 7, 7, 0, 2, 11, 2, 10, 11, 0, 0, 0, 9, 7,
+    8, 0, 9, 9, 0, 10, 10, 0, 2, 7, 0, 2, 2, 0, 9, 9,
+    0, 9, 9, 0, 0, 0, 4, 5, 5, 10, 9, 9, 0, 9, 10, 0,
+    8, 9, 0, 8, 9, 0, 12, 14, 12, 12, 12, 0, 0, 3, 0, 1,
+    1, 0, 7, 9, 0, 8, 8, 0, 12, 12, 0, 8, 12, 8, 4, 4,
+    0, 1, 4, 0, 9, 9, 0, 10, 10, 0, 3, 3, 0, 7, 7, 0,
+    13, 13, 0, 14, 14, 0, 6, 6, 0, 3, 3, 0, 8, 8, 0, 9,
+    9, 0, 5, 5, 10, 6, 6, 0, 1, 7, 0, 11, 11, 0, 5, 7,
+    0, 3, 3, 0, 12, 12, 0, 11, 11, 0, 0, 0, 0, 2, 2, 0,
+    9, 10, 0, 5, 9, 0, 8, 9, 0, 3, 7, 0, 10, 12, 0, 5,
+    5, 0, 4, 6, 0, 9, 9, 0, 3, 11, 3, 9, 9, 0, 1, 1,
+    9, 8, 8, 0, 4, 10, 4, 7, 10, 7, 8, 8, 0, 7, 9, 0,
+    6, 6, 0, 10, 12, 0, 0, 6, 0, 6, 6, 0, 11, 11, 0, 4,
+    10, 4, 1, 2, 0, 1, 2, 0, 4, 10, 4, 3, 3, 0, 3, 3,
+    10, 2, 2, 0, 9, 9, 0, 8, 10, 8, 6, 8, 0, 9, 10, 0,
+    9, 10, 0, 9, 9, 0, 8, 9, 0, 6, 8, 0, 0, 0, 0, 1,
+    1, 5, 7, 7, 0, 3, 3, 0, 6, 8, 0, 0, 0, 0, 9, 9,
+    0, 2, 2, 0, 4, 4, 7, 0, 3, 0, 10, 15, 10, 5, 9, 0,
+    9, 9, 0, 9, 9, 0, 9, 10, 0, 12, 15, 12, 8, 9, 0, 1,
+    1, 10, 9, 10, 0, 10, 10, 0, 8, 9, 0, 5, 5, 0, 8, 12,
+    8, 5, 5, 0, 4, 4, 10, 5, 5, 0, 7, 7, 0, 9, 9, 0,
+    8, 8, 0, 1, 1, 0, 9, 9, 0, 12, 13, 0, 5, 6, 0, 5,
+    5, 0, 1, 10, 1, 7, 7, 0, 6, 7, 0, 0, 0, 9, 7, 7,
+    0, 9, 9, 0, 9, 9, 0, 8, 8, 0, 13, 13, 0, 4, 4, 0,
+    6, 6, 10, 1, 1, 0, 2, 11, 2, 7, 7, 0, 0, 0, 0, 4,
+    4, 0, 19, 19, 0, 6, 6, 0, 0, 0, 0, 5, 5, 0, 8, 8,
+    0, 10, 12, 0, 8, 8, 0, 9, 9, 0, 10, 12, 0, 5, 10, 0,
+    2, 2, 0, 4, 6, 0, 8, 10, 0, 1, 7, 0, 0, 4, 0, 0,
+    5, 0, 8, 10, 0, 11, 11, 0, 6, 8, 0, 6, 6, 0, 9, 10,
+    0, 12, 12, 0, 8, 9, 0, 4, 6, 0, 10, 10, 0, 10, 11, 0,
+    1, 7, 0, 2, 5, 0, 1, 1, 0, 5, 5, 0, 14, 14, 0, 11,
+    14, 11, 9, 9, 0, 3, 3, 0, 14, 14, 0, 15, 15, 0, 0, 3,
+    0, 3, 3, 6, 4, 4, 0, 10, 10, 0, 7, 9, 0, 1, 1, 9,
+    9, 9, 0, 11, 11, 0, 3, 3, 0, 7, 7, 0, 8, 10, 8, 7,
+    12, 7, 8, 8, 0, 5, 7, 0, 9, 9, 0, 14, 14, 0, 9, 9,
+    0, 1, 1, 5, 19, 19, 0, 9, 9, 0, 3, 3, 10, 5, 5, 0,
+    11, 11, 0, 7, 7, 0, 7, 7, 10, 0, 0, 0, 6, 6, 0, 9,
+    9, 0, 7, 7, 0, 0, 0, 0, 11, 11, 0, 11, 11, 0, 3, 7,
+    0, 0, 2, 0, 7, 9, 0, 9, 9, 0, 3, 3, 0, 4, 4, 0,
+    11, 11, 0, 8, 10, 0, 7, 8, 0, 6, 8, 0, 11, 11, 0, 11,
+    11, 0, 8, 9, 0, 9, 10, 0, 14, 14, 0, 8, 8, 0, 0, 0,
+    0, 4, 4, 0, 11, 11, 0, 12, 12, 0, 5, 5, 0, 5, 7, 0,
+    15, 15, 0, 9, 9, 0, 1, 1, 0, 2, 2, 0, 9, 9, 0, 9,
+    9, 0, 7, 8, 0, 5, 7, 0, 6, 10, 6, 0, 10, 0, 6, 7,
+    0, 0, 2, 0, 11, 11, 0, 12, 12, 0, 6, 6, 0, 5, 5, 0,
+    2, 11, 2, 7, 7, 0, 0, 1, 0, 1, 1, 0, 9, 9, 0, 8,
+    8, 0, 0, 0, 9, 7, 7, 0, 17, 17, 0, 12, 12, 0, 2, 2,
+    0, 5, 5, 0, 1, 7, 0, 0, 0, 0, 7, 9, 0, 13, 16, 13,
+    3, 3, 5, 0, 0, 0, 9, 9, 0, 11, 11, 0, 5, 5, 8, 5,
+    5, 0, 13, 13, 0, 8, 8, 0, 1, 1, 10, 3, 3, 0, 18, 18,
+    0, 9, 11, 0, 0, 3, 0, 4, 4, 0, 6, 9, 0, 9, 9, 0,
+    5, 7, 0, 5, 8, 0, 14, 14, 0, 18, 18, 0, 8, 9, 0, 0,
+    3, 0, 13, 16, 13, 8, 8, 0, 1, 1, 4, 1, 1, 0, 9, 9,
+    0, 12, 12, 0, 5, 8, 0, 6, 6, 0, 1, 7, 0, 12, 12, 0,
+    7, 7, 0, 6, 7, 0, 0, 0, 0, 8, 14, 8, 8, 8, 0, 8,
+    8, 0, 12, 12, 0, 6, 10, 6, 0, 0, 0, 9, 10, 0, 9, 9,
+    0, 17, 17, 0, 3, 3, 0, 7, 7, 0, 14, 14, 0, 4, 4, 0,
+    1, 1, 0, 1, 1, 7, 12, 12, 0, 9, 10, 0, 9, 10, 0, 0,
+    0, 0, 12, 12, 0, 9, 10, 0, 4, 4, 0, 8, 9, 0, 9, 10,
+    0, 16, 17, 0, 8, 9, 0, 1, 2, 0, 10, 11, 0, 17, 17, 0,
+    2, 2, 0, 9, 9, 0, 6, 6, 0, 13, 16, 13, 1, 2, 0, 4,
+    4, 0, 8, 8, 0, 5, 9, 0, 1, 5, 0, 1, 3, 0, 8, 8,
+    0, 10, 12, 0, 4, 8, 0, 4, 6, 0, 3, 3, 0, 8, 8, 0,
+    8, 8, 0, 5, 8, 0, 18, 18, 0, 16, 16, 0, 8, 9, 0, 7,
+    8, 0, 5, 5, 0, 12, 12, 0, 8, 9, 0, 3, 7, 0, 1, 4,
+    0, 5, 5, 8, 16, 16, 0, 16, 16, 0, 8, 9, 0, 8, 8, 0,
+    7, 13, 7, 11, 11, 0, 7, 7, 0, 5, 5, 0, 11, 14, 11, 5,
+    9, 0, 4, 4, 0, 4, 4, 0, 14, 14, 0, 15, 15, 0, 7, 7,
+    0, 8, 8, 0, 11, 14, 11, 12, 12, 0, 3, 3, 9, 3, 3, 6,
+    16, 18, 16, 5, 10, 5, 0, 0, 2, 1, 1, 7, 10, 11, 0, 11,
+    12, 11, 7, 8, 0, 8, 8, 0, 10, 12, 10, 13, 13, 0, 3, 3,
+    0, 7, 7, 8, 2, 2, 0, 10, 12, 10, 6, 6, 8, 3, 3, 0,
+    0, 0, 0, 6, 6, 0, 8, 9, 0, 9, 9, 0, 9, 9, 0, 5,
+    5, 0, 9, 10, 0, 5, 10, 0, 13, 13, 0, 4, 8, 0, 7, 8,
+    0, 7, 8, 0, 13, 13, 0, 11, 12, 11, 5, 5, 0, 6, 6, 0,
+    13, 13, 0, 16, 16, 0, 5, 6, 0, 1, 1, 0, 13, 13, 0, 13,
+    13, 0, 0, 0, 0, 0, 0, 0, 10, 10, 0, 8, 8, 0, 0, 6,
+    0, 1, 1, 0, 15, 15, 0, 13, 13, 0, 3, 3, 0, 4, 4, 0,
+    11, 11, 0, 9, 9, 0, 0, 0, 0, 4, 6, 0, 9, 9, 0, 8,
+    8, 0, 8, 9, 0, 1, 1, 0, 11, 11, 0, 8, 8, 0, 8, 8,
+    0, 4, 4, 10, 10, 10, 0, 13, 14, 13, 0, 0, 0, 8, 9, 0,
+    13, 14, 0, 11, 11, 0, 4, 5, 0, 5, 5, 9, 11, 11, 0, 12,
+    12, 0, 5, 5, 10, 3, 9, 0, 9, 9, 0, 9, 9, 0, 8, 9,
+    0, 5, 7, 0, 13, 13, 0, 12, 12, 0, 0, 0, 0, 5, 5, 0,
+    12, 12, 0, 8, 12, 0, 0, 4, 0, 0, 4, 0, 2, 5, 0, 0,
+    0, 0, 4, 8, 0, 10, 12, 0, 0, 0, 0, 4, 6, 0, 1, 7,
+    0, 13, 13, 0, 6, 6, 0, 3, 3, 0, 9, 9, 0, 9, 10, 0,
+    8, 8, 0, 3, 3, 10, 7, 9, 0, 6, 6, 0, 2, 2, 0, 4,
+    4, 0, 9, 9, 0, 3, 3, 0, 9, 9, 0, 9, 10, 0, 9, 9,
+    0, 4, 4, 0, 0, 0, 0, 5, 5, 0, 8, 8, 0, 8, 8, 0,
+    8, 8, 0, 3, 3, 0, 11, 11, 0, 4, 8, 0, 0, 0, 0, 7,
+    9, 0, 0, 10, 0, 14, 14, 0, 0, 0, 10, 8, 8, 0, 9, 10,
+    0, 9, 11, 0, 5, 5, 0, 5, 5, 0, 14, 14, 0, 11, 12, 0,
+    3, 3, 0, 9, 9, 0, 9, 10, 0, 12, 12, 0, 8, 9, 0, 4,
+    4, 10, 6, 6, 0, 16, 16, 0, 1, 1, 4, 1, 1, 3, 15, 15,
+    0, 9, 9, 0, 0, 0, 0, 6, 7, 0, 12, 16, 12, 5, 9, 0,
+    3, 3, 0, 5, 5, 0, 9, 9, 0, 7, 7, 0, 3, 3, 0, 0,
+    7, 0, 9, 11, 0, 12, 14, 0, 5, 7, 0, 0, 3, 0, 10, 11,
+    0, 9, 9, 0, 7, 8, 0, 0, 2, 0, 9, 9, 0, 6, 10, 6,
+    6, 6, 0, 8, 8, 0, 7, 9, 0, 9, 9, 0, 8, 9, 0, 9,
+    10, 0, 10, 10, 0, 16, 17, 0, 5, 5, 10, 5, 8, 0, 9, 9,
+    0, 11, 11, 0, 8, 8, 10, 0, 0, 0, 9, 9, 0, 8, 8, 0,
+    7, 7, 0, 7, 9, 0, 16, 16, 0, 16, 16, 0, 0, 2, 0, 1,
+    1, 0, 9, 11, 0, 10, 11, 0, 1, 1, 10, 5, 7, 0, 9, 11,
+    0, 14, 17, 14, 2, 2, 0, 0, 0, 3, 11, 11, 0, 2, 2, 0,
+    6, 7, 0, 4, 4, 0, 8, 8, 0, 8, 8, 0, 3, 3, 0, 6,
+    7, 0, 11, 12, 11, 5, 9, 0, 8, 10, 0, 6, 10, 0, 10, 12,
+    0, 12, 13, 12, 3, 3, 0, 7, 7, 0, 12, 13, 12, 11, 11, 0,
+    5, 7, 0, 6, 6, 7, 17, 17, 0, 10, 12, 10, 1, 1, 0, 7,
+    7, 8, 3, 10, 3, 9, 9, 0, 1, 1, 0, 0, 0, 0, 7, 9,
+    0, 0, 0, 0, 9, 9, 0, 12, 12, 0, 4, 8, 0, 4, 8, 0,
+    9, 9, 0, 14, 15, 14, 3, 6, 0, 3, 3, 0, 11, 11, 0, 14,
+    14, 0, 6, 6, 0, 6, 6, 0, 8, 8, 0, 10, 10, 0, 5, 7,
+    0, 5, 8, 0, 14, 14, 0, 9, 9, 0, 8, 8, 0, 3, 3, 0,
+    12, 12, 0, 5, 5, 0, 3, 3, 0, 9, 9, 10, 9, 9, 0, 9,
+    9, 0, 0, 0, 0, 0, 3, 0, 8, 10, 8, 7, 7, 0, 3, 3,
+    10, 7, 7, 0, 8, 10, 8, 10, 10, 0, 8, 8, 10, 9, 9, 0,
+    10, 10, 0, 11, 11, 0, 9, 9, 0, 0, 0, 0, 10, 10, 0, 10,
+    10, 0, 0, 0, 0, 4, 5, 0, 9, 9, 0, 10, 10, 0, 9, 10,
+    0, 5, 7, 0, 9, 10, 0, 8, 8, 0, 8, 9, 0, 4, 10, 0,
+    8, 8, 0, 16, 16, 0, 4, 10, 0, 7, 8, 0, 0, 10, 0, 11,
+    14, 0, 0, 1, 0, 8, 8, 10, 1, 1, 0, 15, 15, 0, 0, 0,
+    10, 2, 2, 0, 8, 10, 0, 16, 16, 0, 7, 7, 0, 7, 7, 0,
+    13, 13, 0, 14, 14, 0, 1, 1, 0, 4, 4, 0, 17, 18, 0, 5,
+    12, 5, 6, 8, 0, 0, 0, 0, 9, 10, 0, 10, 10, 0, 8, 9,
+    0, 4, 4, 0, 12, 12, 0, 12, 12, 0, 0, 0, 10, 5, 5, 0,
+    2, 10, 2, 3, 11, 3, 1, 1, 9, 4, 5, 0, 11, 14, 0, 3,
+    10, 3, 0, 3, 0, 1, 1, 4, 9, 9, 0, 6, 10, 6, 2, 2,
+    0, 0, 0, 0, 7, 7, 0, 9, 9, 0, 5, 5, 0, 6, 6, 0,
+    12, 12, 0, 0, 0, 0, 5, 7, 0, 5, 7, 0, 1, 7, 0, 14,
+    14, 0, 0, 0, 0, 7, 7, 9, 14, 14, 0, 9, 9, 0, 4, 4,
+    0, 8, 8, 0, 9, 9, 0, 8, 8, 0, 1, 1, 3, 0, 2, 0,
+    9, 11, 9, 12, 12, 0, 7, 7, 0, 7, 9, 0, 9, 11, 0, 8,
+    8, 0, 6, 8, 0, 6, 7, 0, 0, 4, 0, 8, 8, 9, 0, 0,
+    0, 12, 12, 0, 8, 8, 0, 5, 5, 0, 6, 6, 0, 4, 8, 0,
+    7, 9, 0, 8, 8, 0, 12, 12, 0, 11, 14, 11, 5, 5, 10, 4,
+    4, 0, 9, 9, 0, 11, 11, 0, 4, 5, 0, 0, 0, 0, 10, 11,
+    0, 9, 10, 0, 9, 9, 0, 0, 0, 8, 10, 10, 0, 9, 9, 0,
+    3, 3, 6, 3, 3, 0, 9, 9, 0, 10, 10, 0, 9, 9, 0, 7,
+    7, 0, 12, 12, 0, 8, 8, 0, 5, 5, 0, 8, 8, 0, 11, 11,
+    0, 7, 7, 0, 3, 3, 10, 8, 8, 10, 8, 8, 0, 7, 9, 0,
+    7, 7, 0, 3, 3, 0, 9, 9, 0, 8, 8, 0, 7, 8, 0, 8,
+    9, 0, 12, 13, 0, 9, 9, 0, 5, 6, 0, 3, 7, 0, 12, 12,
+    0, 11, 11, 0, 3, 3, 10, 6, 6, 0, 8, 8, 0, 1, 7, 0,
+    0, 5, 0, 2, 2, 0, 12, 12, 0, 13, 13, 0, 2, 2, 0, 5,
+    10, 0, 11, 12, 11, 12, 12, 0, 7, 7, 8, 4, 4, 0, 11, 12,
+    0, 9, 9, 0, 4, 4, 0, 4, 4, 0, 11, 12, 0, 8, 8, 0,
+    6, 7, 0, 4, 4, 0, 9, 9, 0, 17, 17, 0, 8, 8, 0, 0,
+    0, 0, 9, 9, 0, 8, 8, 0, 1, 1, 4, 0, 0, 0, 12, 12,
+    0, 9, 10, 0, 4, 6, 0, 4, 6, 0, 9, 10, 0, 6, 10, 6,
+    8, 9, 0, 8, 9, 0, 3, 10, 3, 1, 10, 1, 8, 8, 0, 0,
+    0, 10, 5, 10, 5, 10, 10, 0, 8, 8, 0, 8, 8, 0, 13, 13,
+    0, 7, 9, 0, 2, 2, 0, 0, 0, 1, 9, 10, 0, 18, 18, 0,
+    0, 0, 0, 0, 0, 0, 17, 18, 0, 10, 10, 0, 0, 1, 0, 6,
+    8, 0, 13, 13, 0, 5, 9, 0, 6, 6, 0, 3, 7, 0, 9, 10,
+    0, 7, 9, 0, 7, 7, 0, 5, 5, 0, 0, 0, 0, 4, 4, 0,
+    8, 9, 0, 7, 7, 0, 5, 11, 5, 8, 8, 0, 5, 5, 0, 7,
+    7, 0, 8, 8, 0, 8, 8, 0, 7, 7, 8, 7, 7, 8, 18, 18,
+    0, 12, 12, 0, 1, 1, 0, 2, 2, 0, 9, 9, 0, 9, 9, 0,
+    3, 4, 0, 3, 3, 0, 12, 12, 0, 7, 7, 0, 8, 8, 0, 7,
+    7, 0, 0, 5, 0, 0, 0, 0, 7, 9, 0, 3, 3, 0, 5, 5,
+    0, 8, 8, 0, 9, 12, 9, 10, 10, 0, 4, 4, 0, 7, 9, 0,
+    15, 15, 0, 13, 13, 0, 4, 4, 0, 4, 6, 0, 0, 0, 0, 6,
+    11, 6, 4, 4, 5, 4, 6, 0, 13, 13, 0, 5, 5, 0, 1, 1,
+    10, 1, 6, 0, 8, 8, 0, 9, 9, 0, 8, 8, 0, 8, 8, 0,
+    15, 15, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 6,
+    11, 6, 8, 8, 0, 6, 6, 10, 13, 13, 0, 6, 11, 6, 5, 6,
+    0, 4, 4, 9, 9, 9, 0, 0, 0, 0, 2, 2, 0, 9, 10, 0,
+    9, 10, 0, 9, 10, 0, 8, 9, 0, 8, 9, 0, 16, 16, 0, 15,
+    16, 15, 1, 1, 10, 9, 9, 0, 12, 12, 0, 5, 5, 0, 5, 5,
+    0, 4, 8, 0, 14, 14, 0, 16, 18, 16, 0, 0, 0, 0, 0, 2,
+    12, 12, 0, 16, 16, 0, 1, 7, 0, 6, 7, 0, 0, 0, 0, 8,
+    10, 0, 1, 1, 9, 7, 7, 9, 7, 7, 0, 10, 10, 0, 3, 3,
+    0, 8, 9, 0, 13, 13, 0, 15, 15, 0, 5, 5, 0, 2, 2, 0,
+    15, 15, 0, 16, 16, 0, 1, 1, 0, 9, 9, 0, 10, 10, 0, 8,
+    8, 0, 4, 7, 0, 9, 9, 0, 0, 10, 0, 6, 6, 0, 0, 0,
+    10, 3, 3, 4, 13, 13, 0, 9, 9, 0, 2, 2, 10, 5, 6, 0,
+    9, 9, 0, 9, 9, 0, 0, 0, 0, 1, 1, 4, 12, 16, 12, 14,
+    16, 0, 6, 6, 0, 6, 6, 0, 5, 10, 0, 15, 15, 0, 1, 7,
+    0, 0, 0, 0, 10, 11, 0, 10, 11, 0, 1, 1, 3, 7, 8, 0,
+    9, 9, 0, 9, 11, 0, 7, 8, 0, 8, 8, 0, 4, 10, 4, 13,
+    13, 0, 4, 4, 10, 5, 5, 0, 8, 10, 0, 9, 9, 0, 6, 8,
+    0, 9, 10, 0, 12, 12, 0, 0, 0, 0, 5, 10, 0, 1, 1, 0,
+    12, 12, 0, 10, 10, 0, 3, 3, 10, 6, 6, 10, 12, 12, 0, 10,
+    10, 0, 5, 5, 0, 5, 5, 0, 13, 13, 0, 0, 0, 0, 3, 3,
+    0, 7, 7, 0, 12, 12, 0, 15, 15, 0, 6, 7, 0, 3, 4, 0,
+    11, 11, 0, 13, 13, 0, 7, 8, 0, 5, 6, 0, 19, 19, 0, 12,
+    12, 0, 0, 0, 0, 6, 6, 0, 11, 11, 0, 11, 11, 0, 4, 4,
+    0, 0, 6, 0, 1, 7, 0, 5, 5, 0, 10, 10, 0, 6, 13, 6,
+    5, 5, 8, 7, 7, 0, 8, 8, 0, 9, 9, 0, 7, 8, 0, 0,
+    0, 0, 8, 12, 8, 4, 4, 0, 4, 6, 0, 9, 9, 0, 10, 12,
+    0, 9, 9, 0, 8, 8, 0, 8, 8, 0, 10, 12, 0, 3, 3, 0,
+    5, 5, 0, 6, 6, 0, 17, 17, 0, 16, 16, 0, 3, 3, 0, 0,
+    2, 0, 18, 18, 0, 16, 16, 0, 0, 1, 0, 1, 1, 0, 11, 11,
+    0, 3, 10, 3, 7, 8, 0, 6, 6, 0, 8, 8, 0, 7, 7, 0,
+    0, 0, 0, 9, 9, 10, 9, 10, 9, 9, 10, 0, 9, 9, 10, 8,
+    9, 0, 9, 9, 0, 9, 9, 0, 0, 0, 0, 8, 8, 0, 10, 12,
+    0, 9, 9, 0, 5, 5, 0, 5, 5, 0, 9, 10, 0, 0, 0, 0,
+    4, 6, 0, 5, 5, 8, 9, 10, 0, 9, 9, 0, 8, 9, 0, 5,
+    5, 0, 0, 10, 0, 14, 14, 0, 5, 5, 0, 5, 7, 0, 14, 14,
+    0, 0, 0, 0, 2, 2, 10, 7, 7, 0, 14, 14, 0, 16, 16, 0,
+    0, 3, 0, 0, 0, 0, 9, 9, 0, 9, 9, 0, 3, 5, 0, 4,
+    4, 0, 11, 11, 0, 3, 11, 3, 3, 3, 4, 5, 5, 10, 10, 10,
+    0, 14, 16, 0, 0, 2, 0, 2, 2, 10, 12, 16, 12, 14, 16, 0,
+    0, 0, 4, 0, 2, 0, 4, 9, 0, 12, 14, 12, 9, 10, 0, 0,
+    10, 0, 16, 16, 0, 16, 16, 0, 4, 6, 0, 0, 6, 0, 6, 12,
+    6, 11, 12, 0, 5, 5, 0, 5, 7, 0, 4, 9, 0, 10, 12, 0,
+    1, 6, 0, 5, 5, 6, 0, 0, 0, 12, 12, 0, 0, 4, 0, 8,
+    9, 0, 9, 10, 0, 9, 10, 0, 8, 8, 0, 8, 8, 9, 5, 5,
+    0, 11, 11, 0, 6, 6, 0, 4, 4, 0, 17, 17, 0, 9, 10, 9,
+    9, 9, 10, 9, 9, 0, 5, 11, 5, 6, 12, 6, 5, 5, 6, 4,
+    5, 0, 6, 12, 6, 5, 9, 0, 1, 7, 0, 0, 5, 0, 16, 16,
+    0, 7, 7, 0, 6, 6, 0, 6, 6, 0, 10, 13, 10, 16, 16, 0,
+    8, 8, 0, 9, 9, 0, 13, 14, 0, 15, 15, 0, 8, 8, 0, 4,
+    5, 0, 9, 10, 0, 9, 10, 0, 2, 2, 8, 4, 8, 0, 18, 18,
+    0, 17, 18, 0, 0, 1, 0, 6, 6, 0, 13, 13, 0, 5, 5, 0,
+    2, 2, 0, 0, 0, 0, 16, 17, 0, 17, 18, 0, 0, 0, 4, 1,
+    1, 5, 14, 16, 0, 15, 17, 15, 1, 3, 0, 5, 5, 0, 7, 9,
+    0, 4, 8, 0, 8, 8, 0, 2, 5, 0, 9, 9, 0, 3, 3, 0,
+    6, 6, 0, 5, 7, 0, 12, 12, 0, 8, 8, 0, 0, 0, 9, 6,
+    6, 0, 14, 14, 0, 15, 15, 0, 7, 9, 0, 2, 2, 9, 14, 14,
+    0, 9, 14, 9, 0, 3, 0, 1, 1, 6, 9, 11, 0, 7, 9, 0,
+    5, 7, 0, 4, 6, 0, 9, 9, 0, 8, 8, 0, 6, 6, 10, 4,
+    4, 0, 12, 12, 0, 7, 7, 0, 2, 2, 0, 0, 0, 0, 9, 10,
+    0, 9, 10, 0, 0, 0, 10, 3, 5, 0, 7, 11, 7, 17, 17, 0,
+    5, 5, 9, 5, 5, 0, 9, 10, 0, 10, 11, 10, 0, 0, 0, 3,
+    3, 7, 8, 8, 0, 8, 8, 0, 5, 6, 0, 9, 9, 0, 13, 13,
+    0, 14, 16, 0, 5, 6, 0, 2, 5, 0, 9, 9, 0, 7, 7, 0,
+    0, 0, 0, 7, 9, 0, 9, 9, 0, 2, 2, 0, 1, 2, 0, 1,
+    3, 0, 14, 14, 0, 13, 13, 0, 0, 3, 0, 2, 2, 0, 9, 9,
+    0, 8, 8, 0, 6, 7, 0, 8, 8, 0, 11, 11, 0, 11, 12, 11,
+    5, 5, 0, 5, 5, 0, 3, 11, 3, 0, 0, 0, 1, 1, 9, 4,
+    4, 0, 12, 13, 12, 12, 12, 0, 6, 6, 7, 6, 8, 0, 11, 11,
+    0, 9, 12, 9, 2, 2, 0, 3, 3, 0, 9, 10, 0, 9, 9, 0,
+    1, 1, 0, 8, 9, 0, 9, 9, 0, 11, 11, 0, 0, 1, 0, 0,
+    0, 0, 11, 12, 11, 11, 12, 11, 7, 7, 8, 7, 7, 8, 8, 10,
+    8, 2, 10, 2, 9, 9, 0, 7, 7, 0, 7, 9, 0, 9, 11, 0,
+    8, 9, 0, 8, 8, 9, 9, 10, 9, 11, 12, 0, 6, 7, 0, 5,
+    7, 0, 1, 7, 0, 0, 0, 0, 9, 10, 0, 6, 8, 0, 0, 0,
+    0, 11, 11, 0, 5, 10, 0, 8, 8, 0, 2, 10, 2, 11, 11, 0,
+    0, 4, 0, 0, 0, 0, 6, 6, 0, 4, 4, 0, 2, 2, 0, 5,
+    5, 0, 9, 9, 0, 9, 9, 0, 3, 3, 0, 6, 6, 0, 9, 9,
+    0, 6, 6, 0, 2, 2, 0, 2, 2, 9, 11, 11, 0, 6, 6, 0,
+    8, 8, 0, 8, 8, 0, 6, 6, 0, 7, 7, 0, 0, 0, 0, 1,
+    1, 5, 2, 2, 0, 13, 13, 0, 0, 0, 0, 5, 6, 0, 18, 19,
+    18, 19, 19, 0, 0, 0, 1, 0, 0, 0, 14, 14, 0, 11, 11, 0,
+    7, 7, 0, 7, 7, 9, 8, 8, 0, 12, 13, 12, 7, 7, 0, 7,
+    7, 0, 2, 10, 2, 7, 9, 0, 7, 7, 0, 0, 0, 0, 6, 6,
+    0, 12, 16, 12, 8, 8, 0, 8, 8, 0, 11, 12, 11, 12, 13, 0,
+    7, 7, 8, 3, 3, 0, 10, 11, 0, 11, 11, 0, 1, 1, 0, 4,
+    6, 0, 13, 13, 0, 11, 13, 11, 6, 6, 0, 5, 5, 7, 10, 11,
+    0, 9, 9, 0, 2, 2, 8, 6, 9, 0, 1, 7, 0, 5, 5, 8,
+    5, 5, 0, 7, 9, 0, 9, 9, 0, 9, 9, 0, 6, 6, 0, 9,
+    12, 9, 4, 4, 0, 3, 3, 0, 8, 10, 0, 9, 11, 9, 0, 3,
+    0, 2, 2, 0, 14, 14, 0, 10, 11, 0, 2, 2, 0, 7, 8, 0,
+    10, 10, 0, 10, 10, 0, 7, 7, 0, 3, 3, 0, 8, 8, 0, 13,
+    13, 0, 8, 8, 0, 5, 5, 9, 0, 10, 0, 4, 4, 0, 0, 0,
+    10, 4, 4, 0, 9, 9, 0, 8, 8, 0, 5, 8, 0, 6, 8, 0,
+    11, 14, 0, 13, 13, 0, 4, 4, 10, 8, 9, 0, 11, 14, 0, 13,
+    13, 0, 4, 4, 0, 7, 7, 0, 12, 12, 0, 13, 13, 0, 5, 7,
+    0, 7, 8, 0, 0, 0, 0, 10, 10, 0, 5, 5, 0, 5, 5, 0,
+    8, 8, 0, 10, 10, 0, 0, 0, 0, 1, 1, 0, 16, 16, 0, 18,
+    19, 18, 1, 3, 0, 7, 7, 10, 12, 16, 12, 10, 12, 0, 0, 0,
+    4, 1, 2, 0, 16, 16, 0, 8, 8, 0, 8, 8, 0, 4, 4, 0,
+    8, 8, 0, 7, 7, 0, 9, 9, 0, 4, 6, 0, 12, 12, 0, 5,
+    5, 0, 4, 4, 0, 0, 0, 8, 11, 11, 0, 10, 10, 0, 1, 1,
+    0, 4, 5, 0, 11, 11, 0, 12, 12, 0, 7, 8, 0, 4, 6, 0,
+    6, 9, 0, 11, 11, 0, 7, 10, 0, 8, 8, 10, 16, 16, 0, 18,
+    18, 0, 5, 5, 8, 5, 5, 0, 11, 11, 0, 4, 8, 0, 5, 7,
+    0, 7, 9, 0, 2, 8, 0, 9, 9, 0, 8, 9, 0, 5, 8, 0,
+    10, 11, 0, 8, 8, 0, 7, 8, 0, 6, 9, 0, 10, 11, 0, 0,
+    0, 0, 9, 10, 0, 5, 7, 0, 13, 13, 0, 16, 16, 0, 7, 7,
+    0, 6, 6, 0, 11, 11, 0, 19, 19, 0, 0, 3, 0, 0, 3, 0,
+    11, 11, 0, 12, 12, 0, 1, 1, 0, 8, 9, 0, 18, 18, 0, 14,
+    16, 0, 0, 1, 0, 0, 2, 0, 9, 10, 0, 12, 12, 0, 8, 9,
+    0, 6, 7, 0, 10, 10, 0, 13, 13, 0, 8, 8, 9, 8, 9, 0,
+    8, 8, 0, 7, 7, 0, 0, 0, 0, 8, 8, 9, 7, 11, 0, 10,
+    11, 0, 1, 5, 0, 6, 6, 10, 9, 10, 0, 16, 16, 0, 8, 9,
+    0, 9, 9, 0, 8, 10, 8, 12, 12, 0, 6, 7, 0, 2, 3, 0,
+    11, 12, 11, 12, 12, 0, 1, 1, 4, 3, 3, 0, 14, 14, 0, 15,
+    15, 0, 2, 2, 0, 3, 3, 9, 5, 5, 0, 15, 15, 0, 7, 7,
+    8, 2, 2, 0, 6, 6, 0, 1, 7, 0, 8, 8, 0, 0, 0, 0,
+    3, 3, 0, 6, 6, 0, 5, 6, 0, 5, 6, 0, 15, 17, 15, 12,
+    15, 12, 8, 9, 0, 6, 7, 0, 12, 12, 0, 12, 15, 12, 0, 0,
+    0, 0, 5, 0, 12, 15, 12, 10, 10, 0, 9, 10, 0, 9, 9, 10,
+    18, 18, 0, 13, 13, 0, 8, 8, 9, 7, 7, 0, 8, 8, 0, 13,
+    13, 0, 6, 6, 7, 0, 0, 0, 7, 7, 0, 7, 7, 0, 2, 6,
+    0, 7, 10, 0, 9, 9, 0, 9, 9, 0, 2, 3, 0, 0, 0, 0,
+    4, 4, 0, 0, 3, 0, 13, 13, 0, 9, 12, 9, 5, 9, 0, 1,
+    6, 0, 4, 8, 0, 13, 15, 13, 9, 9, 0, 3, 6, 0, 8, 8,
+    0, 8, 11, 0, 3, 6, 0, 5, 8, 0, 7, 7, 0, 4, 4, 0,
+    3, 3, 10, 8, 8, 0, 6, 6, 0, 9, 9, 0, 8, 8, 0, 5,
+    7, 0, 14, 14, 0, 4, 4, 0, 3, 3, 0, 3, 3, 5, 0, 10,
+    0, 8, 8, 0, 0, 0, 10, 8, 8, 0, 10, 10, 0, 2, 11, 2,
+    8, 8, 0, 4, 6, 0, 11, 11, 0, 13, 13, 0, 1, 1, 0, 8,
+    8, 0, 7, 7, 0, 9, 9, 0, 5, 6, 0, 5, 8, 0, 7, 7,
+    0, 7, 9, 0, 0, 1, 0, 1, 1, 0, 12, 12, 0, 12, 12, 0,
+    5, 5, 0, 5, 5, 0, 8, 10, 8, 2, 11, 2, 9, 9, 0, 8,
+    8, 0, 9, 9, 0, 1, 7, 0, 0, 2, 0, 0, 2, 0, 1, 7,
+    0, 8, 14, 8, 0, 0, 9, 3, 4, 0, 14, 14, 0, 15, 15, 0,
+    2, 4, 0, 3, 3, 0, 11, 11, 0, 14, 15, 14, 7, 7, 8, 7,
+    8, 0, 9, 9, 0, 12, 12, 0, 8, 8, 0, 2, 2, 0, 2, 2,
+    0, 9, 9, 0, 5, 5, 6, 8, 8, 10, 9, 9, 0, 9, 10, 0,
+    8, 9, 0, 8, 9, 0, 8, 10, 8, 2, 10, 2, 8, 9, 0, 3,
+    3, 0, 9, 14, 9, 14, 14, 0, 1, 7, 0, 2, 7, 0, 4, 4,
+    0, 8, 8, 0, 9, 9, 10, 5, 5, 0, 13, 13, 0, 14, 14, 0,
+    6, 6, 7, 7, 9, 0, 9, 9, 0, 12, 13, 0, 8, 8, 0, 5,
+    6, 0, 10, 10, 0, 7, 10, 7, 4, 4, 5, 5, 6, 0, 18, 18,
+    0, 13, 13, 0, 3, 5, 0, 3, 3, 0, 14, 17, 14, 4, 4, 0,
+    2, 2, 0, 5, 5, 6, 15, 16, 15, 13, 15, 0, 4, 4, 10, 5,
+    10, 0, 11, 12, 11, 13, 13, 0, 7, 7, 8, 7, 10, 0, 12, 14,
+    12, 12, 12, 0, 5, 7, 0, 9, 9, 0, 15, 16, 15, 14, 16, 14,
+    5, 7, 0, 1, 7, 0, 12, 12, 0, 16, 16, 0, 5, 5, 0, 2,
+    2, 0, 15, 16, 15, 10, 10, 0, 0, 0, 5, 3, 3, 0, 12, 12,
+    0, 12, 13, 12, 6, 7, 0, 0, 0, 1, 16, 16, 0, 10, 10, 0,
+    4, 4, 6, 4, 4, 0, 0, 10, 0, 14, 14, 0, 5, 7, 0, 0,
+    0, 0, 9, 9, 0, 7, 7, 0, 3, 3, 4, 6, 7, 0, 14, 14,
+    0, 13, 13, 0, 2, 2, 4, 2, 2, 0, 10, 11, 0, 9, 9, 0,
+    0, 0, 0, 8, 8, 0, 5, 5, 0, 5, 10, 0, 8, 8, 0, 4,
+    6, 0, 7, 7, 0, 7, 7, 0, 8, 8, 0, 3, 3, 0, 6, 6,
+    0, 9, 10, 0, 5, 5, 0, 8, 9, 0, 5, 10, 5, 8, 8, 0,
+    8, 9, 0, 9, 9, 10, 9, 10, 0, 2, 2, 0, 1, 4, 0, 7,
+    9, 0, 8, 8, 0, 10, 10, 0, 0, 0, 0, 5, 5, 8, 11, 11,
+    0, 10, 10, 0, 9, 9, 0, 4, 4, 0, 11, 11, 0, 12, 12, 0,
+    0, 0, 8, 7, 7, 0, 11, 11, 0, 12, 12, 0, 8, 8, 0, 8,
+    8, 0, 11, 11, 0, 14, 14, 0, 6, 7, 0, 4, 4, 5, 11, 14,
+    0, 16, 16, 0, 0, 0, 0, 7, 8, 0, 11, 14, 0, 16, 16, 0,
+    0, 3, 0, 0, 2, 0, 5, 5, 0, 9, 9, 0, 3, 3, 0, 7,
+    9, 0, 9, 9, 0, 2, 2, 0, 2, 7, 0, 9, 10, 0, 12, 12,
+    0, 14, 14, 0, 5, 5, 0, 4, 4, 0, 14, 14, 0, 6, 6, 0,
+    1, 1, 0, 1, 3, 0, 9, 10, 0, 10, 10, 0, 8, 9, 0, 4,
+    4, 0, 9, 10, 0, 9, 9, 0, 8, 9, 0, 2, 2, 9, 10, 10,
+    0, 7, 11, 7, 5, 5, 9, 6, 6, 10, 10, 12, 10, 12, 12, 0,
+    4, 8, 0, 8, 9, 0, 13, 13, 0, 7, 7, 0, 9, 9, 0, 7,
+    7, 0, 10, 11, 0, 14, 14, 0, 4, 4, 0, 4, 4, 0, 9, 9,
+    0, 10, 11, 0, 7, 8, 0, 1, 1, 0, 12, 12, 0, 14, 14, 0,
+    2, 2, 0, 5, 5, 0, 14, 14, 0, 15, 15, 0, 3, 3, 0, 8,
+    8, 0, 0, 0, 0, 9, 10, 0, 0, 10, 0, 8, 9, 0, 1, 1,
+    0, 12, 12, 0, 7, 7, 0, 7, 8, 0, 2, 2, 0, 9, 9, 0,
+    7, 8, 0, 9, 9, 0, 9, 9, 0, 7, 10, 7, 9, 10, 0, 5,
+    7, 0, 9, 10, 0, 4, 8, 0, 4, 6, 0, 4, 4, 0, 3, 10,
+    3, 3, 3, 0, 0, 0, 0, 8, 8, 0, 13, 14, 0, 10, 10, 0,
+    4, 5, 0, 0, 0, 0, 12, 13, 0, 6, 10, 0, 1, 1, 4, 1,
+    1, 0, 14, 17, 14, 18, 18, 0, 3, 3, 5, 2, 4, 0, 14, 17,
+    14, 18, 18, 0, 5, 8, 0, 3, 3, 6, 14, 17, 14, 11, 11, 0,
+    0, 0, 3, 7, 7, 0, 14, 14, 0, 12, 12, 0, 0, 0, 0, 1,
+    1, 5, 14, 14, 0, 15, 15, 0, 8, 8, 0, 5, 5, 0, 13, 14,
+    0, 17, 18, 17, 4, 5, 0, 1, 1, 2, 7, 7, 0, 1, 1, 0,
+    3, 3, 8, 2, 2, 0, 13, 13, 0, 19, 19, 0, 4, 4, 0, 0,
+    0, 0, 12, 12, 0, 14, 15, 14, 5, 5, 0, 0, 0, 0, 18, 19,
+    18, 18, 18, 0, 0, 0, 1, 1, 1, 0, 16, 18, 16, 10, 10, 0,
+    0, 0, 2, 9, 9, 0, 9, 9, 0, 4, 8, 0, 0, 0, 0, 4,
+    4, 5, 13, 13, 0, 11, 11, 0, 4, 5, 0, 0, 4, 0, 13, 13,
+    0, 14, 15, 0, 5, 6, 0, 3, 4, 0, 18, 18, 0, 12, 13, 12,
+    0, 0, 0, 6, 6, 7, 7, 9, 0, 12, 12, 0, 1, 4, 0, 1,
+    4, 0, 12, 12, 0, 8, 8, 0, 6, 6, 0, 1, 4, 0, 12, 12,
+    0, 4, 4, 0, 6, 8, 0, 7, 8, 0, 9, 10, 0, 11, 12, 0,
+    8, 9, 0, 6, 7, 0, 12, 12, 0, 14, 14, 0, 2, 2, 0, 1,
+    7, 0, 4, 10, 4, 6, 10, 6, 3, 3, 0, 6, 6, 0, 9, 9,
+    0, 12, 12, 0, 7, 7, 0, 9, 10, 0, 5, 5, 0, 6, 6, 0,
+    5, 10, 0, 6, 10, 0, 5, 10, 5, 10, 12, 10, 1, 1, 0, 4,
+    4, 0, 9, 9, 0, 12, 12, 0, 7, 7, 0, 5, 5, 0, 10, 10,
+    0, 2, 8, 0, 5, 6, 0, 4, 4, 0
+};
+
+constexpr int32_t rectY[6282] = {
+    7, 9, 0, 4, 11, 0, 6, 9, 0, 2, 2, 0, 3, 6, 0, 7,
+    10, 0, 7, 9, 0, 4, 12, 0, 1, 1, 0, 5, 9, 0, 7, 10,
+    0, 0, 2, 0, 5, 5, 0, 3, 6, 0, 12, 16, 0, 16, 17, 0,
+    1, 1, 0, 4, 4, 0, 2, 2, 0, 4, 6, 0, 11, 12, 0, 12,
+    14, 0, 11, 12, 0, 5, 9, 0, 4, 6, 0, 4, 8, 0, 5, 5,
+    0, 7, 10, 0, 7, 10, 0, 1, 1, 0, 0, 0, 6, 8, 9, 0,
+    1, 1, 0, 3, 3, 0, 8, 12, 0, 5, 10, 0, 2, 2, 6, 1,
+    2, 0, 15, 15, 17, 14, 16, 0, 15, 15, 17, 18, 19, 0, 5, 5,
+    10, 4, 4, 10, 11, 12, 0, 3, 3, 9, 11, 12, 0, 18, 18, 0,
+    11, 12, 0, 18, 18, 0, 8, 9, 0, 6, 12, 0, 3, 6, 0, 7,
+    7, 0, 9, 13, 0, 5, 10, 0, 6, 9, 0, 4, 4, 0, 3, 3,
+    0, 0, 3, 0, 12, 12, 16, 5, 9, 0, 3, 3, 0, 0, 3, 0,
+    3, 3, 0, 1, 3, 0, 2, 2, 0, 3, 3, 0, 15, 17, 0, 13,
+    15, 0, 5, 12, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 15, 15,
+    0, 10, 12, 0, 17, 17, 0, 12, 14, 0, 6, 6, 0, 3, 6, 0,
+    6, 6, 0, 5, 5, 9, 5, 10, 0, 10, 13, 0, 0, 0, 0, 5,
+    7, 0, 3, 3, 10, 5, 9, 0, 3, 3, 10, 5, 9, 0, 1, 3,
+    0, 0, 1, 0, 7, 9, 0, 10, 14, 0, 1, 1, 0, 1, 1, 0,
+    3, 6, 0, 5, 5, 0, 5, 5, 0, 6, 10, 0, 0, 0, 0, 8,
+    12, 0, 2, 2, 7, 2, 2, 0, 18, 18, 0, 18, 18, 0, 8, 10,
+    0, 5, 7, 0, 19, 19, 0, 18, 18, 0, 3, 3, 0, 2, 2, 3,
+    11, 12, 0, 13, 14, 0, 1, 1, 0, 12, 13, 0, 13, 14, 0, 7,
+    7, 9, 13, 16, 0, 5, 12, 0, 12, 13, 0, 5, 12, 0, 10, 13,
+    0, 5, 9, 0, 11, 11, 0, 1, 1, 6, 12, 13, 0, 18, 18, 0,
+    0, 3, 0, 2, 2, 6, 5, 5, 0, 9, 14, 0, 5, 5, 0, 7,
+    9, 0, 5, 10, 0, 4, 10, 0, 6, 7, 0, 13, 13, 16, 1, 1,
+    0, 7, 7, 12, 1, 1, 0, 5, 11, 0, 7, 7, 9, 10, 12, 0,
+    4, 4, 10, 5, 10, 0, 10, 14, 0, 12, 14, 0, 11, 12, 0, 13,
+    14, 0, 14, 14, 16, 7, 9, 0, 12, 14, 0, 4, 6, 0, 14, 15,
+    0, 7, 7, 9, 2, 6, 0, 3, 3, 0, 6, 6, 0, 0, 0, 0,
+    12, 13, 0, 14, 15, 0, 1, 1, 3, 5, 5, 0, 1, 1, 3, 5,
+    5, 0, 5, 7, 0, 8, 9, 0, 10, 10, 0, 7, 9, 0, 14, 15,
+    0, 7, 12, 0, 8, 8, 9, 9, 9, 13, 7, 7, 0, 6, 6, 0,
+    3, 3, 0, 6, 6, 0, 0, 0, 7, 5, 5, 0, 2, 2, 0, 12,
+    13, 0, 7, 7, 0, 3, 6, 0, 10, 13, 0, 1, 1, 9, 6, 9,
+    0, 3, 3, 0, 8, 12, 0, 9, 14, 0, 9, 14, 0, 5, 12, 0,
+    14, 16, 0, 12, 14, 0, 14, 16, 0, 12, 14, 0, 13, 14, 0, 14,
+    15, 0, 1, 1, 5, 4, 6, 0, 10, 10, 0, 10, 10, 0, 11, 11,
+    0, 13, 14, 0, 12, 14, 0, 10, 12, 0, 8, 9, 0, 1, 3, 0,
+    7, 7, 0, 6, 6, 0, 7, 7, 0, 6, 6, 0, 5, 5, 0, 7,
+    7, 0, 5, 5, 0, 3, 8, 0, 1, 1, 2, 9, 10, 0, 1, 1,
+    2, 14, 15, 0, 5, 5, 10, 13, 13, 16, 9, 10, 0, 2, 2, 0,
+    6, 7, 0, 7, 7, 0, 0, 0, 0, 10, 13, 0, 12, 15, 0, 4,
+    4, 10, 2, 2, 0, 5, 5, 0, 13, 13, 15, 3, 9, 0, 3, 3,
+    9, 11, 14, 0, 14, 17, 0, 14, 14, 17, 2, 2, 0, 5, 5, 0,
+    8, 8, 0, 12, 12, 0, 8, 8, 0, 10, 10, 0, 4, 6, 0, 3,
+    3, 6, 15, 17, 0, 10, 15, 0, 4, 4, 0, 4, 9, 0, 4, 11,
+    0, 0, 2, 0, 12, 12, 16, 5, 5, 0, 7, 7, 9, 8, 8, 0,
+    9, 10, 0, 4, 6, 0, 6, 6, 0, 7, 7, 9, 6, 6, 0, 6,
+    6, 9, 1, 1, 0, 8, 9, 0, 1, 1, 0, 8, 9, 0, 6, 6,
+    10, 7, 7, 0, 5, 5, 10, 5, 6, 0, 14, 15, 0, 14, 15, 0,
+    14, 15, 0, 10, 13, 0, 7, 8, 0, 3, 3, 0, 3, 3, 0, 6,
+    10, 0, 11, 11, 13, 12, 13, 0, 0, 0, 0, 11, 11, 13, 12, 13,
+    0, 12, 13, 0, 12, 13, 0, 11, 12, 0, 3, 4, 0, 0, 1, 0,
+    9, 9, 13, 11, 12, 0, 5, 5, 9, 1, 6, 0, 3, 5, 0, 5,
+    6, 0, 3, 5, 0, 15, 16, 0, 3, 5, 0, 5, 6, 0, 8, 9,
+    0, 6, 6, 0, 13, 16, 0, 11, 15, 0, 6, 6, 0, 15, 15, 0,
+    14, 15, 0, 7, 7, 0, 3, 3, 0, 0, 0, 0, 14, 14, 0, 15,
+    15, 0, 3, 3, 0, 11, 14, 0, 3, 3, 0, 11, 14, 0, 6, 6,
+    0, 10, 10, 0, 6, 6, 0, 6, 6, 0, 3, 3, 0, 8, 8, 0,
+    0, 0, 0, 8, 8, 0, 4, 6, 0, 5, 9, 0, 2, 2, 0, 6,
+    6, 13, 5, 11, 0, 7, 9, 0, 3, 3, 0, 2, 4, 0, 2, 2,
+    0, 6, 6, 13, 6, 10, 0, 12, 16, 0, 0, 0, 0, 7, 7, 13,
+    11, 12, 0, 9, 9, 0, 3, 4, 0, 17, 18, 0, 12, 12, 16, 4,
+    4, 10, 14, 15, 0, 9, 9, 0, 9, 9, 0, 15, 16, 0, 14, 15,
+    0, 7, 7, 9, 3, 4, 0, 12, 13, 0, 14, 14, 16, 0, 1, 0,
+    14, 16, 0, 14, 15, 0, 13, 13, 16, 2, 4, 0, 7, 8, 0, 7,
+    7, 0, 1, 6, 0, 2, 3, 0, 4, 4, 0, 10, 13, 0, 9, 9,
+    0, 0, 0, 0, 0, 0, 0, 15, 16, 0, 12, 13, 0, 5, 6, 0,
+    4, 4, 0, 3, 3, 0, 4, 4, 0, 3, 3, 0, 4, 5, 0, 8,
+    12, 0, 7, 7, 0, 7, 7, 0, 11, 13, 0, 8, 9, 0, 3, 4,
+    0, 14, 16, 0, 4, 5, 0, 4, 5, 0, 4, 5, 0, 15, 15, 0,
+    1, 4, 0, 10, 11, 0, 6, 8, 0, 4, 9, 0, 12, 13, 0, 12,
+    13, 0, 6, 6, 0, 3, 3, 0, 1, 1, 6, 0, 0, 5, 3, 3,
+    0, 2, 2, 0, 10, 12, 0, 6, 10, 0, 10, 12, 0, 6, 10, 0,
+    6, 6, 9, 14, 15, 0, 0, 0, 0, 2, 10, 0, 13, 14, 0, 13,
+    14, 0, 6, 6, 9, 13, 14, 0, 4, 5, 0, 11, 14, 0, 4, 5,
+    0, 4, 5, 0, 2, 2, 0, 1, 3, 0, 5, 5, 0, 7, 7, 9,
+    1, 1, 6, 4, 9, 0, 8, 12, 0, 18, 19, 0, 16, 16, 18, 18,
+    19, 0, 11, 12, 0, 5, 5, 0, 2, 2, 5, 5, 7, 0, 1, 3,
+    0, 11, 11, 0, 2, 2, 0, 12, 13, 0, 12, 12, 0, 4, 4, 0,
+    11, 11, 0, 4, 4, 0, 12, 12, 0, 3, 6, 0, 1, 1, 0, 12,
+    12, 0, 7, 7, 9, 0, 1, 0, 7, 7, 9, 2, 3, 0, 13, 14,
+    0, 13, 14, 0, 12, 12, 0, 10, 14, 0, 0, 0, 0, 0, 1, 0,
+    7, 13, 0, 2, 2, 0, 13, 15, 0, 5, 5, 6, 14, 15, 0, 14,
+    15, 0, 13, 15, 0, 0, 0, 6, 15, 17, 0, 0, 0, 0, 5, 5,
+    0, 2, 4, 0, 11, 12, 0, 13, 14, 0, 12, 13, 0, 8, 9, 0,
+    12, 13, 0, 15, 15, 16, 11, 12, 0, 8, 8, 0, 5, 5, 0, 2,
+    4, 0, 11, 12, 0, 7, 7, 0, 11, 12, 0, 8, 8, 0, 3, 3,
+    0, 5, 5, 0, 3, 3, 0, 5, 5, 0, 1, 1, 0, 5, 5, 0,
+    8, 9, 0, 7, 8, 0, 1, 6, 0, 0, 0, 4, 5, 5, 0, 2,
+    3, 0, 8, 10, 0, 6, 6, 0, 2, 2, 0, 1, 1, 0, 6, 6,
+    0, 7, 7, 0, 6, 6, 0, 7, 7, 0, 14, 16, 0, 12, 13, 0,
+    12, 13, 0, 12, 12, 0, 10, 11, 0, 8, 10, 0, 3, 3, 0, 1,
+    1, 0, 11, 14, 0, 2, 9, 0, 7, 7, 0, 5, 5, 0, 2, 2,
+    0, 5, 5, 10, 18, 18, 0, 18, 18, 0, 4, 4, 0, 4, 6, 0,
+    15, 15, 17, 18, 19, 0, 7, 12, 0, 6, 10, 0, 1, 1, 7, 8,
+    8, 0, 7, 9, 0, 11, 13, 0, 16, 17, 0, 15, 16, 0, 12, 13,
+    0, 13, 14, 0, 1, 1, 7, 2, 3, 0, 10, 10, 13, 1, 1, 7,
+    6, 6, 13, 1, 1, 5, 6, 6, 13, 15, 15, 17, 17, 17, 0, 2,
+    2, 5, 17, 17, 0, 15, 16, 0, 15, 15, 16, 13, 14, 0, 13, 14,
+    0, 2, 2, 5, 1, 2, 0, 15, 15, 16, 15, 15, 16, 0, 1, 0,
+    9, 10, 0, 7, 8, 0, 14, 14, 0, 10, 11, 0, 7, 7, 0, 6,
+    6, 0, 7, 7, 0, 6, 6, 0, 9, 9, 0, 3, 3, 0, 1, 1,
+    0, 4, 4, 0, 9, 9, 0, 6, 6, 7, 4, 5, 0, 5, 6, 0,
+    9, 9, 0, 14, 15, 0, 9, 9, 0, 14, 15, 0, 1, 3, 0, 3,
+    4, 0, 6, 13, 0, 4, 6, 0, 1, 3, 0, 0, 0, 0, 0, 0,
+    0, 1, 3, 0, 15, 16, 0, 16, 18, 0, 15, 16, 0, 16, 18, 0,
+    14, 15, 0, 13, 14, 0, 0, 2, 0, 1, 1, 0, 13, 14, 0, 15,
+    16, 0, 3, 3, 0, 8, 9, 0, 14, 15, 0, 13, 14, 0, 14, 15,
+    0, 13, 13, 15, 7, 7, 0, 4, 4, 8, 5, 7, 0, 7, 7, 0,
+    0, 0, 0, 2, 2, 0, 0, 0, 0, 5, 5, 11, 4, 5, 0, 3,
+    4, 0, 5, 5, 11, 6, 6, 0, 6, 6, 0, 5, 5, 0, 7, 7,
+    0, 1, 1, 0, 16, 17, 0, 4, 5, 0, 16, 17, 0, 4, 5, 0,
+    9, 9, 0, 10, 10, 0, 9, 9, 0, 10, 10, 0, 3, 3, 0, 0,
+    3, 0, 7, 7, 0, 4, 4, 0, 10, 12, 0, 3, 3, 0, 1, 1,
+    0, 9, 9, 0, 15, 17, 0, 17, 18, 0, 4, 9, 0, 17, 17, 0,
+    2, 6, 0, 4, 4, 10, 7, 7, 0, 7, 9, 0, 10, 11, 0, 6,
+    9, 0, 11, 12, 0, 1, 2, 0, 8, 9, 0, 6, 6, 0, 7, 8,
+    0, 10, 15, 0, 10, 11, 0, 15, 16, 0, 14, 15, 0, 16, 17, 0,
+    9, 10, 0, 3, 4, 0, 12, 13, 0, 12, 12, 0, 2, 3, 0, 4,
+    4, 0, 2, 2, 9, 6, 7, 0, 4, 4, 10, 12, 13, 0, 18, 18,
+    0, 17, 17, 0, 6, 7, 0, 4, 5, 0, 15, 16, 0, 3, 3, 0,
+    15, 16, 0, 12, 13, 0, 13, 13, 0, 12, 13, 0, 18, 18, 0, 7,
+    7, 9, 19, 19, 0, 14, 15, 0, 0, 0, 5, 0, 0, 5, 3, 5,
+    0, 5, 10, 0, 3, 5, 0, 0, 0, 0, 8, 8, 9, 8, 8, 0,
+    13, 14, 0, 13, 14, 0, 15, 16, 0, 15, 16, 0, 14, 16, 0, 19,
+    19, 0, 17, 17, 0, 11, 11, 0, 17, 17, 0, 1, 1, 0, 1, 1,
+    0, 5, 5, 0, 1, 1, 0, 4, 4, 0, 5, 5, 0, 0, 0, 5,
+    6, 13, 0, 5, 12, 0, 7, 7, 0, 3, 6, 0, 1, 1, 0, 6,
+    6, 0, 8, 8, 0, 4, 4, 0, 9, 9, 12, 5, 5, 0, 8, 9,
+    0, 7, 7, 0, 12, 12, 16, 1, 4, 0, 10, 11, 0, 11, 12, 0,
+    8, 9, 0, 8, 8, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0,
+    3, 0, 7, 7, 0, 6, 6, 0, 2, 2, 3, 8, 8, 0, 0, 0,
+    0, 1, 1, 10, 9, 10, 0, 1, 1, 10, 8, 8, 0, 1, 10, 0,
+    3, 3, 0, 12, 13, 0, 13, 14, 0, 14, 15, 0, 12, 13, 0, 3,
+    3, 0, 10, 10, 11, 8, 8, 0, 4, 4, 0, 6, 6, 0, 4, 4,
+    0, 7, 7, 8, 5, 9, 0, 1, 7, 0, 7, 7, 8, 13, 16, 0,
+    1, 1, 0, 7, 7, 8, 5, 6, 0, 3, 3, 8, 5, 6, 0, 10,
+    10, 11, 12, 12, 14, 15, 16, 0, 13, 14, 0, 3, 4, 0, 7, 7,
+    0, 4, 6, 0, 3, 10, 0, 0, 0, 0, 18, 18, 0, 10, 10, 0,
+    9, 10, 0, 1, 1, 5, 4, 4, 0, 3, 4, 0, 15, 17, 0, 13,
+    15, 0, 6, 9, 0, 10, 14, 0, 13, 14, 0, 11, 15, 0, 11, 11,
+    0, 4, 4, 0, 2, 3, 0, 12, 13, 0, 1, 3, 0, 5, 9, 0,
+    5, 6, 0, 14, 16, 0, 5, 6, 0, 14, 14, 17, 12, 13, 0, 13,
+    14, 0, 2, 3, 0, 1, 1, 0, 13, 13, 16, 13, 14, 0, 12, 12,
+    14, 14, 16, 0, 13, 13, 16, 14, 15, 0, 13, 13, 16, 14, 15, 0,
+    15, 16, 0, 16, 17, 0, 0, 1, 0, 1, 5, 0, 14, 15, 0, 13,
+    14, 0, 3, 6, 0, 1, 1, 0, 7, 8, 0, 8, 12, 0, 7, 7,
+    0, 0, 0, 0, 7, 7, 0, 12, 16, 0, 7, 7, 0, 7, 7, 0,
+    6, 6, 0, 15, 16, 0, 6, 6, 0, 8, 8, 0, 10, 10, 11, 16,
+    16, 0, 5, 5, 0, 15, 15, 16, 8, 9, 0, 16, 17, 0, 4, 4,
+    9, 14, 16, 0, 6, 6, 0, 4, 6, 0, 13, 14, 0, 13, 14, 0,
+    13, 14, 0, 12, 13, 0, 13, 14, 0, 12, 13, 0, 4, 4, 0, 5,
+    5, 9, 8, 8, 0, 4, 6, 0, 1, 1, 0, 4, 5, 0, 1, 1,
+    0, 4, 5, 0, 4, 5, 0, 11, 12, 0, 2, 2, 5, 4, 5, 0,
+    10, 10, 12, 10, 10, 13, 10, 10, 13, 7, 7, 0, 16, 16, 0, 16,
+    16, 18, 16, 16, 0, 14, 14, 17, 0, 0, 0, 7, 7, 12, 15, 16,
+    0, 14, 16, 0, 8, 9, 0, 2, 7, 0, 6, 7, 0, 6, 7, 0,
+    13, 15, 0, 0, 9, 0, 1, 1, 0, 1, 1, 0, 19, 19, 0, 16,
+    17, 0, 5, 10, 0, 15, 15, 16, 11, 12, 0, 8, 9, 0, 11, 12,
+    0, 8, 9, 0, 10, 11, 0, 8, 9, 0, 9, 9, 14, 12, 12, 0,
+    1, 1, 2, 13, 15, 0, 0, 1, 0, 14, 14, 0, 6, 6, 0, 10,
+    10, 0, 10, 10, 0, 8, 8, 0, 4, 4, 0, 2, 2, 5, 7, 9,
+    0, 10, 13, 0, 15, 17, 0, 16, 18, 0, 2, 6, 0, 7, 7, 0,
+    0, 0, 0, 11, 12, 0, 11, 14, 0, 2, 2, 7, 7, 7, 13, 4,
+    9, 0, 7, 7, 0, 9, 9, 0, 7, 7, 0, 2, 4, 0, 7, 7,
+    0, 7, 7, 0, 1, 2, 0, 6, 6, 9, 15, 16, 0, 14, 15, 0,
+    2, 2, 7, 0, 1, 0, 14, 15, 0, 15, 16, 0, 13, 16, 0, 13,
+    14, 0, 11, 14, 0, 12, 13, 0, 11, 14, 0, 12, 13, 0, 13, 15,
+    0, 14, 15, 0, 13, 13, 15, 14, 14, 17, 15, 16, 0, 16, 16, 0,
+    7, 8, 0, 9, 10, 0, 8, 10, 0, 10, 11, 0, 7, 7, 0, 7,
+    7, 0, 3, 3, 0, 7, 7, 0, 3, 3, 0, 7, 7, 0, 5, 6,
+    0, 2, 3, 0, 2, 2, 3, 1, 8, 0, 0, 0, 0, 9, 9, 0,
+    0, 0, 0, 5, 10, 0, 5, 6, 0, 4, 5, 0, 15, 16, 0, 6,
+    6, 0, 6, 6, 7, 4, 5, 0, 6, 6, 7, 4, 5, 0, 4, 4,
+    0, 3, 3, 0, 5, 6, 0, 6, 7, 0, 4, 4, 0, 8, 9, 0,
+    4, 4, 0, 14, 15, 0, 7, 7, 0, 0, 1, 0, 10, 13, 0, 8,
+    9, 0, 15, 16, 0, 7, 8, 0, 14, 14, 17, 18, 19, 0, 9, 9,
+    0, 8, 8, 0, 9, 9, 0, 18, 18, 0, 7, 7, 0, 7, 7, 13,
+    7, 7, 0, 7, 7, 0, 16, 16, 18, 14, 14, 16, 7, 8, 0, 4,
+    4, 10, 5, 5, 11, 2, 2, 0, 11, 12, 0, 12, 13, 0, 13, 15,
+    0, 0, 0, 0, 13, 15, 0, 4, 4, 10, 19, 19, 0, 0, 2, 0,
+    3, 5, 0, 0, 2, 0, 2, 2, 0, 3, 3, 0, 2, 2, 0, 2,
+    2, 0, 0, 2, 0, 1, 1, 0, 0, 2, 0, 1, 1, 0, 12, 12,
+    0, 13, 13, 0, 14, 15, 0, 16, 17, 0, 12, 14, 0, 18, 19, 0,
+    12, 12, 0, 13, 14, 0, 5, 5, 10, 1, 6, 0, 4, 10, 0, 13,
+    15, 0, 4, 12, 0, 12, 15, 0, 13, 13, 14, 12, 12, 13, 0, 0,
+    0, 11, 12, 0, 18, 19, 0, 18, 19, 0, 7, 7, 0, 6, 6, 0,
+    1, 1, 0, 0, 1, 0, 10, 12, 0, 7, 8, 0, 8, 10, 0, 12,
+    13, 0, 2, 2, 0, 1, 3, 0, 6, 6, 0, 7, 9, 0, 7, 9,
+    0, 8, 12, 0, 17, 17, 18, 17, 18, 0, 2, 3, 0, 3, 3, 0,
+    13, 16, 0, 14, 16, 0, 11, 14, 0, 17, 17, 0, 6, 6, 0, 5,
+    5, 11, 0, 0, 6, 1, 1, 0, 7, 7, 0, 5, 7, 0, 10, 10,
+    11, 6, 6, 0, 14, 15, 0, 14, 15, 0, 14, 15, 0, 13, 14, 0,
+    14, 15, 0, 14, 14, 0, 14, 15, 0, 3, 4, 0, 6, 6, 0, 3,
+    3, 10, 12, 13, 0, 3, 3, 6, 7, 7, 0, 3, 3, 10, 7, 7,
+    0, 3, 3, 10, 7, 7, 0, 3, 3, 0, 1, 2, 0, 7, 7, 0,
+    17, 17, 0, 7, 7, 0, 17, 17, 0, 7, 7, 0, 3, 5, 0, 6,
+    6, 12, 4, 4, 9, 4, 6, 0, 5, 6, 0, 12, 14, 0, 5, 6,
+    0, 6, 6, 0, 4, 6, 0, 0, 0, 3, 4, 6, 0, 0, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 7,
+    7, 0, 1, 1, 3, 2, 2, 3, 4, 5, 0, 4, 10, 0, 12, 13,
+    0, 8, 8, 0, 9, 9, 0, 11, 12, 0, 6, 7, 0, 11, 12, 0,
+    11, 12, 0, 0, 0, 0, 11, 12, 0, 11, 12, 0, 9, 9, 0, 15,
+    16, 0, 9, 9, 0, 14, 15, 0, 2, 2, 3, 7, 8, 0, 2, 2,
+    3, 1, 1, 6, 4, 9, 0, 8, 9, 0, 11, 11, 13, 1, 1, 0,
+    10, 11, 0, 11, 12, 0, 10, 11, 0, 7, 7, 9, 0, 0, 4, 1,
+    1, 0, 3, 10, 0, 1, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 3, 3, 11, 0, 0, 0,
+    13, 16, 0, 0, 0, 0, 7, 7, 0, 2, 6, 0, 10, 10, 13, 5,
+    6, 0, 10, 10, 13, 5, 6, 0, 6, 6, 0, 6, 6, 0, 6, 6,
+    0, 6, 6, 0, 9, 9, 0, 6, 6, 0, 7, 7, 0, 16, 17, 0,
+    4, 5, 0, 3, 4, 0, 9, 9, 13, 8, 8, 13, 4, 5, 0, 3,
+    4, 0, 4, 5, 0, 3, 4, 0, 16, 17, 0, 5, 7, 0, 14, 15,
+    0, 15, 16, 0, 9, 9, 0, 13, 13, 0, 9, 9, 0, 13, 13, 0,
+    4, 4, 0, 4, 4, 0, 4, 4, 0, 4, 4, 0, 6, 7, 0, 7,
+    7, 0, 6, 7, 0, 15, 16, 0, 8, 9, 0, 7, 7, 0, 13, 14,
+    0, 17, 17, 0, 0, 0, 0, 7, 9, 0, 6, 6, 0, 4, 4, 6,
+    16, 16, 18, 15, 17, 0, 5, 12, 0, 9, 10, 0, 5, 5, 0, 0,
+    3, 0, 6, 6, 10, 8, 9, 0, 3, 3, 0, 1, 3, 0, 5, 5,
+    0, 5, 9, 0, 14, 15, 0, 12, 13, 0, 3, 3, 0, 10, 12, 0,
+    5, 10, 0, 10, 13, 0, 2, 2, 0, 6, 13, 0, 11, 14, 0, 2,
+    2, 0, 0, 0, 0, 12, 13, 0, 2, 2, 0, 10, 12, 0, 1, 1,
+    0, 2, 2, 3, 1, 1, 0, 1, 7, 0, 14, 15, 0, 14, 15, 0,
+    13, 14, 0, 0, 0, 3, 0, 0, 3, 7, 7, 0, 0, 0, 3, 7,
+    7, 0, 6, 6, 0, 4, 4, 0, 4, 5, 0, 7, 8, 0, 6, 6,
+    0, 6, 10, 0, 4, 5, 0, 6, 7, 0, 17, 17, 0, 7, 8, 0,
+    3, 3, 0, 10, 10, 15, 17, 17, 0, 10, 11, 0, 17, 17, 0, 6,
+    7, 0, 1, 1, 2, 2, 5, 0, 3, 4, 0, 4, 4, 0, 2, 5,
+    0, 12, 14, 0, 2, 2, 4, 12, 13, 0, 9, 9, 0, 6, 7, 0,
+    9, 9, 0, 16, 17, 0, 12, 13, 0, 7, 11, 0, 2, 2, 0, 1,
+    2, 0, 15, 16, 0, 1, 1, 2, 6, 6, 7, 11, 11, 14, 11, 14,
+    0, 9, 9, 0, 9, 9, 0, 11, 11, 14, 0, 0, 5, 2, 2, 0,
+    0, 0, 5, 2, 2, 0, 9, 9, 0, 3, 3, 7, 2, 2, 0, 2,
+    2, 0, 1, 1, 0, 0, 3, 0, 3, 3, 0, 0, 0, 0, 2, 2,
+    9, 8, 8, 0, 12, 13, 0, 10, 10, 0, 9, 9, 0, 7, 7, 0,
+    9, 9, 0, 0, 0, 5, 0, 7, 0, 7, 7, 0, 7, 7, 0, 1,
+    1, 0, 7, 7, 0, 9, 9, 0, 9, 10, 0, 4, 4, 8, 8, 9,
+    0, 14, 15, 0, 10, 12, 0, 17, 18, 0, 6, 7, 0, 12, 12, 13,
+    13, 13, 15, 11, 12, 0, 5, 5, 10, 3, 3, 9, 7, 7, 8, 3,
+    3, 0, 2, 2, 9, 2, 2, 0, 1, 1, 0, 9, 9, 0, 8, 9,
+    0, 13, 16, 0, 14, 16, 0, 17, 18, 0, 18, 18, 19, 8, 9, 0,
+    13, 14, 0, 15, 16, 0, 0, 0, 0, 11, 12, 0, 15, 16, 0, 0,
+    0, 0, 7, 7, 0, 9, 9, 0, 2, 2, 9, 2, 2, 0, 18, 18,
+    0, 2, 2, 0, 18, 18, 0, 11, 14, 0, 10, 12, 0, 8, 9, 0,
+    10, 12, 0, 8, 9, 0, 2, 2, 0, 4, 4, 0, 8, 8, 14, 7,
+    7, 10, 1, 1, 0, 0, 0, 2, 1, 1, 0, 5, 9, 0, 7, 7,
+    0, 7, 7, 0, 4, 6, 0, 4, 4, 0, 12, 16, 0, 8, 14, 0,
+    13, 14, 0, 9, 9, 0, 1, 2, 0, 12, 13, 0, 2, 2, 3, 10,
+    13, 0, 0, 0, 0, 0, 4, 0, 16, 16, 0, 11, 11, 13, 10, 10,
+    0, 8, 8, 14, 10, 10, 0, 8, 8, 14, 3, 3, 0, 4, 4, 0,
+    3, 3, 0, 5, 5, 0, 16, 17, 0, 14, 15, 0, 0, 0, 6, 12,
+    13, 0, 16, 17, 0, 12, 13, 0, 16, 17, 0, 7, 10, 0, 7, 7,
+    0, 7, 7, 0, 5, 5, 10, 1, 1, 0, 6, 6, 11, 6, 7, 0,
+    6, 6, 11, 12, 14, 0, 7, 7, 0, 3, 3, 6, 4, 5, 0, 16,
+    16, 18, 13, 14, 0, 7, 11, 0, 9, 9, 0, 15, 16, 0, 9, 9,
+    0, 0, 0, 0, 10, 10, 0, 9, 9, 0, 11, 12, 0, 11, 12, 0,
+    6, 7, 0, 0, 0, 0, 16, 17, 0, 13, 16, 0, 3, 3, 0, 1,
+    1, 0, 1, 1, 0, 2, 3, 0, 1, 1, 0, 3, 5, 0, 10, 11,
+    0, 13, 14, 0, 3, 3, 0, 2, 6, 0, 12, 13, 0, 12, 12, 13,
+    5, 6, 0, 4, 5, 0, 11, 11, 13, 10, 11, 0, 11, 11, 13, 2,
+    3, 0, 6, 6, 7, 11, 13, 0, 6, 6, 7, 4, 4, 0, 18, 19,
+    0, 17, 17, 18, 13, 14, 0, 15, 16, 0, 7, 7, 0, 6, 6, 0,
+    14, 16, 0, 1, 1, 0, 7, 7, 0, 10, 10, 0, 3, 3, 0, 3,
+    5, 0, 15, 15, 16, 14, 14, 15, 15, 15, 16, 14, 14, 15, 13, 13,
+    16, 14, 14, 16, 8, 9, 0, 7, 8, 0, 5, 5, 0, 1, 1, 0,
+    6, 6, 0, 5, 5, 7, 13, 13, 16, 0, 0, 0, 0, 0, 0, 15,
+    15, 0, 9, 9, 0, 0, 1, 0, 6, 6, 0, 10, 10, 0, 7, 7,
+    0, 3, 5, 0, 7, 7, 0, 10, 11, 0, 0, 0, 4, 0, 5, 0,
+    2, 2, 0, 0, 2, 0, 0, 1, 0, 1, 2, 0, 1, 8, 0, 1,
+    7, 0, 11, 12, 0, 10, 12, 0, 0, 4, 0, 7, 11, 0, 5, 6,
+    0, 8, 9, 0, 2, 5, 0, 1, 1, 3, 14, 15, 0, 15, 16, 0,
+    14, 15, 0, 11, 15, 0, 15, 16, 0, 16, 17, 0, 16, 17, 0, 16,
+    16, 18, 9, 10, 0, 11, 11, 0, 13, 15, 0, 11, 11, 0, 2, 2,
+    11, 7, 10, 0, 2, 2, 11, 7, 10, 0, 12, 13, 0, 14, 15, 0,
+    8, 9, 0, 12, 12, 15, 13, 14, 0, 14, 14, 15, 13, 14, 0, 13,
+    14, 0, 10, 10, 12, 0, 0, 0, 1, 2, 0, 12, 13, 0, 3, 4,
+    0, 0, 0, 3, 12, 13, 0, 8, 12, 0, 11, 11, 12, 7, 7, 0,
+    11, 11, 12, 13, 14, 0, 18, 18, 0, 11, 11, 0, 10, 13, 0, 8,
+    8, 0, 12, 14, 0, 3, 3, 10, 12, 14, 0, 3, 3, 10, 18, 18,
+    0, 12, 13, 0, 2, 2, 5, 6, 6, 0, 0, 0, 0, 7, 7, 9,
+    7, 9, 0, 7, 7, 0, 5, 6, 0, 9, 10, 0, 17, 18, 0, 17,
+    17, 18, 12, 13, 0, 12, 13, 0, 3, 3, 0, 3, 3, 6, 3, 3,
+    0, 0, 6, 0, 2, 5, 0, 18, 18, 0, 2, 5, 0, 18, 18, 0,
+    14, 15, 0, 12, 15, 0, 5, 7, 0, 3, 4, 0, 4, 5, 0, 6,
+    7, 0, 8, 12, 0, 4, 4, 11, 1, 1, 5, 0, 1, 0, 1, 1,
+    5, 0, 1, 0, 5, 5, 0, 13, 15, 0, 5, 5, 0, 3, 3, 0,
+    18, 18, 0, 11, 11, 0, 6, 6, 11, 17, 17, 0, 18, 18, 0, 11,
+    11, 0, 16, 17, 0, 15, 17, 0, 4, 5, 0, 6, 7, 0, 11, 11,
+    0, 10, 10, 0, 12, 14, 0, 2, 3, 0, 4, 5, 0, 5, 6, 0,
+    8, 9, 0, 4, 8, 0, 3, 4, 0, 3, 4, 0, 1, 1, 0, 2,
+    2, 10, 8, 8, 0, 2, 2, 3, 4, 4, 5, 6, 6, 0, 4, 4,
+    5, 3, 3, 0, 3, 5, 0, 6, 7, 0, 14, 15, 0, 11, 12, 0,
+    14, 15, 0, 15, 16, 0, 12, 16, 0, 6, 6, 0, 7, 8, 0, 3,
+    8, 0, 7, 8, 0, 8, 8, 9, 8, 8, 0, 0, 0, 0, 6, 7,
+    0, 3, 3, 0, 8, 8, 0, 10, 10, 0, 8, 8, 0, 10, 10, 0,
+    7, 7, 0, 13, 13, 0, 10, 10, 0, 11, 11, 15, 1, 1, 0, 2,
+    2, 0, 6, 6, 7, 4, 5, 0, 1, 1, 0, 2, 2, 0, 1, 1,
+    0, 3, 3, 0, 0, 0, 0, 5, 10, 0, 6, 6, 0, 5, 5, 0,
+    6, 6, 0, 9, 9, 0, 6, 6, 0, 10, 10, 0, 0, 0, 0, 3,
+    9, 0, 7, 7, 0, 9, 9, 0, 13, 14, 0, 9, 9, 0, 15, 16,
+    0, 16, 17, 0, 14, 16, 0, 14, 15, 0, 9, 9, 0, 19, 19, 0,
+    14, 16, 0, 12, 14, 0, 14, 16, 0, 1, 1, 0, 2, 2, 0, 0,
+    0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
+    0, 1, 1, 0, 8, 9, 0, 15, 16, 0, 12, 12, 13, 15, 15, 0,
+    6, 12, 0, 6, 10, 0, 11, 12, 0, 11, 11, 12, 7, 7, 0, 8,
+    8, 0, 7, 7, 0, 5, 5, 6, 10, 10, 0, 0, 0, 0, 10, 10,
+    0, 10, 11, 0, 9, 9, 10, 14, 16, 0, 1, 1, 0, 0, 0, 0,
+    11, 11, 12, 12, 14, 0, 0, 0, 5, 0, 3, 0, 13, 14, 0, 2,
+    3, 0, 13, 14, 0, 4, 4, 9, 1, 3, 0, 3, 4, 0, 11, 11,
+    12, 14, 16, 0, 13, 14, 0, 19, 19, 0, 12, 15, 0, 0, 5, 0,
+    0, 4, 0, 1, 7, 0, 3, 3, 0, 1, 1, 0, 14, 14, 17, 11,
+    11, 15, 7, 7, 0, 11, 11, 0, 3, 3, 0, 11, 11, 12, 2, 3,
+    0, 0, 0, 0, 11, 11, 12, 5, 5, 0, 7, 7, 0, 0, 0, 5,
+    14, 15, 0, 11, 14, 0, 13, 13, 14, 8, 9, 0, 9, 10, 0, 12,
+    13, 0, 14, 14, 15, 14, 15, 0, 13, 14, 0, 9, 11, 0, 9, 9,
+    0, 9, 9, 0, 7, 8, 0, 14, 15, 0, 3, 3, 0, 11, 12, 0,
+    3, 6, 0, 2, 2, 0, 0, 0, 0, 7, 7, 9, 7, 7, 0, 8,
+    8, 0, 12, 12, 0, 0, 0, 5, 9, 10, 0, 9, 9, 0, 17, 18,
+    0, 3, 3, 0, 3, 3, 0, 0, 0, 0, 3, 8, 0, 8, 9, 0,
+    12, 12, 14, 12, 13, 0, 10, 14, 0, 12, 16, 0, 12, 13, 0, 5,
+    5, 0, 15, 16, 0, 6, 7, 0, 15, 16, 0, 9, 9, 10, 11, 11,
+    13, 15, 16, 0, 11, 11, 13, 15, 16, 0, 13, 16, 0, 1, 1, 2,
+    14, 15, 0, 1, 1, 0, 13, 14, 0, 5, 11, 0, 14, 16, 0, 13,
+    14, 0, 13, 14, 0, 10, 11, 0, 1, 1, 0, 5, 5, 0, 5, 12,
+    0, 16, 16, 0, 2, 2, 0, 0, 1, 0, 4, 5, 0, 6, 7, 0,
+    4, 5, 0, 6, 7, 0, 12, 12, 16, 17, 17, 18, 3, 4, 0, 5,
+    7, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 4, 4,
+    0, 16, 16, 18, 0, 0, 1, 0, 0, 0, 9, 9, 0, 14, 15, 0,
+    9, 9, 0, 14, 15, 0, 0, 2, 0, 0, 0, 3, 11, 11, 12, 10,
+    10, 0, 14, 17, 0, 18, 19, 0, 17, 18, 0, 18, 19, 0, 9, 10,
+    0, 9, 10, 0, 14, 14, 16, 9, 9, 10, 5, 5, 0, 9, 9, 0,
+    9, 9, 0, 8, 8, 0, 12, 12, 16, 17, 17, 18, 12, 12, 0, 10,
+    11, 0, 14, 14, 17, 13, 15, 0, 19, 19, 0, 10, 10, 0, 17, 18,
+    0, 6, 9, 0, 16, 16, 18, 5, 9, 0, 1, 1, 0, 0, 2, 0,
+    7, 7, 8, 1, 1, 0, 11, 12, 0, 9, 9, 0, 11, 12, 0, 9,
+    9, 0, 11, 12, 0, 9, 9, 11, 7, 7, 8, 7, 7, 0, 3, 4,
+    0, 1, 1, 0, 1, 1, 0, 0, 1, 0, 7, 7, 9, 8, 9, 0,
+    11, 13, 0, 16, 16, 18, 6, 6, 12, 3, 3, 0, 5, 5, 11, 1,
+    1, 0, 5, 5, 6, 5, 6, 0, 4, 4, 6, 5, 5, 0, 4, 4,
+    7, 11, 13, 0, 6, 6, 0, 8, 9, 0, 6, 6, 7, 7, 7, 9,
+    5, 5, 0, 19, 19, 0, 3, 4, 0, 0, 1, 0, 3, 4, 0, 0,
+    1, 0, 6, 6, 7, 13, 16, 0, 7, 7, 8, 10, 11, 0, 18, 19,
+    0, 18, 18, 19, 19, 19, 0, 4, 4, 12, 1, 4, 0, 2, 3, 0,
+    14, 14, 17, 15, 17, 0, 2, 2, 4, 5, 9, 0, 12, 12, 0, 13,
+    15, 0, 14, 15, 0, 14, 15, 0, 6, 6, 7, 7, 7, 0, 5, 6,
+    0, 4, 5, 0, 7, 7, 9, 9, 12, 0, 1, 1, 0, 8, 9, 0,
+    14, 15, 0, 11, 15, 0, 11, 14, 0, 13, 13, 0, 10, 15, 0, 14,
+    14, 0, 14, 15, 0, 16, 17, 0, 7, 8, 0, 5, 8, 0, 5, 6,
+    0, 0, 0, 0, 5, 6, 0, 7, 7, 0, 2, 2, 5, 4, 4, 0,
+    16, 16, 0, 13, 13, 16, 8, 8, 0, 5, 10, 0, 3, 3, 0, 6,
+    6, 0, 17, 18, 0, 13, 14, 0, 10, 12, 0, 7, 7, 9, 12, 13,
+    0, 10, 11, 0, 5, 6, 0, 4, 9, 0, 18, 18, 0, 18, 19, 0,
+    6, 6, 9, 6, 12, 0, 18, 18, 0, 18, 19, 0, 12, 13, 0, 13,
+    14, 0, 18, 18, 0, 12, 12, 0, 0, 0, 0, 0, 0, 4, 17, 17,
+    0, 2, 2, 0, 2, 5, 0, 2, 2, 0, 17, 17, 0, 2, 2, 0,
+    17, 17, 0, 2, 2, 0, 11, 14, 0, 6, 7, 0, 17, 18, 0, 5,
+    5, 0, 8, 8, 0, 2, 3, 0, 8, 8, 0, 8, 8, 0, 10, 12,
+    0, 3, 4, 0, 5, 6, 0, 6, 7, 0, 12, 13, 0, 12, 13, 0,
+    2, 4, 0, 0, 0, 0, 8, 8, 0, 9, 10, 0, 8, 8, 0, 4,
+    9, 0, 10, 10, 0, 10, 11, 0, 10, 10, 0, 4, 4, 10, 12, 15,
+    0, 3, 3, 11, 6, 6, 11, 2, 2, 6, 5, 5, 6, 4, 5, 0,
+    19, 19, 0, 2, 2, 0, 17, 18, 0, 14, 15, 0, 14, 15, 0, 15,
+    16, 0, 18, 18, 0, 12, 13, 0, 10, 12, 0, 13, 14, 0, 16, 17,
+    0, 18, 18, 0, 18, 18, 0, 10, 11, 0, 4, 5, 0, 4, 5, 0,
+    4, 5, 0, 4, 5, 0, 12, 13, 0, 12, 13, 0, 16, 17, 0, 0,
+    1, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 7, 7, 0, 6, 7,
+    0, 7, 8, 0, 8, 9, 0, 7, 7, 0, 9, 10, 0, 4, 8, 0,
+    3, 3, 0, 7, 8, 0, 14, 15, 0, 8, 8, 10, 7, 7, 0, 5,
+    5, 0, 1, 1, 0, 5, 5, 0, 2, 2, 0, 7, 8, 0, 6, 6,
+    9, 6, 6, 0, 5, 6, 0, 13, 14, 0, 0, 0, 0, 8, 9, 0,
+    0, 0, 0, 8, 9, 0, 5, 5, 0, 7, 7, 0, 14, 14, 17, 17,
+    18, 0, 8, 8, 14, 5, 6, 0, 16, 16, 17, 16, 16, 0, 8, 8,
+    14, 5, 6, 0, 16, 16, 0, 14, 14, 17, 8, 8, 14, 7, 11, 0,
+    8, 8, 14, 7, 11, 0, 12, 13, 0, 13, 13, 0, 3, 6, 0, 4,
+    4, 5, 12, 13, 0, 12, 13, 0, 16, 17, 0, 12, 13, 0, 4, 4,
+    0, 3, 3, 6, 4, 4, 0, 3, 3, 6, 15, 17, 0, 0, 1, 0,
+    17, 17, 18, 5, 10, 0, 8, 10, 0, 13, 14, 0, 8, 10, 0, 13,
+    14, 0, 7, 13, 0, 7, 7, 8, 3, 4, 0, 2, 4, 0, 2, 2,
+    8, 1, 2, 0, 2, 2, 8, 1, 2, 0, 4, 4, 11, 14, 17, 0,
+    4, 4, 11, 14, 17, 0, 14, 15, 0, 7, 7, 0, 8, 9, 0, 7,
+    7, 8, 7, 7, 0, 4, 4, 0, 8, 8, 0, 3, 3, 0, 7, 7,
+    0, 7, 7, 0, 7, 7, 0, 7, 7, 0, 5, 6, 0, 14, 14, 15,
+    5, 6, 0, 14, 14, 15, 12, 12, 0, 17, 18, 0, 11, 11, 0, 9,
+    9, 0, 7, 13, 0, 7, 8, 0, 7, 13, 0, 2, 2, 0, 17, 18,
+    0, 7, 7, 0, 7, 7, 0, 3, 3, 0, 4, 4, 0, 11, 11, 0,
+    4, 4, 0, 11, 11, 0, 13, 15, 0, 13, 15, 0, 13, 15, 0, 5,
+    5, 0, 7, 7, 8, 1, 1, 6, 13, 14, 0, 13, 14, 0, 14, 15,
+    0, 9, 10, 0, 14, 15, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0,
+    0, 0, 0, 6, 6, 0, 9, 9, 13, 0, 0, 5, 4, 5, 0, 4,
+    5, 0, 7, 8, 0, 8, 14, 0, 7, 8, 0, 8, 14, 0, 0, 2,
+    0, 1, 1, 0, 0, 0, 0, 7, 8, 0
+};
+
+constexpr int32_t rectWidth[6282] = {
+    16, 16, 0, 3, 3, 0, 1, 1, 0, 12, 4, 0, 1, 1, 0, 14,
+    14, 0, 4, 4, 0, 2, 2, 0, 18, 6, 0, 13, 13, 0, 16, 16,
+    0, 15, 15, 0, 6, 2, 0, 8, 8, 0, 3, 3, 0, 2, 2, 0,
+    6, 3, 0, 12, 4, 0, 6, 3, 0, 9, 9, 0, 6, 6, 0, 6,
+    6, 0, 6, 6, 0, 5, 5, 0, 10, 10, 0, 16, 16, 0, 12, 4,
+    0, 2, 2, 0, 2, 2, 0, 6, 2, 0, 4, 2, 2, 10, 10, 0,
+    6, 2, 0, 9, 3, 0, 3, 3, 0, 20, 20, 0, 6, 3, 3, 6,
+    6, 0, 6, 3, 3, 2, 2, 0, 4, 2, 2, 1, 1, 0, 12, 6,
+    6, 8, 4, 4, 2, 2, 0, 12, 6, 6, 5, 5, 0, 3, 1, 0,
+    5, 5, 0, 3, 1, 0, 16, 16, 0, 5, 5, 0, 8, 8, 0, 12,
+    4, 0, 6, 6, 0, 3, 3, 0, 3, 3, 0, 6, 2, 0, 8, 4,
+    0, 3, 3, 0, 10, 5, 5, 6, 6, 0, 8, 4, 0, 3, 3, 0,
+    8, 4, 0, 4, 4, 0, 3, 1, 0, 3, 1, 0, 3, 3, 0, 3,
+    3, 0, 1, 1, 0, 10, 10, 0, 6, 2, 0, 3, 1, 0, 6, 2,
+    0, 2, 2, 0, 3, 1, 0, 7, 7, 0, 3, 1, 0, 4, 4, 0,
+    3, 1, 0, 18, 9, 9, 2, 2, 0, 2, 2, 0, 3, 1, 0, 8,
+    8, 0, 6, 3, 3, 1, 1, 0, 6, 3, 3, 1, 1, 0, 1, 1,
+    0, 15, 15, 0, 20, 20, 0, 6, 6, 0, 3, 1, 0, 2, 1, 0,
+    12, 12, 0, 9, 3, 0, 9, 3, 0, 6, 6, 0, 6, 3, 0, 1,
+    1, 0, 6, 3, 3, 4, 2, 0, 3, 1, 0, 3, 1, 0, 2, 2,
+    0, 6, 6, 0, 6, 2, 0, 3, 1, 0, 3, 1, 0, 16, 8, 8,
+    5, 5, 0, 6, 6, 0, 6, 2, 0, 2, 2, 0, 1, 1, 0, 6,
+    3, 3, 3, 3, 0, 1, 1, 0, 2, 2, 0, 3, 3, 0, 2, 2,
+    0, 1, 1, 0, 2, 1, 0, 6, 3, 3, 2, 2, 0, 2, 1, 0,
+    17, 17, 0, 8, 4, 4, 6, 3, 0, 7, 7, 0, 6, 3, 0, 20,
+    20, 0, 9, 9, 0, 4, 4, 0, 8, 8, 0, 10, 5, 5, 4, 2,
+    0, 10, 5, 5, 4, 2, 0, 8, 8, 0, 6, 3, 3, 7, 7, 0,
+    20, 10, 10, 6, 6, 0, 3, 3, 0, 7, 7, 0, 2, 2, 0, 4,
+    4, 0, 14, 7, 7, 2, 2, 0, 6, 6, 0, 3, 3, 0, 3, 3,
+    0, 10, 5, 5, 6, 6, 0, 6, 2, 0, 3, 1, 0, 6, 2, 0,
+    1, 1, 0, 5, 5, 0, 18, 9, 9, 3, 1, 0, 18, 9, 9, 3,
+    1, 0, 2, 2, 0, 5, 5, 0, 15, 5, 0, 2, 2, 0, 3, 3,
+    0, 4, 4, 0, 8, 4, 4, 10, 5, 5, 2, 1, 0, 3, 1, 0,
+    2, 1, 0, 3, 1, 0, 4, 2, 2, 6, 3, 0, 6, 3, 0, 4,
+    4, 0, 6, 2, 0, 4, 4, 0, 4, 4, 0, 8, 4, 4, 3, 3,
+    0, 6, 3, 0, 3, 3, 0, 7, 7, 0, 7, 7, 0, 1, 1, 0,
+    1, 1, 0, 3, 3, 0, 1, 1, 0, 3, 3, 0, 5, 5, 0, 2,
+    2, 0, 10, 5, 5, 5, 5, 0, 18, 6, 0, 4, 2, 0, 6, 2,
+    0, 2, 2, 0, 3, 3, 0, 5, 5, 0, 16, 16, 0, 3, 3, 0,
+    3, 1, 0, 12, 4, 0, 3, 1, 0, 12, 4, 0, 6, 2, 0, 10,
+    5, 0, 6, 2, 0, 2, 2, 0, 16, 8, 8, 3, 3, 0, 16, 8,
+    8, 1, 1, 0, 12, 6, 6, 6, 3, 3, 3, 3, 0, 6, 2, 0,
+    9, 9, 0, 6, 2, 0, 18, 6, 0, 2, 2, 0, 3, 3, 0, 12,
+    6, 6, 3, 1, 0, 3, 1, 0, 12, 6, 6, 17, 17, 0, 14, 7,
+    7, 16, 16, 0, 3, 3, 0, 4, 2, 2, 6, 2, 0, 2, 1, 0,
+    3, 1, 0, 6, 3, 0, 3, 1, 0, 4, 2, 0, 20, 20, 0, 8,
+    4, 4, 6, 6, 0, 14, 14, 0, 4, 2, 0, 20, 20, 0, 2, 2,
+    0, 16, 16, 0, 6, 3, 3, 6, 3, 0, 10, 5, 5, 12, 4, 0,
+    2, 2, 0, 2, 2, 0, 3, 1, 0, 6, 3, 3, 3, 1, 0, 18,
+    9, 9, 3, 1, 0, 5, 5, 0, 3, 1, 0, 5, 5, 0, 8, 4,
+    4, 10, 5, 0, 12, 6, 6, 2, 2, 0, 6, 6, 0, 3, 3, 0,
+    3, 3, 0, 8, 8, 0, 2, 2, 0, 3, 1, 0, 3, 1, 0, 2,
+    2, 0, 18, 9, 9, 6, 6, 0, 3, 1, 0, 18, 9, 9, 6, 6,
+    0, 3, 3, 0, 2, 2, 0, 4, 4, 0, 4, 4, 0, 12, 12, 0,
+    8, 4, 4, 6, 6, 0, 18, 9, 9, 6, 6, 0, 3, 3, 0, 4,
+    4, 0, 1, 1, 0, 8, 8, 0, 1, 1, 0, 3, 3, 0, 4, 4,
+    0, 6, 2, 0, 2, 2, 0, 2, 2, 0, 6, 2, 0, 15, 5, 0,
+    2, 2, 0, 6, 2, 0, 6, 2, 0, 18, 6, 0, 8, 4, 0, 15,
+    5, 0, 6, 2, 0, 3, 3, 0, 6, 2, 0, 3, 3, 0, 3, 1,
+    0, 4, 2, 0, 3, 1, 0, 4, 2, 0, 4, 2, 0, 3, 1, 0,
+    18, 6, 0, 6, 3, 0, 15, 15, 0, 10, 10, 0, 6, 3, 0, 6,
+    3, 3, 2, 2, 0, 4, 4, 0, 6, 3, 0, 4, 4, 0, 6, 3,
+    0, 6, 3, 3, 16, 16, 0, 2, 2, 0, 6, 2, 0, 16, 8, 8,
+    3, 3, 0, 4, 2, 0, 1, 1, 0, 5, 5, 0, 4, 2, 2, 10,
+    5, 5, 4, 4, 0, 4, 2, 0, 8, 4, 0, 5, 5, 0, 2, 2,
+    0, 8, 4, 4, 1, 1, 0, 2, 2, 0, 14, 7, 7, 10, 10, 0,
+    4, 4, 0, 6, 6, 0, 6, 3, 3, 1, 1, 0, 8, 8, 0, 6,
+    3, 0, 6, 6, 0, 6, 6, 0, 2, 1, 0, 3, 3, 0, 8, 4,
+    0, 4, 2, 0, 6, 2, 0, 2, 2, 0, 1, 1, 0, 11, 11, 0,
+    2, 1, 0, 6, 2, 0, 2, 1, 0, 6, 2, 0, 4, 4, 0, 2,
+    2, 0, 3, 1, 0, 2, 1, 0, 1, 1, 0, 4, 4, 0, 2, 2,
+    0, 5, 5, 0, 4, 4, 0, 3, 3, 0, 4, 4, 0, 4, 2, 0,
+    5, 5, 0, 3, 3, 0, 2, 2, 0, 8, 8, 0, 3, 3, 0, 3,
+    3, 0, 3, 1, 0, 6, 2, 0, 8, 4, 4, 20, 10, 10, 3, 1,
+    0, 6, 2, 0, 3, 3, 0, 3, 3, 0, 3, 3, 0, 3, 3, 0,
+    18, 9, 9, 7, 7, 0, 2, 1, 0, 18, 18, 0, 5, 5, 0, 4,
+    4, 0, 18, 9, 9, 6, 6, 0, 1, 1, 0, 1, 1, 0, 1, 1,
+    0, 2, 2, 0, 18, 6, 0, 20, 20, 0, 6, 2, 0, 6, 3, 3,
+    4, 2, 2, 19, 19, 0, 3, 3, 0, 5, 5, 0, 6, 3, 3, 3,
+    3, 0, 3, 3, 0, 8, 4, 0, 18, 9, 9, 14, 14, 0, 2, 2,
+    0, 6, 2, 0, 6, 3, 0, 2, 2, 0, 9, 3, 0, 6, 3, 0,
+    6, 2, 0, 6, 3, 0, 6, 3, 0, 2, 2, 0, 3, 1, 0, 6,
+    3, 0, 6, 3, 3, 10, 10, 0, 6, 3, 3, 3, 3, 0, 4, 4,
+    0, 7, 7, 0, 9, 3, 0, 4, 4, 0, 18, 6, 0, 5, 5, 0,
+    1, 1, 0, 3, 1, 0, 20, 20, 0, 12, 6, 6, 2, 2, 0, 4,
+    4, 0, 7, 7, 0, 8, 4, 4, 9, 9, 0, 2, 1, 0, 2, 1,
+    0, 3, 3, 0, 2, 2, 0, 3, 3, 0, 5, 5, 0, 14, 14, 0,
+    5, 5, 0, 12, 6, 6, 4, 4, 0, 3, 1, 0, 2, 1, 0, 3,
+    3, 0, 4, 4, 0, 3, 1, 0, 4, 4, 0, 3, 1, 0, 3, 1,
+    0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 2, 1, 0,
+    14, 14, 0, 1, 1, 0, 8, 8, 0, 6, 3, 3, 2, 1, 0, 12,
+    12, 0, 4, 4, 0, 12, 4, 0, 8, 4, 0, 6, 2, 0, 8, 4,
+    0, 6, 2, 0, 8, 4, 0, 6, 2, 0, 16, 16, 0, 4, 4, 0,
+    3, 3, 0, 6, 3, 0, 2, 2, 0, 4, 4, 0, 2, 1, 0, 3,
+    1, 0, 11, 11, 0, 3, 3, 0, 3, 1, 0, 12, 4, 0, 6, 3,
+    0, 6, 3, 3, 2, 1, 0, 2, 1, 0, 2, 1, 0, 1, 1, 0,
+    12, 6, 6, 6, 6, 0, 4, 4, 0, 10, 10, 0, 6, 3, 3, 12,
+    4, 0, 3, 3, 0, 3, 3, 0, 2, 2, 0, 2, 2, 0, 6, 6,
+    0, 4, 4, 0, 6, 3, 3, 4, 4, 0, 12, 6, 6, 6, 3, 3,
+    4, 2, 2, 10, 5, 5, 4, 2, 2, 12, 6, 6, 3, 1, 0, 2,
+    1, 1, 3, 1, 0, 4, 4, 0, 4, 2, 2, 4, 4, 0, 4, 4,
+    0, 2, 1, 1, 16, 16, 0, 4, 2, 2, 4, 2, 2, 13, 13, 0,
+    20, 20, 0, 9, 9, 0, 3, 1, 0, 2, 2, 0, 2, 1, 0, 10,
+    5, 0, 2, 1, 0, 10, 5, 0, 2, 1, 0, 12, 4, 0, 2, 1,
+    0, 3, 1, 0, 2, 1, 0, 2, 1, 1, 2, 2, 0, 1, 1, 0,
+    2, 1, 0, 3, 3, 0, 2, 1, 0, 3, 3, 0, 1, 1, 0, 7,
+    7, 0, 20, 20, 0, 3, 3, 0, 9, 9, 0, 12, 6, 0, 18, 6,
+    0, 9, 9, 0, 2, 2, 0, 3, 3, 0, 2, 2, 0, 3, 3, 0,
+    1, 1, 0, 5, 5, 0, 3, 3, 0, 6, 2, 0, 4, 4, 0, 5,
+    5, 0, 3, 1, 0, 18, 18, 0, 1, 1, 0, 6, 6, 0, 1, 1,
+    0, 12, 6, 6, 2, 1, 0, 2, 1, 1, 4, 4, 0, 2, 1, 0,
+    3, 1, 0, 2, 1, 0, 3, 1, 0, 8, 4, 4, 6, 6, 0, 4,
+    4, 0, 10, 5, 5, 12, 6, 0, 2, 1, 0, 2, 1, 0, 3, 1,
+    0, 6, 2, 0, 7, 7, 0, 3, 3, 0, 7, 7, 0, 3, 3, 0,
+    8, 4, 0, 12, 4, 0, 8, 4, 0, 12, 4, 0, 6, 3, 0, 17,
+    17, 0, 12, 4, 0, 6, 2, 0, 20, 20, 0, 6, 2, 0, 18, 6,
+    0, 2, 1, 0, 7, 7, 0, 4, 4, 0, 8, 8, 0, 3, 1, 0,
+    4, 4, 0, 14, 7, 7, 6, 2, 0, 9, 9, 0, 3, 3, 0, 2,
+    2, 0, 3, 3, 0, 15, 15, 0, 2, 2, 0, 2, 1, 0, 2, 2,
+    0, 12, 12, 0, 4, 4, 0, 9, 9, 0, 6, 6, 0, 4, 4, 0,
+    4, 4, 0, 14, 14, 0, 1, 1, 0, 12, 4, 0, 1, 1, 0, 4,
+    2, 0, 20, 10, 10, 1, 1, 0, 20, 10, 10, 1, 1, 0, 3, 1,
+    0, 6, 2, 0, 2, 2, 0, 3, 3, 0, 3, 3, 0, 3, 1, 0,
+    3, 3, 0, 2, 2, 0, 3, 1, 0, 5, 5, 0, 3, 1, 0, 12,
+    6, 6, 14, 7, 0, 3, 3, 0, 6, 3, 3, 4, 2, 2, 5, 5,
+    0, 2, 2, 0, 5, 5, 0, 3, 1, 0, 8, 4, 4, 12, 4, 0,
+    3, 3, 0, 3, 3, 0, 3, 3, 0, 7, 7, 0, 11, 11, 0, 14,
+    7, 0, 6, 2, 0, 6, 2, 0, 6, 2, 0, 9, 3, 0, 3, 1,
+    0, 6, 3, 0, 3, 1, 0, 4, 2, 0, 6, 3, 0, 8, 4, 4,
+    5, 5, 0, 4, 4, 0, 6, 2, 0, 3, 3, 0, 3, 1, 0, 2,
+    1, 0, 6, 3, 0, 3, 1, 0, 10, 5, 5, 6, 3, 0, 4, 4,
+    0, 2, 1, 0, 4, 2, 2, 4, 4, 0, 3, 3, 0, 4, 4, 0,
+    4, 4, 0, 6, 2, 0, 4, 2, 0, 3, 3, 0, 4, 2, 0, 3,
+    3, 0, 6, 2, 0, 3, 1, 0, 18, 9, 9, 6, 2, 0, 6, 2,
+    0, 6, 3, 3, 2, 2, 0, 6, 3, 3, 4, 2, 0, 18, 18, 0,
+    3, 1, 0, 2, 2, 0, 5, 5, 0, 4, 4, 0, 5, 5, 0, 3,
+    1, 0, 2, 1, 1, 12, 4, 0, 4, 2, 0, 8, 4, 0, 6, 2,
+    0, 2, 1, 1, 10, 10, 0, 2, 2, 0, 2, 1, 1, 1, 1, 0,
+    6, 2, 0, 2, 1, 1, 2, 2, 0, 4, 2, 2, 2, 2, 0, 2,
+    1, 1, 14, 7, 7, 3, 3, 0, 3, 3, 0, 1, 1, 0, 6, 2,
+    0, 16, 16, 0, 2, 2, 0, 4, 2, 0, 12, 4, 0, 12, 4, 0,
+    2, 2, 0, 2, 1, 1, 9, 3, 0, 4, 4, 0, 2, 2, 0, 2,
+    2, 0, 1, 1, 0, 8, 8, 0, 4, 4, 0, 4, 4, 0, 6, 2,
+    0, 6, 3, 0, 6, 6, 0, 3, 3, 0, 4, 4, 0, 13, 13, 0,
+    5, 5, 0, 15, 15, 0, 5, 5, 0, 2, 1, 1, 3, 3, 0, 3,
+    3, 0, 6, 6, 0, 9, 3, 0, 4, 2, 2, 6, 6, 0, 14, 7,
+    7, 1, 1, 0, 4, 2, 2, 1, 1, 0, 4, 2, 2, 1, 1, 0,
+    2, 2, 0, 1, 1, 0, 2, 2, 0, 5, 5, 0, 2, 2, 0, 2,
+    2, 0, 16, 16, 0, 2, 1, 0, 2, 2, 0, 2, 2, 0, 2, 1,
+    0, 6, 2, 0, 3, 1, 0, 10, 10, 0, 3, 1, 0, 12, 6, 0,
+    8, 4, 0, 3, 3, 0, 12, 6, 0, 3, 1, 0, 20, 10, 10, 9,
+    3, 0, 3, 1, 0, 4, 2, 2, 19, 19, 0, 3, 3, 0, 20, 10,
+    10, 7, 7, 0, 6, 2, 0, 4, 4, 0, 6, 6, 0, 4, 4, 0,
+    6, 6, 0, 2, 2, 0, 6, 6, 0, 2, 2, 0, 3, 1, 0, 14,
+    7, 7, 6, 2, 0, 4, 4, 0, 3, 1, 0, 6, 6, 0, 3, 1,
+    0, 6, 6, 0, 3, 3, 0, 4, 4, 0, 20, 10, 10, 3, 3, 0,
+    16, 8, 8, 16, 8, 8, 16, 8, 8, 2, 1, 0, 9, 3, 0, 14,
+    7, 7, 9, 3, 0, 6, 3, 3, 2, 1, 0, 8, 4, 4, 1, 1,
+    0, 7, 7, 0, 6, 6, 0, 2, 2, 0, 2, 2, 0, 8, 8, 0,
+    5, 5, 0, 20, 20, 0, 6, 2, 0, 4, 2, 0, 18, 6, 0, 5,
+    5, 0, 15, 15, 0, 4, 2, 2, 2, 2, 0, 3, 3, 0, 2, 2,
+    0, 3, 3, 0, 2, 2, 0, 4, 4, 0, 4, 2, 2, 6, 2, 0,
+    4, 2, 2, 7, 7, 0, 2, 2, 0, 6, 2, 0, 6, 2, 0, 8,
+    4, 0, 4, 2, 0, 3, 1, 0, 8, 4, 0, 2, 1, 1, 20, 20,
+    0, 3, 3, 0, 1, 1, 0, 2, 2, 0, 8, 8, 0, 12, 4, 0,
+    6, 2, 0, 3, 3, 0, 3, 3, 0, 6, 3, 3, 10, 5, 5, 2,
+    2, 0, 2, 1, 0, 6, 3, 0, 2, 1, 0, 4, 4, 0, 3, 1,
+    0, 3, 1, 0, 1, 1, 0, 16, 8, 8, 3, 3, 0, 4, 4, 0,
+    6, 3, 3, 14, 14, 0, 3, 3, 0, 3, 3, 0, 2, 2, 0, 6,
+    6, 0, 3, 3, 0, 5, 5, 0, 3, 3, 0, 3, 3, 0, 7, 7,
+    0, 6, 6, 0, 14, 7, 7, 4, 2, 2, 4, 4, 0, 6, 2, 0,
+    6, 6, 0, 13, 13, 0, 3, 3, 0, 4, 4, 0, 3, 1, 0, 3,
+    1, 0, 3, 1, 0, 2, 1, 0, 3, 1, 0, 12, 4, 0, 3, 3,
+    0, 6, 6, 0, 14, 7, 7, 7, 7, 0, 12, 6, 0, 18, 6, 0,
+    10, 5, 0, 8, 8, 0, 3, 3, 0, 2, 2, 0, 4, 4, 0, 10,
+    5, 0, 2, 1, 1, 4, 4, 0, 2, 1, 1, 4, 4, 0, 3, 1,
+    0, 2, 1, 0, 5, 5, 0, 4, 4, 0, 3, 1, 0, 4, 4, 0,
+    3, 1, 0, 1, 1, 0, 2, 1, 0, 3, 3, 0, 2, 2, 0, 18,
+    18, 0, 2, 2, 0, 4, 4, 0, 6, 3, 3, 6, 6, 0, 4, 2,
+    0, 3, 1, 0, 4, 2, 0, 6, 2, 0, 3, 1, 0, 8, 4, 4,
+    3, 1, 0, 3, 1, 0, 14, 7, 7, 18, 9, 9, 3, 3, 0, 20,
+    10, 10, 10, 5, 5, 4, 2, 0, 4, 4, 0, 3, 3, 0, 5, 5,
+    0, 6, 2, 0, 5, 5, 0, 2, 1, 1, 3, 1, 0, 2, 2, 0,
+    1, 1, 0, 3, 3, 0, 3, 1, 0, 4, 2, 0, 3, 1, 0, 4,
+    2, 0, 1, 1, 0, 12, 4, 0, 1, 1, 0, 12, 4, 0, 3, 1,
+    0, 6, 2, 0, 6, 6, 0, 7, 7, 0, 20, 20, 0, 14, 14, 0,
+    3, 1, 0, 3, 3, 0, 12, 6, 6, 5, 5, 0, 9, 9, 0, 6,
+    6, 0, 5, 5, 0, 4, 4, 0, 2, 1, 1, 2, 1, 1, 2, 1,
+    0, 7, 7, 0, 1, 1, 0, 1, 1, 0, 2, 1, 0, 2, 1, 0,
+    2, 1, 0, 3, 3, 0, 3, 3, 0, 8, 8, 0, 3, 3, 0, 6,
+    6, 0, 10, 5, 0, 20, 20, 0, 6, 2, 0, 14, 14, 0, 3, 3,
+    0, 3, 3, 0, 6, 3, 3, 4, 4, 0, 4, 4, 0, 6, 2, 0,
+    1, 1, 0, 2, 2, 0, 5, 5, 0, 4, 2, 0, 20, 10, 0, 10,
+    5, 5, 2, 1, 1, 6, 2, 0, 2, 1, 0, 15, 15, 0, 18, 9,
+    9, 15, 5, 0, 4, 4, 0, 3, 3, 0, 4, 4, 0, 3, 3, 0,
+    5, 5, 0, 20, 10, 0, 6, 6, 0, 4, 4, 0, 20, 10, 0, 10,
+    5, 5, 4, 4, 0, 8, 4, 4, 2, 1, 0, 10, 5, 5, 2, 1,
+    0, 10, 5, 5, 2, 1, 0, 20, 10, 0, 10, 10, 0, 2, 1, 0,
+    3, 1, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 4, 4, 0, 2,
+    1, 1, 18, 9, 9, 2, 2, 0, 3, 3, 0, 10, 10, 0, 3, 3,
+    0, 12, 4, 0, 6, 6, 0, 4, 2, 2, 6, 6, 0, 4, 2, 2,
+    8, 4, 0, 4, 2, 0, 18, 6, 0, 2, 1, 0, 20, 10, 0, 6,
+    2, 0, 16, 8, 8, 4, 2, 2, 9, 9, 0, 5, 5, 0, 2, 2,
+    0, 3, 1, 0, 2, 1, 0, 2, 2, 0, 2, 2, 0, 6, 6, 0,
+    4, 4, 0, 4, 2, 0, 4, 4, 0, 1, 1, 0, 6, 3, 0, 4,
+    4, 0, 6, 3, 0, 2, 2, 0, 20, 10, 10, 8, 8, 0, 20, 10,
+    10, 2, 1, 1, 1, 1, 0, 4, 4, 0, 16, 8, 8, 3, 1, 0,
+    2, 2, 0, 2, 2, 0, 20, 20, 0, 6, 3, 3, 8, 4, 4, 6,
+    2, 0, 2, 2, 0, 7, 7, 0, 15, 5, 0, 4, 2, 0, 18, 6,
+    0, 17, 17, 0, 3, 1, 0, 3, 1, 0, 4, 2, 2, 3, 1, 0,
+    2, 2, 0, 6, 2, 0, 3, 1, 0, 1, 1, 0, 12, 6, 6, 2,
+    2, 0, 12, 6, 6, 2, 2, 0, 6, 2, 0, 2, 1, 0, 6, 2,
+    0, 2, 1, 0, 2, 1, 0, 20, 10, 0, 10, 5, 0, 4, 4, 0,
+    3, 3, 0, 5, 5, 0, 14, 7, 7, 8, 4, 4, 3, 3, 0, 5,
+    5, 0, 3, 3, 0, 5, 5, 0, 2, 2, 0, 20, 20, 0, 3, 3,
+    0, 5, 5, 0, 2, 1, 0, 2, 1, 0, 2, 1, 0, 2, 1, 0,
+    2, 1, 0, 2, 1, 0, 2, 1, 0, 2, 1, 0, 1, 1, 0, 8,
+    4, 0, 1, 1, 0, 4, 4, 0, 2, 2, 0, 2, 1, 0, 2, 2,
+    0, 18, 6, 0, 18, 6, 0, 3, 3, 0, 2, 1, 0, 14, 7, 7,
+    6, 3, 3, 2, 2, 0, 5, 5, 0, 2, 2, 0, 3, 1, 0, 3,
+    3, 0, 8, 4, 4, 13, 13, 0, 6, 2, 0, 2, 2, 0, 6, 2,
+    0, 2, 2, 0, 4, 4, 0, 4, 4, 0, 6, 2, 0, 16, 16, 0,
+    3, 3, 0, 3, 3, 0, 2, 1, 0, 2, 2, 0, 12, 12, 0, 4,
+    2, 0, 2, 1, 0, 3, 3, 0, 2, 1, 0, 2, 2, 0, 2, 1,
+    0, 14, 7, 7, 2, 1, 0, 8, 8, 0, 4, 4, 0, 6, 6, 0,
+    5, 5, 0, 2, 1, 1, 2, 1, 1, 3, 1, 0, 2, 1, 1, 3,
+    1, 0, 2, 1, 0, 4, 2, 0, 4, 4, 0, 4, 4, 0, 6, 2,
+    0, 3, 3, 0, 2, 2, 0, 1, 1, 0, 3, 1, 0, 20, 20, 0,
+    6, 2, 0, 6, 3, 3, 3, 1, 0, 2, 2, 0, 3, 1, 0, 1,
+    1, 0, 20, 10, 10, 6, 6, 0, 3, 3, 0, 4, 2, 0, 6, 6,
+    0, 20, 20, 0, 16, 8, 8, 5, 5, 0, 6, 3, 0, 3, 3, 0,
+    6, 3, 0, 5, 5, 0, 2, 2, 0, 2, 2, 0, 6, 2, 0, 1,
+    1, 0, 1, 1, 0, 16, 8, 8, 2, 1, 1, 10, 5, 5, 4, 4,
+    0, 6, 2, 0, 6, 2, 0, 16, 8, 8, 8, 4, 4, 6, 2, 0,
+    8, 4, 4, 6, 2, 0, 15, 5, 0, 4, 2, 2, 2, 1, 0, 20,
+    10, 0, 4, 2, 0, 4, 4, 0, 6, 2, 0, 18, 6, 0, 12, 6,
+    6, 3, 1, 0, 2, 2, 0, 4, 2, 0, 15, 5, 0, 6, 2, 0,
+    15, 5, 0, 2, 1, 1, 20, 20, 0, 8, 4, 0, 8, 4, 0, 3,
+    1, 0, 3, 1, 0, 3, 1, 0, 3, 3, 0, 2, 1, 1, 12, 12,
+    0, 1, 1, 0, 3, 3, 0, 8, 8, 0, 2, 2, 0, 2, 1, 1,
+    2, 1, 1, 2, 2, 0, 12, 6, 6, 12, 6, 6, 2, 1, 1, 3,
+    1, 0, 12, 6, 6, 12, 4, 0, 18, 6, 0, 10, 5, 0, 4, 4,
+    0, 6, 6, 0, 1, 1, 0, 4, 4, 0, 6, 3, 3, 1, 1, 0,
+    4, 4, 0, 1, 1, 0, 3, 1, 0, 1, 1, 0, 3, 3, 0, 3,
+    1, 0, 3, 1, 0, 3, 1, 0, 12, 6, 6, 12, 4, 0, 2, 1,
+    0, 3, 1, 0, 2, 1, 0, 2, 2, 0, 5, 5, 0, 15, 15, 0,
+    5, 5, 0, 15, 15, 0, 3, 1, 0, 3, 1, 0, 8, 4, 4, 8,
+    4, 4, 6, 2, 0, 4, 2, 2, 4, 2, 0, 1, 1, 0, 6, 2,
+    0, 12, 4, 0, 4, 4, 0, 9, 3, 0, 2, 2, 0, 14, 14, 0,
+    7, 7, 0, 6, 2, 0, 6, 6, 0, 6, 6, 0, 18, 9, 9, 3,
+    3, 0, 6, 3, 0, 5, 5, 0, 6, 2, 0, 14, 7, 7, 6, 3,
+    0, 10, 5, 5, 6, 3, 0, 10, 5, 5, 6, 2, 0, 6, 2, 0,
+    6, 2, 0, 6, 2, 0, 3, 3, 0, 6, 6, 0, 8, 4, 4, 2,
+    2, 0, 6, 6, 0, 7, 7, 0, 6, 6, 0, 16, 16, 0, 3, 1,
+    0, 3, 1, 0, 20, 10, 10, 4, 2, 0, 8, 4, 4, 3, 3, 0,
+    8, 4, 4, 10, 10, 0, 3, 1, 0, 2, 1, 1, 3, 3, 0, 8,
+    4, 4, 5, 5, 0, 4, 4, 0, 2, 1, 0, 2, 2, 0, 2, 1,
+    0, 6, 2, 0, 2, 1, 0, 9, 3, 0, 2, 2, 0, 6, 6, 0,
+    3, 3, 0, 6, 2, 0, 3, 3, 0, 17, 17, 0, 3, 1, 0, 6,
+    2, 0, 6, 3, 0, 3, 3, 0, 6, 3, 0, 2, 2, 0, 3, 3,
+    0, 4, 4, 0, 3, 1, 0, 3, 3, 0, 1, 1, 0, 2, 1, 1,
+    2, 2, 0, 1, 1, 0, 16, 8, 8, 20, 20, 0, 16, 8, 8, 4,
+    4, 0, 2, 1, 1, 6, 6, 0, 2, 1, 1, 4, 2, 0, 3, 3,
+    0, 6, 3, 3, 5, 5, 0, 2, 2, 0, 3, 1, 0, 2, 1, 0,
+    7, 7, 0, 2, 1, 0, 2, 1, 0, 2, 1, 0, 3, 1, 0, 3,
+    3, 0, 2, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 4, 2,
+    2, 16, 8, 8, 2, 2, 0, 5, 5, 0, 6, 2, 0, 6, 2, 0,
+    3, 1, 0, 2, 1, 1, 2, 1, 1, 3, 1, 0, 3, 1, 0, 4,
+    2, 0, 18, 6, 0, 20, 20, 0, 2, 1, 0, 6, 2, 0, 20, 10,
+    0, 5, 5, 0, 10, 5, 0, 3, 3, 0, 16, 8, 8, 9, 9, 0,
+    8, 4, 0, 2, 2, 0, 9, 9, 0, 12, 12, 0, 16, 16, 0, 8,
+    8, 0, 2, 2, 0, 5, 5, 0, 13, 13, 0, 5, 5, 0, 2, 2,
+    0, 8, 8, 0, 7, 7, 0, 14, 7, 7, 1, 1, 0, 8, 8, 0,
+    1, 1, 0, 2, 2, 0, 8, 8, 0, 8, 8, 0, 2, 2, 0, 8,
+    4, 4, 16, 16, 0, 2, 1, 0, 16, 16, 0, 2, 1, 0, 2, 1,
+    1, 1, 1, 0, 2, 1, 1, 1, 1, 0, 2, 2, 0, 2, 2, 0,
+    6, 6, 0, 4, 2, 2, 5, 5, 0, 2, 1, 1, 6, 6, 0, 5,
+    5, 0, 16, 8, 8, 6, 2, 0, 6, 6, 0, 6, 6, 0, 11, 11,
+    0, 8, 4, 4, 1, 1, 0, 1, 1, 0, 2, 1, 1, 3, 1, 0,
+    2, 1, 1, 1, 1, 0, 3, 1, 0, 2, 1, 0, 5, 5, 0, 6,
+    2, 0, 1, 1, 0, 4, 2, 2, 1, 1, 0, 4, 2, 2, 3, 1,
+    0, 3, 3, 0, 12, 6, 6, 6, 3, 0, 18, 6, 0, 6, 3, 3,
+    10, 10, 0, 6, 2, 0, 2, 2, 0, 2, 2, 0, 8, 8, 0, 6,
+    3, 3, 2, 2, 0, 9, 9, 0, 6, 2, 0, 4, 2, 2, 6, 3,
+    0, 2, 2, 0, 4, 4, 0, 3, 1, 0, 4, 4, 0, 3, 1, 0,
+    3, 3, 0, 2, 2, 0, 3, 3, 0, 6, 6, 0, 7, 7, 0, 2,
+    2, 0, 2, 2, 0, 8, 4, 4, 20, 10, 10, 12, 12, 0, 20, 10,
+    10, 12, 12, 0, 6, 3, 0, 10, 10, 0, 6, 3, 0, 6, 2, 0,
+    9, 3, 0, 6, 3, 0, 12, 6, 6, 3, 1, 0, 9, 3, 0, 6,
+    3, 0, 2, 2, 0, 4, 4, 0, 3, 3, 0, 2, 2, 0, 6, 2,
+    0, 3, 1, 0, 20, 20, 0, 3, 3, 0, 3, 3, 0, 4, 4, 0,
+    4, 4, 0, 2, 2, 0, 4, 4, 0, 2, 2, 0, 4, 2, 0, 2,
+    1, 1, 6, 2, 0, 6, 3, 3, 8, 4, 4, 6, 2, 0, 8, 4,
+    4, 3, 1, 0, 4, 4, 0, 4, 4, 0, 1, 1, 0, 1, 1, 0,
+    6, 6, 0, 7, 7, 0, 2, 2, 0, 6, 2, 0, 4, 4, 0, 13,
+    13, 0, 4, 4, 0, 16, 8, 8, 2, 1, 0, 6, 3, 0, 4, 4,
+    0, 2, 1, 0, 2, 1, 0, 4, 2, 0, 2, 1, 0, 4, 2, 0,
+    9, 3, 0, 2, 1, 0, 6, 3, 0, 4, 2, 2, 4, 2, 0, 2,
+    1, 0, 6, 3, 3, 1, 1, 0, 4, 2, 0, 12, 4, 0, 4, 2,
+    0, 6, 2, 0, 18, 6, 0, 2, 2, 0, 3, 1, 0, 9, 3, 0,
+    3, 1, 0, 6, 3, 0, 3, 1, 0, 6, 3, 0, 3, 1, 0, 20,
+    20, 0, 2, 1, 0, 4, 2, 0, 3, 3, 0, 4, 2, 0, 6, 6,
+    0, 7, 7, 0, 9, 9, 0, 1, 1, 0, 6, 3, 0, 9, 3, 0,
+    9, 9, 0, 6, 6, 0, 8, 8, 0, 3, 1, 0, 2, 1, 0, 6,
+    2, 0, 2, 1, 0, 6, 2, 0, 3, 1, 0, 2, 1, 0, 3, 1,
+    0, 2, 1, 0, 2, 2, 0, 6, 6, 0, 2, 1, 1, 3, 1, 0,
+    4, 4, 0, 7, 7, 0, 8, 8, 0, 2, 1, 1, 12, 4, 0, 3,
+    1, 0, 12, 4, 0, 8, 4, 4, 3, 1, 0, 2, 1, 0, 3, 1,
+    0, 2, 2, 0, 4, 2, 2, 7, 7, 0, 3, 1, 0, 2, 1, 0,
+    2, 1, 1, 6, 6, 0, 6, 3, 3, 2, 2, 0, 3, 3, 0, 3,
+    3, 0, 5, 5, 0, 12, 6, 6, 14, 14, 0, 3, 3, 0, 2, 1,
+    1, 6, 6, 0, 8, 8, 0, 18, 6, 0, 1, 1, 0, 14, 14, 0,
+    16, 16, 0, 8, 8, 0, 3, 1, 0, 3, 1, 0, 4, 2, 2, 6,
+    3, 3, 2, 1, 0, 3, 1, 0, 2, 1, 0, 6, 3, 3, 5, 5,
+    0, 15, 5, 0, 6, 3, 3, 2, 1, 0, 2, 1, 0, 2, 1, 1,
+    2, 2, 0, 4, 4, 0, 2, 1, 1, 4, 4, 0, 4, 4, 0, 4,
+    4, 0, 2, 1, 1, 2, 2, 0, 6, 6, 0, 10, 10, 0, 12, 4,
+    0, 6, 3, 0, 2, 2, 0, 4, 4, 0, 3, 1, 0, 6, 6, 0,
+    11, 11, 0, 6, 3, 0, 4, 2, 0, 6, 3, 3, 8, 4, 0, 15,
+    5, 0, 12, 4, 0, 4, 2, 2, 2, 2, 0, 6, 3, 0, 4, 4,
+    0, 9, 3, 0, 9, 3, 0, 9, 3, 0, 7, 7, 0, 13, 13, 0,
+    14, 7, 7, 4, 4, 0, 9, 9, 0, 2, 2, 0, 3, 3, 0, 4,
+    2, 0, 3, 3, 0, 13, 13, 0, 3, 3, 0, 4, 2, 2, 20, 10,
+    10, 4, 4, 0, 20, 10, 10, 4, 4, 0, 1, 1, 0, 18, 9, 9,
+    3, 3, 0, 6, 2, 0, 1, 1, 0, 2, 2, 0, 18, 18, 0, 1,
+    1, 0, 6, 6, 0, 3, 3, 0, 3, 1, 0, 6, 3, 0, 6, 6,
+    0, 6, 2, 0, 2, 1, 0, 5, 5, 0, 3, 3, 0, 3, 3, 0,
+    3, 3, 0, 3, 3, 0, 4, 2, 2, 18, 9, 9, 2, 2, 0, 4,
+    4, 0, 8, 8, 0, 18, 6, 0, 4, 2, 0, 6, 2, 0, 18, 6,
+    0, 12, 6, 6, 18, 9, 9, 3, 1, 0, 4, 2, 0, 2, 2, 0,
+    4, 2, 0, 2, 2, 0, 6, 6, 0, 2, 1, 1, 2, 1, 1, 2,
+    1, 0, 2, 2, 0, 4, 4, 0, 4, 4, 0, 8, 8, 0, 16, 16,
+    0, 2, 2, 0, 2, 1, 1, 4, 2, 2, 2, 1, 0, 3, 1, 0,
+    3, 1, 0, 3, 1, 0, 4, 2, 2, 16, 8, 8, 3, 1, 0, 1,
+    1, 0, 10, 5, 5, 3, 3, 0, 18, 6, 0, 15, 5, 0, 16, 16,
+    0, 4, 4, 0, 2, 1, 1, 10, 10, 0, 4, 2, 0, 3, 3, 0,
+    2, 1, 1, 6, 2, 0, 3, 3, 0, 3, 1, 0, 3, 3, 0, 3,
+    1, 0, 1, 1, 0, 6, 3, 3, 2, 1, 1, 3, 1, 0, 2, 2,
+    0, 4, 2, 0, 4, 2, 0, 5, 5, 0, 6, 3, 3, 16, 16, 0,
+    5, 5, 0, 2, 1, 1, 2, 1, 1, 6, 2, 0, 12, 6, 6, 10,
+    5, 0, 2, 1, 1, 1, 1, 0, 2, 1, 1, 6, 3, 0, 4, 2,
+    2, 7, 7, 0, 6, 2, 0, 2, 2, 0, 2, 1, 1, 4, 2, 2,
+    6, 2, 0, 18, 6, 0, 3, 3, 0, 2, 2, 0, 3, 3, 0, 2,
+    2, 0, 2, 1, 1, 1, 1, 0, 10, 5, 5, 6, 6, 0, 4, 4,
+    0, 2, 1, 1, 2, 1, 0, 2, 1, 1, 4, 4, 0, 1, 1, 0,
+    4, 2, 2, 1, 1, 0, 20, 10, 10, 2, 2, 0, 4, 2, 0, 9,
+    9, 0, 11, 11, 0, 7, 7, 0, 2, 1, 1, 2, 1, 0, 1, 1,
+    0, 4, 4, 0, 4, 2, 2, 13, 13, 0, 3, 1, 0, 5, 5, 0,
+    11, 11, 0, 2, 2, 0, 10, 10, 0, 15, 5, 0, 1, 1, 0, 6,
+    2, 0, 7, 7, 0, 9, 9, 0, 3, 3, 0, 1, 1, 0, 11, 11,
+    0, 3, 1, 0, 1, 1, 0, 3, 1, 0, 10, 5, 5, 6, 3, 0,
+    3, 1, 0, 2, 1, 1, 3, 1, 0, 18, 18, 0, 6, 3, 0, 6,
+    2, 0, 4, 4, 0, 2, 2, 0, 20, 20, 0, 6, 3, 3, 1, 1,
+    0, 2, 2, 0, 2, 2, 0, 1, 1, 0, 4, 2, 0, 3, 3, 0,
+    16, 8, 8, 4, 4, 0, 4, 2, 0, 3, 3, 0, 1, 1, 0, 1,
+    1, 0, 4, 2, 0, 4, 2, 0, 3, 1, 0, 2, 1, 1, 9, 3,
+    0, 4, 2, 0, 5, 5, 0, 3, 1, 0, 9, 3, 0, 4, 2, 0,
+    9, 3, 0, 4, 2, 0, 10, 10, 0, 3, 3, 0, 5, 5, 0, 4,
+    2, 0, 2, 1, 0, 18, 18, 0, 15, 5, 0, 2, 1, 0, 4, 4,
+    0, 6, 6, 0, 2, 2, 0, 3, 3, 0, 3, 3, 0, 11, 11, 0,
+    3, 3, 0, 4, 2, 0, 3, 1, 0, 2, 2, 0, 3, 1, 0, 10,
+    10, 0, 3, 1, 0, 3, 3, 0, 3, 1, 0, 14, 7, 7, 1, 1,
+    0, 8, 4, 4, 8, 4, 4, 8, 4, 4, 4, 2, 2, 3, 3, 0,
+    12, 4, 0, 3, 1, 0, 4, 4, 0, 6, 6, 0, 2, 2, 0, 6,
+    6, 0, 3, 1, 0, 2, 2, 0, 4, 4, 0, 3, 3, 0, 2, 2,
+    0, 3, 1, 0, 3, 1, 0, 4, 4, 0, 6, 6, 0, 1, 1, 0,
+    6, 6, 0, 1, 1, 0, 3, 3, 0, 2, 2, 0, 4, 4, 0, 4,
+    4, 0, 20, 10, 0, 3, 1, 0, 20, 10, 0, 3, 1, 0, 19, 19,
+    0, 4, 4, 0, 3, 3, 0, 3, 1, 0, 16, 16, 0, 2, 2, 0,
+    2, 1, 0, 2, 2, 0, 4, 4, 0, 6, 3, 3, 2, 1, 0, 6,
+    2, 0, 3, 1, 0, 12, 4, 0, 6, 2, 0, 8, 8, 0, 14, 7,
+    7, 14, 7, 0, 2, 2, 0, 4, 4, 0, 3, 1, 0, 10, 10, 0,
+    3, 1, 0, 10, 10, 0, 3, 1, 0, 12, 4, 0, 6, 3, 3, 6,
+    6, 0, 6, 3, 3, 2, 2, 0, 4, 2, 2, 6, 2, 0, 6, 3,
+    3, 2, 2, 0, 9, 3, 0, 6, 3, 3, 6, 3, 3, 2, 2, 0,
+    6, 3, 3, 2, 2, 0, 1, 1, 0, 8, 4, 0, 16, 16, 0, 8,
+    4, 4, 1, 1, 0, 2, 2, 0, 3, 3, 0, 1, 1, 0, 3, 1,
+    0, 2, 1, 1, 3, 1, 0, 2, 1, 1, 12, 12, 0, 19, 19, 0,
+    10, 5, 5, 10, 10, 0, 3, 3, 0, 1, 1, 0, 3, 3, 0, 1,
+    1, 0, 2, 2, 0, 2, 1, 1, 8, 8, 0, 2, 2, 0, 2, 1,
+    1, 1, 1, 0, 2, 1, 1, 1, 1, 0, 4, 2, 2, 1, 1, 0,
+    4, 2, 2, 1, 1, 0, 4, 4, 0, 12, 4, 0, 4, 4, 0, 2,
+    1, 1, 2, 1, 0, 4, 2, 0, 3, 1, 0, 8, 4, 0, 2, 1,
+    0, 3, 1, 0, 2, 1, 0, 3, 1, 0, 2, 2, 0, 2, 1, 1,
+    2, 2, 0, 2, 1, 1, 6, 2, 0, 5, 5, 0, 6, 3, 0, 6,
+    3, 0, 2, 2, 0, 5, 5, 0, 2, 2, 0, 9, 3, 0, 5, 5,
+    0, 12, 6, 0, 6, 2, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0,
+    3, 1, 0, 3, 1, 0, 6, 6, 0, 1, 1, 0, 6, 6, 0, 18,
+    6, 0, 12, 6, 6, 8, 4, 4, 4, 4, 0, 4, 4, 0, 4, 4,
+    0, 2, 2, 0, 4, 4, 0, 2, 1, 0, 10, 5, 0, 8, 4, 0,
+    10, 5, 0, 8, 4, 0, 10, 5, 5, 4, 2, 2, 8, 8, 0, 8,
+    8, 0, 4, 4, 0, 3, 3, 0, 4, 4, 0, 3, 3, 0, 7, 7,
+    0, 18, 6, 0, 3, 1, 0, 4, 4, 0
+};
+
+constexpr int32_t rectHeight[6282] = {
+    4, 2, 0, 14, 7, 0, 6, 3, 0, 8, 8, 0, 9, 3, 0, 9,
+    3, 0, 4, 2, 0, 16, 8, 0, 5, 5, 0, 8, 4, 0, 9, 3,
+    0, 4, 2, 0, 4, 4, 0, 9, 3, 0, 8, 4, 0, 2, 1, 0,
+    12, 12, 0, 6, 6, 0, 15, 15, 0, 6, 2, 0, 3, 1, 0, 4,
+    2, 0, 3, 1, 0, 8, 4, 0, 4, 2, 0, 12, 4, 0, 6, 6,
+    0, 9, 3, 0, 9, 3, 0, 8, 8, 0, 12, 6, 6, 2, 1, 0,
+    4, 4, 0, 12, 12, 0, 12, 4, 0, 15, 5, 0, 8, 4, 4, 2,
+    1, 0, 4, 2, 2, 6, 2, 0, 4, 2, 2, 2, 1, 0, 10, 5,
+    5, 12, 6, 6, 3, 1, 0, 12, 6, 6, 3, 1, 0, 2, 2, 0,
+    3, 1, 0, 2, 2, 0, 2, 1, 0, 12, 6, 0, 6, 3, 0, 2,
+    2, 0, 8, 4, 0, 10, 5, 0, 9, 3, 0, 4, 4, 0, 3, 3,
+    0, 6, 3, 0, 8, 4, 4, 8, 4, 0, 3, 3, 0, 6, 3, 0,
+    3, 3, 0, 4, 2, 0, 2, 2, 0, 1, 1, 0, 4, 2, 0, 6,
+    2, 0, 14, 7, 0, 6, 2, 0, 3, 3, 0, 5, 5, 0, 5, 5,
+    0, 6, 2, 0, 2, 2, 0, 6, 2, 0, 7, 7, 0, 9, 3, 0,
+    7, 7, 0, 8, 4, 4, 10, 5, 0, 6, 3, 0, 5, 5, 0, 6,
+    2, 0, 14, 7, 7, 8, 4, 0, 14, 7, 7, 8, 4, 0, 6, 2,
+    0, 2, 1, 0, 6, 2, 0, 8, 4, 0, 2, 2, 0, 2, 2, 0,
+    9, 3, 0, 5, 5, 0, 5, 5, 0, 12, 4, 0, 18, 18, 0, 12,
+    4, 0, 10, 5, 5, 6, 6, 0, 2, 2, 0, 2, 2, 0, 6, 2,
+    0, 6, 2, 0, 1, 1, 0, 2, 2, 0, 1, 1, 0, 2, 1, 1,
+    3, 1, 0, 3, 1, 0, 15, 15, 0, 3, 1, 0, 3, 1, 0, 4,
+    2, 2, 6, 3, 0, 14, 7, 0, 3, 1, 0, 14, 7, 0, 6, 3,
+    0, 8, 4, 0, 1, 1, 0, 10, 5, 5, 3, 1, 0, 1, 1, 0,
+    9, 3, 0, 8, 4, 4, 4, 4, 0, 10, 5, 0, 4, 4, 0, 6,
+    2, 0, 10, 5, 0, 12, 6, 0, 3, 1, 0, 6, 3, 3, 11, 11,
+    0, 10, 5, 5, 11, 11, 0, 12, 6, 0, 4, 2, 2, 4, 2, 0,
+    12, 6, 6, 15, 5, 0, 8, 4, 0, 6, 2, 0, 3, 1, 0, 3,
+    1, 0, 4, 2, 2, 4, 2, 0, 6, 2, 0, 6, 2, 0, 3, 1,
+    0, 4, 2, 2, 8, 4, 0, 2, 2, 0, 5, 5, 0, 19, 19, 0,
+    2, 1, 0, 3, 1, 0, 4, 2, 2, 8, 8, 0, 4, 2, 2, 8,
+    8, 0, 6, 2, 0, 2, 1, 0, 1, 1, 0, 6, 2, 0, 3, 1,
+    0, 10, 5, 0, 2, 1, 1, 8, 4, 4, 4, 4, 0, 4, 4, 0,
+    1, 1, 0, 4, 4, 0, 14, 7, 7, 9, 9, 0, 16, 16, 0, 2,
+    1, 0, 1, 1, 0, 9, 3, 0, 6, 3, 0, 16, 8, 8, 6, 3,
+    0, 2, 2, 0, 12, 4, 0, 10, 5, 0, 10, 5, 0, 14, 7, 0,
+    6, 2, 0, 6, 2, 0, 6, 2, 0, 6, 2, 0, 3, 1, 0, 3,
+    1, 0, 8, 4, 4, 4, 2, 0, 1, 1, 0, 3, 3, 0, 1, 1,
+    0, 3, 1, 0, 4, 2, 0, 6, 2, 0, 2, 1, 0, 4, 2, 0,
+    3, 3, 0, 6, 6, 0, 3, 3, 0, 6, 6, 0, 5, 5, 0, 2,
+    2, 0, 5, 5, 0, 10, 5, 0, 2, 1, 1, 2, 1, 0, 2, 1,
+    1, 3, 1, 0, 10, 5, 5, 6, 3, 3, 2, 1, 0, 4, 4, 0,
+    3, 1, 0, 1, 1, 0, 6, 6, 0, 6, 3, 0, 6, 3, 0, 12,
+    6, 6, 6, 6, 0, 7, 7, 0, 4, 2, 2, 12, 6, 0, 12, 6,
+    6, 9, 3, 0, 6, 3, 0, 6, 3, 3, 1, 1, 0, 5, 5, 0,
+    5, 5, 0, 1, 1, 0, 5, 5, 0, 3, 3, 0, 6, 2, 0, 6,
+    3, 3, 4, 2, 0, 10, 5, 0, 4, 4, 0, 10, 5, 0, 14, 7,
+    0, 4, 2, 0, 8, 4, 4, 7, 7, 0, 4, 2, 2, 1, 1, 0,
+    2, 1, 0, 4, 2, 0, 6, 6, 0, 4, 2, 2, 6, 6, 0, 6,
+    3, 3, 3, 3, 0, 2, 1, 0, 3, 3, 0, 2, 1, 0, 8, 4,
+    4, 2, 2, 0, 10, 5, 5, 3, 1, 0, 3, 1, 0, 3, 1, 0,
+    3, 1, 0, 9, 3, 0, 3, 1, 0, 3, 3, 0, 3, 3, 0, 12,
+    4, 0, 4, 2, 2, 2, 1, 0, 6, 6, 0, 4, 2, 2, 2, 1,
+    0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 2, 1, 0, 2, 1, 0,
+    8, 4, 4, 2, 1, 0, 8, 4, 4, 10, 5, 0, 6, 2, 0, 3,
+    1, 0, 6, 2, 0, 2, 1, 0, 6, 2, 0, 3, 1, 0, 3, 1,
+    0, 3, 3, 0, 6, 3, 0, 8, 4, 0, 3, 3, 0, 5, 5, 0,
+    2, 1, 0, 2, 2, 0, 1, 1, 0, 12, 12, 0, 6, 6, 0, 5,
+    5, 0, 1, 1, 0, 6, 3, 0, 1, 1, 0, 6, 3, 0, 4, 4,
+    0, 7, 7, 0, 4, 4, 0, 7, 7, 0, 12, 12, 0, 4, 4, 0,
+    14, 14, 0, 11, 11, 0, 4, 2, 0, 8, 4, 0, 8, 8, 0, 14,
+    7, 7, 12, 6, 0, 6, 2, 0, 6, 6, 0, 4, 2, 0, 7, 7,
+    0, 14, 7, 7, 8, 4, 0, 8, 4, 0, 20, 20, 0, 12, 6, 6,
+    3, 1, 0, 5, 5, 0, 2, 1, 0, 3, 1, 0, 8, 4, 4, 12,
+    6, 6, 3, 1, 0, 5, 5, 0, 2, 2, 0, 2, 1, 0, 3, 1,
+    0, 4, 2, 2, 2, 1, 0, 3, 1, 0, 4, 2, 2, 2, 1, 0,
+    6, 2, 0, 3, 1, 0, 6, 3, 3, 6, 2, 0, 2, 1, 0, 1,
+    1, 0, 10, 5, 0, 2, 1, 0, 4, 4, 0, 6, 3, 0, 2, 2,
+    0, 6, 6, 0, 2, 2, 0, 3, 1, 0, 2, 1, 0, 3, 1, 0,
+    4, 4, 0, 3, 3, 0, 4, 4, 0, 3, 3, 0, 3, 1, 0, 8,
+    4, 0, 5, 5, 0, 5, 5, 0, 6, 2, 0, 3, 1, 0, 2, 1,
+    0, 6, 2, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 2, 2, 0,
+    9, 3, 0, 3, 1, 0, 6, 2, 0, 15, 5, 0, 2, 1, 0, 3,
+    1, 0, 5, 5, 0, 2, 2, 0, 10, 5, 5, 10, 5, 5, 1, 1,
+    0, 8, 8, 0, 4, 2, 0, 8, 4, 0, 4, 2, 0, 8, 4, 0,
+    6, 3, 3, 3, 1, 0, 12, 12, 0, 16, 8, 0, 3, 1, 0, 3,
+    1, 0, 6, 3, 3, 3, 1, 0, 3, 1, 0, 9, 3, 0, 3, 1,
+    0, 3, 1, 0, 3, 3, 0, 6, 2, 0, 3, 3, 0, 4, 2, 2,
+    10, 5, 5, 10, 5, 0, 12, 4, 0, 2, 1, 0, 4, 2, 2, 2,
+    1, 0, 2, 1, 0, 4, 4, 0, 6, 3, 3, 6, 2, 0, 6, 2,
+    0, 1, 1, 0, 11, 11, 0, 3, 1, 0, 2, 2, 0, 15, 15, 0,
+    1, 1, 0, 15, 15, 0, 7, 7, 0, 9, 3, 0, 1, 1, 0, 7,
+    7, 0, 4, 2, 2, 2, 1, 0, 4, 2, 2, 3, 1, 0, 3, 1,
+    0, 2, 1, 0, 2, 2, 0, 8, 4, 0, 4, 4, 0, 2, 1, 0,
+    12, 6, 0, 4, 4, 0, 6, 2, 0, 2, 1, 1, 3, 1, 0, 3,
+    1, 0, 6, 2, 0, 12, 6, 6, 4, 2, 0, 5, 5, 0, 6, 6,
+    0, 6, 2, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0,
+    3, 1, 0, 2, 1, 1, 2, 1, 0, 5, 5, 0, 6, 6, 0, 6,
+    2, 0, 2, 1, 0, 5, 5, 0, 2, 1, 0, 5, 5, 0, 1, 1,
+    0, 8, 8, 0, 1, 1, 0, 8, 8, 0, 3, 3, 0, 4, 4, 0,
+    3, 1, 0, 3, 1, 0, 10, 5, 0, 8, 4, 4, 4, 4, 0, 2,
+    1, 0, 4, 2, 0, 4, 4, 0, 1, 1, 0, 10, 10, 0, 2, 2,
+    0, 6, 6, 0, 2, 2, 0, 6, 6, 0, 4, 2, 0, 2, 1, 0,
+    3, 1, 0, 1, 1, 0, 3, 1, 0, 6, 2, 0, 1, 1, 0, 9,
+    9, 0, 6, 3, 0, 14, 7, 0, 3, 3, 0, 5, 5, 0, 3, 3,
+    0, 10, 5, 5, 2, 2, 0, 2, 2, 0, 5, 5, 0, 4, 2, 0,
+    4, 2, 2, 2, 1, 0, 10, 5, 0, 8, 4, 0, 12, 6, 6, 1,
+    1, 0, 6, 2, 0, 4, 2, 0, 2, 1, 0, 2, 1, 0, 2, 1,
+    0, 2, 1, 0, 12, 6, 6, 2, 1, 0, 6, 3, 3, 12, 6, 6,
+    14, 7, 7, 8, 4, 4, 14, 7, 7, 4, 2, 2, 3, 3, 0, 6,
+    3, 3, 3, 3, 0, 3, 1, 0, 2, 1, 1, 3, 1, 0, 3, 1,
+    0, 6, 3, 3, 3, 1, 0, 2, 1, 1, 2, 1, 1, 3, 1, 0,
+    3, 1, 0, 2, 1, 0, 6, 6, 0, 2, 1, 0, 5, 5, 0, 3,
+    3, 0, 5, 5, 0, 3, 3, 0, 2, 2, 0, 11, 11, 0, 7, 7,
+    0, 8, 8, 0, 2, 2, 0, 2, 1, 1, 3, 1, 0, 3, 1, 0,
+    2, 2, 0, 3, 1, 0, 2, 2, 0, 3, 1, 0, 6, 2, 0, 2,
+    1, 0, 14, 7, 0, 6, 2, 0, 6, 2, 0, 5, 5, 0, 5, 5,
+    0, 6, 2, 0, 2, 1, 0, 4, 2, 0, 2, 1, 0, 4, 2, 0,
+    3, 1, 0, 3, 1, 0, 6, 2, 0, 3, 3, 0, 3, 1, 0, 3,
+    1, 0, 2, 2, 0, 2, 1, 0, 3, 1, 0, 3, 1, 0, 3, 1,
+    0, 4, 2, 2, 2, 2, 0, 8, 4, 4, 6, 2, 0, 2, 2, 0,
+    7, 7, 0, 14, 14, 0, 7, 7, 0, 12, 6, 6, 3, 1, 0, 3,
+    1, 0, 12, 6, 6, 3, 3, 0, 7, 7, 0, 4, 4, 0, 3, 3,
+    0, 4, 4, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0,
+    10, 10, 0, 5, 5, 0, 10, 10, 0, 5, 5, 0, 2, 2, 0, 9,
+    3, 0, 2, 2, 0, 4, 4, 0, 4, 2, 0, 5, 5, 0, 4, 4,
+    0, 3, 3, 0, 4, 2, 0, 2, 1, 0, 10, 5, 0, 2, 2, 0,
+    8, 4, 0, 12, 6, 6, 4, 4, 0, 4, 2, 0, 3, 1, 0, 9,
+    3, 0, 3, 1, 0, 2, 1, 0, 3, 1, 0, 5, 5, 0, 3, 1,
+    0, 10, 5, 0, 2, 1, 0, 2, 1, 0, 3, 1, 0, 3, 1, 0,
+    2, 1, 0, 2, 1, 0, 2, 1, 0, 1, 1, 0, 2, 1, 0, 6,
+    6, 0, 14, 7, 7, 3, 1, 0, 12, 6, 6, 2, 1, 0, 2, 2,
+    0, 2, 2, 0, 3, 1, 0, 3, 1, 0, 2, 1, 0, 4, 4, 0,
+    2, 1, 0, 3, 1, 0, 7, 7, 0, 3, 1, 0, 2, 2, 0, 4,
+    2, 2, 1, 1, 0, 2, 1, 0, 10, 5, 5, 10, 5, 5, 6, 2,
+    0, 15, 5, 0, 6, 2, 0, 2, 2, 0, 2, 1, 1, 1, 1, 0,
+    3, 1, 0, 2, 1, 0, 3, 1, 0, 3, 1, 0, 6, 2, 0, 1,
+    1, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 10, 10, 0, 3, 3,
+    0, 4, 4, 0, 3, 3, 0, 11, 11, 0, 4, 4, 0, 10, 5, 5,
+    14, 7, 0, 14, 7, 0, 5, 5, 0, 9, 3, 0, 3, 3, 0, 4,
+    4, 0, 9, 9, 0, 8, 8, 0, 6, 3, 3, 4, 4, 0, 2, 1,
+    0, 2, 2, 0, 8, 4, 4, 9, 3, 0, 3, 1, 0, 2, 1, 0,
+    2, 1, 0, 1, 1, 0, 9, 9, 0, 6, 3, 0, 9, 9, 0, 6,
+    3, 0, 9, 9, 0, 6, 6, 0, 2, 1, 1, 8, 8, 0, 16, 16,
+    0, 18, 9, 9, 3, 1, 0, 18, 9, 9, 12, 12, 0, 18, 9, 0,
+    1, 1, 0, 2, 1, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 4,
+    4, 0, 2, 1, 1, 1, 1, 0, 8, 8, 0, 5, 5, 0, 4, 4,
+    0, 2, 1, 1, 8, 4, 0, 12, 6, 0, 2, 1, 1, 6, 3, 0,
+    15, 15, 0, 2, 1, 1, 2, 1, 0, 10, 5, 5, 2, 1, 0, 2,
+    1, 1, 4, 2, 2, 2, 1, 0, 3, 1, 0, 2, 1, 0, 1, 1,
+    0, 6, 2, 0, 14, 7, 0, 3, 3, 0, 2, 2, 0, 4, 4, 0,
+    2, 1, 0, 8, 4, 4, 1, 1, 0, 2, 1, 0, 4, 2, 0, 6,
+    2, 0, 6, 3, 0, 8, 4, 0, 3, 1, 0, 8, 4, 0, 1, 1,
+    0, 10, 10, 0, 3, 1, 0, 2, 1, 0, 6, 2, 0, 8, 4, 0,
+    3, 1, 0, 6, 2, 0, 3, 1, 0, 6, 3, 3, 2, 1, 0, 2,
+    1, 0, 3, 1, 0, 11, 11, 0, 6, 3, 3, 3, 1, 0, 4, 2,
+    2, 4, 2, 0, 6, 3, 3, 3, 1, 0, 6, 3, 3, 3, 1, 0,
+    3, 1, 0, 2, 1, 0, 2, 1, 0, 8, 4, 0, 3, 1, 0, 3,
+    1, 0, 6, 3, 0, 2, 2, 0, 3, 1, 0, 12, 4, 0, 2, 2,
+    0, 8, 8, 0, 6, 6, 0, 8, 4, 0, 6, 6, 0, 2, 2, 0,
+    3, 3, 0, 3, 1, 0, 3, 3, 0, 5, 5, 0, 2, 1, 1, 4,
+    4, 0, 4, 4, 0, 2, 1, 1, 3, 1, 0, 3, 1, 0, 10, 5,
+    5, 6, 2, 0, 6, 6, 0, 6, 2, 0, 3, 1, 0, 3, 1, 0,
+    2, 1, 0, 3, 1, 0, 2, 1, 0, 3, 1, 0, 5, 5, 0, 8,
+    4, 4, 5, 5, 0, 6, 2, 0, 6, 6, 0, 3, 1, 0, 6, 6,
+    0, 3, 1, 0, 3, 1, 0, 2, 1, 0, 6, 3, 3, 3, 1, 0,
+    4, 2, 2, 6, 3, 3, 6, 3, 3, 4, 4, 0, 4, 4, 0, 4,
+    2, 2, 4, 4, 0, 6, 3, 3, 1, 1, 0, 10, 5, 5, 2, 1,
+    0, 6, 2, 0, 2, 1, 0, 15, 5, 0, 2, 1, 0, 3, 1, 0,
+    6, 2, 0, 18, 9, 0, 6, 6, 0, 9, 9, 0, 1, 1, 0, 2,
+    1, 0, 10, 5, 0, 2, 1, 1, 2, 1, 0, 3, 1, 0, 2, 1,
+    0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 10, 5, 5, 8, 8, 0,
+    2, 1, 1, 6, 2, 0, 3, 1, 0, 3, 3, 0, 4, 4, 0, 3,
+    3, 0, 3, 3, 0, 5, 5, 0, 1, 1, 0, 6, 3, 3, 6, 2,
+    0, 6, 3, 0, 4, 2, 0, 4, 2, 0, 12, 4, 0, 2, 2, 0,
+    1, 1, 0, 3, 1, 0, 6, 3, 0, 10, 5, 5, 12, 6, 6, 10,
+    5, 0, 3, 3, 0, 2, 2, 0, 2, 2, 0, 6, 2, 0, 4, 4,
+    0, 5, 5, 0, 3, 1, 0, 6, 3, 3, 3, 1, 0, 3, 1, 0,
+    10, 5, 5, 2, 1, 0, 3, 1, 0, 3, 1, 0, 6, 3, 0, 3,
+    1, 0, 6, 3, 0, 2, 1, 0, 6, 3, 0, 2, 1, 0, 6, 2,
+    0, 3, 1, 0, 4, 2, 2, 6, 3, 3, 3, 1, 0, 2, 2, 0,
+    2, 1, 0, 3, 1, 0, 4, 2, 0, 3, 1, 0, 4, 4, 0, 5,
+    5, 0, 4, 4, 0, 3, 3, 0, 4, 4, 0, 1, 1, 0, 3, 1,
+    0, 2, 1, 0, 2, 1, 1, 14, 7, 0, 5, 5, 0, 1, 1, 0,
+    5, 5, 0, 15, 5, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 3,
+    3, 0, 2, 1, 1, 3, 1, 0, 2, 1, 1, 3, 1, 0, 3, 3,
+    0, 1, 1, 0, 3, 1, 0, 3, 1, 0, 3, 3, 0, 3, 1, 0,
+    3, 3, 0, 3, 1, 0, 3, 3, 0, 2, 1, 0, 9, 3, 0, 2,
+    1, 0, 3, 1, 0, 3, 1, 0, 6, 3, 3, 2, 1, 0, 3, 3,
+    0, 8, 8, 0, 3, 3, 0, 1, 1, 0, 2, 2, 0, 12, 6, 6,
+    2, 2, 0, 6, 6, 0, 4, 2, 2, 4, 2, 2, 3, 1, 0, 12,
+    6, 6, 12, 6, 6, 7, 7, 0, 3, 1, 0, 3, 1, 0, 6, 2,
+    0, 6, 6, 0, 6, 2, 0, 12, 6, 6, 1, 1, 0, 6, 2, 0,
+    6, 2, 0, 6, 2, 0, 7, 7, 0, 7, 7, 0, 7, 7, 0, 8,
+    8, 0, 4, 2, 0, 5, 5, 0, 4, 2, 0, 5, 5, 0, 8, 8,
+    0, 1, 1, 0, 3, 1, 0, 3, 1, 0, 6, 2, 0, 2, 1, 0,
+    8, 8, 0, 3, 1, 0, 10, 5, 5, 10, 5, 0, 12, 6, 0, 6,
+    2, 0, 16, 8, 0, 6, 3, 0, 2, 1, 1, 2, 1, 1, 14, 14,
+    0, 2, 1, 0, 2, 1, 0, 2, 1, 0, 1, 1, 0, 3, 3, 0,
+    2, 2, 0, 2, 1, 0, 4, 2, 0, 2, 1, 0, 4, 2, 0, 3,
+    1, 0, 3, 3, 0, 6, 2, 0, 3, 3, 0, 4, 2, 0, 6, 2,
+    0, 12, 4, 0, 2, 1, 1, 3, 1, 0, 2, 1, 0, 14, 14, 0,
+    6, 3, 0, 6, 2, 0, 6, 3, 0, 2, 2, 0, 2, 2, 0, 12,
+    6, 6, 12, 6, 6, 2, 2, 0, 1, 1, 0, 6, 2, 0, 2, 1,
+    1, 7, 7, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 2, 1, 0,
+    3, 1, 0, 1, 1, 0, 3, 1, 0, 2, 1, 0, 1, 1, 0, 14,
+    7, 7, 2, 1, 0, 6, 3, 3, 1, 1, 0, 14, 7, 7, 1, 1,
+    0, 14, 7, 7, 2, 2, 0, 1, 1, 0, 3, 1, 0, 2, 2, 0,
+    2, 2, 0, 6, 6, 0, 2, 2, 0, 6, 6, 0, 6, 2, 0, 12,
+    6, 6, 10, 5, 5, 4, 2, 0, 2, 1, 0, 4, 2, 0, 2, 1,
+    0, 6, 6, 0, 6, 2, 0, 6, 3, 3, 6, 2, 0, 6, 3, 3,
+    5, 5, 0, 17, 17, 0, 20, 20, 0, 5, 5, 0, 1, 1, 0, 4,
+    4, 0, 4, 2, 2, 2, 1, 1, 3, 1, 0, 12, 6, 0, 3, 1,
+    0, 5, 5, 0, 3, 3, 0, 2, 1, 0, 3, 1, 0, 2, 1, 0,
+    3, 1, 0, 17, 17, 0, 3, 1, 0, 3, 1, 0, 7, 7, 0, 2,
+    1, 0, 7, 7, 0, 3, 1, 0, 2, 1, 1, 2, 1, 0, 2, 1,
+    1, 10, 5, 5, 10, 5, 0, 3, 1, 0, 4, 2, 2, 5, 5, 0,
+    3, 1, 0, 2, 1, 0, 2, 1, 0, 4, 2, 2, 8, 4, 4, 4,
+    4, 0, 14, 7, 0, 12, 6, 0, 5, 5, 0, 10, 10, 0, 3, 3,
+    0, 2, 1, 0, 3, 3, 0, 12, 12, 0, 16, 8, 8, 3, 3, 0,
+    6, 3, 0, 13, 13, 0, 2, 2, 0, 12, 4, 0, 6, 3, 3, 3,
+    1, 0, 6, 3, 3, 3, 1, 0, 7, 7, 0, 4, 4, 0, 7, 7,
+    0, 4, 4, 0, 3, 3, 0, 1, 1, 0, 2, 2, 0, 3, 1, 0,
+    3, 1, 0, 3, 1, 0, 8, 4, 4, 10, 5, 5, 3, 1, 0, 3,
+    1, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 6, 2, 0, 3, 1,
+    0, 3, 1, 0, 3, 3, 0, 6, 6, 0, 3, 3, 0, 6, 6, 0,
+    4, 4, 0, 5, 5, 0, 4, 4, 0, 5, 5, 0, 2, 1, 0, 13,
+    13, 0, 2, 1, 0, 3, 1, 0, 2, 1, 0, 4, 4, 0, 3, 1,
+    0, 3, 3, 0, 5, 5, 0, 4, 2, 0, 2, 2, 0, 4, 2, 2,
+    4, 2, 2, 4, 2, 0, 14, 7, 0, 2, 1, 0, 7, 7, 0, 9,
+    3, 0, 8, 4, 4, 2, 1, 0, 1, 1, 0, 6, 2, 0, 4, 4,
+    0, 12, 4, 0, 3, 1, 0, 3, 1, 0, 7, 7, 0, 6, 2, 0,
+    10, 5, 0, 6, 3, 0, 12, 12, 0, 14, 7, 0, 9, 3, 0, 12,
+    12, 0, 18, 18, 0, 2, 1, 0, 15, 15, 0, 4, 2, 0, 18, 18,
+    0, 2, 1, 1, 18, 18, 0, 12, 6, 0, 3, 1, 0, 3, 1, 0,
+    2, 1, 0, 6, 3, 3, 6, 3, 3, 6, 6, 0, 6, 3, 3, 6,
+    6, 0, 6, 6, 0, 3, 3, 0, 3, 1, 0, 2, 1, 0, 3, 3,
+    0, 12, 4, 0, 3, 1, 0, 3, 1, 0, 2, 2, 0, 2, 1, 0,
+    7, 7, 0, 10, 5, 5, 2, 2, 0, 2, 1, 0, 2, 2, 0, 3,
+    1, 0, 2, 1, 1, 9, 3, 0, 2, 1, 0, 2, 2, 0, 9, 3,
+    0, 6, 2, 0, 4, 2, 2, 3, 1, 0, 10, 10, 0, 2, 1, 0,
+    10, 10, 0, 2, 1, 0, 3, 1, 0, 12, 4, 0, 2, 2, 0, 2,
+    1, 0, 2, 1, 0, 2, 1, 1, 2, 1, 1, 6, 3, 3, 6, 3,
+    0, 11, 11, 0, 11, 11, 0, 6, 3, 3, 10, 5, 5, 4, 4, 0,
+    10, 5, 5, 4, 4, 0, 2, 2, 0, 8, 4, 4, 9, 9, 0, 1,
+    1, 0, 5, 5, 0, 6, 3, 0, 4, 4, 0, 5, 5, 0, 14, 7,
+    7, 5, 5, 0, 2, 1, 0, 3, 3, 0, 2, 2, 0, 2, 2, 0,
+    2, 2, 0, 10, 5, 5, 14, 7, 0, 4, 4, 0, 4, 4, 0, 3,
+    3, 0, 4, 4, 0, 1, 1, 0, 2, 1, 0, 8, 4, 4, 3, 1,
+    0, 3, 1, 0, 6, 2, 0, 3, 1, 0, 3, 1, 0, 2, 1, 1,
+    4, 2, 2, 3, 1, 0, 10, 5, 5, 12, 6, 6, 2, 1, 1, 2,
+    2, 0, 14, 7, 7, 3, 3, 0, 17, 17, 0, 1, 1, 0, 3, 1,
+    0, 6, 3, 0, 6, 2, 0, 2, 1, 0, 2, 1, 1, 3, 1, 0,
+    3, 1, 0, 2, 1, 0, 12, 12, 0, 3, 1, 0, 3, 1, 0, 12,
+    12, 0, 3, 3, 0, 1, 1, 0, 14, 7, 7, 3, 3, 0, 2, 2,
+    0, 8, 8, 0, 2, 2, 0, 6, 3, 0, 6, 2, 0, 3, 1, 0,
+    6, 2, 0, 3, 1, 0, 1, 1, 0, 2, 2, 0, 12, 6, 6, 6,
+    3, 3, 2, 2, 0, 4, 2, 2, 11, 11, 0, 8, 4, 0, 1, 1,
+    0, 2, 2, 0, 4, 2, 0, 1, 1, 0, 8, 4, 0, 12, 6, 0,
+    3, 1, 0, 3, 3, 0, 3, 1, 0, 2, 1, 0, 2, 1, 1, 6,
+    3, 0, 6, 6, 0, 8, 4, 0, 4, 4, 0, 4, 2, 2, 10, 10,
+    0, 12, 6, 6, 10, 10, 0, 12, 6, 6, 1, 1, 0, 3, 3, 0,
+    1, 1, 0, 3, 3, 0, 3, 1, 0, 3, 1, 0, 12, 6, 6, 3,
+    1, 0, 3, 1, 0, 2, 1, 0, 3, 1, 0, 6, 3, 0, 3, 3,
+    0, 5, 5, 0, 10, 5, 5, 2, 2, 0, 10, 5, 5, 2, 1, 0,
+    10, 5, 5, 6, 2, 0, 3, 3, 0, 6, 3, 3, 3, 1, 0, 4,
+    2, 2, 2, 1, 0, 12, 4, 0, 2, 2, 0, 3, 1, 0, 3, 3,
+    0, 17, 17, 0, 2, 2, 0, 1, 1, 0, 3, 1, 0, 3, 1, 0,
+    2, 1, 0, 1, 1, 0, 3, 1, 0, 6, 3, 0, 7, 7, 0, 4,
+    4, 0, 5, 5, 0, 2, 1, 0, 5, 5, 0, 6, 2, 0, 2, 1,
+    0, 3, 1, 0, 1, 1, 0, 12, 4, 0, 2, 1, 0, 2, 1, 1,
+    2, 1, 0, 3, 1, 0, 4, 2, 2, 3, 1, 0, 4, 2, 2, 2,
+    1, 0, 2, 1, 1, 6, 2, 0, 2, 1, 1, 16, 16, 0, 2, 1,
+    0, 2, 1, 1, 2, 1, 0, 2, 1, 0, 3, 3, 0, 6, 6, 0,
+    6, 2, 0, 11, 11, 0, 4, 4, 0, 1, 1, 0, 9, 9, 0, 6,
+    2, 0, 2, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 6, 3,
+    3, 4, 2, 2, 2, 1, 0, 3, 1, 0, 2, 2, 0, 18, 18, 0,
+    4, 4, 0, 4, 2, 2, 6, 3, 3, 18, 18, 0, 18, 18, 0, 2,
+    2, 0, 1, 1, 0, 3, 1, 0, 4, 4, 0, 2, 2, 0, 1, 1,
+    0, 4, 2, 0, 1, 1, 0, 3, 1, 0, 8, 4, 4, 10, 5, 0,
+    18, 18, 0, 6, 2, 0, 2, 1, 0, 2, 1, 0, 14, 7, 0, 12,
+    6, 0, 2, 1, 0, 6, 2, 0, 8, 4, 0, 8, 4, 0, 3, 1,
+    0, 3, 1, 0, 6, 3, 0, 4, 2, 2, 3, 1, 0, 2, 1, 0,
+    3, 1, 0, 8, 4, 0, 2, 1, 0, 3, 1, 0, 2, 1, 0, 4,
+    2, 2, 3, 1, 0, 4, 4, 0, 6, 2, 0, 4, 4, 0, 18, 9,
+    9, 9, 3, 0, 18, 9, 9, 9, 3, 0, 2, 1, 0, 3, 1, 0,
+    2, 1, 0, 6, 3, 3, 3, 1, 0, 2, 1, 1, 3, 1, 0, 2,
+    1, 0, 4, 2, 2, 6, 6, 0, 3, 1, 0, 2, 1, 0, 2, 1,
+    0, 6, 3, 3, 2, 1, 0, 12, 4, 0, 2, 1, 1, 13, 13, 0,
+    2, 1, 1, 3, 1, 0, 2, 2, 0, 1, 1, 0, 9, 3, 0, 4,
+    4, 0, 4, 2, 0, 14, 7, 7, 4, 2, 0, 14, 7, 7, 2, 2,
+    0, 3, 1, 0, 6, 3, 3, 2, 2, 0, 12, 12, 0, 4, 2, 2,
+    4, 2, 0, 4, 4, 0, 2, 1, 0, 2, 1, 0, 3, 1, 0, 2,
+    1, 1, 2, 1, 0, 2, 1, 0, 1, 1, 0, 6, 3, 3, 5, 5,
+    0, 18, 6, 0, 9, 3, 0, 2, 2, 0, 9, 3, 0, 2, 2, 0,
+    3, 1, 0, 6, 3, 0, 6, 2, 0, 2, 1, 0, 3, 1, 0, 3,
+    1, 0, 12, 4, 0, 14, 7, 7, 8, 4, 4, 2, 1, 0, 8, 4,
+    4, 2, 1, 0, 3, 3, 0, 6, 2, 0, 3, 3, 0, 1, 1, 0,
+    2, 2, 0, 7, 7, 0, 10, 5, 5, 3, 3, 0, 2, 2, 0, 8,
+    8, 0, 2, 1, 0, 4, 2, 0, 3, 1, 0, 3, 1, 0, 1, 1,
+    0, 1, 1, 0, 4, 2, 0, 2, 1, 0, 3, 1, 0, 3, 1, 0,
+    3, 1, 0, 12, 4, 0, 3, 1, 0, 3, 1, 0, 11, 11, 0, 16,
+    8, 8, 12, 12, 0, 2, 1, 1, 2, 1, 1, 2, 2, 0, 2, 1,
+    1, 5, 5, 0, 6, 2, 0, 3, 1, 0, 3, 1, 0, 2, 1, 0,
+    3, 1, 0, 3, 1, 0, 8, 4, 0, 2, 2, 0, 2, 1, 0, 10,
+    5, 0, 2, 1, 0, 2, 1, 1, 5, 5, 0, 13, 13, 0, 2, 1,
+    0, 1, 1, 0, 5, 5, 0, 8, 8, 0, 5, 5, 0, 8, 8, 0,
+    12, 12, 0, 3, 3, 0, 10, 10, 0, 8, 4, 4, 11, 11, 0, 4,
+    4, 0, 2, 1, 1, 3, 1, 0, 14, 14, 0, 3, 3, 0, 14, 14,
+    0, 2, 2, 0, 4, 4, 0, 10, 5, 0, 4, 4, 0, 11, 11, 0,
+    5, 5, 0, 5, 5, 0, 5, 5, 0, 3, 3, 0, 7, 7, 0, 12,
+    6, 0, 2, 2, 0, 1, 1, 0, 2, 1, 0, 6, 6, 0, 3, 1,
+    0, 3, 1, 0, 6, 2, 0, 3, 1, 0, 6, 6, 0, 1, 1, 0,
+    6, 2, 0, 6, 2, 0, 6, 2, 0, 2, 2, 0, 4, 4, 0, 3,
+    3, 0, 4, 4, 0, 3, 3, 0, 2, 2, 0, 2, 2, 0, 2, 2,
+    0, 2, 2, 0, 3, 1, 0, 2, 1, 0, 2, 1, 1, 5, 5, 0,
+    12, 6, 0, 8, 4, 0, 2, 1, 0, 2, 1, 1, 1, 1, 0, 2,
+    2, 0, 1, 1, 0, 2, 1, 1, 10, 10, 0, 4, 4, 0, 10, 10,
+    0, 3, 1, 0, 2, 1, 1, 6, 2, 0, 1, 1, 0, 4, 4, 0,
+    2, 1, 1, 6, 2, 0, 10, 5, 5, 9, 3, 0, 2, 1, 0, 2,
+    1, 0, 2, 1, 0, 10, 5, 5, 6, 2, 0, 2, 1, 0, 2, 1,
+    1, 6, 2, 0, 3, 1, 0, 1, 1, 0, 6, 3, 0, 15, 5, 0,
+    8, 4, 0, 12, 6, 0, 3, 3, 0, 4, 4, 0, 6, 3, 3, 8,
+    4, 4, 4, 4, 0, 1, 1, 0, 14, 14, 0, 2, 1, 1, 2, 1,
+    0, 1, 1, 0, 2, 1, 1, 2, 2, 0, 2, 2, 0, 10, 5, 5,
+    2, 1, 0, 9, 3, 0, 2, 1, 1, 3, 1, 0, 2, 1, 0, 2,
+    1, 0, 2, 1, 1, 2, 1, 0, 3, 1, 0, 6, 2, 0, 4, 4,
+    0, 11, 11, 0, 3, 1, 0, 3, 1, 0, 17, 17, 0, 3, 1, 0,
+    9, 3, 0, 11, 11, 0, 5, 5, 0, 4, 2, 2, 2, 2, 0, 1,
+    1, 0, 2, 2, 0, 10, 5, 5, 2, 1, 0, 2, 2, 0, 3, 1,
+    0, 2, 2, 0, 2, 2, 0, 14, 14, 0, 10, 5, 0, 3, 1, 0,
+    4, 2, 2, 2, 1, 0, 8, 4, 0, 8, 4, 0, 3, 1, 0, 10,
+    10, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 2, 1, 1, 4, 2,
+    2, 3, 1, 0, 4, 2, 2, 3, 1, 0, 6, 3, 0, 2, 1, 1,
+    3, 1, 0, 1, 1, 0, 3, 1, 0, 12, 6, 0, 6, 2, 0, 3,
+    1, 0, 3, 1, 0, 2, 1, 0, 3, 3, 0, 5, 5, 0, 14, 7,
+    0, 2, 2, 0, 12, 12, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0,
+    3, 1, 0, 3, 1, 0, 8, 4, 4, 2, 1, 1, 2, 1, 0, 6,
+    2, 0, 6, 2, 0, 4, 4, 0, 8, 8, 0, 9, 9, 0, 2, 2,
+    0, 4, 2, 2, 2, 1, 1, 18, 18, 0, 7, 7, 0, 2, 1, 0,
+    7, 7, 0, 2, 1, 0, 6, 2, 0, 6, 3, 3, 2, 1, 1, 2,
+    2, 0, 6, 3, 0, 2, 1, 0, 3, 1, 0, 2, 1, 0, 3, 1,
+    0, 2, 1, 0, 4, 2, 2, 2, 1, 1, 5, 5, 0, 2, 2, 0,
+    2, 2, 0, 6, 6, 0, 8, 4, 4, 2, 1, 1, 8, 8, 0, 3,
+    1, 0, 6, 3, 3, 6, 2, 0, 1, 1, 0, 2, 2, 0, 3, 1,
+    0, 9, 3, 0, 4, 2, 2, 8, 4, 0, 2, 2, 0, 6, 2, 0,
+    2, 1, 1, 1, 1, 0, 3, 1, 0, 3, 3, 0, 3, 1, 0, 3,
+    3, 0, 3, 1, 0, 4, 2, 2, 2, 1, 1, 1, 1, 0, 3, 1,
+    0, 2, 2, 0, 2, 2, 0, 2, 1, 0, 4, 2, 2, 2, 1, 0,
+    6, 2, 0, 4, 2, 2, 12, 6, 6, 16, 16, 0, 12, 6, 6, 13,
+    13, 0, 2, 1, 1, 3, 1, 0, 4, 2, 2, 4, 4, 0, 6, 3,
+    3, 6, 2, 0, 6, 6, 0, 2, 1, 0, 2, 1, 1, 4, 2, 2,
+    2, 2, 0, 1, 1, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 3,
+    1, 0, 2, 1, 1, 6, 3, 0, 2, 1, 1, 2, 1, 0, 2, 1,
+    0, 2, 1, 1, 1, 1, 0, 16, 8, 8, 9, 3, 0, 2, 1, 0,
+    6, 3, 3, 4, 2, 0, 4, 2, 2, 8, 4, 0, 5, 5, 0, 6,
+    2, 0, 3, 1, 0, 3, 1, 0, 2, 1, 1, 7, 7, 0, 3, 1,
+    0, 3, 1, 0, 4, 2, 2, 6, 3, 0, 4, 4, 0, 2, 1, 0,
+    3, 1, 0, 8, 4, 0, 6, 3, 0, 5, 5, 0, 10, 5, 0, 2,
+    2, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 6, 3, 0, 2, 1,
+    0, 2, 2, 0, 3, 1, 0, 2, 2, 0, 6, 3, 3, 4, 4, 0,
+    4, 4, 0, 6, 3, 3, 1, 1, 0, 15, 5, 0, 2, 2, 0, 2,
+    2, 0, 3, 1, 0, 3, 1, 0, 4, 2, 0, 4, 2, 2, 2, 1,
+    0, 3, 1, 0, 2, 1, 0, 10, 5, 0, 2, 2, 0, 2, 1, 0,
+    6, 3, 3, 12, 6, 0, 2, 2, 0, 2, 1, 0, 2, 1, 0, 3,
+    1, 0, 2, 2, 0, 6, 6, 0, 4, 4, 0, 8, 4, 4, 3, 3,
+    0, 5, 5, 0, 9, 3, 0, 2, 2, 0, 3, 3, 0, 5, 5, 0,
+    3, 3, 0, 5, 5, 0, 9, 3, 0, 3, 1, 0, 3, 1, 0, 7,
+    7, 0, 5, 5, 0, 2, 1, 0, 6, 6, 0, 5, 5, 0, 6, 2,
+    0, 2, 1, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0,
+    6, 2, 0, 7, 7, 0, 4, 4, 0, 2, 1, 0, 4, 4, 0, 10,
+    5, 0, 2, 2, 0, 2, 1, 0, 2, 2, 0, 12, 6, 6, 6, 3,
+    0, 16, 8, 8, 10, 5, 5, 8, 4, 4, 2, 1, 1, 3, 1, 0,
+    1, 1, 0, 1, 1, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 3,
+    1, 0, 2, 2, 0, 3, 1, 0, 6, 2, 0, 2, 1, 0, 3, 1,
+    0, 2, 2, 0, 2, 2, 0, 2, 1, 0, 3, 1, 0, 3, 1, 0,
+    3, 1, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 3, 1, 0, 2,
+    1, 0, 1, 1, 0, 4, 4, 0, 1, 1, 0, 4, 4, 0, 3, 1,
+    0, 2, 1, 0, 3, 1, 0, 3, 3, 0, 3, 1, 0, 12, 4, 0,
+    5, 5, 0, 3, 1, 0, 3, 1, 0, 4, 2, 2, 2, 2, 0, 6,
+    6, 0, 6, 6, 0, 2, 2, 0, 4, 4, 0, 2, 1, 0, 6, 3,
+    3, 3, 3, 0, 2, 1, 0, 3, 1, 0, 20, 20, 0, 3, 1, 0,
+    20, 20, 0, 3, 1, 0, 4, 4, 0, 4, 4, 0, 6, 3, 3, 2,
+    1, 0, 12, 6, 6, 2, 1, 0, 2, 1, 1, 2, 2, 0, 12, 6,
+    6, 2, 1, 0, 2, 2, 0, 6, 3, 3, 12, 6, 6, 12, 4, 0,
+    12, 6, 6, 12, 4, 0, 2, 1, 0, 1, 1, 0, 6, 3, 0, 2,
+    1, 1, 2, 1, 0, 3, 1, 0, 3, 1, 0, 2, 1, 0, 15, 15,
+    0, 6, 3, 3, 15, 15, 0, 6, 3, 3, 4, 2, 0, 3, 1, 0,
+    2, 1, 1, 15, 5, 0, 4, 2, 0, 2, 1, 0, 4, 2, 0, 2,
+    1, 0, 12, 6, 0, 2, 1, 1, 2, 1, 0, 6, 2, 0, 12, 6,
+    6, 2, 1, 0, 12, 6, 6, 2, 1, 0, 14, 7, 7, 6, 3, 0,
+    14, 7, 7, 6, 3, 0, 3, 1, 0, 2, 2, 0, 3, 1, 0, 2,
+    1, 1, 1, 1, 0, 5, 5, 0, 3, 3, 0, 1, 1, 0, 1, 1,
+    0, 2, 2, 0, 1, 1, 0, 2, 2, 0, 2, 1, 0, 2, 1, 1,
+    2, 1, 0, 2, 1, 1, 5, 5, 0, 2, 1, 0, 3, 3, 0, 3,
+    3, 0, 12, 6, 0, 3, 1, 0, 12, 6, 0, 18, 18, 0, 2, 1,
+    0, 2, 2, 0, 1, 1, 0, 2, 2, 0, 1, 1, 0, 1, 1, 0,
+    1, 1, 0, 1, 1, 0, 6, 2, 0, 6, 2, 0, 6, 2, 0, 1,
+    1, 0, 2, 1, 1, 10, 5, 5, 3, 1, 0, 3, 1, 0, 3, 1,
+    0, 3, 1, 0, 3, 1, 0, 1, 1, 0, 5, 5, 0, 7, 7, 0,
+    5, 5, 0, 7, 7, 0, 8, 4, 4, 10, 5, 5, 3, 1, 0, 3,
+    1, 0, 3, 1, 0, 12, 6, 0, 3, 1, 0, 12, 6, 0, 6, 2,
+    0, 1, 1, 0, 8, 8, 0, 2, 1, 0
+};
+
+constexpr float rectWeight[6282] = {
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 2.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f,
+    0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 2.0f, 2.0f, -1.0f, 2.0f, 2.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 2.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 2.0f,
+    2.0f, -1.0f, 2.0f, 2.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f,
+    -1.0f, 3.0f, 0.0f, -1.0f, 2.0f, 0.0f, -1.0f, 3.0f,
+    0.0f, -1.0f, 3.0f, 0.0f, -1.0f, 3.0f, 0.0f, -1.0f,
+    2.0f, 0.0f
+};
+
+} // namespace FrontalFaceAlt2Cascade_tables
+
+struct FrontalFaceAlt2Cascade {
+    enum {
+        windowWidth = 20,
+        windowHeight = 20,
+        stageCount = 20,
+        weakCount = 1047,
+        featureCount = 2094
+    };
+    static constexpr float stageThreshold(int i) { return FrontalFaceAlt2Cascade_tables::stageThreshold[i]; }
+    static constexpr int stageWeakBegin(int i) { return FrontalFaceAlt2Cascade_tables::stageWeakBegin[i]; }
+    static constexpr int weakNodeBegin(int i) { return FrontalFaceAlt2Cascade_tables::weakNodeBegin[i]; }
+    static constexpr int weakLeafBegin(int i) { return FrontalFaceAlt2Cascade_tables::weakLeafBegin[i]; }
+    static constexpr int nodeLeft(int i) { return FrontalFaceAlt2Cascade_tables::nodeLeft[i]; }
+    static constexpr int nodeRight(int i) { return FrontalFaceAlt2Cascade_tables::nodeRight[i]; }
+    static constexpr int nodeFeature(int i) { return FrontalFaceAlt2Cascade_tables::nodeFeature[i]; }
+    static constexpr float nodeThreshold(int i) { return FrontalFaceAlt2Cascade_tables::nodeThreshold[i]; }
+    static constexpr float leafValue(int i) { return FrontalFaceAlt2Cascade_tables::leafValue[i]; }
+    static constexpr int rectX(int i) { return FrontalFaceAlt2Cascade_tables::rectX[i]; }
+    static constexpr int rectY(int i) { return FrontalFaceAlt2Cascade_tables::rectY[i]; }
+    static constexpr int rectWidth(int i) { return FrontalFaceAlt2Cascade_tables::rectWidth[i]; }
+    static constexpr int rectHeight(int i) { return FrontalFaceAlt2Cascade_tables::rectHeight[i]; }
+    static constexpr float rectWeight(int i) { return FrontalFaceAlt2Cascade_tables::rectWeight[i]; }
+};
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+#include "bench_util.hpp"
+#include "haar_detector.hpp"
+#include "frontalface_alt2_cascade.hpp"
+
+// Rectangles in a fixed order, detection order differs when OpenCV runs threads
+static std::vector<cv::Rect> sorted(std::vector<cv::Rect> rects) {
+    std::sort(rects.begin(), rects.end(), [](const cv::Rect& a, const cv::Rect& b) {
+        if (a.y != b.y) return a.y < b.y;
+        if (a.x != b.x) return a.x < b.x;
+        if (a.width != b.width) return a.width < b.width;
+        return a.height < b.height;
+    });
+    return rects;
+}
+
+// Check compiled alt2 cascade against CascadeClassifier on a set of images and compare throughput
+int main(int argc, char **argv) {
+
+    if (argc < 3) {
+        std::cout << "Usage: " << argv[0] << " <haarcascade_frontalface_alt2.xml> <image or directory>... [--runs N]" << std::endl;
+        return -1;
+    }
+    std::string xmlPath = argv[1];
+    int runs = 10;
+    std::vector<std::string> files;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--runs" && i + 1 < argc) {
+            runs = std::max(1, std::atoi(argv[++i]));
+            continue;
+        }
+        // Directories are expanded to every file inside
+        std::vector<cv::String> found;
+        cv::glob(arg, found, false);
+        files.insert(files.end(), found.begin(), found.end());
+    }
+
+    cv::CascadeClassifier classifier;
+    if (!classifier.load(xmlPath)) {
+        std::cout << "Cannot load " << xmlPath << std::endl;
+        return -1;
+    }
+    HaarCascadeDetector<FrontalFaceAlt2Cascade> compiled;
+
+    // Both detectors on one thread so the comparison is per core
+    cv::setNumThreads(1);
+
+    // Same settings as face_detect.cpp
+    const double scaleFactor = 1.1;
+    const int minNeighbors = 7;
+    const cv::Size minSize(30, 30);
+
+    int images = 0, mismatches = 0;
+    double opencvMs = 0.0, compiledMs = 0.0;
+    std::vector<cv::Rect> expected, actual;
+    for (size_t f = 0; f < files.size(); f++) {
+        cv::Mat image = cv::imread(files[f]);
+        if (image.empty()) continue;
+        cv::Mat gray;
+        cv::cvtColor(image, gray, cv::COLOR_BGR2GRAY);
+        images++;
+
+        // Raw windows (no grouping) and final detections must both match
+        bool same = true;
+        int neighbors[2] = {0, minNeighbors};
+        for (int n = 0; n < 2; n++) {
+            classifier.detectMultiScale(gray, expected, scaleFactor, neighbors[n], 0, minSize);
+            compiled.detectMultiScale(gray, actual, scaleFactor, neighbors[n], minSize);
+            if (sorted(expected) != sorted(actual)) same = false;
+        }
+        if (!same) mismatches++;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < runs; r++) classifier.detectMultiScale(gray, expected, scaleFactor, minNeighbors, 0, minSize);
+        double opencv = elapsedMs(start) / runs;
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < runs; r++) compiled.detectMultiScale(gray, actual, scaleFactor, minNeighbors, minSize);
+        double fast = elapsedMs(start) / runs;
+
+        opencvMs += opencv;
+        compiledMs += fast;
+        std::cout << files[f] << " " << gray.cols << "x" << gray.rows
+                  << " faces=" << actual.size() << (same ? " same" : " MISMATCH")
+                  << std::fixed << std::setprecision(3)
+                  << " opencv=" << opencv << " ms compiled=" << fast << " ms" << std::endl;
+    }
+
+    if (images == 0) {
+        std::cout << "No readable images" << std::endl;
+        return -1;
+    }
+    std::cout << std::fixed << std::setprecision(3)
+              << "Images: " << images << ", mismatches: " << mismatches << std::endl
+              << "CascadeClassifier:  " << opencvMs / images << " ms/image, "
+              << 1000.0 * images / opencvMs << " images/s" << std::endl
+              << "Compiled cascade:   " << compiledMs / images << " ms/image, "
+              << 1000.0 * images / compiledMs << " images/s" << std::endl
+              << "Speedup: " << opencvMs / compiledMs << "x" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,330 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+
+// Header-only Haar Cascade detector for models compiled into the binary
+//
+// Cascade is a traits struct generated by cascade_codegen: window size and
+// counts as enum values, every table as static constexpr accessor. All trees,
+// stages and weak classifier loops are expanded by templates, so thresholds,
+// leaf values and rectangle weights end up as immediates in the code.
+//
+// Scale selection, window stepping, variance normalization and grouping follow
+// cv::CascadeClassifier::detectMultiScale so both return the same rectangles.
+
+// One scale of the image pyramid
+struct HaarLayer {
+    float scale;
+    // Resized image size
+    cv::Size size;
+    // Window size in original image coordinates
+    cv::Size winSize;
+    // Window step, both in x and y
+    int ystep;
+    // Windows start at x < colEnd, y < rowEnd
+    int colEnd;
+    int rowEnd;
+    // First element of layer integral in pyramid buffers
+    size_t offset;
+};
+
+// Integral images of every scale kept in one reusable buffer
+// Every layer uses the same row step so feature offsets are computed once per image size
+class HaarPyramid {
+
+public:
+    /* Choose scales like CascadeClassifier::detectMultiScale, return false if none fits */
+    bool plan(cv::Size imageSize, cv::Size window, double scaleFactor, cv::Size minSize, cv::Size maxSize) {
+        layers_.clear();
+        if (maxSize.height == 0 || maxSize.width == 0) maxSize = imageSize;
+        if (imageSize.height < window.height || imageSize.width < window.width) return false;
+
+        // All scales where window fits into image
+        std::vector<float> allScales, scales;
+        for (double factor = 1; ; factor *= scaleFactor) {
+            cv::Size windowSize(cvRound(window.width * factor), cvRound(window.height * factor));
+            if (windowSize.width > imageSize.width || windowSize.height > imageSize.height) break;
+            allScales.push_back((float) factor);
+        }
+        // Keep scales inside [minSize, maxSize]
+        for (size_t i = 0; i < allScales.size(); i++) {
+            cv::Size windowSize(cvRound(window.width * allScales[i]), cvRound(window.height * allScales[i]));
+            if (windowSize.width > maxSize.width || windowSize.height > maxSize.height) break;
+            if (windowSize.width < minSize.width || windowSize.height < minSize.height) continue;
+            scales.push_back(allScales[i]);
+        }
+        // minSize == maxSize between two scales, take the closest one
+        if (scales.empty() && !allScales.empty()) {
+            size_t best = 0;
+            double bestDistance = 0;
+            for (size_t i = 0; i < allScales.size(); i++) {
+                cv::Size windowSize(cvRound(window.width * allScales[i]), cvRound(window.height * allScales[i]));
+                double d = (minSize.width - windowSize.width) * (minSize.width - windowSize.width)
+                         + (minSize.height - windowSize.height) * (minSize.height - windowSize.height);
+                if (i == 0 || d < bestDistance) {
+                    best = i;
+                    bestDistance = d;
+                }
+            }
+            scales.push_back(allScales[best]);
+        }
+        if (scales.empty()) return false;
+
+        // Rows are scanned in stripes sized from first layer width, as OpenCV does
+        int stripes = 0;
+        step_ = 0;
+        size_t offset = 0;
+        for (size_t i = 0; i < scales.size(); i++) {
+            HaarLayer layer;
+            float sc = scales[i];
+            layer.scale = sc;
+            layer.size = cv::Size(cvRound(imageSize.width / sc), cvRound(imageSize.height / sc));
+            layer.winSize = cv::Size(cvRound(window.width * sc), cvRound(window.height * sc));
+            layer.ystep = sc >= 2 ? 1 : 2;
+
+            cv::Size working(std::max(layer.size.width + 1 - window.width, 0),
+                             std::max(layer.size.height + 1 - window.height, 0));
+            if (i == 0) {
+                stripes = cvCeil(working.width / 32.);
+                step_ = layer.size.width + 1;
+            }
+            int stripeSize = std::max((working.height / layer.ystep + stripes - 1) / std::max(stripes, 1), 1) * layer.ystep;
+            layer.colEnd = working.width;
+            layer.rowEnd = std::min(stripes * stripeSize, working.height);
+
+            layer.offset = offset;
+            offset += (size_t) (layer.size.height + 1) * step_;
+            layers_.push_back(layer);
+        }
+
+        // Buffers only grow, so same-size frames never allocate again
+        if (sum_.size() < offset) {
+            sum_.resize(offset);
+            sqsum_.resize(offset);
+        }
+        return true;
+    }
+
+    /* Resize image to one layer and compute its integrals
+     * Different layers may be built concurrently, each caller passes own resize buffer */
+    void build(const cv::Mat& gray, int index, cv::Mat& resized) {
+        const HaarLayer& layer = layers_[index];
+        resized.create(layer.size, CV_8U);
+        cv::resize(gray, resized, layer.size, 1. / layer.scale, 1. / layer.scale, cv::INTER_LINEAR_EXACT);
+        integral(resized, &sum_[layer.offset], &sqsum_[layer.offset]);
+    }
+
+    /* Build every layer on calling thread */
+    void buildAll(const cv::Mat& gray) {
+        for (size_t i = 0; i < layers_.size(); i++) build(gray, (int) i, resized_);
+    }
+
+    const std::vector<HaarLayer>& layers() const { return layers_; }
+    int step() const { return step_; }
+    const int* sum(int index) const { return &sum_[layers_[index].offset]; }
+    const uint32_t* sqsum(int index) const { return &sqsum_[layers_[index].offset]; }
+
+private:
+    // Sum and squared sum integrals with zero first row and column
+    // Squared sum wraps around in 32 bits like CascadeClassifier, window differences stay exact
+    void integral(const cv::Mat& src, int* sum, uint32_t* sqsum) const {
+        std::fill(sum, sum + step_, 0);
+        std::fill(sqsum, sqsum + step_, 0u);
+        for (int y = 0; y < src.rows; y++) {
+            const uchar* s = src.ptr<uchar>(y);
+            int* prev = sum + (size_t) y * step_;
+            int* row = prev + step_;
+            uint32_t* sqPrev = sqsum + (size_t) y * step_;
+            uint32_t* sqRow = sqPrev + step_;
+            int rowSum = 0;
+            uint32_t rowSqSum = 0;
+            row[0] = 0;
+            sqRow[0] = 0;
+            for (int x = 0; x < src.cols; x++) {
+                rowSum += s[x];
+                rowSqSum += (uint32_t) s[x] * s[x];
+                row[x + 1] = prev[x + 1] + rowSum;
+                sqRow[x + 1] = sqPrev[x + 1] + rowSqSum;
+            }
+        }
+    }
+
+    std::vector<HaarLayer> layers_;
+    int step_ = 0;
+    std::vector<int> sum_;
+    std::vector<uint32_t> sqsum_;
+    cv::Mat resized_;
+};
+
+// Detection window at one position of one layer
+struct HaarWindow {
+    const int* sum;
+    // offset of each window row inside layer integral
+    const int* rowOfs;
+    float varianceNormFactor;
+
+    /* Weighted rectangle sums of feature F, normalized by window variance */
+    template <class C, int F>
+    float feature() const {
+        float ret = C::rectWeight(F * 3) * rectSum<C, F * 3>() + C::rectWeight(F * 3 + 1) * rectSum<C, F * 3 + 1>();
+        if (C::rectWeight(F * 3 + 2) != 0.0f) ret += C::rectWeight(F * 3 + 2) * rectSum<C, F * 3 + 2>();
+        return ret * varianceNormFactor;
+    }
+
+    template <class C, int R>
+    int rectSum() const {
+        const int* top = sum + rowOfs[C::rectY(R)] + C::rectX(R);
+        const int* bottom = sum + rowOfs[C::rectY(R) + C::rectHeight(R)] + C::rectX(R);
+        return top[0] - top[C::rectWidth(R)] - bottom[0] + bottom[C::rectWidth(R)];
+    }
+};
+
+namespace haar_detail {
+
+template <class C, int Root, int Idx, int LeafBase>
+struct TreeNode;
+
+// Child > 0 is another node of same tree, otherwise it selects leaf LeafBase - Child
+template <class C, int Root, int Child, int LeafBase, bool Internal = (Child > 0)>
+struct TreeChild {
+    static inline float eval(const HaarWindow& w) { return TreeNode<C, Root, Child, LeafBase>::eval(w); }
+};
+
+template <class C, int Root, int Child, int LeafBase>
+struct TreeChild<C, Root, Child, LeafBase, false> {
+    static inline float eval(const HaarWindow&) { return C::leafValue(LeafBase - Child); }
+};
+
+template <class C, int Root, int Idx, int LeafBase>
+struct TreeNode {
+    enum { Node = Root + Idx };
+    static inline float eval(const HaarWindow& w) {
+        double val = w.template feature<C, C::nodeFeature(Node)>();
+        return val < C::nodeThreshold(Node)
+               ? TreeChild<C, Root, C::nodeLeft(Node), LeafBase>::eval(w)
+               : TreeChild<C, Root, C::nodeRight(Node), LeafBase>::eval(w);
+    }
+};
+
+// Sum weak classifiers [W, End) of a stage in model order
+template <class C, int W, int End>
+struct WeakSum {
+    static inline void add(const HaarWindow& w, double& sum) {
+        sum += TreeNode<C, C::weakNodeBegin(W), 0, C::weakLeafBegin(W)>::eval(w);
+        WeakSum<C, W + 1, End>::add(w, sum);
+    }
+};
+
+template <class C, int End>
+struct WeakSum<C, End, End> {
+    static inline void add(const HaarWindow&, double&) {}
+};
+
+// Every stage passed
+template <class C, int S>
+inline int runStages(const HaarWindow&, std::true_type) {
+    return 1;
+}
+
+// Return 1 if window passes all stages, otherwise minus index of rejecting stage
+template <class C, int S>
+inline int runStages(const HaarWindow& w, std::false_type) {
+    double sum = 0;
+    WeakSum<C, C::stageWeakBegin(S), C::stageWeakBegin(S + 1)>::add(w, sum);
+    if (sum < C::stageThreshold(S)) return -S;
+    return runStages<C, S + 1>(w, std::integral_constant<bool, S + 1 == C::stageCount>());
+}
+
+} // namespace haar_detail
+
+template <class Cascade>
+class HaarCascadeDetector {
+
+public:
+    /* Same arguments and result as cv::CascadeClassifier::detectMultiScale */
+    void detectMultiScale(const cv::Mat& image, std::vector<cv::Rect>& objects,
+                          double scaleFactor = 1.1, int minNeighbors = 3,
+                          cv::Size minSize = cv::Size(), cv::Size maxSize = cv::Size()) {
+        objects.clear();
+        CV_Assert(scaleFactor > 1 && image.depth() == CV_8U);
+
+        const cv::Mat* gray = &image;
+        if (image.channels() > 1) {
+            cv::cvtColor(image, gray_, cv::COLOR_BGR2GRAY);
+            gray = &gray_;
+        }
+
+        if (!pyramid_.plan(gray->size(), cv::Size(Cascade::windowWidth, Cascade::windowHeight),
+                           scaleFactor, minSize, maxSize)) {
+            return;
+        }
+        pyramid_.buildAll(*gray);
+        prepare(pyramid_);
+
+        for (size_t i = 0; i < pyramid_.layers().size(); i++) {
+            scanRows(pyramid_, (int) i, 0, pyramid_.layers()[i].rowEnd, objects);
+        }
+        cv::groupRectangles(objects, minNeighbors, 0.2);
+    }
+
+    /* Compute window row offsets for pyramid row step, call before scanRows() */
+    void prepare(const HaarPyramid& pyramid) {
+        for (int y = 0; y <= Cascade::windowHeight; y++) rowOfs_[y] = y * pyramid.step();
+    }
+
+    /* Scan window rows [y0, y1) of one layer and append windows passing every stage
+     * y0 must be a multiple of layer step, rows of one layer can be split between threads */
+    void scanRows(const HaarPyramid& pyramid, int index, int y0, int y1, std::vector<cv::Rect>& candidates) const {
+        const HaarLayer& layer = pyramid.layers()[index];
+        const int* sum = pyramid.sum(index);
+        const uint32_t* sqsum = pyramid.sqsum(index);
+        const int step = pyramid.step();
+        y1 = std::min(y1, layer.rowEnd);
+
+        // Variance is normalized over window shrunk by one pixel on each side
+        const int nw = Cascade::windowWidth - 2, nh = Cascade::windowHeight - 2;
+        const double area = (double) nw * nh;
+        const int n0 = step + 1, n1 = step + 1 + nw, n2 = (nh + 1) * step + 1, n3 = (nh + 1) * step + 1 + nw;
+
+        HaarWindow w;
+        w.rowOfs = rowOfs_;
+        for (int y = y0; y < y1; y += layer.ystep) {
+            for (int x = 0; x < layer.colEnd; x += layer.ystep) {
+                size_t ofs = (size_t) y * step + x;
+                const int* p = sum + ofs;
+                const uint32_t* q = sqsum + ofs;
+
+                // Flat windows are rejected before first stage
+                int valsum = p[n0] - p[n1] - p[n2] + p[n3];
+                uint32_t valsqsum = q[n0] - q[n1] - q[n2] + q[n3];
+                double nf = area * valsqsum - (double) valsum * valsum;
+                if (nf <= 0.) continue;
+                w.varianceNormFactor = (float) (1. / std::sqrt(nf));
+                if (!(area * w.varianceNormFactor < 1e-1)) continue;
+
+                w.sum = p;
+                int result = haar_detail::runStages<Cascade, 0>(w, std::integral_constant<bool, Cascade::stageCount == 0>());
+                if (result > 0) {
+                    candidates.push_back(cv::Rect(cvRound(x * layer.scale), cvRound(y * layer.scale),
+                                                  layer.winSize.width, layer.winSize.height));
+                }
+                // Rejected by the very first stage, neighbour is skipped too
+                if (result == 0) x += layer.ystep;
+            }
+        }
+    }
+
+    HaarPyramid& pyramid() { return pyramid_; }
+
+private:
+    HaarPyramid pyramid_;
+    int rowOfs_[Cascade::windowHeight + 1];
+    cv::Mat gray_;
+};
@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include "bench_util.hpp"
+#include "haar_detector.hpp"
+#include "parallel_haar_detector.hpp"
+#include "frontalface_alt2_cascade.hpp"
+#include "work_stealing_pool.hpp"
+
+// Report scaling of work-stealing multi-scale detection for 1..N threads
+int main(int argc, char **argv) {
+
+    if (argc < 2) {
+        std::cout << "Usage: " << argv[0] << " <image or directory>... [--threads N] [--runs N] [--tile-rows N]" << std::endl;
+        return -1;
+    }
+    int maxThreads = (int) std::max(1u, std::thread::hardware_concurrency());
+    int runs = 10;
+    ParallelScanConfig config;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) maxThreads = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--runs" && i + 1 < argc) runs = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--tile-rows" && i + 1 < argc) config.tileRows = std::atoi(argv[++i]);
+        else {
+            std::vector<cv::String> found;
+            cv::glob(arg, found, false);
+            files.insert(files.end(), found.begin(), found.end());
+        }
+    }
+
+    // A throwing task reaches the caller after every worker left the batch, next batch runs every item
+    int failures = 0;
+    {
+        WorkStealingPool pool(maxThreads);
+        std::atomic<int> ran(0);
+        bool thrown = false;
+        try {
+            pool.run(256, [&](size_t item, int) {
+                if (item == 3) throw std::runtime_error("task failed");
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                ran++;
+            });
+        }
+        catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        check(thrown && ran < 256, "task exception is rethrown by run()", failures);
+        ran = 0;
+        pool.run(256, [&](size_t, int) { ran++; });
+        check(ran == 256, "batch after exception runs every item", failures);
+    }
+
+    std::vector<cv::Mat> images;
+    for (size_t f = 0; f < files.size(); f++) {
+        cv::Mat image = cv::imread(files[f], cv::IMREAD_GRAYSCALE);
+        if (!image.empty()) images.push_back(image);
+    }
+    if (images.empty()) {
+        std::cout << "No readable images" << std::endl;
+        return -1;
+    }
+
+    // Same settings as face_detect.cpp
+    const double scaleFactor = 1.1;
+    const int minNeighbors = 7;
+    const cv::Size minSize(30, 30);
+
+    // Single-threaded scan gives reference detections
+    HaarCascadeDetector<FrontalFaceAlt2Cascade> serial;
+    std::vector<std::vector<cv::Rect>> expected(images.size());
+    for (size_t i = 0; i < images.size(); i++) {
+        serial.detectMultiScale(images[i], expected[i], scaleFactor, minNeighbors, minSize);
+    }
+
+    std::cout << "Images: " << images.size() << ", runs: " << runs << ", tile rows: " << config.tileRows << std::endl;
+    std::cout << "threads    ms/image   images/s   speedup  efficiency   build ms    scan ms   stolen" << std::endl;
+
+    double baseMs = 0.0;
+    int mismatches = 0;
+    std::vector<cv::Rect> faces;
+    for (int threads = 1; threads <= maxThreads; threads++) {
+        config.threads = threads;
+        ParallelHaarDetector<FrontalFaceAlt2Cascade> detector(config);
+
+        for (size_t i = 0; i < images.size(); i++) {
+            detector.detectMultiScale(images[i], faces, scaleFactor, minNeighbors, minSize);
+            if (faces != expected[i]) mismatches++;
+        }
+        detector.pool().resetStats();
+
+        double buildMs = 0.0, scanMs = 0.0;
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < runs; r++) {
+            for (size_t i = 0; i < images.size(); i++) {
+                detector.detectMultiScale(images[i], faces, scaleFactor, minNeighbors, minSize);
+                buildMs += detector.stats().buildMs;
+                scanMs += detector.stats().scanMs;
+            }
+        }
+        double frames = (double) runs * images.size();
+        double ms = elapsedMs(start) / frames;
+        if (threads == 1) baseMs = ms;
+
+        uint64_t stolen = 0;
+        std::vector<WorkerStats> workers = detector.pool().stats();
+        for (size_t w = 0; w < workers.size(); w++) stolen += workers[w].stolen;
+
+        double speedup = baseMs / ms;
+        std::cout << std::setw(7) << threads << std::fixed << std::setprecision(3)
+                  << std::setw(11) << ms
+                  << std::setw(11) << 1000.0 / ms
+                  << std::setw(10) << speedup
+                  << std::setw(12) << speedup / threads
+                  << std::setw(11) << buildMs / frames
+                  << std::setw(11) << scanMs / frames
+                  << std::setw(9) << stolen << std::endl;
+    }
+
+    std::cout << "Mismatches against single-threaded scan: " << mismatches << std::endl;
+    return mismatches == 0 && failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,247 @@
+#include "motion_gate.hpp"
+#include <algorithm>
+#include <chrono>
+#include <opencv2/imgproc.hpp>
+
+// Milliseconds elapsed since start
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    std::chrono::duration<double, std::milli> diff = std::chrono::steady_clock::now() - start;
+    return diff.count();
+}
+
+const char* gateDecisionName(GateDecision decision) {
+    switch (decision) {
+        case GateDecision::Reuse: return "reuse";
+        case GateDecision::Tiles: return "tiles";
+        default: return "full";
+    }
+}
+
+MotionGate::MotionGate(FaceDetectorSession& session, const MotionGateConfig& config)
+    : session_(session), config_(config) {
+    if (config_.sampleWidth < 8) config_.sampleWidth = 8;
+    if (config_.tileSize < 1) config_.tileSize = 1;
+    if (config_.refreshEvery < 1) config_.refreshEvery = 1;
+}
+
+void MotionGate::reset() {
+    previous_.clear();
+    reference_.release();
+    sinceFull_ = 0;
+}
+
+void MotionGate::measure() {
+    int w = std::min(config_.sampleWidth, gray_.cols);
+    int h = std::max(1, cvRound((double) gray_.rows * w / gray_.cols));
+    cv::resize(gray_, sample_, cv::Size(w, h), 0, 0, cv::INTER_AREA);
+
+    int tx = (w + config_.tileSize - 1) / config_.tileSize;
+    int ty = (h + config_.tileSize - 1) / config_.tileSize;
+    changed_.create(ty, tx, CV_8U);
+    last_.tiles = tx * ty;
+
+    // No reference yet, everything counts as changed
+    if (reference_.size() != sample_.size()) {
+        changed_.setTo(255);
+        last_.changedTiles = last_.tiles;
+        last_.score = 255.0;
+        return;
+    }
+
+    // Sum of absolute differences per tile of downscaled frame
+    cv::absdiff(sample_, reference_, diff_);
+    uint64_t total = 0;
+    last_.changedTiles = 0;
+    for (int ti = 0; ti < ty; ti++) {
+        for (int tj = 0; tj < tx; tj++) {
+            int y0 = ti * config_.tileSize, y1 = std::min(y0 + config_.tileSize, h);
+            int x0 = tj * config_.tileSize, x1 = std::min(x0 + config_.tileSize, w);
+            uint32_t sad = 0;
+            for (int y = y0; y < y1; y++) {
+                const uchar* d = diff_.ptr<uchar>(y);
+                for (int x = x0; x < x1; x++) sad += d[x];
+            }
+            total += sad;
+            bool changed = sad >= config_.tileThreshold * (y1 - y0) * (x1 - x0);
+            changed_.at<uchar>(ti, tj) = changed ? 255 : 0;
+            if (changed) last_.changedTiles++;
+        }
+    }
+    last_.score = (double) total / (double) (w * h);
+}
+
+void MotionGate::searchFull(std::vector<cv::Rect>& faces) {
+    auto start = std::chrono::steady_clock::now();
+    session_.detect(gray_, faces);
+    last_.detectMs = elapsedMs(start);
+    last_.pixelsScanned = (uint64_t) gray_.total();
+    stats_.fullMs += last_.detectMs;
+
+    sample_.copyTo(reference_);
+    sinceFull_ = 0;
+}
+
+void MotionGate::searchTiles(std::vector<cv::Rect>& faces) {
+    // Neighbouring tiles are searched too, a face may straddle tile borders
+    cv::Mat grown;
+    cv::dilate(changed_, grown, cv::Mat());
+    cv::findContours(grown, regions_, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
+
+    double scale = (double) gray_.cols / (double) sample_.cols;
+    cv::Rect frameRect(0, 0, gray_.cols, gray_.rows);
+    std::vector<cv::Rect> windows;
+    for (size_t i = 0; i < regions_.size(); i++) {
+        cv::Rect tiles = cv::boundingRect(regions_[i]);
+        cv::Rect window(cvFloor(tiles.x * config_.tileSize * scale), cvFloor(tiles.y * config_.tileSize * scale),
+                        cvCeil(tiles.width * config_.tileSize * scale), cvCeil(tiles.height * config_.tileSize * scale));
+
+        // Known faces touching changed region are searched as a whole, with room to move
+        for (size_t f = 0; f < previous_.size(); f++) {
+            if ((previous_[f] & window).area() == 0) continue;
+            const cv::Rect& face = previous_[f];
+            window |= cv::Rect(face.x - face.width / 4, face.y - face.height / 4,
+                               face.width + face.width / 2, face.height + face.height / 2);
+        }
+        windows.push_back(window & frameRect);
+    }
+
+    // Merge overlapping windows so no face is found twice
+    for (bool merged = true; merged; ) {
+        merged = false;
+        for (size_t i = 0; i < windows.size() && !merged; i++) {
+            for (size_t j = i + 1; j < windows.size(); j++) {
+                if ((windows[i] & windows[j]).area() == 0) continue;
+                windows[i] |= windows[j];
+                windows.erase(windows.begin() + j);
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    // Faces outside every window did not change
+    faces.clear();
+    for (size_t f = 0; f < previous_.size(); f++) {
+        bool searched = false;
+        for (size_t i = 0; i < windows.size(); i++) searched = searched || (previous_[f] & windows[i]).area() > 0;
+        if (!searched) faces.push_back(previous_[f]);
+    }
+
+    const cv::Size& minSize = session_.params().minSize;
+    auto start = std::chrono::steady_clock::now();
+    last_.pixelsScanned = 0;
+    for (size_t i = 0; i < windows.size(); i++) {
+        const cv::Rect& window = windows[i];
+        if (window.width >= minSize.width && window.height >= minSize.height) {
+            // Single channel ROI is passed to detectMultiScale without copy
+            session_.detect(gray_(window), found_);
+            for (size_t f = 0; f < found_.size(); f++) faces.push_back(found_[f] + window.tl());
+            last_.pixelsScanned += (uint64_t) window.area();
+
+            // Searched part of reference is brought up to date
+            // Windows below minSize stay changed, so a face entering slowly is searched once it is big enough
+            cv::Rect area(cvFloor(window.x / scale), cvFloor(window.y / scale),
+                          cvCeil(window.width / scale), cvCeil(window.height / scale));
+            area &= cv::Rect(0, 0, sample_.cols, sample_.rows);
+            sample_(area).copyTo(reference_(area));
+        }
+    }
+    last_.detectMs = elapsedMs(start);
+}
+
+// Face counts as found when a gated box overlaps it by half of their union
+int MotionGate::audit(const std::vector<cv::Rect>& faces) {
+    session_.detect(gray_, audit_);
+    int missed = 0;
+    for (size_t i = 0; i < audit_.size(); i++) {
+        bool found = false;
+        for (size_t j = 0; j < faces.size() && !found; j++) {
+            int overlap = (audit_[i] & faces[j]).area();
+            found = overlap * 2 >= audit_[i].area() + faces[j].area() - overlap;
+        }
+        if (!found) missed++;
+    }
+    stats_.auditedFaces += audit_.size();
+    stats_.missedFaces += (uint64_t) missed;
+    return missed;
+}
+
+void MotionGate::detect(const cv::Mat& frame, std::vector<cv::Rect>& faces) {
+    faces.clear();
+    if (frame.empty()) return;
+
+    // Convert to grayscale once, shared by gate and detector
+    if (frame.channels() == 1) gray_ = frame;
+    else cv::cvtColor(frame, gray_, cv::COLOR_BGR2GRAY);
+
+    stats_.frames++;
+    last_.detectMs = 0.0;
+    last_.pixelsScanned = 0;
+    last_.missed = -1;
+    measure();
+
+    // Static scene reuses last faces, periodic refresh bounds drift
+    bool refresh = sinceFull_ + 1 >= config_.refreshEvery;
+    if (last_.changedTiles == last_.tiles || refresh ||
+        last_.changedTiles >= config_.fullFraction * last_.tiles) {
+        last_.decision = GateDecision::Full;
+    }
+    else if (last_.score < config_.frameThreshold || last_.changedTiles == 0) {
+        last_.decision = GateDecision::Reuse;
+    }
+    else {
+        last_.decision = GateDecision::Tiles;
+    }
+
+    switch (last_.decision) {
+        case GateDecision::Reuse:
+            faces = previous_;
+            sinceFull_++;
+            stats_.reused++;
+            break;
+        case GateDecision::Tiles:
+            searchTiles(faces);
+            sinceFull_++;
+            stats_.tiled++;
+            break;
+        case GateDecision::Full:
+            searchFull(faces);
+            stats_.full++;
+            break;
+    }
+
+    // Full detections are their own reference
+    if (config_.audit && last_.decision == GateDecision::Full) {
+        last_.missed = 0;
+        stats_.auditedFaces += faces.size();
+    }
+    else if (config_.audit) {
+        last_.missed = audit(faces);
+    }
+
+    stats_.pixelsScanned += last_.pixelsScanned;
+    stats_.framePixels += (uint64_t) gray_.total();
+    stats_.detectMs += last_.detectMs;
+    previous_ = faces;
+
+    if (gray_.data == frame.data) gray_.release();
+}
+
+void MotionGate::printStats(std::ostream& out) const {
+    if (stats_.frames == 0) return;
+
+    // Cost of detecting every frame estimated from full-frame detections
+    double fullAvg = stats_.full ? stats_.fullMs / stats_.full : 0.0;
+    double baseline = fullAvg * stats_.frames;
+
+    out << "Motion gate: frames=" << stats_.frames
+        << " reuse=" << stats_.reused
+        << " tiles=" << stats_.tiled
+        << " full=" << stats_.full
+        << " pixelsSaved=" << stats_.pixelsSaved() << std::endl;
+    out << "Detection time: " << stats_.detectMs / stats_.frames << " ms/frame, every-frame estimate "
+        << fullAvg << " ms/frame, saved " << (baseline > 0 ? 1.0 - stats_.detectMs / baseline : 0.0) << std::endl;
+    if (config_.audit) {
+        out << "Audit: faces=" << stats_.auditedFaces << " missed=" << stats_.missedFaces << std::endl;
+    }
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <opencv2/core.hpp>
+#include "face_detector_session.hpp"
+
+// Motion gate settings
+struct MotionGateConfig {
+    // Frames are compared after downscaling to this width
+    int sampleWidth = 80;
+    // Side of a change tile in downscaled pixels
+    int tileSize = 8;
+    // Mean absolute difference (0-255) of whole frame below which last faces are reused
+    double frameThreshold = 1.5;
+    // Mean absolute difference (0-255) of a tile to count it as changed
+    double tileThreshold = 6.0;
+    // Search whole frame when this fraction of tiles changed
+    double fullFraction = 0.5;
+    // Run full detection at least every N frames so slow changes are not missed forever
+    int refreshEvery = 30;
+    // Also run full detection on gated frames and count faces the gate missed
+    bool audit = false;
+};
+
+// What the gate did with a frame
+enum class GateDecision {
+    // Nothing changed, last faces are returned
+    Reuse,
+    // Only changed regions were searched
+    Tiles,
+    // Whole frame was searched
+    Full
+};
+
+const char* gateDecisionName(GateDecision decision);
+
+// Gate result of one frame
+struct GateFrame {
+    GateDecision decision = GateDecision::Full;
+    // Mean absolute difference to reference frame, 0-255
+    double score = 0.0;
+    int changedTiles = 0;
+    int tiles = 0;
+    uint64_t pixelsScanned = 0;
+    double detectMs = 0.0;
+    // Faces found by full detection but not by gate, -1 without audit
+    int missed = -1;
+};
+
+// Decision and work counters
+struct MotionGateStats {
+    uint64_t frames = 0;
+    uint64_t reused = 0;
+    uint64_t tiled = 0;
+    uint64_t full = 0;
+    uint64_t pixelsScanned = 0;
+    uint64_t framePixels = 0;
+    double detectMs = 0.0;
+    double fullMs = 0.0;
+    // audit mode only
+    uint64_t auditedFaces = 0;
+    uint64_t missedFaces = 0;
+
+    /* Fraction of frame pixels never passed to the detector */
+    double pixelsSaved() const { return framePixels ? 1.0 - (double) pixelsScanned / (double) framePixels : 0.0; }
+};
+
+// Skip detection on frames without scene change
+// Every frame is downscaled and compared to the frame last faces come from.
+// Below frameThreshold last faces are reused, otherwise only regions of
+// changed tiles are searched (whole frame when most tiles changed) and known
+// faces outside of them are kept.
+class MotionGate {
+
+public:
+    MotionGate(FaceDetectorSession& session, const MotionGateConfig& config = MotionGateConfig());
+
+    /* Detect faces in BGR(A) or grayscale frame, detection is skipped or limited by scene change */
+    void detect(const cv::Mat& frame, std::vector<cv::Rect>& faces);
+
+    /* Forget reference frame and faces, next frame is searched fully */
+    void reset();
+
+    /* Decision and score of last frame */
+    const GateFrame& last() const { return last_; }
+
+    /* Faces returned for last frame */
+    const std::vector<cv::Rect>& lastFaces() const { return previous_; }
+
+    MotionGateConfig& config() { return config_; }
+    const MotionGateStats& stats() const { return stats_; }
+    void printStats(std::ostream& out) const;
+
+private:
+    /* Compare downscaled frame to reference, fill changed tile mask */
+    void measure();
+    void searchFull(std::vector<cv::Rect>& faces);
+    void searchTiles(std::vector<cv::Rect>& faces);
+    /* Count faces of full detection without a match in faces */
+    int audit(const std::vector<cv::Rect>& faces);
+
+    FaceDetectorSession& session_;
+    MotionGateConfig config_;
+    MotionGateStats stats_;
+    GateFrame last_;
+    std::vector<cv::Rect> previous_;
+    int sinceFull_ = 0;
+
+    // Reusable per-frame buffers
+    cv::Mat gray_;
+    cv::Mat sample_;
+    cv::Mat reference_;
+    cv::Mat diff_;
+    cv::Mat changed_;
+    std::vector<std::vector<cv::Point>> regions_;
+    std::vector<cv::Rect> found_;
+    std::vector<cv::Rect> audit_;
+};
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+#include "haar_detector.hpp"
+#include "work_stealing_pool.hpp"
+
+// Multi-scale scan settings
+struct ParallelScanConfig {
+    // Worker threads, 0 uses every hardware thread
+    int threads = 0;
+    // Window rows per work item, small layers become a single item
+    int tileRows = 16;
+};
+
+// Work done for last frame
+struct ParallelScanStats {
+    size_t layers = 0;
+    size_t tiles = 0;
+    double buildMs = 0.0;
+    double scanMs = 0.0;
+};
+
+// Multi-scale Haar detection on a work-stealing pool
+//
+// Pyramid integrals are built once per frame into HaarPyramid's reusable
+// buffers (one work item per layer), then every layer is cut into bands of
+// window rows and (layer, band) items are scanned in parallel. Candidates are
+// merged in item order and grouped with cv::groupRectangles, so the result is
+// the same as HaarCascadeDetector and CascadeClassifier::detectMultiScale.
+template <class Cascade>
+class ParallelHaarDetector {
+
+public:
+    explicit ParallelHaarDetector(const ParallelScanConfig& config = ParallelScanConfig())
+        : config_(config), pool_(config.threads) {
+        if (config_.tileRows < 1) config_.tileRows = 1;
+        resized_.resize(pool_.threads());
+    }
+
+    /* Same arguments and result as cv::CascadeClassifier::detectMultiScale */
+    void detectMultiScale(const cv::Mat& image, std::vector<cv::Rect>& objects,
+                          double scaleFactor = 1.1, int minNeighbors = 3,
+                          cv::Size minSize = cv::Size(), cv::Size maxSize = cv::Size()) {
+        objects.clear();
+        CV_Assert(scaleFactor > 1 && image.depth() == CV_8U);
+
+        const cv::Mat* gray = &image;
+        if (image.channels() > 1) {
+            cv::cvtColor(image, gray_, cv::COLOR_BGR2GRAY);
+            gray = &gray_;
+        }
+
+        HaarPyramid& pyramid = detector_.pyramid();
+        stats_ = ParallelScanStats();
+        if (!pyramid.plan(gray->size(), cv::Size(Cascade::windowWidth, Cascade::windowHeight),
+                          scaleFactor, minSize, maxSize)) {
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        buildPyramid(*gray);
+        auto built = std::chrono::steady_clock::now();
+        scan(objects);
+        auto scanned = std::chrono::steady_clock::now();
+
+        stats_.buildMs = std::chrono::duration<double, std::milli>(built - start).count();
+        stats_.scanMs = std::chrono::duration<double, std::milli>(scanned - built).count();
+        cv::groupRectangles(objects, minNeighbors, 0.2);
+    }
+
+    int threads() const { return pool_.threads(); }
+    const ParallelScanStats& stats() const { return stats_; }
+    const WorkStealingPool& pool() const { return pool_; }
+    WorkStealingPool& pool() { return pool_; }
+
+private:
+    // One item per layer, each worker resizes into its own buffer
+    void buildPyramid(const cv::Mat& gray) {
+        HaarPyramid& pyramid = detector_.pyramid();
+        stats_.layers = pyramid.layers().size();
+        pool_.run(pyramid.layers().size(), [&](size_t layer, int worker) {
+            pyramid.build(gray, (int) layer, resized_[worker]);
+        });
+        detector_.prepare(pyramid);
+    }
+
+    // Cut layers into bands of window rows and scan them in parallel
+    void scan(std::vector<cv::Rect>& objects) {
+        const HaarPyramid& pyramid = detector_.pyramid();
+        tiles_.clear();
+        for (size_t i = 0; i < pyramid.layers().size(); i++) {
+            const HaarLayer& layer = pyramid.layers()[i];
+            int band = config_.tileRows * layer.ystep;
+            for (int y = 0; y < layer.rowEnd; y += band) {
+                Tile tile = {(int) i, y, std::min(y + band, layer.rowEnd)};
+                tiles_.push_back(tile);
+            }
+        }
+        stats_.tiles = tiles_.size();
+
+        // Per-tile results keep serial candidate order whichever worker ran the tile
+        if (found_.size() < tiles_.size()) found_.resize(tiles_.size());
+        pool_.run(tiles_.size(), [&](size_t t, int) {
+            found_[t].clear();
+            detector_.scanRows(pyramid, tiles_[t].layer, tiles_[t].y0, tiles_[t].y1, found_[t]);
+        });
+        for (size_t t = 0; t < tiles_.size(); t++) objects.insert(objects.end(), found_[t].begin(), found_[t].end());
+    }
+
+    struct Tile {
+        int layer;
+        int y0;
+        int y1;
+    };
+
+    ParallelScanConfig config_;
+    WorkStealingPool pool_;
+    HaarCascadeDetector<Cascade> detector_;
+    ParallelScanStats stats_;
+
+    // Reusable per-frame buffers
+    cv::Mat gray_;
+    std::vector<cv::Mat> resized_;
+    std::vector<Tile> tiles_;
+    std::vector<std::vector<cv::Rect>> found_;
+};
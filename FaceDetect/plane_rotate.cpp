@@ -0,0 +1,113 @@
+#include "plane_rotate.hpp"
+#include <algorithm>
+#include <opencv2/core/hal/intrin.hpp>
+
+// Tile transposed in registers and cache block made of tiles
+static const int TILE = 16;
+static const int BLOCK = 64;
+
+// Rotation in 0, 90, 180, 270, or -1 if not a multiple of 90
+static int normalizeRotation(int rotationDegrees) {
+    if (rotationDegrees % 90 != 0) return -1;
+    return ((rotationDegrees % 360) + 360) % 360;
+}
+
+cv::Size rotatedSize(cv::Size size, int rotationDegrees) {
+    int rotation = normalizeRotation(rotationDegrees);
+    return rotation == 90 || rotation == 270 ? cv::Size(size.height, size.width) : size;
+}
+
+#if CV_SIMD128
+// Transpose 16x16 bytes, row j of result is column j of r
+// Rows are interleaved in pairs, quads and octets, halves of octets are joined last
+static inline void transpose16x16(const cv::v_uint8x16 r[TILE], cv::v_uint8x16 t[TILE]) {
+    using namespace cv;
+    // Row pairs: [pair][cols 0-7, 8-15]
+    v_uint8x16 s1[8][2];
+    for (int p = 0; p < 8; p++) v_zip(r[2 * p], r[2 * p + 1], s1[p][0], s1[p][1]);
+
+    // Row quads: [quad][column group of 4]
+    v_uint8x16 s2[4][4];
+    for (int q = 0; q < 4; q++) {
+        for (int h = 0; h < 2; h++) {
+            v_uint16x8 lo, hi;
+            v_zip(v_reinterpret_as_u16(s1[2 * q][h]), v_reinterpret_as_u16(s1[2 * q + 1][h]), lo, hi);
+            s2[q][2 * h] = v_reinterpret_as_u8(lo);
+            s2[q][2 * h + 1] = v_reinterpret_as_u8(hi);
+        }
+    }
+
+    // Row octets: [octet][column pair]
+    v_uint8x16 s3[2][8];
+    for (int o = 0; o < 2; o++) {
+        for (int k = 0; k < 4; k++) {
+            v_uint32x4 lo, hi;
+            v_zip(v_reinterpret_as_u32(s2[2 * o][k]), v_reinterpret_as_u32(s2[2 * o + 1][k]), lo, hi);
+            s3[o][2 * k] = v_reinterpret_as_u8(lo);
+            s3[o][2 * k + 1] = v_reinterpret_as_u8(hi);
+        }
+    }
+
+    // Rows 0-7 and 8-15 of each column
+    for (int m = 0; m < 8; m++) {
+        t[2 * m] = v_combine_low(s3[0][m], s3[1][m]);
+        t[2 * m + 1] = v_combine_high(s3[0][m], s3[1][m]);
+    }
+}
+#endif
+
+// Rotate rows [y0, y1) x columns [x0, x1) of src by 90 (clockwise) or 270 degrees
+static void rotateBlock(const cv::Mat& src, cv::Mat& dst, bool clockwise, int y0, int y1, int x0, int x1) {
+    const int H = src.rows, W = src.cols;
+    for (int ty = y0; ty < y1; ty += TILE) {
+        for (int tx = x0; tx < x1; tx += TILE) {
+            int th = std::min(TILE, y1 - ty), tw = std::min(TILE, x1 - tx);
+#if CV_SIMD128
+            if (th == TILE && tw == TILE) {
+                // Clockwise: source rows are loaded bottom up so transposed rows come out mirrored
+                cv::v_uint8x16 r[TILE], t[TILE];
+                for (int i = 0; i < TILE; i++) {
+                    r[i] = cv::v_load(src.ptr<uchar>(clockwise ? ty + TILE - 1 - i : ty + i) + tx);
+                }
+                transpose16x16(r, t);
+                for (int j = 0; j < TILE; j++) {
+                    if (clockwise) cv::v_store(dst.ptr<uchar>(tx + j) + H - TILE - ty, t[j]);
+                    else cv::v_store(dst.ptr<uchar>(W - 1 - tx - j) + ty, t[j]);
+                }
+                continue;
+            }
+#endif
+            // Partial tile on right and bottom border
+            for (int y = ty; y < ty + th; y++) {
+                const uchar* S = src.ptr<uchar>(y);
+                for (int x = tx; x < tx + tw; x++) {
+                    if (clockwise) dst.ptr<uchar>(x)[H - 1 - y] = S[x];
+                    else dst.ptr<uchar>(W - 1 - x)[y] = S[x];
+                }
+            }
+        }
+    }
+}
+
+bool rotatePlane(const cv::Mat& src, cv::Mat& dst, int rotationDegrees) {
+    int rotation = normalizeRotation(rotationDegrees);
+    if (rotation < 0 || src.type() != CV_8UC1) return false;
+
+    if (rotation == 0) {
+        src.copyTo(dst);
+        return true;
+    }
+    dst.create(rotatedSize(src.size(), rotation), CV_8UC1);
+    if (rotation == 180) {
+        cv::flip(src, dst, -1);
+        return true;
+    }
+
+    bool clockwise = rotation == 90;
+    for (int by = 0; by < src.rows; by += BLOCK) {
+        for (int bx = 0; bx < src.cols; bx += BLOCK) {
+            rotateBlock(src, dst, clockwise, by, std::min(by + BLOCK, src.rows), bx, std::min(bx + BLOCK, src.cols));
+        }
+    }
+    return true;
+}
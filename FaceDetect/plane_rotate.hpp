@@ -0,0 +1,17 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+
+// Rotate 8-bit single channel frame clockwise by 90, 180 or 270 degrees
+//
+// Replaces transpose + flip, which allocated two full-frame Mats per frame on
+// Android, with one pass into a buffer reused between frames. Result is the
+// same as cv::rotate(). For 90 and 270 the frame is cut into 16x16 tiles that
+// are transposed in SIMD registers, tiles are visited in 64x64 blocks so
+// source and destination rows of a block stay in L1.
+// 0 degrees copies src. dst must not share memory with src.
+// Return false if src is not CV_8UC1 or rotation is not a multiple of 90.
+bool rotatePlane(const cv::Mat& src, cv::Mat& dst, int rotationDegrees);
+
+/* Size of frame after clockwise rotation */
+cv::Size rotatedSize(cv::Size size, int rotationDegrees);
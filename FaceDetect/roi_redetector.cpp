@@ -0,0 +1,114 @@
+#include "roi_redetector.hpp"
+#include <algorithm>
+#include <opencv2/imgproc.hpp>
+
+RoiRedetector::RoiRedetector(FaceDetectorSession& session, const RoiSearchConfig& config)
+    : session_(session), config_(config) {
+    if (config_.refreshEvery < 1) config_.refreshEvery = 1;
+}
+
+void RoiRedetector::reset() {
+    previous_.clear();
+    sinceFull_ = 0;
+}
+
+void RoiRedetector::beginFrame() {
+    stats_.frames++;
+    stats_.lastFramePixels = 0;
+}
+
+void RoiRedetector::endFrame() {
+    stats_.pixelsScanned += stats_.lastFramePixels;
+}
+
+bool RoiRedetector::searchAround(const cv::Mat& gray, const cv::Rect& previous, cv::Rect& found) {
+    const FaceDetectorParams& params = session_.params();
+
+    // Only look for faces of about the same size as before
+    // but never below configured minimum size
+    cv::Size minSize((int) (previous.width * (1.0 - config_.sizeBand)),
+                     (int) (previous.height * (1.0 - config_.sizeBand)));
+    cv::Size maxSize((int) (previous.width * (1.0 + config_.sizeBand)) + 1,
+                     (int) (previous.height * (1.0 + config_.sizeBand)) + 1);
+    minSize.width = std::max(minSize.width, params.minSize.width);
+    minSize.height = std::max(minSize.height, params.minSize.height);
+    maxSize.width = std::max(maxSize.width, minSize.width);
+    maxSize.height = std::max(maxSize.height, minSize.height);
+
+    // Expand previous box around its center, window must fit the biggest allowed face
+    int w = std::max((int) (previous.width * config_.searchScale), maxSize.width);
+    int h = std::max((int) (previous.height * config_.searchScale), maxSize.height);
+    cv::Rect window(previous.x + previous.width / 2 - w / 2,
+                    previous.y + previous.height / 2 - h / 2, w, h);
+    window &= cv::Rect(0, 0, gray.cols, gray.rows);
+
+    if (window.width < minSize.width || window.height < minSize.height) {
+        stats_.misses++;
+        return false;
+    }
+
+    // Single channel ROI is passed to detectMultiScale without copy
+    session_.detect(gray(window), found_, minSize, maxSize);
+    stats_.lastFramePixels += (uint64_t) window.area();
+
+    if (found_.empty()) {
+        stats_.misses++;
+        return false;
+    }
+
+    // Keep the biggest candidate inside the window
+    size_t best = 0;
+    for ( size_t i = 1; i < found_.size(); i++ ) {
+        if (found_[i].area() > found_[best].area()) best = i;
+    }
+    found = found_[best] + window.tl();
+    stats_.hits++;
+    return true;
+}
+
+void RoiRedetector::searchFull(std::vector<cv::Rect>& faces) {
+    session_.detect(gray_, faces);
+    sinceFull_ = 0;
+    stats_.fullFrameSearches++;
+    stats_.lastFramePixels += (uint64_t) gray_.total();
+}
+
+void RoiRedetector::detect(const cv::Mat& frame, std::vector<cv::Rect>& faces) {
+    faces.clear();
+    if (frame.empty()) return;
+
+    // Convert to grayscale once, shared by every search window
+    if (frame.channels() == 1) gray_ = frame;
+    else cv::cvtColor(frame, gray_, cv::COLOR_BGR2GRAY);
+
+    beginFrame();
+
+    // Search around every previous face first, periodic full search finds faces that entered meanwhile
+    bool full = previous_.empty() || ++sinceFull_ >= config_.refreshEvery;
+    for ( size_t i = 0; i < previous_.size() && !full; i++ ) {
+        cv::Rect found;
+        if (searchAround(gray_, previous_[i], found)) faces.push_back(found);
+        else full = true;
+    }
+
+    // Fall back to full frame, a face may have moved out of its window
+    // or a new face may have appeared
+    if (full) {
+        faces.clear();
+        searchFull(faces);
+    }
+
+    endFrame();
+    previous_ = faces;
+
+    if (gray_.data == frame.data) gray_.release();
+}
+
+void RoiRedetector::printStats(std::ostream& out) const {
+    out << "ROI re-detection: frames=" << stats_.frames
+        << " hits=" << stats_.hits
+        << " misses=" << stats_.misses
+        << " hitRate=" << stats_.hitRate()
+        << " fullFrame=" << stats_.fullFrameSearches
+        << " pixels/frame=" << stats_.pixelsPerFrame() << std::endl;
+}
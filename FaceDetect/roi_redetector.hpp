@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <opencv2/core.hpp>
+#include "face_detector_session.hpp"
+
+// Search window settings for re-detection around previous faces
+struct RoiSearchConfig {
+    // Search window around previous box, as multiple of box size
+    double searchScale = 1.5;
+    // Face size may change by this fraction between two frames
+    double sizeBand = 0.25;
+    // detect() searches the full frame at least every N frames, so faces entering
+    // while known faces keep being found are picked up
+    int refreshEvery = 10;
+};
+
+// Hit/miss and scanned area counters
+struct RoiSearchStats {
+    uint64_t frames = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t fullFrameSearches = 0;
+    uint64_t pixelsScanned = 0;
+    uint64_t lastFramePixels = 0;
+
+    double hitRate() const { return hits + misses ? (double) hits / (double) (hits + misses) : 0.0; }
+    double pixelsPerFrame() const { return frames ? (double) pixelsScanned / (double) frames : 0.0; }
+};
+
+// Re-detect faces only around their previous position
+// Each previous box is searched in an expanded window with a narrow
+// minSize/maxSize band, full frame is searched when a face is missed,
+// nothing was found before or refreshEvery frames passed since last full search.
+class RoiRedetector {
+
+public:
+    RoiRedetector(FaceDetectorSession& session, const RoiSearchConfig& config = RoiSearchConfig());
+
+    /* Detect faces in BGR(A) or grayscale frame, previous result is used as search hint */
+    void detect(const cv::Mat& frame, std::vector<cv::Rect>& faces);
+
+    /* Search one window around previous box in grayscale frame
+     * Return false if no face of similar size is found
+     * Callers outside detect() wrap the searches of a frame in beginFrame() / endFrame() */
+    bool searchAround(const cv::Mat& gray, const cv::Rect& previous, cv::Rect& found);
+
+    /* Count a new frame and reset its scanned pixels */
+    void beginFrame();
+
+    /* Add scanned pixels of current frame to totals */
+    void endFrame();
+
+    /* Forget previous faces, next frame is searched fully */
+    void reset();
+
+    RoiSearchConfig& config() { return config_; }
+    const RoiSearchStats& stats() const { return stats_; }
+    void printStats(std::ostream& out) const;
+
+private:
+    void searchFull(std::vector<cv::Rect>& faces);
+
+    FaceDetectorSession& session_;
+    RoiSearchConfig config_;
+    RoiSearchStats stats_;
+    std::vector<cv::Rect> previous_;
+    int sinceFull_ = 0;
+
+    // Reusable per-frame buffers
+    cv::Mat gray_;
+    std::vector<cv::Rect> found_;
+};
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+#include "bench_util.hpp"
+#include "face_core.hpp"
+#include "plane_rotate.hpp"
+
+// Random Y plane with rows padded to stride, like ImageProxy.planes[0]
+static cv::Mat syntheticPlane(cv::Size size, int padding, cv::Mat& storage) {
+    storage.create(size.height, size.width + padding, CV_8UC1);
+    cv::randu(storage, cv::Scalar::all(0), cv::Scalar::all(256));
+    return storage(cv::Rect(0, 0, size.width, size.height));
+}
+
+// Former Kotlin path: Core.flip(mat.t(), rotatedMat, ...), two new Mats every frame
+static cv::Mat transposeFlip(const cv::Mat& frame, int rotationDegrees) {
+    cv::Mat rotated;
+    switch (rotationDegrees) {
+        case 90: cv::flip(frame.t(), rotated, 1); break;
+        case 180: cv::flip(frame, rotated, -1); break;
+        case 270: cv::flip(frame.t(), rotated, 0); break;
+        default: rotated = frame.clone(); break;
+    }
+    return rotated;
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " [image] [options]\n"
+              << "  image        upright face photo, detection through rotated buffers is compared\n"
+              << "  --model FILE Haar Cascade .xml (default haarcascade_frontalface_alt2.xml)\n"
+              << "  --runs N     timed runs per case, median is reported (default 200)" << std::endl;
+}
+
+// Check blocked rotation against cv::rotate and compare with transpose + flip at camera resolutions
+int main(int argc, char **argv) {
+
+    std::string input, model;
+    int runs = 200;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--runs" && i + 1 < argc) runs = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--model" && i + 1 < argc) model = argv[++i];
+        else if (input.empty() && !arg.empty() && arg[0] != '-') input = arg;
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    const int rotations[] = {90, 180, 270};
+    const cv::RotateFlags flags[] = {cv::ROTATE_90_CLOCKWISE, cv::ROTATE_180, cv::ROTATE_90_COUNTERCLOCKWISE};
+
+    int failures = 0;
+    std::cout << "Rotation checks" << std::endl;
+    {
+        // Sizes that are not multiples of tile and block, padded rows
+        const cv::Size sizes[] = {cv::Size(16, 16), cv::Size(17, 33), cv::Size(100, 37), cv::Size(641, 479), cv::Size(1280, 720)};
+        bool exact = true, kotlin = true;
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            cv::Mat storage;
+            cv::Mat plane = syntheticPlane(sizes[s], 48, storage);
+            for (int r = 0; r < 3; r++) {
+                cv::Mat expected, rotated;
+                cv::rotate(plane, expected, flags[r]);
+                exact = exact && rotatePlane(plane, rotated, rotations[r]) && same(rotated, expected);
+                kotlin = kotlin && same(rotated, transposeFlip(plane, rotations[r]));
+            }
+        }
+        check(exact, "90, 180 and 270 match cv::rotate on padded odd sizes", failures);
+        check(kotlin, "match former Core.flip(mat.t()) rotation", failures);
+
+        cv::Mat storage, rotated, expected;
+        cv::Mat plane = syntheticPlane(cv::Size(640, 480), 0, storage);
+        rotatePlane(plane, rotated, 90);
+        const uchar* buffer = rotated.data;
+        rotatePlane(plane, rotated, 270);
+        check(rotated.data == buffer, "destination buffer reused between frames", failures);
+        cv::rotate(plane, expected, cv::ROTATE_90_CLOCKWISE);
+        check(rotatePlane(plane, rotated, -270) && same(rotated, expected), "-270 is 90", failures);
+        check(!rotatePlane(plane, rotated, 45), "45 degrees rejected", failures);
+        check(!rotatePlane(cv::Mat(480, 640, CV_8UC3), rotated, 90), "color frame rejected", failures);
+    }
+
+    // Detection on sensor buffer rotated back must find same faces as on upright frame
+    if (!input.empty()) {
+        cv::Mat image = cv::imread(input);
+        if (image.empty()) {
+            std::cout << "Cannot read " << input << std::endl;
+            return -1;
+        }
+        if (model.empty()) model = cv::samples::findFile("haarcascades/haarcascade_frontalface_alt2.xml");
+        FaceCoreDetector detector(model, FaceCoreConfig::preset(FaceCorePreset::Desktop));
+        if (!check(!detector.empty(), "model loads", failures)) return 1;
+
+        cv::Mat upright;
+        cv::cvtColor(image, upright, cv::COLOR_BGR2GRAY);
+        std::vector<cv::Rect> expected, faces;
+        detector.detect(upright, expected);
+        std::cout << "Detection checks (" << expected.size() << " faces upright)" << std::endl;
+        for (int r = 0; r < 3; r++) {
+            // Camera delivers frame rotated counter clockwise by rotationDegrees
+            cv::Mat sensor, sensorBgr;
+            cv::rotate(upright, sensor, flags[2 - r]);
+            cv::rotate(image, sensorBgr, flags[2 - r]);
+            std::ostringstream what;
+            what << rotations[r] << " degrees";
+
+            detector.reset();
+            detector.detect(sensor.data, sensor.cols, sensor.rows, sensor.step, FACECORE_FORMAT_GRAY, rotations[r], faces);
+            check(faces == expected, "gray " + what.str() + " finds upright faces", failures);
+            detector.reset();
+            detector.detect(sensorBgr.data, sensorBgr.cols, sensorBgr.rows, sensorBgr.step, FACECORE_FORMAT_BGR, rotations[r], faces);
+            check(faces == expected, "bgr " + what.str() + " finds upright faces", failures);
+        }
+    }
+
+    const cv::Size resolutions[] = {cv::Size(640, 480), cv::Size(1280, 720), cv::Size(1920, 1080)};
+    std::cout << std::endl << std::left << std::setw(12) << "source" << std::setw(8) << "degrees" << std::right
+              << std::setw(12) << "t+flip" << std::setw(12) << "cv::rotate" << std::setw(12) << "blocked"
+              << std::setw(10) << "speedup" << "  (ms, median)" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    for (size_t s = 0; s < sizeof(resolutions) / sizeof(resolutions[0]); s++) {
+        cv::Mat storage;
+        cv::Mat plane = syntheticPlane(resolutions[s], 0, storage);
+        for (int r = 0; r < 3; r++) {
+            double flipMs = medianMs(runs, [&]() { transposeFlip(plane, rotations[r]); });
+            cv::Mat reused, rotated;
+            double rotateMs = medianMs(runs, [&]() { cv::rotate(plane, reused, flags[r]); });
+            double blockedMs = medianMs(runs, [&]() { rotatePlane(plane, rotated, rotations[r]); });
+
+            std::ostringstream source;
+            source << plane.cols << "x" << plane.rows;
+            std::cout << std::left << std::setw(12) << source.str() << std::setw(8) << rotations[r] << std::right
+                      << std::setw(12) << flipMs << std::setw(12) << rotateMs << std::setw(12) << blockedMs
+                      << std::setw(9) << flipMs / blockedMs << "x" << std::endl;
+        }
+    }
+
+    if (failures) std::cout << "FAILED: " << failures << " checks" << std::endl;
+    else std::cout << "All checks passed" << std::endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,235 @@
+#include "stream_scheduler.hpp"
+#include <algorithm>
+
+// Queue delays above this end up in last histogram bucket
+static const int DELAY_BUCKETS = 1000;
+
+StreamScheduler::StreamScheduler(const std::string& model, const FaceDetectorParams& params,
+                                 const StreamSchedulerConfig& config)
+    : config_(config) {
+    if (config_.workers <= 0) config_.workers = (int) std::max(1u, std::thread::hardware_concurrency());
+    config_.streamQueue = std::max(config_.streamQueue, (size_t) 1);
+    config_.maxInFlight = std::max(config_.maxInFlight, 1);
+
+    FaceDetectorParams workerParams = params;
+    workerParams.detectWidth = config_.detectWidth;
+    for (int i = 0; i < config_.workers; i++) {
+        sessions_.emplace_back(new FaceDetectorSession());
+        sessions_.back()->params() = workerParams;
+        sessions_.back()->load(model);
+    }
+    lastClass_.assign(config_.workers, 0);
+    for (int i = 0; i < config_.workers; i++) threads_.emplace_back(&StreamScheduler::workerLoop, this, i);
+}
+
+StreamScheduler::~StreamScheduler() {
+    stop();
+}
+
+bool StreamScheduler::ready() const {
+    for (size_t i = 0; i < sessions_.size(); i++) {
+        if (sessions_[i]->empty()) return false;
+    }
+    return true;
+}
+
+int StreamScheduler::addStream(const StreamConfig& stream) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    streams_.emplace_back(new Stream());
+    streams_.back()->config = stream;
+    streams_.back()->delayHistogram.assign(DELAY_BUCKETS + 1, 0);
+    return (int) streams_.size() - 1;
+}
+
+int StreamScheduler::streams() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (int) streams_.size();
+}
+
+bool StreamScheduler::submit(int stream, const cv::Mat& frame, int64_t index) {
+    if (frame.empty()) return false;
+    Clock::time_point now = Clock::now();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_ || stream < 0 || stream >= (int) streams_.size()) return false;
+
+        Stream& s = *streams_[stream];
+        if (s.stats.submitted++ == 0) s.first = now;
+        s.stats.size = frame.size();
+
+        // Newest frame is the one worth detecting, replace oldest
+        if (s.queue.size() >= config_.streamQueue) {
+            s.queue.pop_front();
+            s.stats.droppedQueue++;
+        }
+        Job job;
+        job.frame = frame;
+        job.index = index;
+        job.submitted = now;
+        job.deadline = now + std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double, std::milli>(s.config.deadlineMs));
+        s.queue.push_back(std::move(job));
+    }
+    work_.notify_one();
+    return true;
+}
+
+uint64_t StreamScheduler::resolutionClass(const cv::Mat& frame) {
+    return ((uint64_t) frame.cols << 40) | ((uint64_t) frame.rows << 16) | (uint64_t) frame.type();
+}
+
+bool StreamScheduler::hasWork() const {
+    for (size_t i = 0; i < streams_.size(); i++) {
+        if (!streams_[i]->queue.empty() && streams_[i]->inFlight < config_.maxInFlight) return true;
+    }
+    return false;
+}
+
+bool StreamScheduler::pickJob(int worker, Pick& pick) {
+    // Frames which can no longer start in time are dropped before anything is picked
+    Clock::time_point now = Clock::now();
+    for (size_t i = 0; i < streams_.size(); i++) {
+        Stream& s = *streams_[i];
+        while (!s.queue.empty() && s.queue.front().deadline < now) {
+            s.queue.pop_front();
+            s.stats.droppedLate++;
+        }
+    }
+
+    // Earliest deadline among streams of the worker's last class, earliest of any class if none is queued
+    int best = -1;
+    bool bestAffine = false;
+    for (size_t i = 0; i < streams_.size(); i++) {
+        const Stream& s = *streams_[i];
+        if (s.queue.empty() || s.inFlight >= config_.maxInFlight) continue;
+        bool affine = resolutionClass(s.queue.front().frame) == lastClass_[worker];
+        if (best >= 0 && bestAffine && !affine) continue;
+        if (best < 0 || (affine && !bestAffine) || s.queue.front().deadline < streams_[best]->queue.front().deadline) {
+            best = (int) i;
+            bestAffine = affine;
+        }
+    }
+    if (best < 0) return false;
+
+    Stream& s = *streams_[best];
+    pick.stream = best;
+    pick.job = std::move(s.queue.front());
+    s.queue.pop_front();
+    s.inFlight++;
+    return true;
+}
+
+void StreamScheduler::workerLoop(int worker) {
+    FaceDetectorSession& session = *sessions_[worker];
+    Pick pick;
+    std::vector<cv::Rect> faces;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        work_.wait(lock, [this] { return stopping_ || hasWork(); });
+        if (stopping_) return;
+
+        if (!pickJob(worker, pick)) {
+            // Everything queued was late
+            idle_.notify_all();
+            continue;
+        }
+        uint64_t cls = resolutionClass(pick.job.frame);
+        if (cls != lastClass_[worker]) classSwitches_++;
+        lastClass_[worker] = cls;
+        picks_++;
+        busy_++;
+        lock.unlock();
+
+        std::chrono::duration<double, std::milli> delay = Clock::now() - pick.job.submitted;
+        faces.clear();
+        session.detect(pick.job.frame, faces);
+        if (callback_) callback_(pick.stream, pick.job.index, faces);
+        // Release frame before taking the lock, source may be waiting for the buffer
+        pick.job.frame.release();
+
+        lock.lock();
+        Stream& s = *streams_[pick.stream];
+        s.inFlight--;
+        s.stats.processed++;
+        s.stats.faces += faces.size();
+        s.delaySumMs += delay.count();
+        s.stats.delayMaxMs = std::max(s.stats.delayMaxMs, delay.count());
+        s.delayHistogram[std::min((int) delay.count(), DELAY_BUCKETS)]++;
+        busy_--;
+        // Freed in-flight slot may unblock a frame other workers skipped
+        work_.notify_all();
+        idle_.notify_all();
+    }
+}
+
+void StreamScheduler::drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] {
+        if (stopping_) return true;
+        if (busy_ > 0) return false;
+        for (size_t i = 0; i < streams_.size(); i++) {
+            if (!streams_[i]->queue.empty()) return false;
+        }
+        return true;
+    });
+}
+
+void StreamScheduler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        for (size_t i = 0; i < streams_.size(); i++) streams_[i]->queue.clear();
+    }
+    work_.notify_all();
+    idle_.notify_all();
+    for (size_t i = 0; i < threads_.size(); i++) {
+        if (threads_[i].joinable()) threads_[i].join();
+    }
+}
+
+StreamStats StreamScheduler::snapshot(const Stream& stream) const {
+    StreamStats stats = stream.stats;
+    if (stats.submitted > 0) {
+        std::chrono::duration<double> elapsed = Clock::now() - stream.first;
+        if (elapsed.count() > 0) stats.fps = stats.processed / elapsed.count();
+    }
+    if (stats.processed > 0) {
+        stats.delayMeanMs = stream.delaySumMs / stats.processed;
+        uint64_t rank = (stats.processed * 95 + 99) / 100, seen = 0;
+        for (int i = 0; i <= DELAY_BUCKETS; i++) {
+            seen += stream.delayHistogram[i];
+            if (seen >= rank) {
+                // Upper edge of bucket, never above real maximum
+                stats.delayP95Ms = std::min((double) (i + 1), stats.delayMaxMs);
+                break;
+            }
+        }
+    }
+    return stats;
+}
+
+StreamStats StreamScheduler::stats(int stream) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stream < 0 || stream >= (int) streams_.size()) return StreamStats();
+    return snapshot(*streams_[stream]);
+}
+
+void StreamScheduler::printStats(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    out << "Scheduler: streams=" << streams_.size()
+        << " workers=" << config_.workers
+        << " picks=" << picks_
+        << " classSwitches=" << classSwitches_ << std::endl;
+    for (size_t i = 0; i < streams_.size(); i++) {
+        StreamStats s = snapshot(*streams_[i]);
+        out << "  [" << i << "] " << streams_[i]->config.name
+            << " " << s.size.width << "x" << s.size.height
+            << " fps=" << s.fps
+            << " submitted=" << s.submitted
+            << " processed=" << s.processed
+            << " dropped(queue/late)=" << s.droppedQueue << "/" << s.droppedLate
+            << " delay(mean/p95/max)=" << s.delayMeanMs << "/" << s.delayP95Ms << "/" << s.delayMaxMs << " ms"
+            << " faces=" << s.faces << std::endl;
+    }
+}
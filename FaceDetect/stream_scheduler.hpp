@@ -0,0 +1,159 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <opencv2/core.hpp>
+#include "face_detector_session.hpp"
+
+// Multi-stream scheduler settings
+struct StreamSchedulerConfig {
+    // Detection threads shared by all streams, 0 uses every hardware thread
+    int workers = 0;
+    // Frames queued per stream, oldest is dropped when a new frame arrives on full queue
+    size_t streamQueue = 2;
+    // Frames of one stream processed at the same time, 1 keeps results of a stream in order
+    int maxInFlight = 1;
+    // Frames are downscaled to this width for detection, boxes are reported in source size
+    int detectWidth = 480;
+};
+
+// Settings of one camera feed
+struct StreamConfig {
+    std::string name;
+    // Frame has to start detection this long after submit, later frames are dropped
+    double deadlineMs = 100.0;
+};
+
+// Per-stream counters, snapshot returned by StreamScheduler::stats()
+struct StreamStats {
+    uint64_t submitted = 0;
+    uint64_t processed = 0;
+    // Replaced by a newer frame while queued
+    uint64_t droppedQueue = 0;
+    // Detection could not start before deadline
+    uint64_t droppedLate = 0;
+    uint64_t faces = 0;
+    // Processed frames per second since first submit
+    double fps = 0.0;
+    // Submit -> start of detection
+    double delayMeanMs = 0.0;
+    double delayP95Ms = 0.0;
+    double delayMaxMs = 0.0;
+    // Source size of last submitted frame
+    cv::Size size;
+};
+
+// Shared face detection service for many camera feeds
+// Sources submit frames into small per-stream queues, a fixed pool of workers
+// with their own FaceDetectorSession takes one frame at a time. A worker prefers
+// the stream whose oldest frame is closest to its deadline among streams of the
+// resolution class it detected last, so resize tables and cascade buffers of the
+// session are reused instead of rebuilt on every size change, and falls back to
+// the earliest deadline of any class. No worker holds frames while others idle.
+// A stream never has more than maxInFlight frames in detection, a fast feed
+// cannot take workers away from slower ones.
+class StreamScheduler {
+
+public:
+    // Called on worker thread for every processed frame, may run concurrently for different streams
+    typedef std::function<void(int stream, int64_t index, const std::vector<cv::Rect>& faces)> ResultCallback;
+
+    StreamScheduler(const std::string& model, const FaceDetectorParams& params,
+                    const StreamSchedulerConfig& config = StreamSchedulerConfig());
+    ~StreamScheduler();
+
+    /* Return true if every worker has the model loaded */
+    bool ready() const;
+
+    /* Register feed, return stream id used by submit() */
+    int addStream(const StreamConfig& stream);
+
+    /* Set result callback, call before first submit */
+    void setCallback(const ResultCallback& callback) { callback_ = callback; }
+
+    /* Queue frame of stream, frame data is shared and must not be written after submit
+     * Return false if frame is empty or scheduler is stopped */
+    bool submit(int stream, const cv::Mat& frame, int64_t index);
+
+    /* Block until every queued frame is processed or dropped */
+    void drain();
+
+    /* Finish workers, queued frames are discarded */
+    void stop();
+
+    int streams() const;
+    StreamStats stats(int stream) const;
+
+    /* Print per-stream fps, queue delay and drops */
+    void printStats(std::ostream& out) const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    // Frame waiting in stream queue
+    struct Job {
+        cv::Mat frame;
+        int64_t index;
+        Clock::time_point submitted;
+        Clock::time_point deadline;
+    };
+
+    // Queue and counters of one feed, guarded by mutex_
+    struct Stream {
+        StreamConfig config;
+        std::deque<Job> queue;
+        int inFlight = 0;
+        Clock::time_point first;
+        StreamStats stats;
+        double delaySumMs = 0.0;
+        // 1 ms buckets, last bucket collects everything slower
+        std::vector<uint32_t> delayHistogram;
+    };
+
+    // Frame picked by a worker with the stream it came from
+    struct Pick {
+        int stream;
+        Job job;
+    };
+
+    /* Frame size and type, workers prefer frames of the class they detected last */
+    static uint64_t resolutionClass(const cv::Mat& frame);
+
+    /* Take one frame, earliest deadline first among streams of the worker's last class
+     * Return false if every queued frame was late, caller holds mutex_ */
+    bool pickJob(int worker, Pick& pick);
+
+    /* Return true if some stream has a queued frame and a free in-flight slot */
+    bool hasWork() const;
+
+    /* Counters of stream with fps and delay percentiles filled in, caller holds mutex_ */
+    StreamStats snapshot(const Stream& stream) const;
+
+    void workerLoop(int worker);
+
+    StreamSchedulerConfig config_;
+    std::vector<std::unique_ptr<FaceDetectorSession>> sessions_;
+    std::vector<std::thread> threads_;
+    ResultCallback callback_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable work_;
+    std::condition_variable idle_;
+    std::vector<std::unique_ptr<Stream>> streams_;
+    int busy_ = 0;
+    bool stopping_ = false;
+
+    // Worker counters, guarded by mutex_
+    uint64_t picks_ = 0;
+    uint64_t classSwitches_ = 0;
+    std::vector<uint64_t> lastClass_;
+};
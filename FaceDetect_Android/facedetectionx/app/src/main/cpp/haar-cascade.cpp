@@ -3,24 +3,47 @@
 //
 
 #include "haar-cascade.h"
+#include <mutex>
 
-// Implement detecting face in each frame
-std::vector<int> faceDetect(const char* haarCascade_model, const cv::Mat& frame) {
+// Keep facecore detector alive between frames
+// Android preset: scaleFactor=1.1, minNeighbors=3, minSize=(250, 250),
+// face found in previous frame is searched around first
+// Loaded once per process and never replaced: a recreated activity may load again
+// while analyzer of previous one is still detecting, mutex orders the two
+static facecore_detector* faceDetector = NULL;
+static std::mutex faceDetectorMutex;
+
+// Parse model once from memory, later calls keep loaded model
+bool faceModelLoad(const void* data, size_t size) {
+    std::lock_guard<std::mutex> lock(faceDetectorMutex);
+    if (faceDetector != NULL) return true;
+    facecore_config config;
+    facecore_config_preset(FACECORE_PRESET_ANDROID, &config);
+    faceDetector = facecore_create_from_memory(data, size, &config);
+    return faceDetector != NULL;
+}
 
-    // Call Haar Cascades model and detect face
-    cv::CascadeClassifier detector;
-    // "haarcascade_frontalface_alt2" is chosen
-    detector.load(haarCascade_model);
-    std::vector<cv::Rect> face;
-    detector.detectMultiScale(frame, face, 1.1, 3, cv::CASCADE_SCALE_IMAGE, cv::Size(250, 250));
+// Implement detecting face in each frame
+// Frame becomes upright after clockwise rotation by rotationDegrees, face is reported upright
+std::vector<int> faceDetect(const cv::Mat& frame, int rotationDegrees) {
 
     std::vector<int> faceInfo;
-    if (!face.empty()) {
-        int left = face[0].x;
-        int top = face[0].y - (int) (0.05 * face[0].height);
-        int right = face[0].x + face[0].width;
-        int bottom = face[0].y + face[0].height + (int) (0.05 * face[0].height);
+    std::lock_guard<std::mutex> lock(faceDetectorMutex);
+    if (faceDetector == NULL || frame.empty()) return faceInfo;
+
+    // Frame is Y plane of camera image, color frames are in Android bitmap (RGB) order
+    facecore_format format = frame.channels() == 1 ? FACECORE_FORMAT_GRAY :
+                             frame.channels() == 4 ? FACECORE_FORMAT_RGBA : FACECORE_FORMAT_RGB;
+
+    // Only first face is reported
+    facecore_box face;
+    if (facecore_detect_rotated(faceDetector, frame.data, frame.cols, frame.rows, frame.step, format,
+                                rotationDegrees, &face, 1) > 0) {
+        int left = face.x;
+        int top = face.y - (int) (0.05 * face.height);
+        int right = face.x + face.width;
+        int bottom = face.y + face.height + (int) (0.05 * face.height);
         faceInfo = {left, top, right, bottom};
     }
     return faceInfo;
-}
\ No newline at end of file
+}
@@ -5,6 +5,11 @@
 
 #include <iostream>
 #include <opencv2/imgproc.hpp>
-#include <opencv2/objdetect.hpp>
+#include <string>
+#include <vector>
+#include "facecore.h"
 
-std::vector<int> faceDetect(const char* haarCascade_model, const cv::Mat& frame);
\ No newline at end of file
+// Load Haar Cascade .xml text from memory, return false if it cannot be parsed
+bool faceModelLoad(const void* data, size_t size);
+
+std::vector<int> faceDetect(const cv::Mat& frame, int rotationDegrees = 0);
\ No newline at end of file
@@ -1,39 +1,78 @@
 #include <jni.h>
 #include <string>
+#include <android/asset_manager.h>
+#include <android/asset_manager_jni.h>
 #include <android/log.h>
+#include "face_result.hpp"
 #include "haar-cascade.h"
+#include "y_plane.hpp"
+
+// Detection results handed from CameraX analyzer thread (producer) to UI thread (consumer)
+// Single producer: MainActivity runs every analyzer on one shared executor thread
+// UI polls every 50 ms, 15 results hold half a second of frames at 30 fps,
+// after a longer UI stall the oldest results are overwritten
+static FaceResultRing faceResults(15);
 
 extern "C"
-JNIEXPORT jobjectArray * JNICALL
-Java_com_example_facedetectionx_MainActivity_00024FaceAnalyzer_faceDetect(JNIEnv *env, jobject thiz,
-                                     jstring haarCascadePathJstring, jlong matAdd) {
+JNIEXPORT jboolean JNICALL
+Java_com_example_facedetectionx_MainActivity_loadFaceModel(JNIEnv *env, jobject thiz,
+                                                          jobject assetManager, jstring assetNameJstring) {
     // Convert jstring to C++ string in modified UTF-8 encoding
-    jboolean isCopy;
-    const char* modelPath = env->GetStringUTFChars(haarCascadePathJstring, &isCopy);
-
-    // Get Mat from raw address
-    cv::Mat &frame = *(cv::Mat*) matAdd;
-
-    // Implement detecting face in each frame and return detected face
-    std::vector<int> faceInfo = faceDetect(modelPath, frame);
-
-    // Initialize faceArray from faceInfo in JNI and pass to Kotlin array
-    // Create integer jobject
-    jclass intClass = env->FindClass("java/lang/Integer");
-    jmethodID midInit = env->GetMethodID(intClass, "<init>", "(I)V");
-    if (NULL == midInit) return NULL;
-    // Initialize faceArray
-    jobjectArray faceArray = env->NewObjectArray(faceInfo.size(), intClass, NULL);
-    for ( int i = 0; i < faceInfo.size() ; i++ ) {
-        jint num = faceInfo[i];
-        jobject numObject = env->NewObject(intClass, midInit, num);
-        env->SetObjectArrayElement(faceArray, i, numObject);
-    }
+    const char* assetName = env->GetStringUTFChars(assetNameJstring, NULL);
+    if (assetName == NULL) return JNI_FALSE;
+    AAssetManager* manager = AAssetManager_fromJava(env, assetManager);
+    AAsset* asset = manager != NULL ? AAssetManager_open(manager, assetName, AASSET_MODE_BUFFER) : NULL;
+    // Every GetStringUTFChars needs its ReleaseStringUTFChars, copy or not
+    env->ReleaseStringUTFChars(assetNameJstring, assetName);
+    if (asset == NULL) return JNI_FALSE;
+
+    // Uncompressed asset is memory mapped straight from APK (see noCompress in build.gradle),
+    // model is parsed from that memory, no temporary file is written
+    const void* data = AAsset_getBuffer(asset);
+    off_t size = AAsset_getLength(asset);
+    bool loaded = data != NULL && size > 0 && faceModelLoad(data, (size_t) size);
+    AAsset_close(asset);
+    return loaded ? JNI_TRUE : JNI_FALSE;
+}
+
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_example_facedetectionx_MainActivity_00024FaceAnalyzer_faceDetectYPlane(JNIEnv *env, jobject thiz,
+                                     jobject yPlane, jint width, jint height, jint rowStride, jint rotationDegrees) {
+    // Wrap Y plane of direct ByteBuffer, rows are rowStride bytes apart
+    // No copy is made, buffer stays valid until ImageProxy is closed
+    void* address = env->GetDirectBufferAddress(yPlane);
+    jlong capacity = env->GetDirectBufferCapacity(yPlane);
+    cv::Mat frame = wrapYPlane(address, capacity > 0 ? (size_t) capacity : 0, width, height, rowStride);
 
-    // After using string, the ReleaseString-Chars call is necessary, it either frees the copy or unpins the instance
-    if (isCopy == JNI_TRUE) {
-        env->ReleaseStringUTFChars(haarCascadePathJstring, modelPath);
+    // Implement detecting face in each frame
+    // Frame is rotated upright inside detector, only gray plane is moved
+    std::vector<int> faceInfo;
+    if (!frame.empty()) faceInfo = faceDetect(frame, rotationDegrees);
+
+    // Publish result of every frame, frames without face clear the overlay
+    FaceResult result;
+    result.count = std::min((int) faceInfo.size() / 4, FACE_RESULT_MAX_BOXES);
+    for (int i = 0; i < result.count; i++) {
+        for (int k = 0; k < 4; k++) result.boxes[i][k] = faceInfo[4 * i + k];
     }
+    result.timestampNs = faceResultClockNs();
+    faceResults.push(result);
+
+    return (jint) result.count;
+}
+
+extern "C"
+JNIEXPORT jintArray JNICALL
+Java_com_example_facedetectionx_MainActivity_readFaceResult(JNIEnv *env, jobject thiz) {
+    // Newest result since last call: age in ms, number of faces, then left, top, right, bottom per face
+    // Empty array if analyzer has not produced anything new
+    FaceResult result;
+    if (faceResults.popLatest(result) == 0) return env->NewIntArray(0);
 
-    return reinterpret_cast<jobjectArray *>(faceArray);
-}
\ No newline at end of file
+    jint packed[FACE_RESULT_PACKED_MAX];
+    int n = packFaceResult(result, faceResultClockNs(), packed, FACE_RESULT_PACKED_MAX);
+    jintArray array = env->NewIntArray(n);
+    if (array != NULL) env->SetIntArrayRegion(array, 0, n, packed);
+    return array;
+}
@@ -2,6 +2,7 @@ package com.example.facedetectionx
 
 import android.Manifest
 import android.content.pm.PackageManager
+import android.content.res.AssetManager
 import android.content.res.Resources
 import android.graphics.*
 import android.graphics.drawable.BitmapDrawable
@@ -23,17 +24,16 @@ import androidx.camera.lifecycle.ProcessCameraProvider
 import androidx.core.app.ActivityCompat
 import androidx.core.content.ContextCompat
 import com.example.facedetectionx.databinding.ActivityMainBinding
-import org.opencv.core.Core
-import org.opencv.core.CvType.CV_8UC1
-import org.opencv.core.Mat
-import java.io.File
 import java.nio.ByteBuffer
 import java.util.concurrent.ExecutorService
 import java.util.concurrent.Executors
 
 class MainActivity : AppCompatActivity() {
     private lateinit var viewBinding: ActivityMainBinding
-    private lateinit var cameraExecutor: ExecutorService
+    // Posts overlay updates, callbacks are removed when activity is destroyed
+    private val uiHandler = Handler(Looper.getMainLooper())
+    // Analysis use case of this activity, its analyzer is cleared when activity is destroyed
+    private var imageAnalysis: ImageAnalysis? = null
 
     // Declare device display
     private val displayMetrics: DisplayMetrics = Resources.getSystem().displayMetrics
@@ -42,11 +42,12 @@ class MainActivity : AppCompatActivity() {
     private val screenH = 1280
 
     companion object {
-        // Declare default temporary file location in Android
-        var tmpDir: String? = System.getProperty("java.io.tmpdir")
         private const val TAG = "Face Detection"
         private const val REQUEST_CODE_PERMISSIONS = 10
         private val REQUIRED_PERMISSIONS = arrayOf(Manifest.permission.CAMERA)
+        // Native result ring takes a single producer: analyzers of every activity instance
+        // run on this one thread, so a recreated activity queues behind the previous analyzer
+        private val cameraExecutor: ExecutorService = Executors.newSingleThreadExecutor()
         init {
             System.loadLibrary("facedetectionx")
             System.loadLibrary("opencv_java4")
@@ -59,22 +60,15 @@ class MainActivity : AppCompatActivity() {
         viewBinding = ActivityMainBinding.inflate(layoutInflater)
         setContentView(viewBinding.root)
 
-        // Cannot load Haar Cascade file because path to OpenCV resources cannot be accessed directly(Android security)
-        // So put model file manually in "/res/raw" resource folder
-        val haarRelativePath = "/res/raw/haarcascade_frontalface_alt2.xml"
-        // then read file as input stream and copy stream to accessible temporary file
-        val haarCascadeIns = javaClass.getResourceAsStream(haarRelativePath)
-        // JNI now can access temporary file and utilize model
-        val tmpFile =  File(tmpDir, "haarcascade_frontalface.xml")
-        haarCascadeIns.use { input ->
-            tmpFile.outputStream().use { output ->
-                input?.copyTo(output)
-            }
+        // Haar Cascade model is parsed by native code straight from APK assets
+        // Asset is stored uncompressed and memory mapped, no temporary file copy is made
+        if (!loadFaceModel(assets, "haarcascade_frontalface_alt2.xml")) {
+            Log.e(TAG, "Cannot load Haar Cascade model from assets")
         }
 
         // Draw faceRect onto a bitmap
         // and update bitmap after each interval
-        Handler(Looper.getMainLooper()).postDelayed(object : Runnable {
+        uiHandler.postDelayed(object : Runnable {
             // Camera X Surface View is mirrored
             // So face bounding box should be mirrored too
             private fun Bitmap.flip(x: Float, y: Float, cx: Float, cy: Float): Bitmap {
@@ -87,41 +81,39 @@ class MainActivity : AppCompatActivity() {
                 val canvas = Canvas(bitmap)
                 var shapeDrawable: ShapeDrawable
 
-                // get bounding box coordinates from created temp file
-                val faceInfoFile = File(tmpDir, "faceCoordinates.txt")
-                if (faceInfoFile.exists()) {
-                    faceInfoFile.forEachLine { it ->
-                        val faceCoordinates: Array<Int> = arrayOf(*it.split(",").toTypedArray()).map{ it.toInt() }.toTypedArray()
-                        if (faceCoordinates.size == 4) {
-                            val left = faceCoordinates[0]
-                            val top = faceCoordinates[1]
-                            val right = faceCoordinates[2]
-                            val bottom = faceCoordinates[3]
-
-                            // draw rectangle shape to canvas
-                            shapeDrawable = ShapeDrawable(RectShape())
-                            shapeDrawable.setBounds( left, top, right, bottom)
-                            shapeDrawable.paint.setColor(Color.parseColor("#3cd184"))
-                            shapeDrawable.paint.setStyle(Paint.Style.STROKE)
-                            shapeDrawable.paint.setStrokeWidth(6f)
-                            shapeDrawable.draw(canvas)
-
-                            // Flip faceRect bitmap horizontally
-                            val cx = bitmap.width / 2f
-                            val cy = bitmap.height / 2f
-                            val flippedBitmap = bitmap.flip(-1f, 1f, cx, cy)
-
-                            // now bitmap holds the updated pixels
-                            // set bitmap as background to ImageView
-                            viewBinding.faceRect.background = BitmapDrawable(resources, flippedBitmap)
-                        }
+                // Newest result from native ring: age in ms, number of faces,
+                // then left, top, right, bottom of each face
+                val faceResult = readFaceResult()
+                val faceCount = if (faceResult.size >= 2) faceResult[1] else 0
+                if (faceCount > 0) {
+                    for (i in 0 until faceCount) {
+                        val left = faceResult[2 + 4 * i]
+                        val top = faceResult[3 + 4 * i]
+                        val right = faceResult[4 + 4 * i]
+                        val bottom = faceResult[5 + 4 * i]
+
+                        // draw rectangle shape to canvas
+                        shapeDrawable = ShapeDrawable(RectShape())
+                        shapeDrawable.setBounds( left, top, right, bottom)
+                        shapeDrawable.paint.setColor(Color.parseColor("#3cd184"))
+                        shapeDrawable.paint.setStyle(Paint.Style.STROKE)
+                        shapeDrawable.paint.setStrokeWidth(6f)
+                        shapeDrawable.draw(canvas)
                     }
-                    faceInfoFile.delete()
+
+                    // Flip faceRect bitmap horizontally
+                    val cx = bitmap.width / 2f
+                    val cy = bitmap.height / 2f
+                    val flippedBitmap = bitmap.flip(-1f, 1f, cx, cy)
+
+                    // now bitmap holds the updated pixels
+                    // set bitmap as background to ImageView
+                    viewBinding.faceRect.background = BitmapDrawable(resources, flippedBitmap)
                 }
                 else {
                     viewBinding.faceRect.background = BitmapDrawable(resources, bitmap)
                 }
-                Handler(Looper.getMainLooper()).postDelayed(this, 50)
+                uiHandler.postDelayed(this, 50)
                 return
             }
         }, 500)
@@ -133,7 +125,6 @@ class MainActivity : AppCompatActivity() {
             ActivityCompat.requestPermissions(
                 this, REQUIRED_PERMISSIONS, REQUEST_CODE_PERMISSIONS)
         }
-        cameraExecutor = Executors.newSingleThreadExecutor()
     }
 
 
@@ -188,6 +179,7 @@ class MainActivity : AppCompatActivity() {
                 .also {
                     it.setAnalyzer(cameraExecutor, FaceAnalyzer())
                 }
+            imageAnalysis = imageAnalyzer
 
             // Select front camera as a default
             val cameraSelector = CameraSelector.Builder()
@@ -209,57 +201,38 @@ class MainActivity : AppCompatActivity() {
     }
 
 
+    // Parse Haar Cascade model from APK asset, return false if it cannot be loaded
+    private external fun loadFaceModel(assetManager: AssetManager, assetName: String): Boolean
+
+    // Newest detection result since last call, empty if there is none
+    private external fun readFaceResult(): IntArray
+
+
     override fun onDestroy() {
         super.onDestroy()
-        cameraExecutor.shutdown()
+        uiHandler.removeCallbacksAndMessages(null)
+        // No new frames reach the analyzer, a frame in progress finishes on the analyzer thread
+        // without blocking UI thread, next activity's analyzer queues behind it
+        imageAnalysis?.clearAnalyzer()
     }
 
 
     private class FaceAnalyzer : ImageAnalysis.Analyzer {
-        private fun ByteBuffer.toByteArray(): ByteArray {
-            rewind()    // Rewind the buffer to zero
-            val data = ByteArray(remaining())
-            get(data)   // Copy the buffer into a byte array
-            return data // Return the byte array
-        }
-
         override fun analyze(image: ImageProxy) {
             // Image format is YUV_420_888
             // Grayscale image is extracted from Y-plane, which is index 0
-            val buffer = image.planes[0].buffer
-            val data = buffer.toByteArray()
-            val mat = Mat(image.height, image.width, CV_8UC1)
-            mat.put(0, 0, data)
-
-            // ImageProxy is rotated incorrectly leading to wrong Matrix rotation
-            // So we rotate Matrix in WYSIWYG way
-            // Note: mat.t() is the transpose
-            val rotatedMat = Mat()
-            when(image.imageInfo.rotationDegrees) {
-                90 -> Core.flip(mat.t(), rotatedMat, 1)
-                180 -> Core.flip(mat, rotatedMat, -1)
-                270 -> Core.flip(mat.t(), rotatedMat, 0)
-            }
-            mat.release()
-
-            // Get absolute path to "tmpFile" and pass it to JNI function
-            val faceInfo = faceDetect("${tmpDir}/haarcascade_frontalface.xml", rotatedMat.nativeObjAddr)
-            rotatedMat.release()
-            // Return x, y, h, w of detected face bounding box
-            if (faceInfo.size == 4) {
-                val x = faceInfo[0].toDouble()
-                val y = faceInfo[1].toDouble()
-                val w = faceInfo[2].toDouble()
-                val h = faceInfo[3].toDouble()
-
-                val tmpFaceFile =  File(tmpDir, "faceCoordinates.txt")
-                tmpFaceFile.writeText("${x.toInt()},${y.toInt()},${w.toInt()},${h.toInt()}")
-            }
+            // Direct buffer is read in place by native code, rows are rowStride bytes apart
+            // Frame is rotated upright natively according to rotationDegrees
+            val yPlane = image.planes[0]
+            // Detected faces are passed to UI thread through native ring, read by readFaceResult()
+            faceDetectYPlane(yPlane.buffer, image.width, image.height, yPlane.rowStride,
+                image.imageInfo.rotationDegrees)
 
             // Close image after finishing processing
             image.close()
         }
 
-        private external fun faceDetect(model: String, matAdd: Long): Array<Int>
+        private external fun faceDetectYPlane(yPlane: ByteBuffer, width: Int, height: Int,
+                                              rowStride: Int, rotationDegrees: Int): Int
     }
 }
\ No newline at end of file
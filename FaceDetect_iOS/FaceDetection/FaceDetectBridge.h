@@ -17,7 +17,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (NSString *) openCVVersionString;
 
-+ (UIImage *) detectFace: (UIImage *) image;
++ (UIImage *) detectFace: (CVPixelBufferRef) pixelBuffer;
 
 @end
 
@@ -16,29 +16,32 @@
     return [NSString stringWithFormat:@"Initializing OpenCV Version %s ...",  CV_VERSION];
 }
 
-// Process UIImage for face detection
-+ (UIImage *) detectFace: (UIImage *) image {
-    // Transform UIImage to cv::Mat
-    cv::Mat imgMat;
-    UIImageToMat(image, imgMat);
-    
+// Process 32BGRA camera buffer for face detection
++ (UIImage *) detectFace: (CVPixelBufferRef) pixelBuffer {
     // Access HaarCascade file in "res" folder
     // and return its directory
-    NSString *haarCascadeFile = [[NSBundle mainBundle] pathForResource:@"haarcascade_frontalface_alt2" ofType:@"xml"];
-    
-    // If file is found successfully, process the frame
-    // else report the error
+    // YuNet model is used instead when it is bundled with the app
+    NSString *haarCascadeFile = [[NSBundle mainBundle] pathForResource:@"face_detection_yunet_2022mar" ofType:@"onnx"];
+    if (haarCascadeFile.length == 0) {
+        haarCascadeFile = [[NSBundle mainBundle] pathForResource:@"haarcascade_frontalface_alt2" ofType:@"xml"];
+    }
+    std::string haarCascadePath;
     if (haarCascadeFile.length != 0) {
-        std::string haarCascadePath;
         haarCascadePath = [haarCascadeFile UTF8String];
-        
-        // Detect face and draw bounding box onto the frame
-        cv::Mat faceBoundingBox = faceDetect(haarCascadePath, imgMat);
-        return MatToUIImage(faceBoundingBox);
-    }
-    else {
-        return MatToUIImage(imgMat);
     }
+    // else detector reports no face and frame is only displayed
+
+    // Read pixels in place, no CGImage / UIImage / UIImageToMat copies
+    CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+    const uchar* bgra = (const uchar*) CVPixelBufferGetBaseAddress(pixelBuffer);
+    size_t bytesPerRow = CVPixelBufferGetBytesPerRow(pixelBuffer);
+    int width = (int) CVPixelBufferGetWidth(pixelBuffer);
+    int height = (int) CVPixelBufferGetHeight(pixelBuffer);
+
+    // Detect face and draw bounding box onto the mirrored frame
+    cv::Mat faceBoundingBox = faceDetect(haarCascadePath, bgra, bytesPerRow, width, height);
+    CVPixelBufferUnlockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+    return MatToUIImage(faceBoundingBox);
 }
 
 @end
@@ -7,30 +7,56 @@
 
 #import "HaarCascade.hpp"
 
-cv::Mat faceDetect(std::string haarCascadePath, const cv::Mat& frame) {
-    // Convert image to grayscale for detection
-    cv::Mat grayFrame;
-    cv::cvtColor(frame, grayFrame, cv::COLOR_BGR2GRAY);
-    
-    // Convert image to correct colorspace for drawing
-    cv::Mat drawFrame;
-    cv::cvtColor(frame, drawFrame, cv::COLOR_RGBA2RGB);
-    
-    // Load "haarcascade_frontalface_alt2.xml" file
-    cv::CascadeClassifier detector;
-    detector.load(haarCascadePath);
-    
-    // Do detection
+// YuNet .onnx model detects on color camera buffer, Haar Cascade .xml on gray plane
+static bool isYuNetModel(const std::string& path) {
+    return path.size() > 5 && path.compare(path.size() - 5, 5, ".onnx") == 0;
+}
+
+// Keep facecore detector alive between frames
+// Model is reloaded only when a different model path is passed
+// iOS preset: scaleFactor=1.15, minNeighbors=6, minSize=(200, 200),
+// faces found in previous frame are searched around first
+static facecore_detector* faceDetector(const std::string& haarCascadePath) {
+    static facecore_detector* detector = NULL;
+    static std::string modelPath;
+    if (detector == NULL || modelPath != haarCascadePath) {
+        facecore_destroy(detector);
+        facecore_config config;
+        facecore_config_preset(FACECORE_PRESET_IOS, &config);
+        if (isYuNetModel(haarCascadePath)) config.backend = FACECORE_BACKEND_YUNET;
+        detector = facecore_create(haarCascadePath.c_str(), &config);
+        modelPath = haarCascadePath;
+    }
+    return detector;
+}
+
+cv::Mat faceDetect(std::string haarCascadePath, const uchar* bgra, size_t stride, int width, int height) {
+    // Gray detection frame and mirrored RGB display frame in one pass over camera buffer
+    // Both buffers are reused between frames, MatToUIImage() copies display frame
+    static cv::Mat gray, drawFrame;
+    bgraToGrayMirroredRgb(bgra, stride, width, height, gray, drawFrame);
+
+    // "haarcascade_frontalface_alt2.xml" is loaded once by detector
     // and return results to face instance
-    std::vector<cv::Rect> face;
-    detector.detectMultiScale(grayFrame, face, 1.15, 6, cv::CASCADE_SCALE_IMAGE, cv::Size(200, 200));
-    // Release Mat to set memory free
-    grayFrame.release();
+    std::vector<facecore_box> face(16);
+    int found = 0;
+    facecore_detector* detector = haarCascadePath.empty() ? NULL : faceDetector(haarCascadePath);
+    if (detector != NULL && isYuNetModel(haarCascadePath)) {
+        found = facecore_detect(detector, bgra, width, height, stride, FACECORE_FORMAT_BGRA,
+                                face.data(), (int) face.size());
+    }
+    else if (detector != NULL) {
+        found = facecore_detect(detector, gray.data, gray.cols, gray.rows, gray.step,
+                                FACECORE_FORMAT_GRAY,
+                                face.data(), (int) face.size());
+    }
+    face.resize(std::max(0, std::min(found, (int) face.size())));
 
     // Draw detected rectangular bounding box
+    // Boxes are in camera orientation, display frame is mirrored
     if (!face.empty()) {
         for ( size_t i = 0; i < face.size(); i++ ) {
-            int x = face[i].x;
+            int x = width - face[i].x - face[i].width;
             int y = face[i].y;
             int h = face[i].height;
             int w = face[i].width;
@@ -40,7 +66,5 @@ cv::Mat faceDetect(std::string haarCascadePath, const cv::Mat& frame) {
                           cv::Scalar(0, 255, 0), 2);
         }
     }
-    // Mirror frame to get natural display
-    cv::flip(drawFrame, drawFrame, 1);
     return drawFrame;
 }
@@ -10,8 +10,11 @@
 
 #import <opencv2/opencv.hpp>
 #include <stdio.h>
+#include "bgra_convert.hpp"
+#include "facecore.h"
 
 // Declare C++ function
-cv::Mat faceDetect(std::string haarCascadePath, const cv::Mat& frame);
+// Detect faces in 32BGRA camera buffer, return mirrored RGB frame with bounding boxes
+cv::Mat faceDetect(std::string haarCascadePath, const uchar* bgra, size_t stride, int width, int height);
 
 #endif /* HaarCascade_hpp */
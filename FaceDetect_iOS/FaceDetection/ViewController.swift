@@ -55,7 +55,7 @@ class ViewController: UIViewController, AVCaptureVideoDataOutputSampleBufferDele
     }
     
     
-    // Convert frame into UIImage
+    // Pass camera buffer to OpenCV and show returned frame
     // Image processing algorithms implemented here
     func captureOutput(
         _ output: AVCaptureOutput,
@@ -64,26 +64,8 @@ class ViewController: UIViewController, AVCaptureVideoDataOutputSampleBufferDele
         // PROCESS THE FRAME HERE
         guard let  imageBuffer = CMSampleBufferGetImageBuffer(sampleBuffer) else { return }
             
-        CVPixelBufferLockBaseAddress(imageBuffer, CVPixelBufferLockFlags.readOnly)
-            
-        let baseAddress = CVPixelBufferGetBaseAddress(imageBuffer)
-        let bytesPerRow = CVPixelBufferGetBytesPerRow(imageBuffer)
-        let width = CVPixelBufferGetWidth(imageBuffer)
-        let height = CVPixelBufferGetHeight(imageBuffer)
-        let colorSpace = CGColorSpaceCreateDeviceRGB()
-            
-        var bitmapInfo: UInt32 = CGBitmapInfo.byteOrder32Little.rawValue
-        bitmapInfo |= CGImageAlphaInfo.premultipliedFirst.rawValue & CGBitmapInfo.alphaInfoMask.rawValue
-            
-        let context = CGContext(data: baseAddress, width: width, height: height, bitsPerComponent: 8, bytesPerRow: bytesPerRow, space: colorSpace, bitmapInfo: bitmapInfo)
-            
-        guard let quartzImage = context?.makeImage() else { return }
-            
-        CVPixelBufferUnlockBaseAddress(imageBuffer, CVPixelBufferLockFlags.readOnly)
-            
-        // Detect face
-        let image = UIImage(cgImage: quartzImage)
-        let detectFrame = FaceDetectBridge.detectFace(image)
+        // Detect face on 32BGRA buffer directly, gray and mirrored display frame are made in one pass
+        let detectFrame = FaceDetectBridge.detectFace(imageBuffer)
         DispatchQueue.main.async {
             self.imageView.image = detectFrame
         }
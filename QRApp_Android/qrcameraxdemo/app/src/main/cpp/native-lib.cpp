@@ -1,14 +1,54 @@
 #include <jni.h>
 #include <string>
+#include <vector>
+#include <sstream>
 #include <android/log.h>
 #include "opencv-zbar.h"
+#include "y_plane.hpp"
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_example_qrcameraxdemo_MainActivity_00024QRAnalyzer_createQRPipeline (
+JNIEnv *env, jobject /* this */) {
+    //    scanner and scratch buffers live as long as the analyzer
+    return (jlong) new QRPipeline();
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_example_qrcameraxdemo_MainActivity_00024QRAnalyzer_destroyQRPipeline (
+JNIEnv *env, jobject /* this */, jlong pipeline) {
+    delete (QRPipeline*) pipeline;
+}
 
 extern "C"
 JNIEXPORT void JNICALL
-Java_com_example_qrcameraxdemo_MainActivity_00024QRAnalyzer_qrDecoder (
-JNIEnv *env, jobject /* this */, jlong matAddr) {
-    //    get Mat from raw address
-    cv::Mat &mat = *(cv::Mat *) matAddr;
-    std::string result = QRDecoder(mat);
-    __android_log_print(ANDROID_LOG_INFO, "Result", "%s", result.c_str());
+Java_com_example_qrcameraxdemo_MainActivity_00024QRAnalyzer_qrDecoderYPlane (
+JNIEnv *env, jobject /* this */, jlong pipeline, jobject yPlane, jint width, jint height, jint rowStride) {
+    if (pipeline == 0) return;
+
+    //    wrap Y plane of direct ByteBuffer without copying, rows are rowStride bytes apart
+    void* address = env->GetDirectBufferAddress(yPlane);
+    jlong capacity = env->GetDirectBufferCapacity(yPlane);
+    cv::Mat mat = wrapYPlane(address, capacity > 0 ? (size_t) capacity : 0, width, height, rowStride);
+    if (mat.empty()) return;
+
+    //    every candidate region of the frame is decoded on the pipeline's threads
+    QRPipeline& qr = *(QRPipeline*) pipeline;
+    std::vector<std::string> results = qr.decodeAll(mat);
+    if (results.empty()) __android_log_print(ANDROID_LOG_INFO, "Result", "%s", "");
+    for (size_t i = 0; i < results.size(); i++) {
+        __android_log_print(ANDROID_LOG_INFO, "Result", "%s", results[i].c_str());
+    }
+
+    //    allocations per frame and retained buffers of Mat pool, candidates and decode throughput every 300 frames
+    const MatPool& pool = qrMatPool();
+    if (pool.stats().frames % 300 == 0) {
+        std::ostringstream stats;
+        pool.printStats(stats);
+        __android_log_print(ANDROID_LOG_INFO, "MatPool", "%s", stats.str().c_str());
+        std::ostringstream qrStats;
+        qr.printStats(qrStats);
+        __android_log_print(ANDROID_LOG_INFO, "QRPipeline", "%s", qrStats.str().c_str());
+    }
 }
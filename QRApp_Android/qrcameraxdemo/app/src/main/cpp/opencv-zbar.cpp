@@ -2,20 +2,8 @@
 // Created by Nguyen Quoc Anh on 28/04/2022.
 //
 #include "opencv-zbar.h"
-
-class QRDetect_Decode {
-
-public:
-    /* Return decoded data after detect QR code */
-    std::string decodedData(cv::Mat image);
-
-private:
-    /* Detect QR code in image */
-    cv::Mat detectQR(cv::Mat grayMat);
-
-    /* Preprocess detected QR code to improve decoding accuracy */
-    cv::Mat preprocess(cv::Mat crop);
-};
+#include <algorithm>
+#include <chrono>
 
 // Suppress OpenCV error message
 // If errors from cv::exception are handled, displaying errors is not necessary
@@ -28,129 +16,185 @@ int handleError( int status, const char* func_name,
     return 0;   //Return value is not used
 }
 
-cv::Mat QRDetect_Decode::detectQR(cv::Mat grayMat) {
-    // detect horizontal and vertical edges
-    // compute the Scharr gradient magnitude representation of the images
-    cv::Mat gradX, gradY, gradient;
-    Sobel(grayMat, gradX, CV_32F, 1, 0, -1);
-    Sobel(grayMat, gradY, CV_32F, 0, 1, -1);
-
-    // subtract the y-gradient from the x-gradient
-    subtract(gradX, gradY, gradient);
-    // convert to 8 bit unsigned int because negative pixels equal 0
-    convertScaleAbs(gradient, gradient);
-
-    // smooth out noise and binarize the image
-    cv::Mat blurred, thresh;
-    blur(gradient, blurred, cv::Size(5, 5));
-    threshold(blurred, thresh, 240, 250, cv::THRESH_BINARY);
-
-    // close small gaps in object by using closing kernel
-    // image width is larger then height, so use wider kernel
-    cv::Mat close, kernel;
-    kernel = getStructuringElement(cv::MORPH_RECT, cv::Size(27, 15));
-    morphologyEx(thresh, close, cv::MORPH_CLOSE, kernel);
-
-    // perform a series of erosion and dilation
-    cv::Mat erosion, expand;
-    erode(close, erosion, 4);
-    dilate(erosion, expand, 4);
-
-    std::vector<std::vector<cv::Point>> contours;
-    findContours(expand, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
-
-    // since QR code is square
-    // find biggest square object and crop
-    float maxArea = 0.0f;
-    cv::Point2f vertices[4];
-
-    for (int i = 0; i < contours.size(); i++){
-        cv::RotatedRect box = cv::minAreaRect(contours[i]);
-        float ratio = box.size.width / box.size.height;
-
-        if ((ratio > 0.9f) && (ratio < 1.1f) && (cv::contourArea(contours[i]) > maxArea)){
-            maxArea = cv::contourArea(contours[i]);
-            box.points(vertices);
-        }
+// Never destroyed, analyzer thread may still release Mats at exit
+static MatPool& framePool() {
+    static MatPool* pool = new MatPool();
+    return *pool;
+}
+
+/* Size buffer to exactly rows x cols, memory is reused while crop size does not change
+ * Row range views of a larger buffer would let GaussianBlur and CLAHE borders read stale rows below */
+static cv::Mat scratch(cv::Mat& buffer, int rows, int cols, int type) {
+    buffer.create(rows, cols, type);
+    return buffer;
+}
+
+QRPipeline::QRPipeline(const QRPipelineConfig& config)
+    : config_(config), detector_(config.candidates), pool_(config.threads), found_(0), scanned_(0), failed_(0) {
+    for (int i = 0; i < pool_.threads(); i++) {
+        std::unique_ptr<Worker> worker(new Worker());
+        // configure scanner
+        worker->scanner.set_config(zbar::ZBAR_QRCODE, zbar::ZBAR_CFG_ENABLE, 1);
+        worker->image.set_format("Y800");
+        worker->clahe = cv::createCLAHE(2.0, cv::Size(8, 8));
+        // preprocessing scratch is reused by next frames through pool
+        cv::Mat* scratchMats[] = {&worker->res, &worker->gaussian, &worker->unsharp, &worker->brighten, &worker->contrast, &worker->bin};
+        for (cv::Mat* mat : scratchMats) framePool().attach(*mat);
+        workers_.push_back(std::move(worker));
     }
 
-    // expand each side of bounding box by 10 pixels
-    cv::Mat crop;
     // Suppress assertion errors, particularly matrix dimensions errors
     // which are due to OpenCV failed to detect QR bounding box
     cv::redirectError(handleError);
-    try {
-        if (maxArea == 0) return grayMat;
-        else {
-            crop = grayMat(cv::Range(vertices[1].y - 10, vertices[3].y + 10),
-                           cv::Range(vertices[0].x - 10, vertices[2].x + 10));
-        }
-        return crop;
-    }
-    catch (cv::Exception & e) {
-        return grayMat;
-    }
 }
 
 
-cv::Mat QRDetect_Decode::preprocess(cv::Mat crop) {
-    cv::Mat res;
+cv::Mat QRPipeline::preprocess(const cv::Mat& crop, Worker& worker) {
     float factor = 500.0f / (float) crop.cols;
-    cv::resize(crop, res, cv::Size(500, (int)(factor * crop.rows)), cv::INTER_AREA);
+    int rows = std::max(1, (int)(factor * crop.rows));
+    cv::Mat res = scratch(worker.res, rows, 500, CV_8UC1);
+    cv::resize(crop, res, cv::Size(500, rows), cv::INTER_AREA);
 
     // deblur
-    cv::Mat gaussian, unsharp;
+    cv::Mat gaussian = scratch(worker.gaussian, rows, 500, CV_8UC1);
+    cv::Mat unsharp = scratch(worker.unsharp, rows, 500, CV_8UC1);
     GaussianBlur(res, gaussian, cv::Size(9, 9), 10.0);
     addWeighted(res, 8, gaussian, -7, 0, unsharp);
 
     // brightness
-    cv::Mat brighten;
+    cv::Mat brighten = unsharp;
     float brightness = sum(unsharp)[0] / (255 * unsharp.rows * unsharp.cols);
     float brRatio =  brightness / 0.7f; // set minimumBrightness = 70%
 
     if (brRatio < 1) {
+        brighten = scratch(worker.brighten, rows, 500, CV_8UC1);
         convertScaleAbs(unsharp, brighten, 1.0 / brRatio, 0);
     }
-    else brighten = unsharp;
 
     // contrast
-    cv::Mat contrast;
-    cv::Ptr<cv::CLAHE> clahe = cv::createCLAHE(2.0, cv::Size(8, 8));
-    clahe->apply(brighten, contrast);
+    cv::Mat contrast = scratch(worker.contrast, rows, 500, CV_8UC1);
+    worker.clahe->apply(brighten, contrast);
 
     // binarization
-    cv::Mat bin;
+    cv::Mat bin = scratch(worker.bin, rows, 500, CV_8UC1);
     threshold(contrast, bin, 0, 255, cv::THRESH_OTSU);
 
     return bin;
 }
 
 
-std::string QRDetect_Decode::decodedData(cv::Mat image) {
-    cv::Mat crop = detectQR(image);
-    cv::Mat bin = preprocess(crop);
+cv::Mat QRPipeline::preprocessed(const cv::Mat& crop) {
+    return preprocess(crop, *workers_[0]);
+}
+
+
+void QRPipeline::decodeCandidate(size_t index, Worker& worker) {
+    // other workers already decoded what the frame is expected to hold
+    if (enough()) return;
+
+    // exceptions must not leave a pool thread, a failed candidate decodes nothing and is counted apart from cancelled ones
+    try {
+        cv::Mat bin = preprocess(crops_[index], worker);
+        if (enough()) return;
 
-    // create zbar scanner
-    zbar::ImageScanner scanner;
+        // point reused zbar image at binarized crop, rows of bin are contiguous
+        worker.image.set_size(bin.cols, bin.rows);
+        worker.image.set_data(bin.data, bin.total());
 
-    // configure scanner
-    scanner.set_config(zbar::ZBAR_QRCODE, zbar::ZBAR_CFG_ENABLE, 1);
+        // scan image, symbols of previous scan are recycled first
+        worker.scanner.scan(worker.image);
 
-    // wrap image data
-    zbar::Image wrap(bin.cols, bin.rows, "Y800", (uchar *) bin.data, bin.cols * bin.rows);
+        // extract results
+        std::vector<std::string>& codes = results_[index];
+        for (zbar::Image::SymbolIterator symbol = worker.image.symbol_begin(); symbol != worker.image.symbol_end(); ++symbol) {
+            codes.push_back(symbol->get_data());
+        }
+        {
+            std::lock_guard<std::mutex> lock(foundMutex_);
+            for (size_t i = 0; i < codes.size(); i++) {
+                if (foundCodes_.insert(codes[i]).second) found_++;
+            }
+        }
+        scanned_++;
+    }
+    catch (...) {
+        results_[index].clear();
+        failed_++;
+    }
+}
 
-    // scan image
-    scanner.scan(wrap);
 
-    // extract results
-    zbar::Image::SymbolIterator symbol = wrap.symbol_begin();
+std::vector<std::string> QRPipeline::decodeAll(const cv::Mat& image) {
+    // Worker scratch is attached to pool, scope counts the frame
+    MatPoolScope poolScope(framePool());
+
+    auto start = std::chrono::steady_clock::now();
+    const std::vector<QRCandidate>& candidates = detector_.detect(image);
+    crops_.clear();
+    for (size_t i = 0; i < candidates.size(); i++) crops_.push_back(image(candidates[i].crop));
+    // no square object, decode whole frame
+    if (crops_.empty()) crops_.push_back(image);
+    std::chrono::duration<double, std::milli> detectMs = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    results_.resize(crops_.size());
+    for (size_t i = 0; i < results_.size(); i++) results_[i].clear();
+    foundCodes_.clear();
+    found_ = 0;
+    scanned_ = 0;
+    failed_ = 0;
+    pool_.run(crops_.size(), [this](size_t item, int worker) { decodeCandidate(item, *workers_[worker]); });
+    std::chrono::duration<double, std::milli> decodeMs = std::chrono::steady_clock::now() - start;
+
+    // rank order, a code seen in two overlapping crops is reported once
+    std::vector<std::string> codes;
+    for (size_t i = 0; i < results_.size(); i++) {
+        for (size_t k = 0; k < results_[i].size(); k++) {
+            if (std::find(codes.begin(), codes.end(), results_[i][k]) == codes.end()) codes.push_back(results_[i][k]);
+        }
+    }
 
-    return symbol->get_data();
+    stats_.frames++;
+    stats_.candidates += crops_.size();
+    stats_.scanned += scanned_;
+    stats_.failed += failed_;
+    stats_.cancelled += crops_.size() - scanned_ - failed_;
+    stats_.codes += codes.size();
+    stats_.detectMs += detectMs.count();
+    stats_.decodeMs += decodeMs.count();
+    return codes;
+}
+
+
+std::string QRPipeline::decode(const cv::Mat& image) {
+    std::vector<std::string> codes = decodeAll(image);
+    return codes.empty() ? std::string() : codes[0];
+}
+
+
+void QRPipeline::printStats(std::ostream& out) const {
+    double frames = (double) std::max<uint64_t>(1, stats_.frames);
+    out << "QR pipeline: " << stats_.frames << " frames, " << pool_.threads() << " threads, "
+        << "expected codes " << config_.expectedCodes << "\n"
+        << "  candidates/frame " << stats_.candidates / frames
+        << ", scanned/frame " << stats_.scanned / frames
+        << ", cancelled " << stats_.cancelled
+        << ", failed " << stats_.failed
+        << ", codes/frame " << stats_.codes / frames << "\n"
+        << "  detect " << stats_.detectMs / frames << " ms/frame"
+        << ", decode " << stats_.decodeMs / frames << " ms/frame"
+        << ", " << (stats_.decodeMs > 0.0 ? 1000.0 * stats_.scanned / stats_.decodeMs : 0.0) << " candidates/s"
+        << ", " << (stats_.decodeMs > 0.0 ? 1000.0 * stats_.codes / stats_.decodeMs : 0.0) << " codes/s" << std::endl;
 }
 
 /** FUNCTIONS */
+const MatPool& qrMatPool() {
+    return framePool();
+}
+
 std::string QRDecoder(cv::Mat image) {
-    QRDetect_Decode detectAndDecode;
-    std::string result = detectAndDecode.decodedData(image);
-    return result;
-}
\ No newline at end of file
+    QRPipelineConfig config;
+    config.threads = 1;
+    QRPipeline pipeline(config);
+    return pipeline.decode(image);
+}
@@ -5,7 +5,114 @@
 
 #include <opencv2/core.hpp>
 #include <opencv2/imgproc.hpp>
+#include <atomic>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
 #include "zbar.h"
+#include "mat_pool.hpp"
+#include "qr_candidates.hpp"
+#include "work_stealing_pool.hpp"
 
+// Settings of QRPipeline
+struct QRPipelineConfig {
+    QRCandidateConfig candidates;
+    // Threads decoding candidates of a frame, calling thread included, 0 uses every hardware thread
+    int threads = 0;
+    // Candidates not started yet are skipped once this many codes are decoded, 0 decodes every candidate
+    int expectedCodes = 1;
+};
+
+// Counters of QRPipeline accumulated over frames, snapshot returned by stats()
+struct QRPipelineStats {
+    uint64_t frames = 0;
+    // Square regions found, frames without any decode the whole frame as one candidate
+    uint64_t candidates = 0;
+    // Candidates preprocessed and scanned, skipped once enough codes were decoded, or failed with an exception
+    uint64_t scanned = 0;
+    uint64_t cancelled = 0;
+    uint64_t failed = 0;
+    // Distinct codes decoded
+    uint64_t codes = 0;
+    // Candidate detection and parallel decode of candidates
+    double detectMs = 0.0;
+    double decodeMs = 0.0;
+};
+
+// Detect, preprocess and decode QR codes of consecutive camera frames
+// Every square region of the frame is a candidate, largest first. Candidates
+// are cropped, preprocessed and scanned as independent items on a work-stealing
+// pool, each worker with its own zbar scanner and scratch Mats. Once expectedCodes
+// codes are decoded the items still queued return without work.
+// zbar scanners are configured once and scan the same zbar::Image every frame,
+// so symbols of previous frame are recycled by the scanner instead of freed.
+// Intermediate Mats are sized on first frame and reused as long as frame
+// size does not change, preprocessing buffers as long as crop size does not change.
+// Not thread-safe, use one pipeline per analyzer thread
+class QRPipeline {
+
+public:
+    explicit QRPipeline(const QRPipelineConfig& config = QRPipelineConfig());
+
+    /* Return decoded data of every QR code in grayscale image, candidates in rank order
+     * Empty if nothing is decoded */
+    std::vector<std::string> decodeAll(const cv::Mat& image);
+
+    /* Return decoded data of first QR code in grayscale image, empty string if nothing is decoded */
+    std::string decode(const cv::Mat& image);
+
+    const QRPipelineConfig& config() const { return config_; }
+
+    QRPipelineStats stats() const { return stats_; }
+
+    /* Return crop preprocessed on first worker as decoding does, for checks
+     * Result points into worker scratch and is valid until next call */
+    cv::Mat preprocessed(const cv::Mat& crop);
+
+    /* Print candidates, codes and decode throughput per frame */
+    void printStats(std::ostream& out) const;
+
+private:
+    // zbar scanner, image and preprocessing scratch of one pool worker
+    struct Worker {
+        zbar::ImageScanner scanner;
+        zbar::Image image;
+        // 500 columns wide, rows follow crop aspect
+        cv::Mat res, gaussian, unsharp, brighten, contrast, bin;
+        cv::Ptr<cv::CLAHE> clahe;
+    };
+
+    /* Preprocess and scan candidate on worker, results go to results_[index] */
+    void decodeCandidate(size_t index, Worker& worker);
+
+    /* Preprocess detected QR code to improve decoding accuracy, result points into worker.bin */
+    static cv::Mat preprocess(const cv::Mat& crop, Worker& worker);
+
+    /* Return true once expected number of distinct codes of this frame is decoded */
+    bool enough() const { return config_.expectedCodes > 0 && found_ >= config_.expectedCodes; }
+
+    QRPipelineConfig config_;
+    QRCandidateDetector detector_;
+    WorkStealingPool pool_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    // Current frame, crops_ and results_ by candidate rank
+    std::vector<cv::Mat> crops_;
+    std::vector<std::vector<std::string>> results_;
+    // Distinct codes of current frame, a code seen in two overlapping crops counts once
+    std::mutex foundMutex_;
+    std::set<std::string> foundCodes_;
+    std::atomic<int> found_;
+    std::atomic<int> scanned_;
+    std::atomic<int> failed_;
+
+    QRPipelineStats stats_;
+};
+
+/* Decode single image with a single-threaded pipeline created for this call only */
 std::string QRDecoder(cv::Mat image);
+
+/* Pool of worker scratch buffers of every QRPipeline, for stats */
+const MatPool& qrMatPool();
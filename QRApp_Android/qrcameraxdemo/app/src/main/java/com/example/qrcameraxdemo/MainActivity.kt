@@ -15,8 +15,6 @@ import androidx.camera.lifecycle.ProcessCameraProvider
 import androidx.core.app.ActivityCompat
 import androidx.core.content.ContextCompat
 import com.example.qrcameraxdemo.databinding.ActivityMainBinding
-import org.opencv.core.CvType.CV_8UC1
-import org.opencv.core.Mat
 import java.nio.ByteBuffer
 import java.util.concurrent.ExecutorService
 import java.util.concurrent.Executors
@@ -27,6 +25,9 @@ class MainActivity : AppCompatActivity() {
 
     private lateinit var cameraExecutor: ExecutorService
 
+    // Native QR pipeline of analyzer is created once and reused for every frame
+    private val qrAnalyzer = QRAnalyzer()
+
     override fun onCreate(savedInstanceState: Bundle?) {
         super.onCreate(savedInstanceState)
         viewBinding = ActivityMainBinding.inflate(layoutInflater)
@@ -74,7 +75,7 @@ class MainActivity : AppCompatActivity() {
                 .setBackpressureStrategy(ImageAnalysis.STRATEGY_KEEP_ONLY_LATEST)
                 .build()
                 .also {
-                    it.setAnalyzer(cameraExecutor, QRAnalyzer())
+                    it.setAnalyzer(cameraExecutor, qrAnalyzer)
                 }
 
             // Select back camera as a default
@@ -151,6 +152,8 @@ class MainActivity : AppCompatActivity() {
 
     override fun onDestroy() {
         super.onDestroy()
+        // Released on analyzer thread after last queued frame
+        cameraExecutor.execute { qrAnalyzer.close() }
         cameraExecutor.shutdown()
     }
 
@@ -173,29 +176,32 @@ class MainActivity : AppCompatActivity() {
 
     private class QRAnalyzer : ImageAnalysis.Analyzer {
 
-        private fun ByteBuffer.toByteArray(): ByteArray {
-            rewind()    // Rewind the buffer to zero
-            val data = ByteArray(remaining())
-            get(data)   // Copy the buffer into a byte array
-            return data // Return the byte array
-        }
+        // Handle of native QRPipeline, 0 after close()
+        private var pipeline: Long = createQRPipeline()
 
         override fun analyze(image: ImageProxy) {
             // Image format is YUV_420_888
             // Grayscale image is extracted from Y-plane, which is index 0
-            val buffer = image.planes[0].buffer
-            val data = buffer.toByteArray()
-            val mat = Mat(image.height, image.width, CV_8UC1)
-            mat.put(0, 0, data)
+            // Direct buffer is read in place by native code, rows are rowStride bytes apart
+            val yPlane = image.planes[0]
 
 //            Log.d("Frame", "${image.height} x ${image.width}, Image format code = ${image.format}\n")
 
-            qrDecoder(mat.nativeObjAddr)
+            qrDecoderYPlane(pipeline, yPlane.buffer, image.width, image.height, yPlane.rowStride)
 
             image.close()
         }
 
-        private external fun qrDecoder(matAddr: Long)
+        fun close() {
+            if (pipeline != 0L) {
+                destroyQRPipeline(pipeline)
+                pipeline = 0L
+            }
+        }
+
+        private external fun createQRPipeline(): Long
+        private external fun destroyQRPipeline(pipeline: Long)
+        private external fun qrDecoderYPlane(pipeline: Long, yPlane: ByteBuffer, width: Int, height: Int, rowStride: Int)
     }
 
     companion object {
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include "bench_util.hpp"
+#include "binary_morph.hpp"
+#include "qr_gradient.hpp"
+
+// Former detectQR chain of opencv-zbar.cpp and wechatQR.cpp, calls kept as written
+static void formerChain(const cv::Mat& blurred, cv::Mat& expand) {
+    cv::Mat thresh, close, erosion;
+    cv::threshold(blurred, thresh, 240, 250, cv::THRESH_BINARY);
+    cv::Mat kernel = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(27, 15));
+    cv::morphologyEx(thresh, close, cv::MORPH_CLOSE, kernel);
+    cv::erode(close, erosion, 4);
+    cv::dilate(erosion, expand, 4);
+}
+
+// threshold + close + open with OpenCV, Size(1, 1) skips a step
+static void opencvCloseOpen(const cv::Mat& src, cv::Mat& dst, cv::Size closeSize, cv::Size openSize, uchar thresh) {
+    cv::threshold(src, dst, thresh, 255, cv::THRESH_BINARY);
+    if (closeSize.area() > 1) {
+        cv::morphologyEx(dst, dst, cv::MORPH_CLOSE, cv::getStructuringElement(cv::MORPH_RECT, closeSize));
+    }
+    if (openSize.area() > 1) {
+        cv::morphologyEx(dst, dst, cv::MORPH_OPEN, cv::getStructuringElement(cv::MORPH_RECT, openSize));
+    }
+}
+
+// Gradient mask of a camera-like frame: noise, text-like strokes and a few code-like blocks
+static cv::Mat makeMask(int width, int height, uint64 seed, double density) {
+    cv::RNG rng(seed);
+    cv::Mat frame(height, width, CV_8UC1);
+    rng.fill(frame, cv::RNG::UNIFORM, 0, 256);
+    cv::Mat spots(height, width, CV_8UC1);
+    rng.fill(spots, cv::RNG::UNIFORM, 0, 256);
+    frame.setTo(cv::Scalar::all(250), spots < density * 256);
+    for (int i = 0; i < 6; i++) {
+        cv::Rect block(rng.uniform(0, std::max(1, width - 4)), rng.uniform(0, std::max(1, height - 4)),
+                       rng.uniform(1, 120), rng.uniform(1, 120));
+        cv::rectangle(frame, block & cv::Rect(0, 0, width, height), cv::Scalar::all(255), cv::FILLED);
+    }
+    return frame;
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " [--runs N]\n"
+              << "  --runs N   timed runs per case (default 100)" << std::endl;
+}
+
+// Check bit-packed rectangular close/open against the former OpenCV calls bit for bit
+// and compare latency of the QR candidate mask stage on camera frame sizes
+int main(int argc, char **argv) {
+
+    int runs = 100;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--runs" && i + 1 < argc) runs = std::max(1, std::atoi(argv[++i]));
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    int failures = 0;
+    BinaryRectMorph morph;
+    std::cout << "Equivalence checks" << std::endl;
+    {
+        // Frames smaller than kernel, around word widths, odd and even kernels, dense and sparse masks
+        const int sizes[][2] = {{1, 1}, {5, 3}, {27, 15}, {63, 20}, {64, 64}, {65, 33}, {129, 97}, {333, 200}, {640, 480}};
+        const int kernels[][4] = {{27, 15, 1, 1}, {27, 15, 9, 9}, {4, 6, 3, 2}, {1, 1, 5, 1}, {3, 1, 1, 3}, {70, 3, 2, 2}, {1, 80, 1, 1}};
+        const double densities[] = {0.02, 0.3};
+        int cases = 0, mismatches = 0;
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+                for (double density : densities) {
+                    cv::Mat src = makeMask(sizes[s][0], sizes[s][1], 1000 * s + k, density), former, packed;
+                    cv::Size closeSize(kernels[k][0], kernels[k][1]), openSize(kernels[k][2], kernels[k][3]);
+                    opencvCloseOpen(src, former, closeSize, openSize, 200);
+                    morph.closeOpen(src, packed, closeSize, openSize, 200, 255);
+                    cases++;
+                    if (!same(former, packed)) {
+                        mismatches++;
+                        std::cout << "        differs at " << src.cols << "x" << src.rows << " close " << closeSize
+                                  << " open " << openSize << std::endl;
+                    }
+                }
+            }
+        }
+        check(mismatches == 0, "closeOpen equals threshold + morphologyEx close/open (" + std::to_string(cases) + " cases)", failures);
+
+        // Exact former chain on real gradient output, rows padded like a camera plane
+        cv::Mat plane = makeMask(1344, 720, 7, 0.02), blurred, former, packed;
+        scharrDiffAbsBlur(plane.colRange(0, 1280), blurred);
+        cv::Mat padded(720, 1344, CV_8UC1, cv::Scalar::all(0));
+        blurred.copyTo(padded.colRange(0, 1280));
+        formerChain(blurred, former);
+        morph.closeOpen(padded.colRange(0, 1280), packed, cv::Size(27, 15), cv::Size(1, 1), 240, 250);
+        check(same(former, packed), "QR chain (threshold 240/250, close 27x15, erode/dilate with 4) unchanged", failures);
+    }
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::endl << std::left << std::setw(12) << "frame" << std::right << std::setw(12) << "former"
+              << std::setw(12) << "packed" << std::setw(9) << "speedup" << std::setw(16) << "close+open 9x9"
+              << std::setw(12) << "packed" << std::setw(9) << "speedup" << "   (ms)" << std::endl;
+    const int frames[][2] = {{640, 480}, {1280, 720}, {1920, 1080}};
+    for (size_t i = 0; i < sizeof(frames) / sizeof(frames[0]); i++) {
+        cv::Mat src = makeMask(frames[i][0], frames[i][1], 99 + i, 0.02), dst;
+        double former = timeMs(runs, [&]() { formerChain(src, dst); });
+        double packed = timeMs(runs, [&]() { morph.closeOpen(src, dst, cv::Size(27, 15), cv::Size(1, 1), 240, 250); });
+        double formerOpen = timeMs(runs, [&]() { opencvCloseOpen(src, dst, cv::Size(27, 15), cv::Size(9, 9), 240); });
+        double packedOpen = timeMs(runs, [&]() { morph.closeOpen(src, dst, cv::Size(27, 15), cv::Size(9, 9), 240, 255); });
+        std::cout << std::left << std::setw(12) << (std::to_string(src.cols) + "x" + std::to_string(src.rows))
+                  << std::right << std::setw(12) << former << std::setw(12) << packed << std::setw(8) << former / packed << "x"
+                  << std::setw(16) << formerOpen << std::setw(12) << packedOpen << std::setw(8) << formerOpen / packedOpen
+                  << "x" << std::endl;
+    }
+
+    if (failures) std::cout << "FAILED: " << failures << " checks" << std::endl;
+    else std::cout << "All checks passed" << std::endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vector>
+#include <opencv2/core.hpp>
+#include "binary_morph.hpp"
+
+// Square region of a frame that may hold a QR code
+struct QRCandidate {
+    // Corners of rotated bounding box, order of cv::RotatedRect::points
+    cv::Point2f corners[4];
+    // Bounding box of corners expanded by margin and clipped to frame, region to decode
+    cv::Rect crop;
+    // Contour area, candidates are ranked by it
+    double area = 0.0;
+};
+
+// Settings of QRCandidateDetector
+struct QRCandidateConfig {
+    // Candidates returned per frame, largest first
+    int maxCandidates = 4;
+    // Width / height of rotated box must be within this of 1
+    float maxAspectError = 0.1f;
+    // Pixels added on each side of crop
+    int margin = 10;
+};
+
+// Locate QR code candidates in grayscale frames
+// |Scharr x - Scharr y| is high inside codes, it is blurred, thresholded and
+// closed into blobs with a 27x15 kernel (frames are wider than tall), and every
+// near-square external contour is a candidate. Candidates are ranked by contour
+// area, so the former single pick (largest square) comes first while further
+// codes or a large square distractor no longer hide each other.
+// Scratch Mats are reused across frames, not thread-safe.
+class QRCandidateDetector {
+
+public:
+    explicit QRCandidateDetector(const QRCandidateConfig& config = QRCandidateConfig()) : config_(config) {}
+
+    /* Return candidates of gray frame ranked by area, empty if none is found
+     * Reference is valid until next call */
+    const std::vector<QRCandidate>& detect(const cv::Mat& gray);
+
+    const QRCandidateConfig& config() const { return config_; }
+
+private:
+    QRCandidateConfig config_;
+
+    // Full frame size, reused while frame size does not change
+    cv::Mat gradientWork_, blurred_, expand_;
+    BinaryRectMorph morph_;
+    std::vector<std::vector<cv::Point>> contours_;
+    std::vector<QRCandidate> candidates_;
+};
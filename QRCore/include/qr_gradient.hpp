@@ -0,0 +1,23 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+
+// |Scharr x - Scharr y| of 8-bit gray frame in one pass, for QR region detection
+//
+// Replaces Sobel(CV_32F, 1, 0, -1), Sobel(CV_32F, 0, 1, -1), subtract and
+// convertScaleAbs of the QR detectors: three full-frame float passes and two
+// float buffers. The two 3x3 Scharr kernels fold into one,
+//   Gx - Gy = 6 (p[y-1][x+1] - p[y+1][x-1]) + 10 (p[y-1][x] + p[y][x+1] - p[y][x-1] - p[y+1][x]),
+// whose magnitude stays below 6631, so it is computed in 16-bit integer lanes
+// with universal intrinsics and saturated straight to 8 bits.
+// Border is BORDER_REFLECT_101 like Sobel, output equals the former sequence bit for bit.
+// Input rows may be padded (camera Y plane). Frames smaller than 2x2 fall back to the former sequence.
+void scharrDiffAbs(const cv::Mat& gray, cv::Mat& dst);
+
+/* Same followed by blur(Size(5, 5)), gradient rows go through a 5-row ring and are
+ * never stored as a full image, output equals blur() of scharrDiffAbs() bit for bit
+ * workspace holds the ring and column sums, keep it between frames to avoid reallocation */
+void scharrDiffAbsBlur(const cv::Mat& gray, cv::Mat& dst, cv::Mat& workspace);
+
+/* Same with workspace allocated for this call */
+void scharrDiffAbsBlur(const cv::Mat& gray, cv::Mat& dst);
@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include "bench_util.hpp"
+#include "qr_gradient.hpp"
+
+// Former detectQR sequence of opencv-zbar.cpp and wechatQR.cpp
+static void formerGradient(const cv::Mat& gray, cv::Mat& dst) {
+    cv::Mat gradX, gradY, gradient;
+    cv::Sobel(gray, gradX, CV_32F, 1, 0, -1);
+    cv::Sobel(gray, gradY, CV_32F, 0, 1, -1);
+    cv::subtract(gradX, gradY, gradient);
+    cv::convertScaleAbs(gradient, dst);
+}
+
+static void formerGradientBlur(const cv::Mat& gray, cv::Mat& dst) {
+    cv::Mat gradient;
+    formerGradient(gray, gradient);
+    cv::blur(gradient, dst, cv::Size(5, 5));
+}
+
+// Camera-like gray frame: smooth noise with a few sharp high-contrast blocks so gradients saturate
+static cv::Mat makeFrame(int width, int height, uint64 seed) {
+    cv::RNG rng(seed);
+    cv::Mat frame(height, width, CV_8UC1);
+    rng.fill(frame, cv::RNG::UNIFORM, 0, 256);
+    cv::GaussianBlur(frame, frame, cv::Size(0, 0), 1.5);
+    for (int i = 0; i < 12; i++) {
+        cv::Rect block(rng.uniform(0, std::max(1, width - 8)), rng.uniform(0, std::max(1, height - 8)),
+                       rng.uniform(1, 40), rng.uniform(1, 40));
+        cv::rectangle(frame, block & cv::Rect(0, 0, width, height), cv::Scalar::all(rng.uniform(0, 2) * 255), cv::FILLED);
+    }
+    return frame;
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " [--runs N]\n"
+              << "  --runs N   timed runs per case (default 100)" << std::endl;
+}
+
+// Check fused |Scharr x - Scharr y| (+ 5x5 blur) against the former float sequence
+// bit for bit and compare latency on camera frame sizes
+int main(int argc, char **argv) {
+
+    int runs = 100;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--runs" && i + 1 < argc) runs = std::max(1, std::atoi(argv[++i]));
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    int failures = 0;
+    std::cout << "Equivalence checks" << std::endl;
+    {
+        // Sizes around vector widths and tiny frames that use every border case
+        const int sizes[][2] = {{1, 1}, {2, 2}, {3, 2}, {2, 5}, {5, 5}, {17, 3}, {31, 33}, {63, 64}, {65, 66},
+                                {127, 129}, {640, 480}, {1280, 720}};
+        bool gradientOk = true, blurOk = true;
+        cv::Mat workspace;
+        for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+            cv::Mat gray = makeFrame(sizes[i][0], sizes[i][1], 20220428 + i), former, fused;
+            formerGradient(gray, former);
+            scharrDiffAbs(gray, fused);
+            if (!same(former, fused)) {
+                std::cout << "        gradient differs at " << gray.cols << "x" << gray.rows << std::endl;
+                gradientOk = false;
+            }
+            formerGradientBlur(gray, former);
+            scharrDiffAbsBlur(gray, fused, workspace);
+            if (!same(former, fused)) {
+                std::cout << "        gradient + blur differs at " << gray.cols << "x" << gray.rows << std::endl;
+                blurOk = false;
+            }
+        }
+        check(gradientOk, "scharrDiffAbs equals Sobel/subtract/convertScaleAbs on all sizes", failures);
+        check(blurOk, "scharrDiffAbsBlur equals former sequence + blur(5x5) on all sizes", failures);
+
+        // Y plane with padded rows, read through step
+        cv::Mat plane = makeFrame(704, 480, 7), former, fused;
+        cv::Mat y = plane.colRange(0, 640);
+        formerGradientBlur(y, former);
+        scharrDiffAbsBlur(y, fused);
+        check(same(former, fused), "padded rows read through step", failures);
+
+        // Every possible window sum, gradients saturated at 255 included
+        cv::Mat flat(64, 64, CV_8UC1, cv::Scalar::all(0));
+        cv::rectangle(flat, cv::Rect(20, 20, 24, 24), cv::Scalar::all(255), cv::FILLED);
+        formerGradientBlur(flat, former);
+        scharrDiffAbsBlur(flat, fused);
+        check(same(former, fused), "saturated edges and rounding of 5x5 mean", failures);
+    }
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::endl << std::left << std::setw(12) << "frame" << std::right << std::setw(11) << "former"
+              << std::setw(11) << "fused" << std::setw(9) << "speedup" << std::setw(13) << "former+blur"
+              << std::setw(13) << "fused+blur" << std::setw(9) << "speedup" << "   (ms)" << std::endl;
+    const int frames[][2] = {{640, 480}, {1280, 720}, {1920, 1080}};
+    for (size_t i = 0; i < sizeof(frames) / sizeof(frames[0]); i++) {
+        cv::Mat gray = makeFrame(frames[i][0], frames[i][1], 99 + i), dst, workspace;
+        double former = timeMs(runs, [&]() { formerGradient(gray, dst); });
+        double fused = timeMs(runs, [&]() { scharrDiffAbs(gray, dst); });
+        double formerBlur = timeMs(runs, [&]() { formerGradientBlur(gray, dst); });
+        double fusedBlur = timeMs(runs, [&]() { scharrDiffAbsBlur(gray, dst, workspace); });
+        std::cout << std::left << std::setw(12) << (std::to_string(gray.cols) + "x" + std::to_string(gray.rows))
+                  << std::right << std::setw(11) << former << std::setw(11) << fused << std::setw(8) << former / fused << "x"
+                  << std::setw(13) << formerBlur << std::setw(13) << fusedBlur << std::setw(8) << formerBlur / fusedBlur
+                  << "x" << std::endl;
+    }
+
+    if (failures) std::cout << "FAILED: " << failures << " checks" << std::endl;
+    else std::cout << "All checks passed" << std::endl;
+    return failures ? 1 : 0;
+}
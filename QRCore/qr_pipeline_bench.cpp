@@ -0,0 +1,277 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+#include <opencv2/videoio.hpp>
+#include "bench_util.hpp"
+#include "opencv-zbar.h"
+
+// C++ heap allocations of whole process, Mat buffers are counted by qrMatPool()
+static std::atomic<uint64_t> newCalls(0);
+
+void* operator new(size_t size) {
+    newCalls++;
+    void* p = std::malloc(size ? size : 1);
+    if (p == NULL) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+// Y-plane-like 1280x720 frames with one generated code drifting over noise
+static void syntheticFrames(int count, std::vector<cv::Mat>& frames) {
+    cv::Ptr<cv::QRCodeEncoder> encoder = cv::QRCodeEncoder::create();
+    cv::RNG rng(20220428);
+    for (int i = 0; i < count; i++) {
+        cv::Mat code, scaled;
+        encoder->encode("frame " + std::to_string(i), code);
+        int side = 240 + 8 * (i % 10);
+        cv::resize(code, scaled, cv::Size(side, side), 0, 0, cv::INTER_NEAREST);
+
+        cv::Mat frame(720, 1280, CV_8UC1);
+        rng.fill(frame, cv::RNG::UNIFORM, 70, 190);
+        cv::Rect place(300 + 6 * (i % 40), 150 + 3 * (i % 40), side, side);
+        scaled.copyTo(frame(place));
+        frames.push_back(frame);
+    }
+}
+
+// 1280x720 frames with three codes and a larger square of dense texture that looks like a code to the detector
+static void multiCodeFrames(int count, std::vector<cv::Mat>& frames) {
+    cv::Ptr<cv::QRCodeEncoder> encoder = cv::QRCodeEncoder::create();
+    cv::RNG rng(20220510);
+    for (int i = 0; i < count; i++) {
+        cv::Mat frame(720, 1280, CV_8UC1);
+        rng.fill(frame, cv::RNG::UNIFORM, 70, 190);
+        cv::GaussianBlur(frame, frame, cv::Size(0, 0), 3.0);
+
+        // distractor, biggest square of the frame, the former detector cropped only this
+        cv::Mat texture(300, 300, CV_8UC1);
+        rng.fill(texture, cv::RNG::UNIFORM, 0, 2);
+        cv::Mat cells;
+        cv::resize(texture * 255, cells, cv::Size(360, 360), 0, 0, cv::INTER_NEAREST);
+        cells.copyTo(frame(cv::Rect(40 + 4 * (i % 10), 60, 360, 360)));
+
+        const cv::Point places[] = {cv::Point(480, 80), cv::Point(900, 80), cv::Point(700, 430)};
+        for (int k = 0; k < 3; k++) {
+            cv::Mat code, scaled;
+            encoder->encode("frame " + std::to_string(i) + " code " + std::to_string(k), code);
+            // 2 pixel modules, coarser clean codes are too sparse in gradient to pass the detector threshold
+            cv::resize(code, scaled, cv::Size(), 2, 2, cv::INTER_NEAREST);
+            scaled.copyTo(frame(cv::Rect(places[k].x + 2 * (i % 10), places[k].y, scaled.cols, scaled.rows)));
+        }
+        frames.push_back(frame);
+    }
+}
+
+// Codes and throughput of one multi-candidate run
+struct MultiResult {
+    std::vector<std::vector<std::string>> decoded;
+    QRPipelineStats stats;
+    double meanMs = 0.0;
+};
+
+static MultiResult runMulti(const std::vector<cv::Mat>& frames, const QRPipelineConfig& config) {
+    QRPipeline pipeline(config);
+    // Untimed frame sizes pipeline buffers
+    pipeline.decodeAll(frames[0]);
+    QRPipelineStats before = pipeline.stats();
+
+    MultiResult r;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < frames.size(); i++) r.decoded.push_back(pipeline.decodeAll(frames[i]));
+    r.meanMs = elapsedMs(start) / frames.size();
+
+    QRPipelineStats after = pipeline.stats();
+    r.stats.frames = after.frames - before.frames;
+    r.stats.candidates = after.candidates - before.candidates;
+    r.stats.scanned = after.scanned - before.scanned;
+    r.stats.cancelled = after.cancelled - before.cancelled;
+    r.stats.failed = after.failed - before.failed;
+    r.stats.codes = after.codes - before.codes;
+    r.stats.detectMs = after.detectMs - before.detectMs;
+    r.stats.decodeMs = after.decodeMs - before.decodeMs;
+    return r;
+}
+
+static void printMultiRow(const std::string& name, const MultiResult& r) {
+    double n = (double) std::max<uint64_t>(1, r.stats.frames);
+    std::cout << std::left << std::setw(22) << name << std::right << std::setw(11) << r.stats.candidates / n
+              << std::setw(10) << r.stats.scanned / n << std::setw(9) << r.stats.codes / n
+              << std::setw(9) << r.meanMs << std::setw(11) << r.stats.decodeMs / n
+              << std::setw(13) << (r.stats.decodeMs > 0.0 ? 1000.0 * r.stats.scanned / r.stats.decodeMs : 0.0) << std::endl;
+}
+
+// Allocations and latency of one run over all frames
+struct RunResult {
+    std::vector<std::string> decoded;
+    double matAllocations = 0.0;
+    double heapAllocations = 0.0;
+    double newCalls = 0.0;
+    double meanMs = 0.0;
+    double maxMs = 0.0;
+};
+
+// Decode every frame, with a pipeline created per frame (former QRDecoder()) or one reused pipeline
+static RunResult run(const std::vector<cv::Mat>& frames, QRPipeline* reused) {
+    RunResult r;
+    MatPoolStats before = qrMatPool().stats();
+    uint64_t calls = newCalls;
+    double total = 0.0;
+    for (size_t i = 0; i < frames.size(); i++) {
+        auto start = std::chrono::steady_clock::now();
+        r.decoded.push_back(reused ? reused->decode(frames[i]) : QRDecoder(frames[i]));
+        double ms = elapsedMs(start);
+        total += ms;
+        r.maxMs = std::max(r.maxMs, ms);
+    }
+    MatPoolStats after = qrMatPool().stats();
+    double n = (double) frames.size();
+    r.matAllocations = (after.allocations - before.allocations) / n;
+    r.heapAllocations = (after.heapAllocations - before.heapAllocations) / n;
+    r.newCalls = (newCalls - calls) / n;
+    r.meanMs = total / n;
+    return r;
+}
+
+static void printRow(const std::string& name, const RunResult& r) {
+    int decoded = (int) std::count_if(r.decoded.begin(), r.decoded.end(), [](const std::string& s) { return !s.empty(); });
+    std::cout << std::left << std::setw(12) << name << std::right << std::setw(12) << r.matAllocations
+              << std::setw(12) << r.heapAllocations << std::setw(12) << r.newCalls
+              << std::setw(9) << r.meanMs << std::setw(9) << r.maxMs << std::setw(9) << decoded << std::endl;
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " [video | image directory | glob] [options]\n"
+              << "  --frames N   frames to decode (default 60, synthetic 720p codes without input)" << std::endl;
+}
+
+// Compare QRDecoder() creating detector, scanner and Mats per frame against a
+// QRPipeline reused across frames, report Mat and C++ heap allocations per frame,
+// then codes, candidates per frame and decode throughput on frames with several codes
+int main(int argc, char **argv) {
+
+    std::string input;
+    int maxFrames = 60;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) maxFrames = std::max(1, std::atoi(argv[++i]));
+        else if (input.empty() && !arg.empty() && arg[0] != '-') input = arg;
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    std::vector<cv::Mat> frames;
+    if (input.empty()) syntheticFrames(maxFrames, frames);
+    else if (!loadFrames(input, maxFrames, frames, true)) {
+        std::cout << "Cannot read frames from " << input << std::endl;
+        return -1;
+    }
+
+    // Untimed pass fills Mat pool and pipeline buffers
+    QRPipeline pipeline;
+    run(frames, NULL);
+    run(frames, &pipeline);
+
+    RunResult perFrame = run(frames, NULL);
+    RunResult reused = run(frames, &pipeline);
+
+    // Smaller frames after larger ones, scratch Mats are resized
+    std::vector<cv::Mat> halves;
+    for (size_t i = 0; i < frames.size(); i++) {
+        cv::Mat half;
+        cv::resize(frames[i], half, cv::Size(), 0.5, 0.5, cv::INTER_AREA);
+        halves.push_back(half);
+    }
+    RunResult halfPerFrame = run(halves, NULL);
+    RunResult halfReused = run(halves, &pipeline);
+
+    int failures = 0;
+    std::cout << "Pipeline checks" << std::endl;
+    check(reused.decoded == perFrame.decoded, "reused pipeline decodes same data as per-frame decoder", failures);
+    check(halfReused.decoded == halfPerFrame.decoded, "same data after frame size change", failures);
+    {
+        // Short crop after a tall one must not see rows left in scratch, 250 rows are not a multiple of CLAHE tiles
+        cv::Mat source;
+        cv::resize(frames[0], source, cv::Size(640, 640), 0, 0, cv::INTER_AREA);
+        cv::Rect tall(100, 100, 200, 400), wide(100, 100, 400, 200);
+        QRPipeline fresh;
+        cv::Mat expected = fresh.preprocessed(source(wide)).clone();
+        pipeline.preprocessed(source(tall));
+        check(same(pipeline.preprocessed(source(wide)), expected), "preprocess pixels unchanged after crop size change", failures);
+    }
+    check(reused.matAllocations < perFrame.matAllocations, "fewer Mat allocations per frame", failures);
+    check(reused.newCalls < perFrame.newCalls, "fewer C++ heap allocations per frame", failures);
+
+    // Several codes and a larger square distractor per frame: former single crop against ranked candidates,
+    // decoded on 1 and N threads with and without cancellation after the expected 3 codes
+    std::vector<cv::Mat> multi;
+    multiCodeFrames(std::min(maxFrames, 30), multi);
+    QRPipelineConfig single;
+    single.candidates.maxCandidates = 1;
+    single.threads = 1;
+    QRPipelineConfig ranked;
+    ranked.threads = 1;
+    ranked.expectedCodes = 3;
+    QRPipelineConfig parallel = ranked;
+    parallel.threads = 0;
+    QRPipelineConfig firstCode = ranked;
+    firstCode.expectedCodes = 1;
+    QRPipelineConfig exhaustive = parallel;
+    exhaustive.expectedCodes = 0;
+    MultiResult singleRun = runMulti(multi, single);
+    MultiResult rankedRun = runMulti(multi, ranked);
+    MultiResult parallelRun = runMulti(multi, parallel);
+    MultiResult firstRun = runMulti(multi, firstCode);
+    MultiResult exhaustiveRun = runMulti(multi, exhaustive);
+
+    check(rankedRun.stats.codes > singleRun.stats.codes, "ranked candidates decode codes the single largest crop misses", failures);
+    check(parallelRun.decoded == rankedRun.decoded, "parallel decode returns same codes in rank order as one thread", failures);
+    check(firstRun.stats.cancelled > 0 && firstRun.stats.scanned < rankedRun.stats.scanned,
+          "candidates after first decoded code are cancelled", failures);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\nInput: " << (input.empty() ? "generated codes" : input) << " " << frames[0].cols << "x" << frames[0].rows
+              << ", " << frames.size() << " frames" << std::endl;
+    std::cout << std::left << std::setw(12) << "decoder" << std::right << std::setw(12) << "Mat/frame"
+              << std::setw(12) << "heap/frame" << std::setw(12) << "new/frame"
+              << std::setw(9) << "mean ms" << std::setw(9) << "max ms" << std::setw(9) << "decoded" << std::endl;
+    printRow("per-frame", perFrame);
+    printRow("reused", reused);
+    printRow("per-frame/2", halfPerFrame);
+    printRow("reused/2", halfReused);
+    std::cout << "\nMulti-code frames: 1280x720, 3 codes and a larger textured square, " << multi.size() << " frames" << std::endl;
+    std::cout << std::left << std::setw(22) << "decoder" << std::right << std::setw(11) << "cand/frame"
+              << std::setw(10) << "scanned" << std::setw(9) << "codes" << std::setw(9) << "mean ms"
+              << std::setw(11) << "decode ms" << std::setw(13) << "candidates/s" << std::endl;
+    printMultiRow("largest square", singleRun);
+    printMultiRow("ranked, 1 thread", rankedRun);
+    printMultiRow("ranked, first code", firstRun);
+    std::string cores = std::to_string(std::max(1u, std::thread::hardware_concurrency()));
+    printMultiRow("ranked, " + cores + " threads", parallelRun);
+    printMultiRow("ranked, no cancel", exhaustiveRun);
+    qrMatPool().printStats(std::cout);
+
+    if (failures) std::cout << "FAILED: " << failures << " checks" << std::endl;
+    else std::cout << "All checks passed" << std::endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,195 @@
+#include "binary_morph.hpp"
+#include <cstring>
+#include <opencv2/core/hal/intrin.hpp>
+
+// acc[x] |= acc[x + d] over a packed row, bits past the row end are clear
+static void shiftOrRight(uint64_t* acc, int words, int d) {
+    int q = d >> 6, s = d & 63;
+    if (q == 0 && s != 0) {
+        // Spans of row kernels stay below one word
+        for (int i = 0; i < words - 1; i++) acc[i] |= (acc[i] >> s) | (acc[i + 1] << (64 - s));
+        acc[words - 1] |= acc[words - 1] >> s;
+        return;
+    }
+    for (int i = 0; i < words; i++) {
+        uint64_t lo = i + q < words ? acc[i + q] : 0;
+        uint64_t hi = i + q + 1 < words ? acc[i + q + 1] : 0;
+        acc[i] |= s ? (lo >> s) | (hi << (64 - s)) : lo;
+    }
+}
+
+// acc[x] |= acc[x - d] over a packed row, pixels left of the row are clear
+static void shiftOrLeft(uint64_t* acc, int words, int d) {
+    int q = d >> 6, s = d & 63;
+    if (q == 0 && s != 0) {
+        for (int i = words - 1; i > 0; i--) acc[i] |= (acc[i] << s) | (acc[i - 1] >> (64 - s));
+        acc[0] |= acc[0] << s;
+        return;
+    }
+    for (int i = words - 1; i >= 0; i--) {
+        uint64_t lo = i - q >= 0 ? acc[i - q] : 0;
+        uint64_t hi = i - q - 1 >= 0 ? acc[i - q - 1] : 0;
+        acc[i] |= s ? (lo << s) | (hi >> (64 - s)) : lo;
+    }
+}
+
+// OR of len pixels starting at x (right) or ending at x (left), span doubles each pass
+static void spanOr(uint64_t* acc, int words, int len, bool right) {
+    int span = 1;
+    for (; span * 2 <= len; span *= 2) {
+        if (right) shiftOrRight(acc, words, span);
+        else shiftOrLeft(acc, words, span);
+    }
+    if (span < len) {
+        if (right) shiftOrRight(acc, words, len - span);
+        else shiftOrLeft(acc, words, len - span);
+    }
+}
+
+// dst = a | b, missing rows are empty
+static void orRows(uint64_t* dst, const uint64_t* a, const uint64_t* b, int words) {
+    if (a && b) {
+        for (int i = 0; i < words; i++) dst[i] = a[i] | b[i];
+    }
+    else if (a || b) {
+        std::memcpy(dst, a ? a : b, words * sizeof(uint64_t));
+    }
+    else {
+        std::memset(dst, 0, words * sizeof(uint64_t));
+    }
+}
+
+void BinaryRectMorph::pack(const cv::Mat& src, uchar thresh) {
+    CV_Assert(src.type() == CV_8UC1);
+    rows_ = src.rows;
+    cols_ = src.cols;
+    words_ = (cols_ + 63) / 64;
+    lastMask_ = (cols_ & 63) ? ((uint64_t) 1 << (cols_ & 63)) - 1 : ~(uint64_t) 0;
+    bits_.assign((size_t) rows_ * words_, 0);
+
+    for (int y = 0; y < rows_; y++) {
+        const uchar* p = src.ptr<uchar>(y);
+        uint64_t* row = &bits_[(size_t) y * words_];
+        int x = 0;
+#if CV_SIMD128
+        const cv::v_uint8x16 t = cv::v_setall_u8(thresh);
+        for (; x + 64 <= cols_; x += 64) {
+            uint64_t word = 0;
+            for (int k = 0; k < 4; k++) {
+                word |= (uint64_t) (unsigned) cv::v_signmask(cv::v_load(p + x + k * 16) > t) << (k * 16);
+            }
+            row[x >> 6] = word;
+        }
+#endif
+        for (; x < cols_; x++) {
+            if (p[x] > thresh) row[x >> 6] |= (uint64_t) 1 << (x & 63);
+        }
+    }
+}
+
+void BinaryRectMorph::unpack(cv::Mat& dst, uchar value) const {
+    // 8 bits to 8 bytes of 0xFF or 0
+    static const std::vector<uint64_t> expand = [] {
+        std::vector<uint64_t> table(256);
+        for (int b = 0; b < 256; b++) {
+            uint64_t bytes = 0;
+            for (int k = 0; k < 8; k++) {
+                if (b & (1 << k)) bytes |= (uint64_t) 0xFF << (k * 8);
+            }
+            table[b] = bytes;
+        }
+        return table;
+    }();
+    const uint64_t fill = (uint64_t) value * 0x0101010101010101ULL;
+
+    dst.create(rows_, cols_, CV_8UC1);
+    for (int y = 0; y < rows_; y++) {
+        const uint64_t* row = &bits_[(size_t) y * words_];
+        uchar* out = dst.ptr<uchar>(y);
+        int x = 0;
+        for (; x + 8 <= cols_; x += 8) {
+            uint64_t bytes = expand[(row[x >> 6] >> (x & 63)) & 0xFF] & fill;
+            std::memcpy(out + x, &bytes, 8);
+        }
+        for (; x < cols_; x++) out[x] = ((row[x >> 6] >> (x & 63)) & 1) ? value : 0;
+    }
+}
+
+void BinaryRectMorph::complement() {
+    for (int y = 0; y < rows_; y++) {
+        uint64_t* row = &bits_[(size_t) y * words_];
+        for (int i = 0; i < words_; i++) row[i] = ~row[i];
+        row[words_ - 1] &= lastMask_;
+    }
+}
+
+void BinaryRectMorph::dilate(int w, int h) {
+    if (w > 1) {
+        // Window [x - w / 2, x + w - 1 - w / 2]: OR looking right and looking left from x
+        right_.resize(words_);
+        left_.resize(words_);
+        for (int y = 0; y < rows_; y++) {
+            uint64_t* row = &bits_[(size_t) y * words_];
+            std::memcpy(right_.data(), row, words_ * sizeof(uint64_t));
+            std::memcpy(left_.data(), row, words_ * sizeof(uint64_t));
+            spanOr(right_.data(), words_, w - w / 2, true);
+            spanOr(left_.data(), words_, w / 2 + 1, false);
+            for (int i = 0; i < words_; i++) row[i] = right_[i] | left_[i];
+            row[words_ - 1] &= lastMask_;
+        }
+    }
+
+    if (h > 1) {
+        // Rows padded with h / 2 empty rows above and h - 1 - h / 2 below, in blocks of h
+        // Window of output row y is padded rows [y, y + h - 1] = suffix OR of y | prefix OR of y + h - 1
+        const int anchor = h / 2, padded = rows_ + h - 1;
+        const size_t rowWords = (size_t) words_;
+        prefix_.resize((size_t) padded * rowWords);
+        suffix_.resize((size_t) padded * rowWords);
+
+        for (int e = 0; e < padded; e++) {
+            int y = e - anchor;
+            const uint64_t* in = (y >= 0 && y < rows_) ? &bits_[y * rowWords] : NULL;
+            const uint64_t* last = (e % h != 0) ? &prefix_[(e - 1) * rowWords] : NULL;
+            orRows(&prefix_[e * rowWords], in, last, words_);
+        }
+        for (int e = padded - 1; e >= 0; e--) {
+            int y = e - anchor;
+            const uint64_t* in = (y >= 0 && y < rows_) ? &bits_[y * rowWords] : NULL;
+            const uint64_t* next = (e % h != h - 1 && e + 1 < padded) ? &suffix_[(e + 1) * rowWords] : NULL;
+            orRows(&suffix_[e * rowWords], in, next, words_);
+        }
+        for (int y = 0; y < rows_; y++) {
+            uint64_t* row = &bits_[y * rowWords];
+            const uint64_t* suf = &suffix_[y * rowWords];
+            const uint64_t* pre = &prefix_[(y + h - 1) * rowWords];
+            for (int i = 0; i < words_; i++) row[i] = suf[i] | pre[i];
+        }
+    }
+}
+
+void BinaryRectMorph::erode(int w, int h) {
+    // Pixels outside frame are clear in complement, so they never erode the mask
+    complement();
+    dilate(w, h);
+    complement();
+}
+
+void BinaryRectMorph::closeOpen(const cv::Mat& src, cv::Mat& dst, cv::Size closeSize, cv::Size openSize,
+                                uchar thresh, uchar value) {
+    CV_Assert(closeSize.width > 0 && closeSize.height > 0 && openSize.width > 0 && openSize.height > 0);
+    if (src.empty()) {
+        dst.release();
+        return;
+    }
+    pack(src, thresh);
+    if (closeSize.area() > 1) {
+        dilate(closeSize.width, closeSize.height);
+        erode(closeSize.width, closeSize.height);
+    }
+    if (openSize.area() > 1) {
+        erode(openSize.width, openSize.height);
+        dilate(openSize.width, openSize.height);
+    }
+    unpack(dst, value);
+}
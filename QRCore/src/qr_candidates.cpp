@@ -0,0 +1,49 @@
+#include "qr_candidates.hpp"
+#include <algorithm>
+#include <opencv2/imgproc.hpp>
+#include "qr_gradient.hpp"
+
+const std::vector<QRCandidate>& QRCandidateDetector::detect(const cv::Mat& gray) {
+    candidates_.clear();
+    if (gray.empty()) return candidates_;
+
+    // detect horizontal and vertical edges
+    // |Scharr x - Scharr y| in 8 bits, smoothed with 5x5 box blur in the same pass
+    scharrDiffAbsBlur(gray, blurred_, gradientWork_);
+
+    // binarize the image and close small gaps in object on bit-packed mask
+    // image width is larger then height, so use wider kernel
+    // former erode(close, erosion, 4) and dilate(erosion, expand, 4) bound 4 to a 1x1 kernel
+    // and left the mask unchanged, so there is no open step
+    morph_.closeOpen(blurred_, expand_, cv::Size(27, 15), cv::Size(1, 1), 240, 250);
+
+    cv::findContours(expand_, contours_, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
+
+    // since QR code is square, keep every near-square object
+    const cv::Rect frame(0, 0, gray.cols, gray.rows);
+    for (size_t i = 0; i < contours_.size(); i++) {
+        cv::RotatedRect box = cv::minAreaRect(contours_[i]);
+        float ratio = box.size.width / box.size.height;
+        if (!(ratio > 1.0f - config_.maxAspectError && ratio < 1.0f + config_.maxAspectError)) continue;
+
+        QRCandidate candidate;
+        box.points(candidate.corners);
+        candidate.area = cv::contourArea(contours_[i]);
+
+        // expand each side of bounding box by margin, rotated codes keep their corners
+        cv::Rect bounds = cv::boundingRect(std::vector<cv::Point2f>(candidate.corners, candidate.corners + 4));
+        bounds.x -= config_.margin;
+        bounds.y -= config_.margin;
+        bounds.width += 2 * config_.margin;
+        bounds.height += 2 * config_.margin;
+        candidate.crop = bounds & frame;
+        if (candidate.crop.empty()) continue;
+        candidates_.push_back(candidate);
+    }
+
+    // biggest first, equal areas keep contour order like the former single pick
+    std::stable_sort(candidates_.begin(), candidates_.end(),
+                     [](const QRCandidate& a, const QRCandidate& b) { return a.area > b.area; });
+    if ((int) candidates_.size() > config_.maxCandidates) candidates_.resize(std::max(0, config_.maxCandidates));
+    return candidates_;
+}
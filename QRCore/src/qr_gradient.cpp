@@ -0,0 +1,163 @@
+#include "qr_gradient.hpp"
+#include <opencv2/core/hal/intrin.hpp>
+#include <opencv2/imgproc.hpp>
+
+// blur(Size(5, 5)) divides window sums up to 25 * 255 by 25 with rounding:
+// (sum + 12) / 25 == ((sum + 12) * BLUR_MUL >> 16) >> BLUR_SHIFT for every such sum (bit-exact)
+static const int BLUR_MUL = 10486;
+static const int BLUR_SHIFT = 2;
+
+static inline int reflect(int i, int n) {
+    return cv::borderInterpolate(i, n, cv::BORDER_REFLECT_101);
+}
+
+static inline uchar diffAbs(const uchar* up, const uchar* mid, const uchar* down, int x, int left, int right) {
+    int d = 6 * (up[right] - down[left]) + 10 * (up[x] + mid[right] - mid[left] - down[x]);
+    d = d < 0 ? -d : d;
+    return (uchar) (d > 255 ? 255 : d);
+}
+
+#if CV_SIMD
+// Folded Scharr difference of 16-bit lanes, saturated to 8 bits
+static inline cv::v_uint16 diffAbsLanes(const cv::v_int16& upRight, const cv::v_int16& downLeft, const cv::v_int16& up,
+                                        const cv::v_int16& midRight, const cv::v_int16& midLeft, const cv::v_int16& down) {
+    cv::v_int16 d = cv::vx_setall_s16(6) * (upRight - downLeft) + cv::vx_setall_s16(10) * (up + midRight - midLeft - down);
+    return cv::v_abs(d);
+}
+
+static inline void expandSigned(const uchar* p, cv::v_int16& lo, cv::v_int16& hi) {
+    cv::v_uint16 a, b;
+    cv::v_expand(cv::vx_load(p), a, b);
+    lo = cv::v_reinterpret_as_s16(a);
+    hi = cv::v_reinterpret_as_s16(b);
+}
+#endif
+
+// One output row from the input row above, at and below it
+static void gradientRow(const uchar* up, const uchar* mid, const uchar* down, int width, uchar* out) {
+    out[0] = diffAbs(up, mid, down, 0, reflect(-1, width), reflect(1, width));
+    int x = 1;
+#if CV_SIMD
+    const int n = cv::v_uint8::nlanes;
+    for (; x + n <= width - 1; x += n) {
+        cv::v_int16 ur0, ur1, dl0, dl1, u0, u1, mr0, mr1, ml0, ml1, d0, d1;
+        expandSigned(up + x + 1, ur0, ur1);
+        expandSigned(down + x - 1, dl0, dl1);
+        expandSigned(up + x, u0, u1);
+        expandSigned(mid + x + 1, mr0, mr1);
+        expandSigned(mid + x - 1, ml0, ml1);
+        expandSigned(down + x, d0, d1);
+        cv::v_store(out + x, cv::v_pack(diffAbsLanes(ur0, dl0, u0, mr0, ml0, d0), diffAbsLanes(ur1, dl1, u1, mr1, ml1, d1)));
+    }
+#endif
+    for (; x < width - 1; x++) out[x] = diffAbs(up, mid, down, x, x - 1, x + 1);
+    if (width > 1) out[width - 1] = diffAbs(up, mid, down, width - 1, width - 2, reflect(width, width));
+}
+
+// Former float sequence, for frames too small for reflected borders
+static void scharrDiffAbsFloat(const cv::Mat& gray, cv::Mat& dst) {
+    cv::Mat gradX, gradY, gradient;
+    cv::Sobel(gray, gradX, CV_32F, 1, 0, -1);
+    cv::Sobel(gray, gradY, CV_32F, 0, 1, -1);
+    cv::subtract(gradX, gradY, gradient);
+    cv::convertScaleAbs(gradient, dst);
+}
+
+void scharrDiffAbs(const cv::Mat& gray, cv::Mat& dst) {
+    CV_Assert(gray.type() == CV_8UC1);
+    if (gray.rows < 2 || gray.cols < 2) {
+        scharrDiffAbsFloat(gray, dst);
+        return;
+    }
+    CV_Assert(dst.data != gray.data);
+    dst.create(gray.size(), CV_8UC1);
+    for (int y = 0; y < gray.rows; y++) {
+        gradientRow(gray.ptr<uchar>(reflect(y - 1, gray.rows)), gray.ptr<uchar>(y),
+                    gray.ptr<uchar>(reflect(y + 1, gray.rows)), gray.cols, dst.ptr<uchar>(y));
+    }
+}
+
+void scharrDiffAbsBlur(const cv::Mat& gray, cv::Mat& dst, cv::Mat& workspace) {
+    CV_Assert(gray.type() == CV_8UC1);
+    if (gray.rows < 2 || gray.cols < 2) {
+        cv::Mat gradient;
+        scharrDiffAbsFloat(gray, gradient);
+        cv::blur(gradient, dst, cv::Size(5, 5));
+        return;
+    }
+    CV_Assert(dst.data != gray.data);
+    const int width = gray.cols, height = gray.rows;
+
+    // Column sums with 2 reflected columns on each side, then ring of 5 gradient rows
+    size_t sumBytes = (size_t) (width + 4) * sizeof(ushort);
+    size_t ringBytes = (size_t) width * 5;
+    if (workspace.empty() || workspace.total() * workspace.elemSize() < sumBytes + ringBytes) {
+        workspace.create(1, (int) (sumBytes + ringBytes), CV_8UC1);
+    }
+    ushort* sums = (ushort*) workspace.data;
+    uchar* ring = workspace.data + sumBytes;
+    int tags[5] = { -1, -1, -1, -1, -1 };
+
+    dst.create(gray.size(), CV_8UC1);
+    for (int y = 0; y < height; y++) {
+        // 5 rows around y are 5 consecutive indices after reflection, each has its own slot
+        const uchar* rows[5];
+        for (int k = 0; k < 5; k++) {
+            int i = reflect(y - 2 + k, height);
+            uchar* slot = ring + (size_t) (i % 5) * width;
+            if (tags[i % 5] != i) {
+                gradientRow(gray.ptr<uchar>(reflect(i - 1, height)), gray.ptr<uchar>(i),
+                            gray.ptr<uchar>(reflect(i + 1, height)), width, slot);
+                tags[i % 5] = i;
+            }
+            rows[k] = slot;
+        }
+
+        // Vertical sums, at most 5 * 255
+        ushort* col = sums + 2;
+        int x = 0;
+#if CV_SIMD
+        const int n = cv::v_uint8::nlanes;
+        const int h = cv::v_uint16::nlanes;
+        for (; x + n <= width; x += n) {
+            cv::v_uint16 lo, hi, a, b;
+            cv::v_expand(cv::vx_load(rows[0] + x), lo, hi);
+            for (int k = 1; k < 5; k++) {
+                cv::v_expand(cv::vx_load(rows[k] + x), a, b);
+                lo += a;
+                hi += b;
+            }
+            cv::v_store(col + x, lo);
+            cv::v_store(col + x + h, hi);
+        }
+#endif
+        for (; x < width; x++) col[x] = (ushort) (rows[0][x] + rows[1][x] + rows[2][x] + rows[3][x] + rows[4][x]);
+        sums[0] = col[reflect(-2, width)];
+        sums[1] = col[reflect(-1, width)];
+        sums[width + 2] = col[reflect(width, width)];
+        sums[width + 3] = col[reflect(width + 1, width)];
+
+        // Horizontal sums, at most 25 * 255, rounded division by 25
+        uchar* out = dst.ptr<uchar>(y);
+        x = 0;
+#if CV_SIMD
+        const cv::v_uint16 round = cv::vx_setall_u16(12), mul = cv::vx_setall_u16((ushort) BLUR_MUL);
+        for (; x + n <= width; x += n) {
+            cv::v_uint16 s0 = cv::vx_load(sums + x) + cv::vx_load(sums + x + 1) + cv::vx_load(sums + x + 2)
+                            + cv::vx_load(sums + x + 3) + cv::vx_load(sums + x + 4) + round;
+            cv::v_uint16 s1 = cv::vx_load(sums + x + h) + cv::vx_load(sums + x + h + 1) + cv::vx_load(sums + x + h + 2)
+                            + cv::vx_load(sums + x + h + 3) + cv::vx_load(sums + x + h + 4) + round;
+            cv::v_store(out + x, cv::v_pack(cv::v_mul_hi(s0, mul) >> BLUR_SHIFT, cv::v_mul_hi(s1, mul) >> BLUR_SHIFT));
+        }
+#endif
+        for (; x < width; x++) {
+            int s = sums[x] + sums[x + 1] + sums[x + 2] + sums[x + 3] + sums[x + 4] + 12;
+            out[x] = (uchar) ((s * BLUR_MUL >> 16) >> BLUR_SHIFT);
+        }
+    }
+}
+
+void scharrDiffAbsBlur(const cv::Mat& gray, cv::Mat& dst) {
+    cv::Mat workspace;
+    scharrDiffAbsBlur(gray, dst, workspace);
+}
@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+#include <opencv2/videoio.hpp>
+#include "bench_util.hpp"
+#include "qr_decoder_service.hpp"
+
+// 640x480 frames with one generated code of varying size and position over noise
+static void syntheticFrames(int count, std::vector<cv::Mat>& frames, std::vector<std::string>& texts) {
+    cv::Ptr<cv::QRCodeEncoder> encoder = cv::QRCodeEncoder::create();
+    cv::RNG rng(20220428);
+    for (int i = 0; i < count; i++) {
+        std::string text = "frame " + std::to_string(i);
+        cv::Mat code, scaled;
+        encoder->encode(text, code);
+        int side = 160 + 20 * (i % 8);
+        cv::resize(code, scaled, cv::Size(side, side), 0, 0, cv::INTER_NEAREST);
+        cv::copyMakeBorder(scaled, scaled, 16, 16, 16, 16, cv::BORDER_CONSTANT, cv::Scalar::all(255));
+
+        cv::Mat frame(480, 640, CV_8UC3);
+        rng.fill(frame, cv::RNG::UNIFORM, 60, 200);
+        cv::Mat bgr;
+        cv::cvtColor(scaled, bgr, cv::COLOR_GRAY2BGR);
+        cv::Rect place(rng.uniform(0, frame.cols - bgr.cols), rng.uniform(0, frame.rows - bgr.rows), bgr.cols, bgr.rows);
+        bgr.copyTo(frame(place));
+        frames.push_back(frame);
+        texts.push_back(text);
+    }
+}
+
+static double meanMs(const std::vector<double>& times) {
+    double sum = 0.0;
+    for (size_t i = 0; i < times.size(); i++) sum += times[i];
+    return times.empty() ? 0.0 : sum / (double) times.size();
+}
+
+static double percentileMs(std::vector<double> times, int percent) {
+    if (times.empty()) return 0.0;
+    std::sort(times.begin(), times.end());
+    return times[std::min(times.size() - 1, times.size() * percent / 100)];
+}
+
+// Print command line options
+void usage(const char* name) {
+    std::cout << "Usage: " << name << " [video | image directory | glob] [options]\n"
+              << "  --models DIR   directory with detect/sr .prototxt and .caffemodel (default ..)\n"
+              << "  --frames N     frames to decode (default 40, generated codes without input)\n"
+              << "  --cold N       frames decoded with a decoder constructed per frame (default 5)\n"
+              << "  --threads N    decoding threads sharing one service (default 2)" << std::endl;
+}
+
+// Compare WeChatQRCode constructed per frame (old wechatQR.cpp loop) against
+// QRDecoderService loaded once, report cold and steady-state latency and shared throughput
+int main(int argc, char **argv) {
+
+    std::string input, modelDir = "..";
+    int maxFrames = 40, coldFrames = 5, threads = 2;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--models" && i + 1 < argc) modelDir = argv[++i];
+        else if (arg == "--frames" && i + 1 < argc) maxFrames = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--cold" && i + 1 < argc) coldFrames = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--threads" && i + 1 < argc) threads = std::max(1, std::atoi(argv[++i]));
+        else if (input.empty() && !arg.empty() && arg[0] != '-') input = arg;
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    std::vector<cv::Mat> frames;
+    std::vector<std::string> texts;
+    if (input.empty()) syntheticFrames(maxFrames, frames, texts);
+    else if (!loadFrames(input, maxFrames, frames)) {
+        std::cout << "Cannot read frames from " << input << std::endl;
+        return -1;
+    }
+    coldFrames = std::min(coldFrames, (int) frames.size());
+
+    // Cold: construct decoder and load four model files for every frame
+    std::vector<double> coldTimes;
+    std::vector<std::vector<std::string>> coldResults;
+    for (int i = 0; i < coldFrames; i++) {
+        auto start = std::chrono::steady_clock::now();
+        std::unique_ptr<cv::wechat_qrcode::WeChatQRCode> decoder;
+        try {
+            decoder = QRDecoderService::createDecoder(modelDir);
+        }
+        catch (const cv::Exception& e) {
+            std::cout << "Cannot load models from " << modelDir << ": " << e.what() << std::endl;
+            return -1;
+        }
+        coldResults.push_back(decoder->detectAndDecode(frames[i]));
+        coldTimes.push_back(elapsedMs(start));
+    }
+
+    // Steady state: one service, models loaded and warmed up before first frame
+    QRDecoderConfig config;
+    config.modelDir = modelDir;
+    config.instances = threads;
+    auto start = std::chrono::steady_clock::now();
+    QRDecoderService service(config);
+    double constructMs = elapsedMs(start);
+
+    std::vector<double> steadyTimes;
+    std::vector<std::vector<std::string>> steadyResults;
+    for (size_t i = 0; i < frames.size(); i++) {
+        start = std::chrono::steady_clock::now();
+        steadyResults.push_back(service.decode(frames[i]));
+        steadyTimes.push_back(elapsedMs(start));
+    }
+
+    // Shared: threads take frames from one counter and decode through the same service
+    std::atomic<size_t> next(0);
+    std::atomic<int> decoded(0);
+    std::vector<std::thread> pool;
+    start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([&]() {
+            for (size_t i = next++; i < frames.size(); i = next++) {
+                if (!service.decode(frames[i]).empty()) decoded++;
+            }
+        });
+    }
+    for (size_t t = 0; t < pool.size(); t++) pool[t].join();
+    double sharedMs = elapsedMs(start);
+
+    int failures = 0;
+    std::cout << "Service checks" << std::endl;
+    check(service.ready(), "service loads models of " + std::to_string(threads) + " instances", failures);
+    bool same = true;
+    for (int i = 0; i < coldFrames; i++) same = same && coldResults[i] == steadyResults[i];
+    check(same, "warm decoder returns same codes as cold decoder", failures);
+    if (!texts.empty()) {
+        int correct = 0;
+        for (size_t i = 0; i < frames.size(); i++) {
+            if (!steadyResults[i].empty() && steadyResults[i][0] == texts[i]) correct++;
+        }
+        check(correct == (int) frames.size(), "every generated code decoded (" + std::to_string(correct) + "/"
+              + std::to_string(frames.size()) + ")", failures);
+    }
+    check(decoded.load() == (int) std::count_if(steadyResults.begin(), steadyResults.end(),
+          [](const std::vector<std::string>& r) { return !r.empty(); }), "shared decoding finds same frames", failures);
+    check(meanMs(steadyTimes) < meanMs(coldTimes), "steady-state decode faster than cold construct", failures);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\nInput: " << (input.empty() ? "generated codes" : input) << " " << frames[0].cols << "x" << frames[0].rows
+              << ", " << frames.size() << " frames" << std::endl;
+    std::cout << "Service construct " << constructMs << " ms (load " << service.stats().loadMs
+              << " ms, warm-up " << service.stats().warmupMs << " ms)" << std::endl;
+
+    std::cout << "\nLatency (ms/frame)" << std::endl;
+    std::cout << std::left << std::setw(10) << "decoder" << std::right << std::setw(8) << "frames" << std::setw(9) << "mean"
+              << std::setw(9) << "p50" << std::setw(9) << "p95" << std::setw(9) << "max" << std::endl;
+    std::cout << std::left << std::setw(10) << "cold" << std::right << std::setw(8) << coldTimes.size()
+              << std::setw(9) << meanMs(coldTimes) << std::setw(9) << percentileMs(coldTimes, 50)
+              << std::setw(9) << percentileMs(coldTimes, 95) << std::setw(9) << percentileMs(coldTimes, 100) << std::endl;
+    std::cout << std::left << std::setw(10) << "steady" << std::right << std::setw(8) << steadyTimes.size()
+              << std::setw(9) << meanMs(steadyTimes) << std::setw(9) << percentileMs(steadyTimes, 50)
+              << std::setw(9) << percentileMs(steadyTimes, 95) << std::setw(9) << percentileMs(steadyTimes, 100) << std::endl;
+    std::cout << "Speedup " << meanMs(coldTimes) / std::max(1e-6, meanMs(steadyTimes)) << "x, first steady frame "
+              << steadyTimes[0] << " ms" << std::endl;
+
+    std::cout << "\nShared service, " << threads << " threads: " << frames.size() * 1000.0 / sharedMs << " frames/s" << std::endl;
+    service.printStats(std::cout);
+
+    if (failures) std::cout << "FAILED: " << failures << " checks" << std::endl;
+    else std::cout << "All checks passed" << std::endl;
+    return failures ? 1 : 0;
+}
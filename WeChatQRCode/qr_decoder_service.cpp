@@ -0,0 +1,133 @@
+#include "qr_decoder_service.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+
+// Milliseconds elapsed since start
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    std::chrono::duration<double, std::milli> diff = std::chrono::steady_clock::now() - start;
+    return diff.count();
+}
+
+QRDecoderService::QRDecoderService(const QRDecoderConfig& config) : config_(config) {
+    int count = config_.instances > 0 ? config_.instances : (int) std::max(1u, std::thread::hardware_concurrency());
+
+    auto start = std::chrono::steady_clock::now();
+    try {
+        for (int i = 0; i < count; i++) decoders_.push_back(createDecoder(config_.modelDir));
+    }
+    catch (const cv::Exception& e) {
+        std::cerr << "Cannot load WeChatQRCode models from " << config_.modelDir << ": " << e.what() << std::endl;
+        decoders_.clear();
+        return;
+    }
+    stats_.loadMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < decoders_.size(); i++) warmup(*decoders_[i]);
+    stats_.warmupMs = elapsedMs(start);
+
+    for (size_t i = decoders_.size(); i > 0; i--) free_.push_back(i - 1);
+}
+
+std::string QRDecoderService::modelPath(const std::string& dir, const std::string& file) {
+    if (dir.empty()) return file;
+    char last = dir[dir.size() - 1];
+    return (last == '/' || last == '\\') ? dir + file : dir + "/" + file;
+}
+
+std::unique_ptr<cv::wechat_qrcode::WeChatQRCode> QRDecoderService::createDecoder(const std::string& modelDir) {
+    return std::unique_ptr<cv::wechat_qrcode::WeChatQRCode>(new cv::wechat_qrcode::WeChatQRCode(
+            modelPath(modelDir, "detect.prototxt"), modelPath(modelDir, "detect.caffemodel"),
+            modelPath(modelDir, "sr.prototxt"), modelPath(modelDir, "sr.caffemodel")));
+}
+
+void QRDecoderService::warmup(cv::wechat_qrcode::WeChatQRCode& decoder) const {
+    if (config_.warmupRuns <= 0) return;
+
+    cv::Mat code;
+    cv::QRCodeEncoder::create()->encode("QRDecoderService warm-up", code);
+    if (code.empty()) return;
+
+    // Large code on camera-sized canvas runs detector net, small one is upscaled by super resolution net
+    std::vector<cv::Mat> images;
+    int sides[] = { 240, 80 };
+    for (int side : sides) {
+        cv::Mat canvas(480, 640, CV_8UC1, cv::Scalar::all(255)), scaled;
+        cv::resize(code, scaled, cv::Size(side, side), 0, 0, cv::INTER_NEAREST);
+        scaled.copyTo(canvas(cv::Rect((canvas.cols - side) / 2, (canvas.rows - side) / 2, side, side)));
+        images.push_back(canvas);
+    }
+
+    std::vector<cv::Mat> points;
+    for (int run = 0; run < config_.warmupRuns; run++) {
+        for (size_t i = 0; i < images.size(); i++) decoder.detectAndDecode(images[i], points);
+    }
+}
+
+size_t QRDecoderService::checkout() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (free_.empty()) {
+        auto start = std::chrono::steady_clock::now();
+        available_.wait(lock, [this] { return !free_.empty(); });
+        stats_.waits++;
+        waitSumMs_ += elapsedMs(start);
+    }
+    size_t index = free_.back();
+    free_.pop_back();
+    return index;
+}
+
+void QRDecoderService::checkin(size_t index, double decodeMs) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_.push_back(index);
+        stats_.decodes++;
+        decodeSumMs_ += decodeMs;
+        stats_.decodeMaxMs = std::max(stats_.decodeMaxMs, decodeMs);
+    }
+    available_.notify_one();
+}
+
+std::vector<std::string> QRDecoderService::decode(const cv::Mat& image, std::vector<cv::Mat>& points) {
+    points.clear();
+    if (!ready() || image.empty()) return std::vector<std::string>();
+
+    size_t index = checkout();
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::string> data;
+    try {
+        data = decoders_[index]->detectAndDecode(image, points);
+    }
+    catch (...) {
+        checkin(index, elapsedMs(start));
+        throw;
+    }
+    checkin(index, elapsedMs(start));
+    return data;
+}
+
+std::vector<std::string> QRDecoderService::decode(const cv::Mat& image) {
+    std::vector<cv::Mat> points;
+    return decode(image, points);
+}
+
+QRDecoderStats QRDecoderService::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    QRDecoderStats s = stats_;
+    if (s.decodes > 0) s.decodeMeanMs = decodeSumMs_ / (double) s.decodes;
+    if (s.waits > 0) s.waitMeanMs = waitSumMs_ / (double) s.waits;
+    return s;
+}
+
+void QRDecoderService::printStats(std::ostream& out) const {
+    QRDecoderStats s = stats();
+    out << "QRDecoderService: instances=" << instances()
+        << " load=" << s.loadMs << " ms warmup=" << s.warmupMs << " ms"
+        << " decodes=" << s.decodes
+        << " decode(mean/max)=" << s.decodeMeanMs << "/" << s.decodeMaxMs << " ms"
+        << " waits=" << s.waits << " wait(mean)=" << s.waitMeanMs << " ms" << std::endl;
+}
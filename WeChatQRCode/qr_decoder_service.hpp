@@ -0,0 +1,97 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <opencv2/core.hpp>
+#include <opencv2/wechat_qrcode.hpp>
+
+// Settings of QRDecoderService
+struct QRDecoderConfig {
+    // Directory with detect.prototxt, detect.caffemodel, sr.prototxt and sr.caffemodel
+    std::string modelDir = "..";
+    // Decoder instances, at most this many threads decode at the same time, 0 uses every hardware thread
+    int instances = 1;
+    // Decodes of generated codes run on every instance after loading, 0 skips warm-up
+    int warmupRuns = 2;
+};
+
+// Counters of QRDecoderService, snapshot returned by stats()
+struct QRDecoderStats {
+    uint64_t decodes = 0;
+    // Decodes that had to wait for a free instance
+    uint64_t waits = 0;
+    // Model loading and warm-up of all instances
+    double loadMs = 0.0;
+    double warmupMs = 0.0;
+    double decodeMeanMs = 0.0;
+    double decodeMaxMs = 0.0;
+    double waitMeanMs = 0.0;
+};
+
+// Keep WeChatQRCode models loaded between frames
+// Detector and super resolution Caffe nets are parsed once per instance in the
+// constructor and run a few times on generated codes, so the first real frame
+// does not pay graph construction and layer buffer allocation.
+// A WeChatQRCode instance must not be used by two threads at once, the service
+// owns a fixed set of instances and decode() checks one out for the duration of
+// the call. Threads sharing the service block only while every instance is busy.
+class QRDecoderService {
+
+public:
+    explicit QRDecoderService(const QRDecoderConfig& config = QRDecoderConfig());
+
+    QRDecoderService(const QRDecoderService&) = delete;
+    QRDecoderService& operator=(const QRDecoderService&) = delete;
+
+    /* Return true if models of every instance are loaded */
+    bool ready() const { return !decoders_.empty(); }
+
+    int instances() const { return (int) decoders_.size(); }
+
+    const QRDecoderConfig& config() const { return config_; }
+
+    /* Detect and decode QR codes in BGR or grayscale image, thread-safe
+     * Corners of every decoded code are returned in points, empty result if service is not ready */
+    std::vector<std::string> decode(const cv::Mat& image, std::vector<cv::Mat>& points);
+
+    /* Same as above without corners */
+    std::vector<std::string> decode(const cv::Mat& image);
+
+    QRDecoderStats stats() const;
+
+    /* Print load and warm-up time, decode latency and instance waits */
+    void printStats(std::ostream& out) const;
+
+    /* Path of file in model directory */
+    static std::string modelPath(const std::string& dir, const std::string& file);
+
+    /* Load new decoder from model directory, throws cv::Exception if a file is missing */
+    static std::unique_ptr<cv::wechat_qrcode::WeChatQRCode> createDecoder(const std::string& modelDir);
+
+private:
+    /* Take free instance, wait while all are busy */
+    size_t checkout();
+
+    void checkin(size_t index, double decodeMs);
+
+    /* Run decoder on generated codes of a size that goes through detector and of one that goes through super resolution */
+    void warmup(cv::wechat_qrcode::WeChatQRCode& decoder) const;
+
+    QRDecoderConfig config_;
+    std::vector<std::unique_ptr<cv::wechat_qrcode::WeChatQRCode>> decoders_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable available_;
+    // Indices of instances not in use, guarded by mutex_
+    std::vector<size_t> free_;
+
+    // Guarded by mutex_
+    QRDecoderStats stats_;
+    double decodeSumMs_ = 0.0;
+    double waitSumMs_ = 0.0;
+};
@@ -1,13 +1,55 @@
 #include <opencv2/opencv.hpp>
 #include <opencv2/wechat_qrcode.hpp>
+#include <atomic>
+#include <mutex>
+#include <set>
 #include <iostream>
 #include <chrono>
+#include "mat_pool.hpp"
+#include "qr_candidates.hpp"
+#include "work_stealing_pool.hpp"
+#include "qr_decoder_service.hpp"
 
 using namespace cv;
 using namespace std;
 using namespace wechat_qrcode;
 using namespace chrono;
 
+// Preprocessing buffers and CLAHE of one worker, reused every frame
+struct Scratch {
+  Mat res, gaussian, unsharp, brighten, contrast, bin;
+  Ptr<CLAHE> clahe;
+};
+
+// Resize, deblur, brighten, enhance contrast and binarize detected QR code for more precise decoding
+// Result points into scratch.bin and is valid until next call on same scratch
+static Mat preprocess(const Mat& crop, Scratch& scratch) {
+  // resize for faster and more precise decoding
+  float factor = 190.0 / crop.cols;
+  resize(crop, scratch.res, Size(190, round(factor * crop.rows)), INTER_AREA);
+
+  // deblur 
+  GaussianBlur(scratch.res, scratch.gaussian, Size(9, 9), 10.0);
+  addWeighted(scratch.res, 8, scratch.gaussian, -7, 0, scratch.unsharp);
+
+  // brightness
+  const Mat& unsharp = scratch.unsharp;
+  float brightness = sum(unsharp)[0] / (255 * unsharp.rows * unsharp.cols);
+  float brRatio =  brightness / 0.7; // set minimumBrightness = 70%
+
+  if (brRatio < 1){
+    convertScaleAbs(unsharp, scratch.brighten, 1.0 / brRatio, 0);
+  }
+  const Mat& brighten = brRatio < 1 ? scratch.brighten : unsharp;
+
+  // contrast
+  scratch.clahe->apply(brighten, scratch.contrast);
+
+  // binarization
+  threshold(scratch.contrast, scratch.bin, 0, 255, THRESH_OTSU);
+  return scratch.bin;
+}
+
 int main(int argc, char **argv) {
   // open the default video camera
   VideoCapture cap(0);
@@ -18,8 +60,45 @@ int main(int argc, char **argv) {
       return -1;
   } 
 
+  // codes expected in view, candidates not started yet are skipped once this many are decoded
+  int expectedCodes = argc > 1 ? max(0, atoi(argv[1])) : 1;
+
+  // load and warm up detector and super resolution models once, not every frame
+  // one instance per candidate decoded at the same time
+  QRDecoderConfig decoderConfig;
+  decoderConfig.modelDir = "..";
+  decoderConfig.instances = 4;
+  QRDecoderService decoder(decoderConfig);
+  if (!decoder.ready()) {
+      cout << "\nCannot load WeChatQRCode models.\n" << endl;
+      return -1;
+  }
+
+  // square regions of the frame, largest first, scratch reused every frame
+  QRCandidateConfig candidateConfig;
+  candidateConfig.maxCandidates = decoder.instances();
+  QRCandidateDetector detector(candidateConfig);
+
+  // Gray frame and preprocessing buffers, never destroyed so Mats released at exit can still return to it
+  MatPool& pool = *new MatPool();
+
+  // candidates of a frame are preprocessed and decoded in parallel, scratch per worker
+  WorkStealingPool workers(decoder.instances());
+  vector<Scratch> scratches(workers.threads());
+  for (Scratch& scratch : scratches) {
+    scratch.clahe = createCLAHE(2.0, Size(8, 8));
+    Mat* mats[] = {&scratch.res, &scratch.gaussian, &scratch.unsharp, &scratch.brighten, &scratch.contrast, &scratch.bin};
+    for (Mat* mat : mats) pool.attach(*mat);
+  }
+
+  // candidates, scanned and failed candidates and codes over all frames, decode stage time
+  uint64_t frames = 0, candidateCount = 0, scannedCount = 0, failedCount = 0, codeCount = 0;
+  double decodeSec = 0.0;
+
+  Mat frame, gray;
   while (true) {
-    Mat frame, gray;
+    // gray and worker scratch come from pool, reallocated only when sizes change
+    MatPoolScope poolScope(pool, {&gray});
     // read a new frame from video 
     bool bSuccess = cap.read(frame); 
 
@@ -33,119 +112,73 @@ int main(int argc, char **argv) {
         auto start = high_resolution_clock::now();
         // Read gray image for faster decoding
         cvtColor(frame, gray, COLOR_BGR2GRAY);
-        
-        // detect vertical and horizontal edges
-        // compute the Scharr gradient magnitude representation of the images
-        Mat gradX, gradY, gradient;
-        Sobel(gray, gradX, CV_32F, 1, 0, -1);
-        Sobel(gray, gradY, CV_32F, 0, 1, -1);
-
-        // subtract the y-gradient from the x-gradient
-        subtract(gradX, gradY, gradient);
-        // convert to 8 bit unsigned int because negative pixels equal 0
-        convertScaleAbs(gradient, gradient);
-
-        // smooth out noise and binarize the image
-        Mat blurred, thresh;
-        blur(gradient, blurred, Size(5, 5));
-        threshold(blurred, thresh, 240, 250, THRESH_BINARY);
-
-        // close small gaps in object by using closing kernel
-        // image width is larger then height, so use wider kernel
-        Mat close, kernel;
-        kernel = getStructuringElement(MORPH_RECT, Size(27, 15));
-        morphologyEx(thresh, close, MORPH_CLOSE, kernel);
-
-        // perform a series of erosions and dilations
-        Mat erosion, expand; 
-        int iterations;
-        erode(close, erosion, iterations = 4);
-        dilate(erosion, expand, iterations = 4);
-
-        vector<vector<Point>> contours;
-        findContours(expand, contours, RETR_EXTERNAL, CHAIN_APPROX_SIMPLE);
-
-        // since QR code is square 
-        // find biggest square object and crop
-        float maxArea = 0;
-        Point2f vertices[4];
-
-        for (int i = 0; i < contours.size(); i++){
-          RotatedRect box = minAreaRect(contours[i]);
-          float ratio = box.size.width / box.size.height;
-
-          if ((ratio > 0.9) && (ratio < 1.1) && (contourArea(contours[i]) > maxArea)){
-              maxArea = contourArea(contours[i]);
-              box.points(vertices);
+
+        // every near-square object is a candidate, not only the biggest one
+        const vector<QRCandidate>& candidates = detector.detect(gray);
+        if (candidates.empty()) cout << "\nDetect failed.\n" << endl;
+
+        vector<vector<string>> results(candidates.size());
+        // distinct codes of this frame, a code seen in two overlapping crops counts once
+        mutex foundMutex;
+        set<string> foundCodes;
+        atomic<int> found(0), scanned(0), failed(0);
+        auto decodeStart = high_resolution_clock::now();
+        workers.run(candidates.size(), [&](size_t item, int worker) {
+          // other workers already decoded what the frame is expected to hold
+          if (expectedCodes > 0 && found >= expectedCodes) return;
+          // exceptions must not leave a pool thread, a failed candidate decodes nothing and is counted apart from cancelled ones
+          try {
+            Mat bin = preprocess(gray(candidates[item].crop), scratches[worker]);
+            if (expectedCodes > 0 && found >= expectedCodes) return;
+
+            // decode using built-in OpenCV WeChatQRCode
+            results[item] = decoder.decode(bin);
+            scanned++;
+            lock_guard<mutex> lock(foundMutex);
+            for (const string& code : results[item]) {
+              if (foundCodes.insert(code).second) found++;
+            }
+          }
+          catch (...) {
+            results[item].clear();
+            failed++;
           }
-        }
-        // expand each side of bounding box by 10 pixels
-        Mat crop;
-        if (maxArea != 0){
-          crop = gray(Range(vertices[1].y - 10, vertices[3].y + 10), 
-                      Range(vertices[0].x - 10, vertices[2].x + 10));
-        }
-        else{
-          cout << "\nDetect failed.\n" << endl;
-        }
-        
-        // resize for faster and more precise decoding
-        Mat res;
-        float factor = 190.0 / crop.cols;
-        resize(crop, res, Size(190, round(factor * crop.rows)), INTER_AREA);
-
-        // deblur 
-        Mat gaussian, unsharp;
-        GaussianBlur(res, gaussian, Size(9, 9), 10.0);
-        addWeighted(res, 8, gaussian, -7, 0, unsharp);
-
-        // brightness
-        Mat brighten;
-        float brightness = sum(unsharp)[0] / (255 * unsharp.rows * unsharp.cols);
-        float brRatio =  brightness / 0.7; // set minimumBrightness = 70%
-
-        if (brRatio < 1){
-          convertScaleAbs(unsharp, brighten, 1.0 / brRatio, 0);
-        }
-        else brighten = unsharp;
-
-        // contrast
-        Mat contrast;
-        Ptr<CLAHE> clahe = createCLAHE(2.0, Size(8, 8));
-        clahe->apply(brighten, contrast);
-
-        // binarization
-        Mat bin;
-        threshold(contrast, bin, 0, 255, THRESH_OTSU);
-
-        // decode using built-in OpenCV WeChatQRCode
-        Ptr<WeChatQRCode> detector;
-        vector<Mat> points;
-        detector = makePtr<WeChatQRCode>("../detect.prototxt", 
-                                        "../detect.caffemodel",
-                                        "../sr.prototxt", 
-                                        "../sr.caffemodel");
-
-        vector<String> data = detector->detectAndDecode(bin, points);
-
-        if (!data.empty()) {
-          for (const string& t : data) cout << "\n" << t << "\n" << endl;
-
-          // display decode time and draw bounding box in captured frame
+        });
+        duration<double> decodeDiff = high_resolution_clock::now() - decodeStart;
+
+        frames++;
+        candidateCount += candidates.size();
+        scannedCount += scanned;
+        failedCount += failed;
+        codeCount += found;
+        decodeSec += decodeDiff.count();
+
+        if (found > 0) {
+          // display decode time and draw bounding box of every decoded candidate in captured frame
           auto stop = high_resolution_clock::now();
           duration<double> diff = (stop - start);
           double sec = static_cast<double>(diff.count());
           stringstream stream;
           stream << fixed << setprecision(3) << sec;
 
-          string detectTime = "Time: " + stream.str() + " s";
-          putText(frame, detectTime, Point(vertices[0].x - 10, vertices[1].y - 10), FONT_HERSHEY_TRIPLEX, 1, Scalar(190, 80, 40), 2, LINE_AA);
-
-          for (int i = 0; i < 4; i++){
-            line(frame, vertices[i], vertices[(i + 1) % 4], Scalar(190, 80, 40), 3, LINE_AA);
+          bool timeShown = false;
+          for (size_t c = 0; c < candidates.size(); c++) {
+            if (results[c].empty()) continue;
+            for (const string& t : results[c]) cout << "\n" << t << "\n" << endl;
+
+            const Point2f* vertices = candidates[c].corners;
+            if (!timeShown) {
+              string detectTime = "Time: " + stream.str() + " s";
+              putText(frame, detectTime, Point(vertices[0].x - 10, vertices[1].y - 10), FONT_HERSHEY_TRIPLEX, 1, Scalar(190, 80, 40), 2, LINE_AA);
+              timeShown = true;
+            }
+            for (int i = 0; i < 4; i++){
+              line(frame, vertices[i], vertices[(i + 1) % 4], Scalar(190, 80, 40), 3, LINE_AA);
+            }
           }
         } 
-        else cout << "\nDecode failed.\n" << endl;
+        else if (failed > 0) cout << "\nDecode failed, " << failed << " candidates raised errors.\n" << endl;
+        else if (!candidates.empty()) cout << "\nDecode failed.\n" << endl;
       }
       catch (...) {continue;}
 
@@ -162,6 +195,12 @@ int main(int argc, char **argv) {
     }
   }
 
+  double n = frames ? (double) frames : 1.0;
+  cout << "Candidates: " << frames << " frames, " << candidateCount / n << " candidates/frame, "
+       << scannedCount / n << " scanned/frame, " << failedCount << " failed, " << codeCount / n << " codes/frame, "
+       << (decodeSec > 0 ? scannedCount / decodeSec : 0.0) << " candidates/s" << endl;
+  pool.printStats(cout);
+  decoder.printStats(cout);
   cap.release();
   destroyAllWindows();
 